@@ -0,0 +1,52 @@
+// Released under the GNU GPLv3; see LICENSE for details.
+// Developed by Boucher Lab and Slizovskiy Lab.
+
+#ifndef BENCH_H
+#define BENCH_H
+
+#include <chrono>
+#include <functional>
+#include <iostream>
+#include <string>
+#include <vector>
+
+/* Shared helpers for the CoNetBench micro-benchmarks */
+
+struct BenchArgs {
+    std::string dataFile = "data/patientwise_colocalization_by_timepoint.csv";
+    int repetitions = 5;
+    long syntheticRows = 1000000;
+};
+
+// Runs fn `repetitions` times and returns the best wall time in milliseconds.
+inline double timeBestOf(int repetitions, const std::function<void()>& fn) {
+    double best = -1.0;
+    for (int i = 0; i < repetitions; ++i) {
+        auto start = std::chrono::steady_clock::now();
+        fn();
+        auto stop = std::chrono::steady_clock::now();
+        double ms = std::chrono::duration<double, std::milli>(stop - start).count();
+        if (best < 0.0 || ms < best) best = ms;
+    }
+    return best;
+}
+
+inline void reportTiming(const std::string& label, double ms) {
+    std::cout << "  " << label << ": " << ms << " ms\n";
+}
+
+// Benchmark entry points, one per bench_*.cpp file.
+int benchIdMaps(const BenchArgs& args);
+int benchCSR(const BenchArgs& args);
+int benchParser(const BenchArgs& args);
+int benchSnapshot(const BenchArgs& args);
+int benchJson(const BenchArgs& args);
+int benchCatalog(const BenchArgs& args);
+int benchTimelines(const BenchArgs& args);
+int benchDrillDown(const BenchArgs& args);
+int benchPredicates(const BenchArgs& args);
+int benchTraversal(const BenchArgs& args);
+int benchTemporal(const BenchArgs& args);
+int benchEntities(const BenchArgs& args);
+
+#endif // BENCH_H
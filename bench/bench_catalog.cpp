@@ -0,0 +1,104 @@
+// Released under the GNU GPLv3; see LICENSE for details.
+// Developed by Boucher Lab and Slizovskiy Lab.
+
+#include <filesystem>
+#include <string>
+#include <unordered_map>
+#include "bench.h"
+#include "catalog_loader.h"
+#include "catalog_tables.h"
+#include "entity_catalog.h"
+
+/* Catalog startup cost: the former static unordered_map tables vs. the generated catalog vs.
+   the runtime loader (TSV parse and binary cache) */
+
+static const char* kArgsFile = "data/catalog/args.tsv";
+static const char* kMGEsFile = "data/catalog/mges.tsv";
+
+// The seven id -> value tables id_maps.cpp used to construct before main.
+struct LegacyTables {
+    std::unordered_map<int, std::string> argIdMap, mgeIdMap, mgeNameMap, argGroupMap, argResistanceMap, mgeGroupMap;
+    std::unordered_map<int, bool> argIDSNPConfirmation;
+};
+
+static void buildLegacyTables(const CatalogTables& tables, LegacyTables& legacy) {
+    legacy = LegacyTables{};
+    for (const CatalogArgRow& row : tables.args) {
+        legacy.argIdMap.emplace(row.id, row.name);
+        legacy.argGroupMap.emplace(row.id, row.group);
+        legacy.argResistanceMap.emplace(row.id, row.resistance);
+        legacy.argIDSNPConfirmation.emplace(row.id, row.requiresSNPConfirmation);
+    }
+    for (const CatalogMGERow& row : tables.mges) {
+        legacy.mgeIdMap.emplace(row.id, row.name);
+        if (!row.label.empty()) legacy.mgeNameMap.emplace(row.id, row.label);
+        if (!row.group.empty()) legacy.mgeGroupMap.emplace(row.id, row.group);
+    }
+}
+
+template <typename T>
+static bool sameColumn(const CatalogColumn<T>& a, const CatalogColumn<T>& b) {
+    if (a.size() != b.size()) return false;
+    for (size_t i = 0; i < a.size(); ++i) {
+        if (!(a[i] == b[i])) return false;
+    }
+    return true;
+}
+
+static bool sameColumn(const CatalogColumn<CatalogNameEntry>& a, const CatalogColumn<CatalogNameEntry>& b) {
+    if (a.size() != b.size()) return false;
+    for (size_t i = 0; i < a.size(); ++i) {
+        if (a[i].name != b[i].name || a[i].id != b[i].id) return false;
+    }
+    return true;
+}
+
+static bool sameCatalog(const EntityCatalog& a, const EntityCatalog& b) {
+    return sameColumn(a.argIds, b.argIds) && sameColumn(a.argNames, b.argNames) && sameColumn(a.argGroups, b.argGroups) &&
+           sameColumn(a.argResistances, b.argResistances) && sameColumn(a.argRequiresSNP, b.argRequiresSNP) &&
+           sameColumn(a.argGroupNames, b.argGroupNames) && sameColumn(a.resistanceNames, b.resistanceNames) &&
+           sameColumn(a.mgeIds, b.mgeIds) && sameColumn(a.mgeNames, b.mgeNames) && sameColumn(a.mgeLabels, b.mgeLabels) &&
+           sameColumn(a.mgeGroups, b.mgeGroups) && sameColumn(a.mgeGroupNames, b.mgeGroupNames) &&
+           sameColumn(a.argIndexById, b.argIndexById) && sameColumn(a.mgeIndexById, b.mgeIndexById) &&
+           sameColumn(a.argsByName, b.argsByName) && sameColumn(a.mgesByName, b.mgesByName) &&
+           sameColumn(a.mgesByLabel, b.mgesByLabel);
+}
+
+int benchCatalog(const BenchArgs& args) {
+    CatalogTables tables;
+    if (!readCatalogTables(kArgsFile, kMGEsFile, tables)) return 1;
+    std::cout << "  entities: " << tables.args.size() << " ARGs, " << tables.mges.size() << " MGEs\n";
+
+    LegacyTables legacy;
+    reportTiming("seven unordered_map tables (former static init)", timeBestOf(args.repetitions, [&] {
+        buildLegacyTables(tables, legacy);
+    }));
+
+    int checksum = 0;
+    reportTiming("generated catalog, first use", timeBestOf(args.repetitions, [&] {
+        const EntityCatalog& catalog = builtinEntityCatalog();
+        checksum = catalog.findMGE(catalog.mgeName(catalog.mgeIds[catalog.mgeIds.size() - 1]));
+    }));
+
+    CatalogData loaded;
+    reportTiming("catalog loaded from the TSV tables", timeBestOf(args.repetitions, [&] {
+        CatalogTables fresh;
+        readCatalogTables(kArgsFile, kMGEsFile, fresh);
+        buildCatalogData(std::move(fresh), loaded);
+    }));
+
+    CatalogSource source{kArgsFile, kMGEsFile, std::filesystem::temp_directory_path() / "conet_bench_catalog.bin"};
+    if (!saveCatalogCache(source.cacheFile, source, loaded)) return 1;
+    CatalogData cached;
+    reportTiming("catalog restored from the binary cache", timeBestOf(args.repetitions, [&] {
+        loadCatalogCache(source.cacheFile, source, cached);
+    }));
+    std::error_code ec;
+    std::filesystem::remove(source.cacheFile, ec);
+
+    if (!sameCatalog(loaded.view(), builtinEntityCatalog()) || !sameCatalog(cached.view(), builtinEntityCatalog()) || checksum != builtinEntityCatalog().mgeIds[builtinEntityCatalog().mgeIds.size() - 1]) {
+        std::cerr << "  MISMATCH: generated catalog differs from " << kArgsFile << " / " << kMGEsFile << "\n";
+        return 1;
+    }
+    return 0;
+}
@@ -0,0 +1,73 @@
+// Released under the GNU GPLv3; see LICENSE for details.
+// Developed by Boucher Lab and Slizovskiy Lab.
+
+#include <map>
+#include <set>
+#include <string>
+#include <tuple>
+#include "bench.h"
+#include "csr_graph.h"
+#include "graph.h"
+#include "parser.h"
+#include "traversal.h"
+
+/* Adjacency-map vs. CSR snapshot: build cost and temporal traversals; the CSR
+   traverseTempGraph (multi-source BFS) is checked against one bfsTemporal per start */
+
+int benchCSR(const BenchArgs& args) {
+    Graph g;
+    std::map<int, std::string> patientToDiseaseMap;
+    parseData(args.dataFile, g, patientToDiseaseMap, true, false);
+    addTemporalEdges(g);
+    std::cout << "  nodes: " << g.nodes.size() << ", edges: " << g.edges.size() << "\n";
+
+    std::unordered_map<Node, std::unordered_set<Node>> adjacency;
+    CSRGraph csr;
+    reportTiming("buildAdjacency", timeBestOf(args.repetitions, [&] {
+        adjacency.clear();
+        buildAdjacency(g, adjacency);
+    }));
+    reportTiming("buildCSR", timeBestOf(args.repetitions, [&] { buildCSR(g, csr); }));
+
+    std::map<std::pair<int, int>, std::set<Timepoint>> byTimeAdj, byTimeCSR;
+    reportTiming("traverseTempGraph (adjacency)", timeBestOf(args.repetitions, [&] {
+        std::map<std::pair<int, int>, Node> firstOccurrence;
+        byTimeAdj.clear();
+        traverseTempGraph(g, adjacency, firstOccurrence, byTimeAdj);
+    }));
+    reportTiming("traverseTempGraph (CSR)", timeBestOf(args.repetitions, [&] {
+        std::map<std::pair<int, int>, Node> firstOccurrence;
+        byTimeCSR.clear();
+        traverseTempGraph(g, csr, firstOccurrence, byTimeCSR);
+    }));
+    std::map<std::pair<int, int>, std::set<Timepoint>> byTimePerStart;
+    reportTiming("traverseTempGraph (CSR, one BFS per start)", timeBestOf(1, [&] {
+        std::map<std::pair<int, int>, Node> firstOccurrence;
+        findFirstOccurrence(g, adjacency, firstOccurrence);
+        byTimePerStart.clear();
+        for (const auto& [key, startNode] : firstOccurrence) bfsTemporal(startNode, csr, byTimePerStart);
+    }));
+    if (byTimePerStart != byTimeCSR) {
+        std::cerr << "  MISMATCH: multi-source and per-start CSR bfsTemporal differ\n";
+        return 1;
+    }
+
+    // The adjacency version depends on hash iteration order when several neighbors
+    // reach a node in the same BFS level, so only report whether the two agree.
+    std::cout << "  traverseTempGraph results " << (byTimeAdj == byTimeCSR ? "match" : "differ (hash-order tie-breaks)") << "\n";
+
+    IndividualTimelines byIndAdj, byIndCSR;
+    reportTiming("traverseGraphByInd (adjacency)", timeBestOf(1, [&] {
+        std::map<std::tuple<int, int, int>, Node> firstOccurrenceByInd;
+        traverseGraphByInd(g, adjacency, g.edges, firstOccurrenceByInd, byIndAdj);
+    }));
+    reportTiming("traverseGraphByInd (CSR)", timeBestOf(1, [&] {
+        std::map<std::tuple<int, int, int>, Node> firstOccurrenceByInd;
+        traverseGraphByInd(g, csr, firstOccurrenceByInd, byIndCSR);
+    }));
+    if (byIndAdj != byIndCSR) {
+        std::cerr << "  MISMATCH: traverseGraphByInd results differ\n";
+        return 1;
+    }
+    return 0;
+}
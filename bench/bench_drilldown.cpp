@@ -0,0 +1,196 @@
+// Released under the GNU GPLv3; see LICENSE for details.
+// Developed by Boucher Lab and Slizovskiy Lab.
+
+#include <cstdio>
+#include <filesystem>
+#include <fstream>
+#include <iterator>
+#include <map>
+#include <set>
+#include <string>
+#include <utility>
+#include <vector>
+#include "bench.h"
+#include "entity_catalog.h"
+#include "export_graph_json.h"
+#include "graph.h"
+#include "graph_index.h"
+#include "graph_utils.h"
+#include "graph_view.h"
+#include "parser.h"
+
+/* Entity drill-downs: the edge-scanning filterGraphBy* functions vs. the GraphIndex overloads,
+   run for every ARG, MGE and MGE group of the catalog and every colocalized ARG-MGE pair;
+   then disease x phase x MGE group slices as chained Graph copies vs. composed GraphViews */
+
+namespace {
+
+struct DrillDowns {
+    std::vector<std::string> args, mges, groups;
+    std::vector<std::pair<std::string, std::string>> pairs;
+};
+
+// Distinct names of a reverse index (a shared name resolves to one entity anyway)
+std::vector<std::string> distinctNames(const CatalogColumn<CatalogNameEntry>& index) {
+    std::vector<std::string> names;
+    for (const CatalogNameEntry& entry : index) {
+        if (names.empty() || names.back() != entry.name) names.emplace_back(entry.name);
+    }
+    return names;
+}
+
+// Runs every query through both filters, times them and checks that the subgraphs agree.
+template <typename Query>
+bool runBoth(const std::string& label, const std::vector<Query>& queries, const BenchArgs& args,
+             const std::function<Graph(const Query&)>& scan, const std::function<Graph(const Query&)>& indexed) {
+    std::vector<Graph> scanned(queries.size()), looked(queries.size());
+    reportTiming(label + ", edge scans", timeBestOf(1, [&] {
+        for (size_t i = 0; i < queries.size(); ++i) scanned[i] = scan(queries[i]);
+    }));
+    reportTiming(label + ", GraphIndex", timeBestOf(args.repetitions, [&] {
+        for (size_t i = 0; i < queries.size(); ++i) looked[i] = indexed(queries[i]);
+    }));
+    size_t elements = 0;
+    for (size_t i = 0; i < queries.size(); ++i) {
+        if (scanned[i].nodes != looked[i].nodes || scanned[i].edges != looked[i].edges) {
+            std::cerr << "  MISMATCH: " << label << " query " << i << " differs\n";
+            return false;
+        }
+        elements += looked[i].nodes.size() + looked[i].edges.size();
+    }
+    std::cout << "  " << label << ": " << queries.size() << " drill-downs, " << elements << " nodes + edges\n";
+    return true;
+}
+
+std::string readFile(const std::string& path) {
+    std::ifstream in(path, std::ios::binary);
+    return std::string(std::istreambuf_iterator<char>(in), std::istreambuf_iterator<char>());
+}
+
+// Every disease x phase x MGE group slice, once by chaining the copying filters and once by
+// intersecting views built per disease, phase and group; every slice's view has to give the
+// chained copy.
+bool runSlices(const Graph& g, const GraphIndex& index, const std::map<int, std::string>& patientToDiseaseMap,
+               const std::vector<std::string>& groups, const BenchArgs& args) {
+    std::set<std::string> diseases;
+    for (const auto& [patientID, disease] : patientToDiseaseMap) diseases.insert(disease);
+    const std::vector<std::string> phases = {"donor", "pre", "post"};
+
+    // The per-filter warnings for empty slices are expected here
+    std::streambuf* cerrBuf = std::cerr.rdbuf(nullptr);
+    size_t copiedEdges = 0, viewedEdges = 0;
+    std::vector<Graph> copies;
+    reportTiming("disease x phase x group, chained Graph copies", timeBestOf(1, [&] {
+        copiedEdges = 0;
+        copies.clear();
+        for (const std::string& disease : diseases) {
+            Graph byDisease = filterGraphByDisease(g, disease, patientToDiseaseMap);
+            for (const std::string& phase : phases) {
+                Graph byPhase = filterGraphByTimepoint(byDisease, phase);
+                for (const std::string& group : groups) {
+                    copies.push_back(filterGraphByMGEGroup(byPhase, group));
+                    copiedEdges += copies.back().edges.size();
+                }
+            }
+        }
+    }));
+    reportTiming("disease x phase x group, composed GraphViews", timeBestOf(args.repetitions, [&] {
+        viewedEdges = 0;
+        std::vector<GraphView> phaseViews, groupViews;
+        for (const std::string& phase : phases) phaseViews.push_back(filterGraphByTimepoint(index, phase));
+        for (const std::string& group : groups) groupViews.push_back(filterGraphByMGEGroup(index, group));
+        for (const std::string& disease : diseases) {
+            GraphView byDisease = filterGraphByDisease(index, disease, patientToDiseaseMap);
+            for (const GraphView& phase : phaseViews) {
+                GraphView byPhase = byDisease & phase;
+                for (const GraphView& group : groupViews) viewedEdges += (byPhase & group).edgeCount();
+            }
+        }
+    }));
+
+    size_t slice = 0, mismatches = 0;
+    for (const std::string& disease : diseases) {
+        GraphView byDisease = filterGraphByDisease(index, disease, patientToDiseaseMap);
+        for (const std::string& phase : phases) {
+            GraphView byPhase = byDisease & filterGraphByTimepoint(index, phase);
+            for (const std::string& group : groups) {
+                GraphView view = byPhase & filterGraphByMGEGroup(index, group);
+                Graph viewed = view.materialize();
+                const Graph& copy = copies[slice++];
+                if (viewed.nodes == copy.nodes && viewed.edges == copy.edges && view.empty() == copy.nodes.empty()) continue;
+                if (++mismatches <= 5) {
+                    std::cout << "  MISMATCH: " << disease << " " << phase << " " << group << ": copy " << copy.nodes.size()
+                              << " nodes / " << copy.edges.size() << " edges, view " << viewed.nodes.size() << " nodes / "
+                              << viewed.edges.size() << " edges\n";
+                }
+            }
+        }
+    }
+    std::cerr.rdbuf(cerrBuf);
+    std::cout << "  slices: " << slice << ", edges copied " << copiedEdges << ", edges viewed " << viewedEdges << "\n";
+    if (mismatches > 0) {
+        std::cerr << "  MISMATCH: " << mismatches << " composed views differ from the chained Graph copies\n";
+        return false;
+    }
+
+    // A view of the whole graph exports exactly what the graph does
+    const std::string graphPath = (std::filesystem::temp_directory_path() / "conet_bench_graph.json").string();
+    const std::string viewPath = (std::filesystem::temp_directory_path() / "conet_bench_view.json").string();
+    cerrBuf = std::cerr.rdbuf(nullptr);
+    exportParentGraphToJson(g, graphPath, patientToDiseaseMap, true);
+    exportParentGraphToJson(GraphView::all(index), viewPath, patientToDiseaseMap, true);
+    bool same = readFile(graphPath) == readFile(viewPath);
+    exportGraphToJsonSimple(g, graphPath, patientToDiseaseMap);
+    exportGraphToJsonSimple(GraphView::all(index), viewPath, patientToDiseaseMap);
+    same = same && readFile(graphPath) == readFile(viewPath);
+    std::cerr.rdbuf(cerrBuf);
+    std::remove(graphPath.c_str());
+    std::remove(viewPath.c_str());
+    if (!same) std::cerr << "  MISMATCH: whole-graph view exports differ from the Graph exports\n";
+    return same;
+}
+
+} // namespace
+
+int benchDrillDown(const BenchArgs& args) {
+    Graph g;
+    std::map<int, std::string> patientToDiseaseMap;
+    parseData(args.dataFile, g, patientToDiseaseMap, true, false);
+    addTemporalEdges(g);
+    std::cout << "  graph: " << g.nodes.size() << " nodes, " << g.edges.size() << " edges\n";
+
+    GraphIndex index;
+    reportTiming("buildGraphIndex", timeBestOf(args.repetitions, [&] { buildGraphIndex(g, index); }));
+
+    const EntityCatalog& catalog = entityCatalog();
+    DrillDowns queries;
+    queries.args = distinctNames(catalog.argsByName);
+    queries.mges = distinctNames(catalog.mgesByName);
+    for (std::string_view group : catalog.mgeGroupNames) queries.groups.emplace_back(group);
+    std::set<std::pair<int, int>> pairs;
+    for (const Edge& edge : g.edges) {
+        if (edge.isColo && edge.source.isARG != edge.target.isARG) {
+            const Node& arg = edge.source.isARG ? edge.source : edge.target;
+            const Node& mge = edge.source.isARG ? edge.target : edge.source;
+            pairs.emplace(arg.id, mge.id);
+        }
+    }
+    for (const auto& [argID, mgeID] : pairs) queries.pairs.emplace_back(catalog.argName(argID), catalog.mgeName(mgeID));
+
+    using Pair = std::pair<std::string, std::string>;
+    bool same =
+        runBoth<std::string>("ARG drill-downs", queries.args, args,
+            [&](const std::string& name) { return filterGraphByARGName(g, name); },
+            [&](const std::string& name) { return filterGraphByARGName(index, name).materialize(); }) &&
+        runBoth<std::string>("MGE drill-downs", queries.mges, args,
+            [&](const std::string& name) { return filterGraphByMGEName(g, name); },
+            [&](const std::string& name) { return filterGraphByMGEName(index, name).materialize(); }) &&
+        runBoth<std::string>("MGE group drill-downs", queries.groups, args,
+            [&](const std::string& name) { return filterGraphByMGEGroup(g, name); },
+            [&](const std::string& name) { return filterGraphByMGEGroup(index, name).materialize(); }) &&
+        runBoth<Pair>("ARG-MGE pair drill-downs", queries.pairs, args,
+            [&](const Pair& pair) { return filterGraphByARGAndMGENames(g, pair.first, pair.second); },
+            [&](const Pair& pair) { return filterGraphByARGAndMGENames(index, pair.first, pair.second).materialize(); }) &&
+        runSlices(g, index, patientToDiseaseMap, queries.groups, args);
+    return same ? 0 : 1;
+}
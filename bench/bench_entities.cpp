@@ -0,0 +1,93 @@
+// Released under the GNU GPLv3; see LICENSE for details.
+// Developed by Boucher Lab and Slizovskiy Lab.
+
+#include <cstdio>
+#include <filesystem>
+#include <map>
+#include <sstream>
+#include <string>
+#include <vector>
+#include "bench.h"
+#include "entity_catalog.h"
+#include "entity_timelines.h"
+#include "export_graph_json.h"
+#include "graph.h"
+#include "parser.h"
+#include "traversal.h"
+
+/* Per-entity timeline drill-downs (getTimelineForARG / getTimelineForMGE /
+   computeNodeDegreeOverTime) for every ARG and MGE in the graph: edge scans vs. the
+   EntityTimelineIndex, plus the bulk per-entity JSON export */
+
+namespace {
+
+// Console output of fn, which prints through std::cout
+template <typename Fn>
+std::string captureOutput(Fn fn) {
+    std::ostringstream captured;
+    std::streambuf* coutBuf = std::cout.rdbuf(captured.rdbuf());
+    fn();
+    std::cout.rdbuf(coutBuf);
+    return captured.str();
+}
+
+struct EntityQuery {
+    bool isARG;
+    std::string name;
+};
+
+} // namespace
+
+int benchEntities(const BenchArgs& args) {
+    Graph g;
+    std::map<int, std::string> patientToDiseaseMap;
+    parseData(args.dataFile, g, patientToDiseaseMap, true, false);
+    addTemporalEdges(g);
+
+    EntityTimelineIndex index;
+    reportTiming("buildEntityTimelineIndex", timeBestOf(args.repetitions, [&] { buildEntityTimelineIndex(g, index); }));
+
+    // Every entity of the index whose name resolves back to it
+    const EntityCatalog& catalog = entityCatalog();
+    std::vector<EntityQuery> queries;
+    for (const EntityTimeline& timeline : index.args()) {
+        std::string name(catalog.argName(timeline.id));
+        if (catalog.findARG(name) == timeline.id) queries.push_back({true, name});
+    }
+    for (const EntityTimeline& timeline : index.mges()) {
+        std::string name(catalog.mgeName(timeline.id));
+        if (catalog.findMGE(name) == timeline.id) queries.push_back({false, name});
+    }
+    std::cout << "  entities: " << queries.size() << " of " << index.args().size() + index.mges().size() << " indexed\n";
+
+    std::vector<std::string> scanned(queries.size()), indexed(queries.size());
+    std::vector<std::map<Timepoint, int>> scannedDegrees(queries.size()), indexedDegrees(queries.size());
+    reportTiming("drill-downs, edge scans", timeBestOf(1, [&] {
+        for (size_t i = 0; i < queries.size(); ++i) {
+            const EntityQuery& q = queries[i];
+            scanned[i] = captureOutput([&] { q.isARG ? getTimelineForARG(g, q.name) : getTimelineForMGE(g, q.name); });
+            scannedDegrees[i] = computeNodeDegreeOverTime(g, q.isARG, q.name);
+        }
+    }));
+    reportTiming("drill-downs, EntityTimelineIndex", timeBestOf(args.repetitions, [&] {
+        for (size_t i = 0; i < queries.size(); ++i) {
+            const EntityQuery& q = queries[i];
+            indexed[i] = captureOutput([&] { q.isARG ? getTimelineForARG(index, q.name) : getTimelineForMGE(index, q.name); });
+            indexedDegrees[i] = computeNodeDegreeOverTime(index, q.isARG, q.name);
+        }
+    }));
+    for (size_t i = 0; i < queries.size(); ++i) {
+        if (scanned[i] != indexed[i] || scannedDegrees[i] != indexedDegrees[i]) {
+            std::cerr << "  MISMATCH: " << (queries[i].isARG ? "ARG " : "MGE ") << queries[i].name << "\n";
+            return 1;
+        }
+    }
+
+    const std::string path = (std::filesystem::temp_directory_path() / "conet_bench_entity_timelines.json").string();
+    std::streambuf* cerrBuf = std::cerr.rdbuf(nullptr);
+    reportTiming("exportEntityTimelinesToJson", timeBestOf(args.repetitions, [&] { exportEntityTimelinesToJson(index, path); }));
+    std::cerr.rdbuf(cerrBuf);
+    std::cout << "  export: " << std::filesystem::file_size(path) / 1024 << " KiB\n";
+    std::remove(path.c_str());
+    return 0;
+}
@@ -0,0 +1,94 @@
+// Released under the GNU GPLv3; see LICENSE for details.
+// Developed by Boucher Lab and Slizovskiy Lab.
+
+#include <fstream>
+#include <map>
+#include <sstream>
+#include <string>
+#include <vector>
+#include "bench.h"
+#include "graph.h"
+#include "id_maps.h"
+#include "entity_catalog.h"
+#include "parser.h"
+
+/* Name -> ID resolution: indexed lookups vs. the former linear catalog scans */
+
+// The lookup parseData used before the reverse indexes were added, over a catalog column.
+static int linearScanId(const CatalogColumn<int>& ids, const CatalogColumn<std::string_view>& names, const std::string& name) {
+    for (size_t i = 0; i < ids.size(); ++i) {
+        if (names[i] == name) return ids[i];
+    }
+    return -1;
+}
+
+int benchIdMaps(const BenchArgs& args) {
+    std::ifstream in(args.dataFile);
+    if (!in) {
+        std::cerr << "Cannot open " << args.dataFile << "\n";
+        return 1;
+    }
+
+    // Collect the (ARG, MGE) label of every data row once, outside the timed region.
+    std::vector<std::pair<std::string, std::string>> labels;
+    std::string line;
+    std::getline(in, line);
+    while (std::getline(in, line)) {
+        std::stringstream ss(line);
+        std::string patient, disease, arg, mge;
+        std::getline(ss, patient, ',');
+        std::getline(ss, disease, ',');
+        std::getline(ss, arg, ',');
+        std::getline(ss, mge, ',');
+        labels.emplace_back(arg, mge);
+    }
+    std::cout << "  rows: " << labels.size() << "\n";
+
+    const EntityCatalog& catalog = entityCatalog();
+    long long checksumLinear = 0, checksumIndexed = 0;
+    double linearMs = timeBestOf(args.repetitions, [&] {
+        checksumLinear = 0;
+        for (const auto& [arg, mge] : labels)
+            checksumLinear += linearScanId(catalog.argIds, catalog.argNames, arg) + linearScanId(catalog.mgeIds, catalog.mgeNames, mge);
+    });
+    double indexedMs = timeBestOf(args.repetitions, [&] {
+        checksumIndexed = 0;
+        for (const auto& [arg, mge] : labels)
+            checksumIndexed += getARGId(arg) + getMGEId(mge);
+    });
+    reportTiming("label resolution, linear scan (before)", linearMs);
+    reportTiming("label resolution, reverse index (after)", indexedMs);
+    if (checksumLinear != checksumIndexed) {
+        std::cerr << "  MISMATCH: linear and indexed lookups disagree\n";
+        return 1;
+    }
+
+    // Per-row MGE group resolution as the exporters do it: a string copy per lookup
+    // through the id_maps getter vs. an integer code from the entity catalog.
+    std::vector<int> mgeIDs;
+    for (const auto& [arg, mge] : labels) mgeIDs.push_back(getMGEId(mge));
+    size_t checksumNames = 0, checksumCodes = 0;
+    double namesMs = timeBestOf(args.repetitions, [&] {
+        checksumNames = 0;
+        for (int id : mgeIDs) checksumNames += getMGEGroupName(id).size();
+    });
+    double codesMs = timeBestOf(args.repetitions, [&] {
+        checksumCodes = 0;
+        for (int id : mgeIDs) checksumCodes += catalog.mgeGroupName(catalog.mgeGroup(id)).size();
+    });
+    reportTiming("MGE group per row, std::string copy", namesMs);
+    reportTiming("MGE group per row, catalog code", codesMs);
+    if (checksumNames != checksumCodes) {
+        std::cerr << "  MISMATCH: group names and catalog codes disagree\n";
+        return 1;
+    }
+
+    double parseMs = timeBestOf(args.repetitions, [&] {
+        Graph g;
+        std::map<int, std::string> patientToDiseaseMap;
+        parseData(args.dataFile, g, patientToDiseaseMap, true, false);
+    });
+    reportTiming("parseData with reverse index", parseMs);
+    reportTiming("parseData estimate with linear scan", parseMs - indexedMs + linearMs);
+    return 0;
+}
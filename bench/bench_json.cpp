@@ -0,0 +1,71 @@
+// Released under the GNU GPLv3; see LICENSE for details.
+// Developed by Boucher Lab and Slizovskiy Lab.
+
+#include <filesystem>
+#include <fstream>
+#include <map>
+#include <sstream>
+#include <string>
+#include "bench.h"
+#include "export_graph_json.h"
+#include "graph.h"
+#include "parser.h"
+#include "../external/json.hpp"
+
+/* Graph JSON export: streaming JsonWriter vs. the json DOM + dump(2) it replaced */
+
+namespace fs = std::filesystem;
+
+static std::string readWholeFile(const fs::path& file) {
+    std::ifstream in(file, std::ios::binary);
+    std::ostringstream text;
+    text << in.rdbuf();
+    return text.str();
+}
+
+// The previous exporters built every node and link as a json value and dumped the tree.
+// Re-creating that tree from the streamed file and dumping it times the same allocation
+// and serialization work, and checks that dump(2) reproduces the streamed bytes.
+static bool benchOneExport(const std::string& label, const BenchArgs& args, const fs::path& file,
+                           const std::function<void(bool)>& exportGraph) {
+    reportTiming(label + " streaming", timeBestOf(args.repetitions, [&] { exportGraph(false); }));
+    std::string streamed = readWholeFile(file);
+    reportTiming(label + " streaming, compact", timeBestOf(args.repetitions, [&] { exportGraph(true); }));
+    std::string compact = readWholeFile(file);
+    std::cout << "  " << label << " size: " << streamed.size() / 1024 << " KiB, compact: " << compact.size() / 1024 << " KiB\n";
+
+    nlohmann::json parsed = nlohmann::json::parse(streamed);
+    reportTiming(label + " json DOM + dump(2) (before)", timeBestOf(args.repetitions, [&] {
+        nlohmann::json dom = parsed;
+        std::ofstream out(file);
+        out << dom.dump(2) << '\n';
+    }));
+
+    bool same = parsed.dump(2) + "\n" == streamed && parsed.dump() + "\n" == compact;
+    if (!same) std::cerr << "  MISMATCH: " << label << " differs from nlohmann dump\n";
+    return same;
+}
+
+int benchJson(const BenchArgs& args) {
+    Graph g;
+    std::map<int, std::string> patientToDiseaseMap;
+    parseData(args.dataFile, g, patientToDiseaseMap, true, false);
+    addTemporalEdges(g);
+
+    fs::path file = fs::temp_directory_path() / "conet_bench_graph.json";
+    // The exporters report to stderr on every call; keep the timing output readable.
+    std::streambuf* stderrBuffer = std::cerr.rdbuf();
+    std::ostringstream discarded;
+    std::cerr.rdbuf(discarded.rdbuf());
+
+    bool ok = benchOneExport("graph1 (exportGraphToJsonSimple)", args, file, [&](bool compact) {
+        exportGraphToJsonSimple(g, file.string(), patientToDiseaseMap, compact);
+    });
+    ok = benchOneExport("graph2 (exportParentGraphToJson)", args, file, [&](bool compact) {
+        exportParentGraphToJson(g, file.string(), patientToDiseaseMap, true, compact);
+    }) && ok;
+
+    std::cerr.rdbuf(stderrBuffer);
+    fs::remove(file);
+    return ok ? 0 : 1;
+}
@@ -0,0 +1,48 @@
+// Released under the GNU GPLv3; see LICENSE for details.
+// Developed by Boucher Lab and Slizovskiy Lab.
+
+#include <iostream>
+#include <map>
+#include <string>
+#include "bench.h"
+
+/* CoNetBench entry point: CoNetBench <benchmark|all> [data.csv] [repetitions] [synthetic rows] */
+
+int main(int argc, char** argv) {
+    const std::map<std::string, std::function<int(const BenchArgs&)>> benchmarks = {
+        {"id_maps", benchIdMaps},
+        {"csr", benchCSR},
+        {"parser", benchParser},
+        {"snapshot", benchSnapshot},
+        {"json", benchJson},
+        {"catalog", benchCatalog},
+        {"timelines", benchTimelines},
+        {"drilldown", benchDrillDown},
+        {"predicates", benchPredicates},
+        {"traversal", benchTraversal},
+        {"temporal", benchTemporal},
+        {"entities", benchEntities},
+    };
+
+    if (argc < 2) {
+        std::cerr << "Usage: " << argv[0] << " <benchmark|all> [data.csv] [repetitions] [synthetic rows]\n";
+        std::cerr << "Benchmarks:";
+        for (const auto& [name, fn] : benchmarks) std::cerr << " " << name;
+        std::cerr << "\n";
+        return 1;
+    }
+
+    BenchArgs args;
+    if (argc > 2) args.dataFile = argv[2];
+    if (argc > 3) args.repetitions = std::stoi(argv[3]);
+    if (argc > 4) args.syntheticRows = std::stol(argv[4]);
+
+    std::string which = argv[1];
+    int status = 0;
+    for (const auto& [name, fn] : benchmarks) {
+        if (which != "all" && which != name) continue;
+        std::cout << "[" << name << "]\n";
+        status |= fn(args);
+    }
+    return status;
+}
@@ -0,0 +1,156 @@
+// Released under the GNU GPLv3; see LICENSE for details.
+// Developed by Boucher Lab and Slizovskiy Lab.
+
+#include <algorithm>
+#include <filesystem>
+#include <fstream>
+#include <map>
+#include <sstream>
+#include <string>
+#include <thread>
+#include <unordered_map>
+#include <vector>
+#include "bench.h"
+#include "graph.h"
+#include "id_maps.h"
+#include "entity_catalog.h"
+#include "parser.h"
+
+/* CSV ingestion on a synthetic cohort: getline parser vs. buffered parser vs. chunked multi-threaded parser */
+
+namespace fs = std::filesystem;
+
+// The getline/stringstream parser parseData used before the buffered reader.
+static void parseDataGetline(const fs::path& filename, Graph& graph, std::map<int, std::string>& patientToDiseaseMap) {
+    std::ifstream infile(filename);
+    std::string line;
+    std::vector<std::string> headers;
+    bool isHeader = true;
+    std::unordered_map<std::string, Timepoint> columnToTimepoint;
+
+    while (std::getline(infile, line)) {
+        if (!line.empty() && line.back() == '\r') line.pop_back();
+
+        std::stringstream ss(line);
+        std::string token;
+        std::vector<std::string> tokens;
+        while (std::getline(ss, token, ',')) tokens.push_back(token);
+
+        if (isHeader) {
+            headers = tokens;
+            for (const std::string& col : headers) {
+                if (col == "Donor") columnToTimepoint[col] = Timepoint::Donor;
+                else if (col == "PreFMT") columnToTimepoint[col] = Timepoint::PreFMT;
+                else if (col.rfind("PostFMT_", 0) == 0) columnToTimepoint[col] = static_cast<Timepoint>(std::stoi(col.substr(8)));
+            }
+            isHeader = false;
+            continue;
+        }
+        if (tokens.size() < 4) continue;
+
+        int patientID = std::stoi(tokens[0]);
+        patientToDiseaseMap[patientID] = tokens[1];
+        int argID = getARGId(tokens[2]);
+        int mgeID = getMGEId(tokens[3]);
+        if (argID == -1 || mgeID == -1) continue;
+
+        for (size_t i = 4; i < tokens.size(); ++i) {
+            const std::string& colName = headers[i];
+            if (columnToTimepoint.count(colName) && (tokens[i] == "1" || tokens[i] == "2")) {
+                Timepoint tp = columnToTimepoint.at(colName);
+                bool requiresSNPConfirmation = entityCatalog().requiresSNPConfirmation(argID);
+                if (requiresSNPConfirmation) continue;
+
+                Node argNode = {argID, true, tp, requiresSNPConfirmation};
+                Node mgeNode = {mgeID, false, tp, false};
+                graph.nodes.insert(argNode);
+                graph.nodes.insert(mgeNode);
+                addEdge(graph, argNode, mgeNode, true, patientID);
+            }
+        }
+    }
+}
+
+// Writes a cohort of `rows` data rows by replaying the real file's rows with the
+// patient IDs shifted for every replay, so the synthetic cohort keeps the real
+// label and timepoint distribution while the patient count grows.
+static bool writeSyntheticCohort(const fs::path& source, const fs::path& target, long rows) {
+    std::ifstream in(source);
+    if (!in) return false;
+    std::string header, line;
+    std::getline(in, header);
+    std::vector<std::pair<int, std::string>> templates;  // patient ID, rest of the row
+    while (std::getline(in, line)) {
+        size_t comma = line.find(',');
+        if (comma == std::string::npos) continue;
+        templates.emplace_back(std::stoi(line.substr(0, comma)), line.substr(comma));
+    }
+    if (templates.empty()) return false;
+
+    std::ofstream out(target, std::ios::binary);
+    out << header << '\n';
+    for (long r = 0; r < rows; ++r) {
+        const auto& [patient, rest] = templates[r % templates.size()];
+        long replay = r / static_cast<long>(templates.size());
+        out << patient + replay * 100 << rest << '\n';
+    }
+    return static_cast<bool>(out);
+}
+
+static bool sameGraph(const Graph& a, const Graph& b) {
+    if (a.nodes != b.nodes || a.edges.size() != b.edges.size()) return false;
+    for (auto x = a.edges.begin(), y = b.edges.begin(); x != a.edges.end(); ++x, ++y) {
+        if (!(*x == *y) || x->individuals != y->individuals || x->weight != y->weight) return false;
+    }
+    return true;
+}
+
+int benchParser(const BenchArgs& args) {
+    fs::path cohort = fs::temp_directory_path() / "conet_bench_cohort.csv";
+    if (!writeSyntheticCohort(args.dataFile, cohort, args.syntheticRows)) {
+        std::cerr << "Cannot build synthetic cohort from " << args.dataFile << "\n";
+        return 1;
+    }
+    std::cout << "  synthetic rows: " << args.syntheticRows << " (" << fs::file_size(cohort) / (1024 * 1024) << " MiB)\n";
+
+    Graph getlineGraph, bufferedGraph;
+    std::map<int, std::string> bufferedDiseases;
+    double getlineMs = timeBestOf(args.repetitions, [&] {
+        getlineGraph = Graph{};
+        std::map<int, std::string> patientToDiseaseMap;
+        parseDataGetline(cohort, getlineGraph, patientToDiseaseMap);
+    });
+    double bufferedMs = timeBestOf(args.repetitions, [&] {
+        bufferedGraph = Graph{};
+        bufferedDiseases.clear();
+        parseData(cohort, bufferedGraph, bufferedDiseases, true, false);
+    });
+
+    reportTiming("getline/stringstream parser (before)", getlineMs);
+    reportTiming("buffered string_view parser (after)", bufferedMs);
+    std::cout << "  rows/s after: " << static_cast<long>(args.syntheticRows / (bufferedMs / 1000.0)) << "\n";
+
+    bool same = sameGraph(getlineGraph, bufferedGraph);
+
+    // Chunked parsing: 2, 4, ... threads up to the core count (at least 2).
+    unsigned maxThreads = std::max(2u, std::thread::hardware_concurrency());
+    for (unsigned threads = 2; threads <= maxThreads; threads *= 2) {
+        Graph chunkedGraph;
+        std::map<int, std::string> chunkedDiseases;
+        double chunkedMs = timeBestOf(args.repetitions, [&] {
+            chunkedGraph = Graph{};
+            chunkedDiseases.clear();
+            parseData(cohort, chunkedGraph, chunkedDiseases, true, false, threads);
+        });
+        reportTiming("chunked parser, " + std::to_string(threads) + " threads", chunkedMs);
+        std::cout << "  speedup vs 1 thread: " << bufferedMs / chunkedMs << "x\n";
+        same = same && sameGraph(bufferedGraph, chunkedGraph) && bufferedDiseases == chunkedDiseases;
+    }
+    fs::remove(cohort);
+
+    if (!same) {
+        std::cerr << "  MISMATCH: parsers built different graphs\n";
+        return 1;
+    }
+    return 0;
+}
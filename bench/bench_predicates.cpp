@@ -0,0 +1,145 @@
+// Released under the GNU GPLv3; see LICENSE for details.
+// Developed by Boucher Lab and Slizovskiy Lab.
+
+#include <map>
+#include <set>
+#include <string>
+#include <vector>
+#include "bench.h"
+#include "edge_predicate.h"
+#include "entity_catalog.h"
+#include "graph.h"
+#include "graph_index.h"
+#include "graph_utils.h"
+#include "graph_view.h"
+#include "parser.h"
+
+/* Multi-predicate filters: the columnar EdgePredicate engine vs. the same predicate tree
+   interpreted edge by edge over Graph::edges, for disease x MGE group x phase x patient-count
+   queries; single-entity predicates are checked against the GraphIndex filters */
+
+namespace {
+
+// Row-at-a-time reference: predicate applied to one colocalization edge of the Graph
+bool matchesEdge(const EdgePredicate& predicate, const Edge& edge) {
+    using Kind = EdgePredicate::Kind;
+    const EntityCatalog& catalog = entityCatalog();
+    const Node* arg = edge.source.isARG ? &edge.source : edge.target.isARG ? &edge.target : nullptr;
+    const Node* mge = !edge.source.isARG ? &edge.source : !edge.target.isARG ? &edge.target : nullptr;
+    switch (predicate.kind) {
+    case Kind::All:
+        for (const EdgePredicate& child : predicate.children) {
+            if (!matchesEdge(child, edge)) return false;
+        }
+        return true;
+    case Kind::Any:
+        for (const EdgePredicate& child : predicate.children) {
+            if (matchesEdge(child, edge)) return true;
+        }
+        return false;
+    case Kind::None: return false;
+    case Kind::Patients: return edge.individuals.intersects(predicate.patients);
+    case Kind::ARG: return arg && arg->id == predicate.value;
+    case Kind::MGE: return mge && mge->id == predicate.value;
+    case Kind::ARGGroup: return arg && catalog.argGroup(arg->id) == predicate.value;
+    case Kind::MGEGroup: return mge && catalog.mgeGroup(mge->id) == predicate.value;
+    case Kind::Resistance: return arg && catalog.argResistance(arg->id) == predicate.value;
+    case Kind::RequiresSNP: return (arg && arg->requiresSNPConfirmation) == (predicate.value != 0);
+    case Kind::Timepoints: {
+        int ordinal = timepointOrdinal(edge.source.timepoint);
+        return ordinal >= predicate.first && ordinal <= predicate.last;
+    }
+    case Kind::MinPatients: return static_cast<int>(edge.individuals.size()) >= predicate.value;
+    }
+    return false;
+}
+
+bool sameSubgraph(const GraphView& a, const GraphView& b) {
+    Graph x = a.materialize(), y = b.materialize();
+    return x.nodes == y.nodes && x.edges == y.edges;
+}
+
+} // namespace
+
+int benchPredicates(const BenchArgs& args) {
+    Graph g;
+    std::map<int, std::string> patientToDiseaseMap;
+    parseData(args.dataFile, g, patientToDiseaseMap, true, false);
+    addTemporalEdges(g);
+    GraphIndex index;
+    buildGraphIndex(g, index);
+
+    ColoEdgeTable table;
+    reportTiming("buildColoEdgeTable", timeBestOf(args.repetitions, [&] { buildColoEdgeTable(index, table); }));
+    std::cout << "  table: " << table.size() << " colocalization edges, " << table.patientWords << " patient words per row\n";
+
+    // Single-entity predicates give the GraphIndex filters' subgraphs
+    const EntityCatalog& catalog = entityCatalog();
+    for (std::string_view group : catalog.mgeGroupNames) {
+        std::string name(group);
+        if (!sameSubgraph(filterGraphByPredicate(table, EdgePredicate::mgeGroup(name)), filterGraphByMGEGroup(index, name))) {
+            std::cerr << "  MISMATCH: MGE group " << name << "\n";
+            return 1;
+        }
+    }
+    size_t pairs = 0;
+    for (const Edge& edge : g.edges) {
+        if (!edge.isColo || edge.source.isARG == edge.target.isARG || ++pairs % 16 != 0) continue;
+        const Node& arg = edge.source.isARG ? edge.source : edge.target;
+        const Node& mge = edge.source.isARG ? edge.target : edge.source;
+        std::string argName(catalog.argName(arg.id)), mgeName(catalog.mgeName(mge.id));
+        GraphView byPredicate = filterGraphByPredicate(table, EdgePredicate::arg(argName) & EdgePredicate::mge(mgeName));
+        if (!sameSubgraph(byPredicate, filterGraphByARGAndMGENames(index, argName, mgeName))) {
+            std::cerr << "  MISMATCH: ARG-MGE pair " << argName << " / " << mgeName << "\n";
+            return 1;
+        }
+    }
+
+    // disease x MGE group x phase, with at least two patients, and the same queries OR-ed
+    // with every SNP-confirmed ARG
+    const DiseaseMasks diseaseMasks = buildDiseaseMasks(patientToDiseaseMap);
+    const std::vector<EdgePredicate> phases = {
+        EdgePredicate::timepoints(Timepoint::Donor, Timepoint::Donor),
+        EdgePredicate::timepoints(Timepoint::PreFMT, Timepoint::PreFMT),
+        EdgePredicate::timepoints(Timepoint::PostFMT_001, Timepoint::PostFMT_730),
+    };
+    std::vector<EdgePredicate> queries;
+    for (const auto& [disease, patients] : diseaseMasks) {
+        for (std::string_view group : catalog.mgeGroupNames) {
+            for (const EdgePredicate& phase : phases) {
+                EdgePredicate query = EdgePredicate::patientsIn(patients) & EdgePredicate::mgeGroup(std::string(group)) &
+                                      phase & EdgePredicate::minPatients(2);
+                queries.push_back(query);
+                queries.push_back(query | EdgePredicate::requiresSNPConfirmation());
+            }
+        }
+    }
+
+    std::vector<size_t> scanned(queries.size()), evaluated(queries.size());
+    reportTiming("predicate trees, edge by edge", timeBestOf(args.repetitions, [&] {
+        for (size_t q = 0; q < queries.size(); ++q) {
+            scanned[q] = 0;
+            for (const Edge& edge : g.edges) {
+                if (edge.isColo && matchesEdge(queries[q], edge)) scanned[q]++;
+            }
+        }
+    }));
+    reportTiming("predicate trees, columnar", timeBestOf(args.repetitions, [&] {
+        for (size_t q = 0; q < queries.size(); ++q) {
+            GraphView view = filterGraphByPredicate(table, queries[q]);
+            evaluated[q] = 0;
+            for (const Edge& edge : view.edges()) evaluated[q] += edge.isColo;
+        }
+    }));
+
+    size_t matched = 0;
+    for (size_t q = 0; q < queries.size(); ++q) {
+        if (scanned[q] != evaluated[q]) {
+            std::cerr << "  MISMATCH: query " << q << " matched " << evaluated[q] << " edges, expected " << scanned[q] << "\n";
+            return 1;
+        }
+        matched += evaluated[q];
+    }
+    std::cout << "  " << queries.size() << " queries, " << matched << " colocalization edges matched\n";
+    return 0;
+}
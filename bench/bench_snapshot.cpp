@@ -0,0 +1,60 @@
+// Released under the GNU GPLv3; see LICENSE for details.
+// Developed by Boucher Lab and Slizovskiy Lab.
+
+#include <filesystem>
+#include <map>
+#include <set>
+#include <string>
+#include <tuple>
+#include "bench.h"
+#include "graph.h"
+#include "graph_snapshot.h"
+#include "parser.h"
+#include "traversal.h"
+
+/* Building the graph from the CSV vs. loading it from a binary snapshot */
+
+namespace fs = std::filesystem;
+
+int benchSnapshot(const BenchArgs& args) {
+    SnapshotSource source = {args.dataFile, true, false, {}};
+    fs::path snapshotFile = fs::temp_directory_path() / "conet_bench.snapshot";
+
+    Graph built;
+    std::map<int, std::string> builtDiseases;
+    IndividualTimelines builtTimelines;
+    reportTiming("parseData + addTemporalEdges + traverseGraph", timeBestOf(args.repetitions, [&] {
+        built = Graph{};
+        builtDiseases.clear();
+        builtTimelines.clear();
+        parseData(args.dataFile, built, builtDiseases, true, false);
+        addTemporalEdges(built);
+        traverseGraph(built, builtTimelines);
+    }));
+
+    reportTiming("saveGraphSnapshot", timeBestOf(args.repetitions, [&] {
+        saveGraphSnapshot(snapshotFile, source, built, builtDiseases, builtTimelines);
+    }));
+    std::cout << "  snapshot size: " << fs::file_size(snapshotFile) / 1024 << " KiB\n";
+
+    Graph loaded;
+    std::map<int, std::string> loadedDiseases;
+    IndividualTimelines loadedTimelines;
+    bool ok = true;
+    reportTiming("loadGraphSnapshot", timeBestOf(args.repetitions, [&] {
+        ok = loadGraphSnapshot(snapshotFile, source, loaded, loadedDiseases, loadedTimelines) && ok;
+    }));
+    fs::remove(snapshotFile);
+
+    bool same = ok && built.nodes == loaded.nodes && builtDiseases == loadedDiseases && builtTimelines == loadedTimelines &&
+                built.edges.size() == loaded.edges.size();
+    for (auto a = built.edges.begin(), b = loaded.edges.begin(); same && a != built.edges.end(); ++a, ++b) {
+        same = *a == *b && a->individuals == b->individuals && a->weight == b->weight &&
+               a->source.requiresSNPConfirmation == b->source.requiresSNPConfirmation;
+    }
+    if (!same) {
+        std::cerr << "  MISMATCH: snapshot does not round-trip the built graph\n";
+        return 1;
+    }
+    return 0;
+}
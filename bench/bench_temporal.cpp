@@ -0,0 +1,70 @@
+// Released under the GNU GPLv3; see LICENSE for details.
+// Developed by Boucher Lab and Slizovskiy Lab.
+
+#include <algorithm>
+#include <map>
+#include <string>
+#include <thread>
+#include "bench.h"
+#include "graph.h"
+#include "parser.h"
+
+/* Temporal-chain construction: the per-patient node-set walk (still used for patient subsets),
+   addTemporalEdges from the parsed graph's edges, and from the patient nodes parseData emits at
+   1, 2, 4, ... threads (at least 4, to check the reduction). Every timing includes copying the
+   parsed graph, which is reported on its own first. */
+
+namespace {
+
+bool sameTemporalEdges(const Graph& a, const Graph& b) {
+    if (a.edges != b.edges) return false;
+    auto x = a.edges.begin();
+    for (auto y = b.edges.begin(); y != b.edges.end(); ++x, ++y) {
+        if (x->weight != y->weight) return false;
+    }
+    return true;
+}
+
+} // namespace
+
+int benchTemporal(const BenchArgs& args) {
+    Graph parsed;
+    std::map<int, std::string> patientToDiseaseMap;
+    PatientNodes patientNodes;
+    parseData(args.dataFile, parsed, patientToDiseaseMap, true, false, 1, &patientNodes);
+    std::cout << "  graph: " << parsed.edges.size() << " colocalization edges, " << patientNodes.size() << " patient nodes\n";
+
+    PatientSet allPatients;
+    for (const auto& [patientID, disease] : patientToDiseaseMap) allPatients.insert(patientID);
+
+    Graph reference, previous;
+    reportTiming("graph copy", timeBestOf(args.repetitions, [&] { previous = parsed; }));
+    reportTiming("addTemporalEdges, per-patient node sets", timeBestOf(args.repetitions, [&] {
+        previous = parsed;
+        addTemporalEdges(previous, allPatients);
+    }));
+    reportTiming("addTemporalEdges, scan of graph edges", timeBestOf(args.repetitions, [&] {
+        reference = parsed;
+        addTemporalEdges(reference);
+    }));
+    std::cout << "  temporal edges: " << reference.edges.size() - parsed.edges.size() << "\n";
+    if (!sameTemporalEdges(previous, reference)) {
+        std::cerr << "  MISMATCH: temporal edges differ from the per-patient node-set walk\n";
+        return 1;
+    }
+
+    const unsigned maxThreads = std::max(4u, std::thread::hardware_concurrency());
+    for (unsigned threads = 1;; threads = std::min(maxThreads, threads * 2)) {
+        Graph built;
+        reportTiming("addTemporalEdges, patient nodes, " + std::to_string(threads) + " threads", timeBestOf(args.repetitions, [&] {
+            built = parsed;
+            addTemporalEdges(built, patientNodes, threads);
+        }));
+        if (!sameTemporalEdges(built, reference)) {
+            std::cerr << "  MISMATCH: " << threads << "-thread temporal edges differ from the edge scan\n";
+            return 1;
+        }
+        if (threads == maxThreads) break;
+    }
+    return 0;
+}
@@ -0,0 +1,174 @@
+// Released under the GNU GPLv3; see LICENSE for details.
+// Developed by Boucher Lab and Slizovskiy Lab.
+
+#include <algorithm>
+#include <climits>
+#include <map>
+#include <set>
+#include <string>
+#include <tuple>
+#include <vector>
+#include "bench.h"
+#include "analysis.h"
+#include "graph.h"
+#include "parser.h"
+#include "traversal.h"
+
+/* Per-individual timelines: std::set<Timepoint> walks vs. TimepointMask tests, and the
+   std::map store vs. the flat IndividualTimelines table (memory, batched builds, iteration,
+   range scans) */
+
+namespace {
+
+using SetTimelines = std::map<std::tuple<int, int, int>, std::set<Timepoint>>;
+using MapTimelines = std::map<std::tuple<int, int, int>, TimepointMask>;
+
+// Red-black tree node: colour, parent, left and right links ahead of the value (libstdc++
+// layout, allocator overhead not counted).
+constexpr size_t kTreeNodeHeader = 32;
+
+size_t mapBytes(const MapTimelines& map) {
+    return map.size() * (kTreeNodeHeader + sizeof(MapTimelines::value_type));
+}
+
+size_t setMapBytes(const SetTimelines& map) {
+    size_t bytes = map.size() * (kTreeNodeHeader + sizeof(SetTimelines::value_type));
+    for (const auto& [key, tps] : map) bytes += tps.size() * (kTreeNodeHeader + sizeof(Timepoint));
+    return bytes;
+}
+
+// Donor / pre / post-bin code of one timeline, as the set-based analyses computed it.
+int classifySet(const std::set<Timepoint>& tps) {
+    bool donor = std::any_of(tps.begin(), tps.end(), isDonor);
+    bool pre = std::any_of(tps.begin(), tps.end(), isPreFMT);
+    bool post = std::any_of(tps.begin(), tps.end(), isPostFMT);
+    int bin = 0;
+    for (Timepoint tp : tps) {
+        TimepointPhase phase = timepointPhase(tp);
+        int b = (phase == TimepointPhase::Post3 || phase == TimepointPhase::Donor) ? 3
+              : phase == TimepointPhase::Post2 ? 2
+              : phase == TimepointPhase::Post1 ? 1 : 0;
+        bin = std::max(bin, b);
+    }
+    return donor << 4 | pre << 3 | post << 2 | bin;
+}
+
+int classifyMask(TimepointMask tps) {
+    return hasDonor(tps) << 4 | hasPreFMT(tps) << 3 | hasPostFMT(tps) << 2 | postBinOf(tps);
+}
+
+} // namespace
+
+int benchTimelines(const BenchArgs& args) {
+    Graph g;
+    std::map<int, std::string> patientToDiseaseMap;
+    parseData(args.dataFile, g, patientToDiseaseMap, true, false);
+
+    IndividualTimelines masks;
+    traverseGraph(g, masks);
+    SetTimelines sets;
+    MapTimelines map;
+    for (const auto& [key, tps] : masks) {
+        forEachTimepoint(tps, [&, key = key](Timepoint tp) { sets[key].insert(tp); });
+        map.emplace_hint(map.end(), key, tps);
+    }
+    std::cout << "  timelines: " << masks.size() << "\n";
+    std::cout << "  memory: map<tuple, set<Timepoint>> ~" << setMapBytes(sets) / 1024 << " KiB, map<tuple, mask> ~"
+              << mapBytes(map) / 1024 << " KiB, IndividualTimelines " << masks.memoryBytes() / 1024 << " KiB\n";
+
+    std::vector<IndividualTimelines::value_type> rows(masks.begin(), masks.end());
+    reportTiming("build std::map<tuple, mask> (one insert per row)", timeBestOf(args.repetitions, [&] {
+        MapTimelines built;
+        for (const auto& [key, tps] : rows) built[key] |= tps;
+    }));
+    reportTiming("build IndividualTimelines (one sort)", timeBestOf(args.repetitions, [&] {
+        IndividualTimelines built;
+        built.add(rows);
+    }));
+
+    // Incremental appends: the same rows in kBatches interleaved batches must give the same
+    // table and ARG index as a single add
+    constexpr size_t kBatches = 64;
+    std::vector<std::vector<IndividualTimelines::value_type>> batches(kBatches);
+    for (size_t i = 0; i < rows.size(); ++i) batches[i % kBatches].push_back(rows[i]);
+    IndividualTimelines batched;
+    reportTiming("build IndividualTimelines (" + std::to_string(kBatches) + " batches)", timeBestOf(args.repetitions, [&] {
+        batched.clear();
+        for (const auto& batch : batches) batched.add(batch);
+    }));
+
+    TimepointMask mapUnion = 0, tableUnion = 0;
+    reportTiming("iterate std::map<tuple, mask>", timeBestOf(args.repetitions, [&] {
+        mapUnion = 0;
+        for (const auto& [key, tps] : map) mapUnion |= tps ^ static_cast<TimepointMask>(std::get<2>(key));
+    }));
+    reportTiming("iterate IndividualTimelines", timeBestOf(args.repetitions, [&] {
+        tableUnion = 0;
+        for (const auto& [key, tps] : masks) tableUnion |= tps ^ static_cast<TimepointMask>(std::get<2>(key));
+    }));
+
+    // Range scans: every patient's slice, and every ARG's timelines
+    std::set<int> patients, argIDs;
+    for (const auto& [key, tps] : masks) {
+        patients.insert(std::get<0>(key));
+        argIDs.insert(std::get<1>(key));
+    }
+    size_t mapPatientRows = 0, tablePatientRows = 0, mapARGRows = 0, tableARGRows = 0;
+    reportTiming("per-patient scans, std::map lower_bound", timeBestOf(args.repetitions, [&] {
+        mapPatientRows = 0;
+        for (int patientID : patients) {
+            for (auto it = map.lower_bound({patientID, INT_MIN, INT_MIN}); it != map.end() && std::get<0>(it->first) == patientID; ++it) ++mapPatientRows;
+        }
+    }));
+    reportTiming("per-patient scans, IndividualTimelines", timeBestOf(args.repetitions, [&] {
+        tablePatientRows = 0;
+        for (int patientID : patients) tablePatientRows += masks.patientTimelines(patientID).size();
+    }));
+    reportTiming("per-ARG scans, std::map full pass", timeBestOf(1, [&] {
+        mapARGRows = 0;
+        for (int argID : argIDs) {
+            for (const auto& [key, tps] : map) mapARGRows += std::get<1>(key) == argID;
+        }
+    }));
+    reportTiming("per-ARG scans, IndividualTimelines", timeBestOf(args.repetitions, [&] {
+        tableARGRows = 0;
+        for (int argID : argIDs) masks.forEachARGTimeline(argID, [&](const IndividualTimelines::value_type&) { ++tableARGRows; });
+    }));
+    std::vector<IndividualTimelines::key_type> tableARGOrder, batchedARGOrder;
+    for (int argID : argIDs) {
+        masks.forEachARGTimeline(argID, [&](const IndividualTimelines::value_type& row) { tableARGOrder.push_back(row.first); });
+        batched.forEachARGTimeline(argID, [&](const IndividualTimelines::value_type& row) { batchedARGOrder.push_back(row.first); });
+    }
+    if (batched != masks || batchedARGOrder != tableARGOrder) {
+        std::cerr << "  MISMATCH: batched IndividualTimelines differs from a single add\n";
+        return 1;
+    }
+    if (mapUnion != tableUnion || mapPatientRows != masks.size() || tablePatientRows != masks.size() ||
+        mapARGRows != masks.size() || tableARGRows != masks.size()) {
+        std::cerr << "  MISMATCH: map and IndividualTimelines scans differ\n";
+        return 1;
+    }
+
+    long setSum = 0, maskSum = 0;
+    reportTiming("classify std::set<Timepoint> timelines", timeBestOf(args.repetitions, [&] {
+        setSum = 0;
+        for (const auto& [key, tps] : sets) setSum += classifySet(tps);
+    }));
+    reportTiming("classify TimepointMask timelines", timeBestOf(args.repetitions, [&] {
+        maskSum = 0;
+        for (const auto& [key, tps] : masks) maskSum += classifyMask(tps);
+    }));
+
+    // forEachTimepoint has to visit a mask in the order the set iterates
+    std::vector<Timepoint> visited;
+    for (const auto& [key, tps] : masks) {
+        const std::set<Timepoint>& set = sets.at(key);
+        visited.clear();
+        forEachTimepoint(tps, [&](Timepoint tp) { visited.push_back(tp); });
+        if (classifySet(set) != classifyMask(tps) || !std::equal(visited.begin(), visited.end(), set.begin(), set.end())) {
+            std::cerr << "  MISMATCH: mask and set timelines differ\n";
+            return 1;
+        }
+    }
+    return setSum == maskSum ? 0 : 1;
+}
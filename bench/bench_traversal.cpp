@@ -0,0 +1,95 @@
+// Released under the GNU GPLv3; see LICENSE for details.
+// Developed by Boucher Lab and Slizovskiy Lab.
+
+#include <algorithm>
+#include <map>
+#include <string>
+#include <thread>
+#include <tuple>
+#include <utility>
+#include <vector>
+#include "bench.h"
+#include "csr_graph.h"
+#include "graph.h"
+#include "parser.h"
+#include "traversal.h"
+
+/* Per-individual temporal traversal (traverseGraphByInd) on the full cohort: edge lookup
+   structures, the adjacency / CSR traversals over every (individual, ARG, MGE) start, and
+   the parallel CSR traversal at 1, 2, 4, ... threads up to the core count (at least 4, so the
+   merge is checked on small machines too) */
+
+int benchTraversal(const BenchArgs& args) {
+    Graph g;
+    std::map<int, std::string> patientToDiseaseMap;
+    parseData(args.dataFile, g, patientToDiseaseMap, true, false);
+    addTemporalEdges(g);
+
+    std::unordered_map<Node, std::unordered_set<Node>> adjacency;
+    buildAdjacency(g, adjacency);
+    CSRGraph csr;
+    buildCSR(g, csr);
+
+    // The edge lookup traverseGraphByInd used to build: every edge copied twice, ordered keys
+    reportTiming("edge lookup, ordered map of edge copies", timeBestOf(args.repetitions, [&] {
+        std::map<std::pair<Node, Node>, std::vector<Edge>> edgeMap;
+        for (const Edge& edge : g.edges) {
+            edgeMap[{edge.source, edge.target}].push_back(edge);
+            edgeMap[{edge.target, edge.source}].push_back(edge);
+        }
+    }));
+    EdgeHandleMap edgeHandles;
+    reportTiming("edge lookup, hashed edge handles", timeBestOf(args.repetitions, [&] { buildEdgeHandleMap(g, edgeHandles); }));
+
+    std::map<std::tuple<int, int, int>, Node> starts;
+    {
+        IndividualTimelines discard;
+        traverseGraphByInd(g, csr, starts, discard);
+    }
+    std::cout << "  starts: " << starts.size() << " (individual, ARG, MGE) first occurrences\n";
+
+    std::vector<IndividualTimelines::value_type> adjacencyRows, csrRows, scratchRows;
+    reportTiming("traversals, adjacency + edge handles", timeBestOf(args.repetitions, [&] {
+        adjacencyRows.clear();
+        for (const auto& [key, start] : starts) {
+            auto [ind, arg, mge] = key;
+            temporalTimelineTraversal(start, adjacency, edgeHandles, ind, arg, mge, adjacencyRows);
+        }
+    }));
+    reportTiming("traversals, CSR, scratch per start", timeBestOf(args.repetitions, [&] {
+        csrRows.clear();
+        for (const auto& [key, start] : starts) {
+            auto [ind, arg, mge] = key;
+            temporalTimelineTraversal(start, csr, ind, arg, mge, csrRows);
+        }
+    }));
+    reportTiming("traversals, CSR, reused scratch", timeBestOf(args.repetitions, [&] {
+        scratchRows.clear();
+        TraversalScratch scratch;
+        for (const auto& [key, start] : starts) {
+            auto [ind, arg, mge] = key;
+            temporalTimelineTraversal(start, csr, ind, arg, mge, scratchRows, scratch);
+        }
+    }));
+    if (adjacencyRows != csrRows || csrRows != scratchRows) {
+        std::cerr << "  MISMATCH: per-individual timelines differ between traversals\n";
+        return 1;
+    }
+
+    IndividualTimelines serial;
+    traverseFirstOccurrencesByInd(csr, starts, serial);
+    const unsigned maxThreads = std::max(4u, std::thread::hardware_concurrency());
+    for (unsigned threads = 1;; threads = std::min(maxThreads, threads * 2)) {
+        IndividualTimelines parallel;
+        reportTiming("traverseFirstOccurrencesByInd, " + std::to_string(threads) + " threads", timeBestOf(args.repetitions, [&] {
+            parallel.clear();
+            traverseFirstOccurrencesByInd(csr, starts, parallel, threads);
+        }));
+        if (parallel != serial) {
+            std::cerr << "  MISMATCH: " << threads << "-thread timelines differ from the serial traversal\n";
+            return 1;
+        }
+        if (threads == maxThreads) break;
+    }
+    return 0;
+}
@@ -2,9 +2,14 @@
 // Developed by Boucher Lab and Slizovskiy Lab.
 
 #pragma once
+#include <array>
+#include <cstdint>
+#include <iterator>
 #include <string>
+#include <string_view>
 #include <iostream>
 #include <ostream>
+#include "bit_utils.h"
 // enum class Timepoint {
 //     Donor = -1,
 //     Pre = 0,
@@ -69,60 +74,185 @@ enum class Timepoint {
     PostFMT_730 = 730,
 };
 
+// Phase bins shared by the analyses and exporters (post bins: days 1-30, 31-60, 61+).
+enum class TimepointPhase : std::uint8_t {
+    Donor,
+    Pre,
+    Post1,
+    Post2,
+    Post3,
+};
+
+struct TimepointInfo {
+    Timepoint timepoint;
+    std::string_view name;
+    TimepointPhase phase;
+};
+
+// Every timepoint in chronological order (Donor, PreFMT, then post days); the array
+// index is the timepoint's dense ordinal.
+inline constexpr TimepointInfo kTimepointTable[] = {
+    {Timepoint::Donor,       "donor",    TimepointPhase::Donor},
+    {Timepoint::PreFMT,      "pre",      TimepointPhase::Pre},
+    {Timepoint::PostFMT_001, "post_001", TimepointPhase::Post1},
+    {Timepoint::PostFMT_002, "post_002", TimepointPhase::Post1},
+    {Timepoint::PostFMT_003, "post_003", TimepointPhase::Post1},
+    {Timepoint::PostFMT_006, "post_006", TimepointPhase::Post1},
+    {Timepoint::PostFMT_007, "post_007", TimepointPhase::Post1},
+    {Timepoint::PostFMT_012, "post_012", TimepointPhase::Post1},
+    {Timepoint::PostFMT_013, "post_013", TimepointPhase::Post1},
+    {Timepoint::PostFMT_014, "post_014", TimepointPhase::Post1},
+    {Timepoint::PostFMT_015, "post_015", TimepointPhase::Post1},
+    {Timepoint::PostFMT_016, "post_016", TimepointPhase::Post1},
+    {Timepoint::PostFMT_020, "post_020", TimepointPhase::Post1},
+    {Timepoint::PostFMT_021, "post_021", TimepointPhase::Post1},
+    {Timepoint::PostFMT_028, "post_028", TimepointPhase::Post1},
+    {Timepoint::PostFMT_029, "post_029", TimepointPhase::Post1},
+    {Timepoint::PostFMT_030, "post_030", TimepointPhase::Post1},
+    {Timepoint::PostFMT_031, "post_031", TimepointPhase::Post2},
+    {Timepoint::PostFMT_035, "post_035", TimepointPhase::Post2},
+    {Timepoint::PostFMT_036, "post_036", TimepointPhase::Post2},
+    {Timepoint::PostFMT_040, "post_040", TimepointPhase::Post2},
+    {Timepoint::PostFMT_041, "post_041", TimepointPhase::Post2},
+    {Timepoint::PostFMT_042, "post_042", TimepointPhase::Post2},
+    {Timepoint::PostFMT_044, "post_044", TimepointPhase::Post2},
+    {Timepoint::PostFMT_054, "post_054", TimepointPhase::Post2},
+    {Timepoint::PostFMT_056, "post_056", TimepointPhase::Post2},
+    {Timepoint::PostFMT_059, "post_059", TimepointPhase::Post2},
+    {Timepoint::PostFMT_061, "post_061", TimepointPhase::Post3},
+    {Timepoint::PostFMT_063, "post_063", TimepointPhase::Post3},
+    {Timepoint::PostFMT_064, "post_064", TimepointPhase::Post3},
+    {Timepoint::PostFMT_065, "post_065", TimepointPhase::Post3},
+    {Timepoint::PostFMT_068, "post_068", TimepointPhase::Post3},
+    {Timepoint::PostFMT_081, "post_081", TimepointPhase::Post3},
+    {Timepoint::PostFMT_084, "post_084", TimepointPhase::Post3},
+    {Timepoint::PostFMT_090, "post_090", TimepointPhase::Post3},
+    {Timepoint::PostFMT_094, "post_094", TimepointPhase::Post3},
+    {Timepoint::PostFMT_095, "post_095", TimepointPhase::Post3},
+    {Timepoint::PostFMT_097, "post_097", TimepointPhase::Post3},
+    {Timepoint::PostFMT_098, "post_098", TimepointPhase::Post3},
+    {Timepoint::PostFMT_111, "post_111", TimepointPhase::Post3},
+    {Timepoint::PostFMT_112, "post_112", TimepointPhase::Post3},
+    {Timepoint::PostFMT_120, "post_120", TimepointPhase::Post3},
+    {Timepoint::PostFMT_135, "post_135", TimepointPhase::Post3},
+    {Timepoint::PostFMT_140, "post_140", TimepointPhase::Post3},
+    {Timepoint::PostFMT_150, "post_150", TimepointPhase::Post3},
+    {Timepoint::PostFMT_179, "post_179", TimepointPhase::Post3},
+    {Timepoint::PostFMT_180, "post_180", TimepointPhase::Post3},
+    {Timepoint::PostFMT_195, "post_195", TimepointPhase::Post3},
+    {Timepoint::PostFMT_365, "post_365", TimepointPhase::Post3},
+    {Timepoint::PostFMT_384, "post_384", TimepointPhase::Post3},
+    {Timepoint::PostFMT_408, "post_408", TimepointPhase::Post3},
+    {Timepoint::PostFMT_730, "post_730", TimepointPhase::Post3},
+};
+
+inline constexpr int kTimepointCount = static_cast<int>(std::size(kTimepointTable));
+
+constexpr bool timepointTableIsChronological() {
+    for (int i = 2; i < kTimepointCount; ++i) {
+        if (static_cast<int>(kTimepointTable[i - 1].timepoint) >= static_cast<int>(kTimepointTable[i].timepoint)) return false;
+    }
+    return kTimepointTable[0].timepoint == Timepoint::Donor && kTimepointTable[1].timepoint == Timepoint::PreFMT;
+}
+static_assert(timepointTableIsChronological(), "kTimepointTable must list Donor, PreFMT, then post days in ascending order");
+
+// Enum value (day, or 1000 for Donor) -> ordinal, -1 for values that are not a timepoint.
+inline constexpr int kMaxTimepointValue = static_cast<int>(Timepoint::Donor);
+
+constexpr std::array<std::int8_t, kMaxTimepointValue + 1> makeTimepointOrdinals() {
+    std::array<std::int8_t, kMaxTimepointValue + 1> ordinals{};
+    for (auto& ordinal : ordinals) ordinal = -1;
+    for (int i = 0; i < kTimepointCount; ++i) {
+        ordinals[static_cast<int>(kTimepointTable[i].timepoint)] = static_cast<std::int8_t>(i);
+    }
+    return ordinals;
+}
+
+inline constexpr auto kTimepointOrdinals = makeTimepointOrdinals();
+
+constexpr int timepointOrdinal(Timepoint tp) {
+    int value = static_cast<int>(tp);
+    return (value >= 0 && value <= kMaxTimepointValue) ? kTimepointOrdinals[value] : -1;
+}
+
+constexpr bool isKnownTimepoint(Timepoint tp) {
+    return timepointOrdinal(tp) >= 0;
+}
+
+constexpr Timepoint timepointAt(int ordinal) {
+    return kTimepointTable[ordinal].timepoint;
+}
+
+// Only valid for known timepoints; the parser rejects columns outside the table.
+constexpr TimepointPhase timepointPhase(Timepoint tp) {
+    return kTimepointTable[timepointOrdinal(tp)].phase;
+}
+
+constexpr std::string_view timepointName(Timepoint tp) {
+    int ordinal = timepointOrdinal(tp);
+    return ordinal >= 0 ? kTimepointTable[ordinal].name : std::string_view("unknown");
+}
+
+constexpr std::string_view timepointPhaseName(TimepointPhase phase) {
+    constexpr std::string_view names[] = {"donor", "pre", "post1", "post2", "post3"};
+    return names[static_cast<int>(phase)];
+}
+
 inline std::string toString(Timepoint tp) {
-    switch (tp) {
-        case Timepoint::Donor: return "donor";
-        case Timepoint::PreFMT: return "pre";
-        case Timepoint::PostFMT_001: return "post_001";
-        case Timepoint::PostFMT_002: return "post_002";
-        case Timepoint::PostFMT_003: return "post_003";
-        case Timepoint::PostFMT_006: return "post_006";
-        case Timepoint::PostFMT_007: return "post_007";
-        case Timepoint::PostFMT_012: return "post_012";
-        case Timepoint::PostFMT_013: return "post_013";
-        case Timepoint::PostFMT_014: return "post_014";
-        case Timepoint::PostFMT_015: return "post_015";
-        case Timepoint::PostFMT_016: return "post_016";
-        case Timepoint::PostFMT_020: return "post_020";
-        case Timepoint::PostFMT_021: return "post_021";
-        case Timepoint::PostFMT_028: return "post_028";
-        case Timepoint::PostFMT_029: return "post_029";
-        case Timepoint::PostFMT_030: return "post_030";
-        case Timepoint::PostFMT_031: return "post_031";
-        case Timepoint::PostFMT_035: return "post_035";
-        case Timepoint::PostFMT_036: return "post_036";
-        case Timepoint::PostFMT_040: return "post_040";
-        case Timepoint::PostFMT_041: return "post_041";
-        case Timepoint::PostFMT_042: return "post_042";
-        case Timepoint::PostFMT_044: return "post_044";
-        case Timepoint::PostFMT_054: return "post_054";
-        case Timepoint::PostFMT_056: return "post_056";
-        case Timepoint::PostFMT_059: return "post_059";
-        case Timepoint::PostFMT_061: return "post_061";
-        case Timepoint::PostFMT_063: return "post_063";
-        case Timepoint::PostFMT_064: return "post_064";
-        case Timepoint::PostFMT_065: return "post_065";
-        case Timepoint::PostFMT_068: return "post_068";
-        case Timepoint::PostFMT_081: return "post_081";
-        case Timepoint::PostFMT_084: return "post_084";
-        case Timepoint::PostFMT_090: return "post_090";
-        case Timepoint::PostFMT_094: return "post_094";
-        case Timepoint::PostFMT_095: return "post_095";
-        case Timepoint::PostFMT_097: return "post_097";
-        case Timepoint::PostFMT_098: return "post_098";
-        case Timepoint::PostFMT_111: return "post_111";
-        case Timepoint::PostFMT_112: return "post_112";
-        case Timepoint::PostFMT_120: return "post_120";
-        case Timepoint::PostFMT_135: return "post_135";
-        case Timepoint::PostFMT_140: return "post_140";
-        case Timepoint::PostFMT_150: return "post_150";
-        case Timepoint::PostFMT_179: return "post_179";
-        case Timepoint::PostFMT_180: return "post_180";
-        case Timepoint::PostFMT_195: return "post_195";
-        case Timepoint::PostFMT_365: return "post_365";
-        case Timepoint::PostFMT_384: return "post_384";
-        case Timepoint::PostFMT_408: return "post_408";
-        case Timepoint::PostFMT_730: return "post_730";
-        default: return "unknown";
+    return std::string(timepointName(tp));
+}
+
+
+// ------------------ Timepoint masks ------------------
+// A set of timepoints packed into one word: bit i is the timepoint with ordinal i, so bit
+// order is chronological (Donor first). Phase tests, post bins and first / last occurrence
+// are a mask test or a bit scan instead of a walk over a std::set<Timepoint>.
+using TimepointMask = std::uint64_t;
+static_assert(kTimepointCount <= 64, "every timepoint needs a bit in TimepointMask");
+
+constexpr TimepointMask timepointBit(Timepoint tp) {
+    return TimepointMask{1} << timepointOrdinal(tp);
+}
+
+constexpr TimepointMask makePhaseMask(TimepointPhase phase) {
+    TimepointMask mask = 0;
+    for (int i = 0; i < kTimepointCount; ++i) {
+        if (kTimepointTable[i].phase == phase) mask |= TimepointMask{1} << i;
     }
-}
\ No newline at end of file
+    return mask;
+}
+
+inline constexpr TimepointMask kDonorMask = makePhaseMask(TimepointPhase::Donor);
+inline constexpr TimepointMask kPreMask = makePhaseMask(TimepointPhase::Pre);
+inline constexpr TimepointMask kPost1Mask = makePhaseMask(TimepointPhase::Post1);
+inline constexpr TimepointMask kPost2Mask = makePhaseMask(TimepointPhase::Post2);
+inline constexpr TimepointMask kPost3Mask = makePhaseMask(TimepointPhase::Post3);
+inline constexpr TimepointMask kPostMask = kPost1Mask | kPost2Mask | kPost3Mask;
+inline constexpr TimepointMask kAllTimepointsMask =
+    kTimepointCount == 64 ? ~TimepointMask{0} : (TimepointMask{1} << kTimepointCount) - 1;
+
+constexpr bool hasDonor(TimepointMask mask) { return (mask & kDonorMask) != 0; }
+constexpr bool hasPreFMT(TimepointMask mask) { return (mask & kPreMask) != 0; }
+constexpr bool hasPostFMT(TimepointMask mask) { return (mask & kPostMask) != 0; }
+
+// Highest post bin present (1: days 1-30, 2: 31-60, 3: 61+), 0 if none. Donor counts as
+// bin 3, as it always has in the per-disease Post column.
+constexpr int postBinOf(TimepointMask mask) {
+    return (mask & (kPost3Mask | kDonorMask)) ? 3 : (mask & kPost2Mask) ? 2 : (mask & kPost1Mask) ? 1 : 0;
+}
+
+// Earliest / latest timepoint of a non-empty mask in chronological order.
+inline Timepoint firstTimepoint(TimepointMask mask) {
+    return timepointAt(countTrailingZeros64(mask));
+}
+inline Timepoint lastTimepoint(TimepointMask mask) {
+    return timepointAt(highestBit64(mask));
+}
+
+// Calls fn(tp) for every timepoint in mask in enum-value order (PreFMT, post days, then
+// Donor), i.e. the order a std::set<Timepoint> iterates in.
+template <typename Fn>
+inline void forEachTimepoint(TimepointMask mask, Fn&& fn) {
+    for (TimepointMask rest = mask & ~kDonorMask; rest; rest &= rest - 1) fn(timepointAt(countTrailingZeros64(rest)));
+    if (hasDonor(mask)) fn(Timepoint::Donor);
+}
@@ -10,7 +10,10 @@
 #include <unordered_map>
 #include <string>
 #include "graph.h"
+#include "csr_graph.h"
 #include "Timepoint.h"
+#include "individual_timelines.h"
+#include "entity_catalog.h"
 
 bool isPostFMT(const Timepoint& tp);
 bool isPreFMT(const Timepoint& tp);
@@ -18,7 +21,7 @@ bool isDonor(const Timepoint& tp);
 
 void getPatientwiseColocalizationsByCriteria(
     const Graph& graph,
-    const std::map<std::tuple<int, int, int>, std::set<Timepoint>>& colocalizationByIndividual,
+    const IndividualTimelines& colocalizationByIndividual,
     bool donorStatus,
     bool preFMTStatus,
     bool postFMTStatus,
@@ -27,13 +30,13 @@ void getPatientwiseColocalizationsByCriteria(
     bool append = false
 );
 
-void getTopARGMGEPairsByFrequency(const std::map<std::tuple<int, int, int>, std::set<Timepoint>>& colocalizations, int topN = -1);
-void getTopARGMGEPairsByFrequencyWODonor(const std::map<std::tuple<int, int, int>, std::set<Timepoint>>& colocalizations, int topN = -1, 
+void getTopARGMGEPairsByFrequency(const IndividualTimelines& colocalizations, int topN = -1);
+void getTopARGMGEPairsByFrequencyWODonor(const IndividualTimelines& colocalizations, int topN = -1, 
     const std::map<int, std::string>& patientToDiseaseMap = {}, const std::string& top_colocalizations_output = {});
 void getConnectedMGE(const Graph& graph, const std::set<Edge>& edges, int mgeId, const std::string& mgeName);
 
 void getColocalizationsByCriteria(
-    const std::map<std::tuple<int, int, int>, std::set<Timepoint>>& colocalizationByIndividual,
+    const IndividualTimelines& colocalizationByIndividual,
     bool donorStatus,
     bool preFMTStatus,
     bool postFMTStatus,
@@ -45,30 +48,27 @@ void getTopARGMGEPairsByUniquePatients(
     const std::string& label = "All Patients"
 );
 
-void writeTemporalDynamicsCountsForDisease(
-    const std::string& disease,
-    std::map<std::tuple<int, int, int>, std::set<Timepoint>>& colocalizationByIndividual,
-    const std::map<int, std::string>& patientToDiseaseMap
-);
-
-void writeAllDiseasesTemporalDynamicsCounts(
-    std::map<std::tuple<int,int,int>, std::set<Timepoint>>& colocalizationByIndividual,
-    const std::map<int, std::string>& patientToDiseaseMap
-);
-
-void writeTemporalDynamicsCountsForMGEGroup(
-    const std::map<std::tuple<int,int,int>, std::set<Timepoint>>& colocalizationByIndividual
-);
-
 void writeColocalizationsToCSV(
-    const std::map<std::tuple<int, int, int>, std::set<Timepoint>>& colocs,
+    const IndividualTimelines& colocs,
     const std::string& filename,
     const std::string& label,
     bool append = false
 );
 
 void exportColocalizations(const Graph& g,
-    const std::map<std::tuple<int,int,int>, std::set<Timepoint>>& colocalizationByIndividual
+    const IndividualTimelines& colocalizationByIndividual
+);
+
+// One pass over colocalizationByIndividual producing the outputs of exportColocalizations
+// plus the per-disease and per-MGE-group temporal dynamics counts, the latter written in
+// parallel.
+// Non-null diseases / mgeGroups limit the per-disease / per-group files to those diseases
+// and MGE group codes.
+void exportTemporalDynamics(
+    const IndividualTimelines& colocalizationByIndividual,
+    const std::map<int, std::string>& patientToDiseaseMap,
+    const std::set<std::string>* diseases = nullptr,
+    const std::set<CatalogCode>* mgeGroups = nullptr
 );
 
 
@@ -78,6 +78,8 @@ void writeGraphStatisticsCSV(
     const std::string& filename
 );
 
+void writeGraphStatisticsCSV(const Graph& g, const CSRGraph& csr, const std::string& filename);
+
 void analyzeColocalizations(const Graph& g, 
                              const std::unordered_map<Node, std::unordered_set<Node>>& adjacency);
 
@@ -95,14 +97,14 @@ void writeCSV(
 );
 
 void writeDetailedCSV(
-    const std::map<std::tuple<int, int, int>, std::set<Timepoint>>& colocs,
+    const IndividualTimelines& colocs,
     const std::string& filename,
     const std::string& label,
     bool append = false
 );
 
 void getDetailedColocalizationsByCriteria(
-    const std::map<std::tuple<int, int, int>, std::set<Timepoint>>& colocalizationByIndividual,
+    const IndividualTimelines& colocalizationByIndividual,
     bool donorStatus,
     bool preFMTStatus,
     bool postFMTStatus,
@@ -112,7 +114,7 @@ void getDetailedColocalizationsByCriteria(
 );
 
 void exportDetailedTemporalDynamics(
-    const std::map<std::tuple<int,int,int>, std::set<Timepoint>>& colocalizationByIndividual
+    const IndividualTimelines& colocalizationByIndividual
 );
 
 #endif
\ No newline at end of file
@@ -0,0 +1,37 @@
+// Released under the GNU GPLv3; see LICENSE for details.
+// Developed by Boucher Lab and Slizovskiy Lab.
+
+#ifndef CATALOG_LOADER_H
+#define CATALOG_LOADER_H
+
+#include <filesystem>
+#include "catalog_tables.h"
+
+// ------------------ Runtime catalog loading ------------------
+// Loads an ARG / MGE catalog from the TSV tables named in config/paths.json
+// (input.catalog) instead of the one compiled in, so a new MEGARes or MGE database release
+// only needs new tables. The derived columns are cached in a versioned binary file that
+// remembers the canonical path, size and modification time of both tables; while they are
+// unchanged the next start restores the columns from the cache without parsing or sorting.
+
+struct CatalogSource {
+    std::filesystem::path argsFile;
+    std::filesystem::path mgesFile;
+    std::filesystem::path cacheFile;   // optional; empty disables the binary cache
+};
+
+// Fills data from source.cacheFile if it is current, else from the tables (refreshing the
+// cache). Returns false if the tables cannot be read.
+bool loadCatalogData(const CatalogSource& source, CatalogData& data);
+
+bool saveCatalogCache(const std::filesystem::path& cacheFile, const CatalogSource& source, const CatalogData& data);
+
+// Returns false (leaving data untouched) if the cache is missing, stale, or not a cache
+// of this format version.
+bool loadCatalogCache(const std::filesystem::path& cacheFile, const CatalogSource& source, CatalogData& data);
+
+// loadCatalogData followed by setEntityCatalog; the loaded catalog stays alive for the rest
+// of the process. On failure the current catalog is kept.
+bool loadEntityCatalog(const CatalogSource& source);
+
+#endif // CATALOG_LOADER_H
@@ -0,0 +1,83 @@
+// Released under the GNU GPLv3; see LICENSE for details.
+// Developed by Boucher Lab and Slizovskiy Lab.
+
+#ifndef CATALOG_TABLES_H
+#define CATALOG_TABLES_H
+
+#include <filesystem>
+#include <string>
+#include <string_view>
+#include <vector>
+#include "entity_catalog.h"
+
+// ------------------ Catalog source tables ------------------
+// The ARG / MGE reference catalog as two tab-separated tables (data/catalog by default):
+//   args.tsv  id, name, group, resistance, requires_snp_confirmation (0/1)
+//   mges.tsv  id, name, label, group
+// Each file starts with a header line; empty fields mean "not in that table". Used by the
+// build-time generator of the built-in catalog and by anything that loads a catalog at
+// runtime, so both derive the columns the same way.
+
+struct CatalogArgRow {
+    int id;
+    std::string name;
+    std::string group;
+    std::string resistance;
+    bool requiresSNPConfirmation;
+};
+
+struct CatalogMGERow {
+    int id;
+    std::string name;
+    std::string label;
+    std::string group;
+};
+
+struct CatalogTables {
+    std::vector<CatalogArgRow> args;   // ascending id
+    std::vector<CatalogMGERow> mges;   // ascending id
+};
+
+// Reads the ARG and MGE tables. Malformed rows are reported to std::cerr and skipped;
+// returns false if a file cannot be opened.
+bool readCatalogTables(const std::filesystem::path& argsFile, const std::filesystem::path& mgesFile, CatalogTables& tables);
+
+// Owning storage for the catalog columns derived from a set of tables. Columns view the
+// strings in tables (or stringPool), so CatalogData is filled in place and never copied.
+struct CatalogData {
+    CatalogTables tables;
+
+    std::vector<int> argIds;
+    std::vector<std::string_view> argNames;
+    std::vector<CatalogCode> argGroups;
+    std::vector<CatalogCode> argResistances;
+    std::vector<uint8_t> argRequiresSNP;
+    std::vector<std::string_view> argGroupNames;
+    std::vector<std::string_view> resistanceNames;
+
+    std::vector<int> mgeIds;
+    std::vector<std::string_view> mgeNames;
+    std::vector<std::string_view> mgeLabels;
+    std::vector<CatalogCode> mgeGroups;
+    std::vector<std::string_view> mgeGroupNames;
+
+    std::vector<int32_t> argIndexById;
+    std::vector<int32_t> mgeIndexById;
+
+    std::vector<CatalogNameEntry> argsByName;
+    std::vector<CatalogNameEntry> mgesByName;
+    std::vector<CatalogNameEntry> mgesByLabel;
+
+    std::string stringPool;   // backs the string columns instead of tables when restored from a cache
+
+    CatalogData() = default;
+    CatalogData(const CatalogData&) = delete;
+    CatalogData& operator=(const CatalogData&) = delete;
+
+    EntityCatalog view() const;
+};
+
+// Takes ownership of tables and derives every column of data from them.
+void buildCatalogData(CatalogTables tables, CatalogData& data);
+
+#endif // CATALOG_TABLES_H
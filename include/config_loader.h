@@ -11,6 +11,12 @@
 
 struct Config {
     std::string input_data_path;
+    std::string graph_snapshot_path;   // optional; empty disables the snapshot cache
+
+    // optional; empty args / mges paths keep the catalog compiled into the binary
+    std::string catalog_args_path;
+    std::string catalog_mges_path;
+    std::string catalog_cache_path;    // optional; empty disables the catalog cache
 
     std::string output_base;
     std::string output_disease;
@@ -30,6 +36,7 @@ struct Config {
     std::string viz_interaction;
     std::string viz_parent;
     std::string viz_temporal_dynamics;
+    std::string viz_entity_timelines;  // optional; empty skips the per-entity timeline export
 };
 
 
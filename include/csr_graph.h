@@ -0,0 +1,58 @@
+// Released under the GNU GPLv3; see LICENSE for details.
+// Developed by Boucher Lab and Slizovskiy Lab.
+
+#ifndef CSR_GRAPH_H
+#define CSR_GRAPH_H
+
+#include <cstdint>
+#include <unordered_map>
+#include <vector>
+#include "graph.h"
+
+// ------------------ CSR snapshot ------------------
+// Frozen compressed-sparse-row copy of a Graph, built once after addTemporalEdges.
+// Nodes get dense indices in Graph::nodes order. Colocalization edges are stored in
+// both directions and temporal edges forward only, each family with its own offset
+// array; neighbor ranges are sorted by node index. Every adjacency slot carries the
+// id of its edge in the per-edge attribute arrays (ids follow Graph::edges order).
+
+struct CSREdgeAttr {
+    int weight;        // temporal weight (0 for colocalization edges)
+    int patientCount;  // number of individuals on the edge
+};
+
+struct CSRGraph {
+    std::vector<Node> nodes;
+    std::unordered_map<Node, uint32_t> nodeIndex;
+
+    std::vector<uint32_t> coloOffsets;        // nodes.size() + 1 entries
+    std::vector<uint32_t> coloNeighbors;
+    std::vector<uint32_t> coloEdgeIds;
+
+    std::vector<uint32_t> temporalOffsets;    // nodes.size() + 1 entries
+    std::vector<uint32_t> temporalNeighbors;
+    std::vector<uint32_t> temporalEdgeIds;
+
+    std::vector<CSREdgeAttr> edgeAttrs;
+    size_t patientWords = 0;                  // 64-bit words per edge patient bitset
+    std::vector<uint64_t> edgePatients;       // edgeAttrs.size() * patientWords, bit = patient ID
+
+    size_t nodeCount() const { return nodes.size(); }
+    size_t edgeCount() const { return edgeAttrs.size(); }
+
+    // Dense index of node, or -1 if the node is not part of the snapshot.
+    int indexOf(const Node& node) const {
+        auto it = nodeIndex.find(node);
+        return it != nodeIndex.end() ? static_cast<int>(it->second) : -1;
+    }
+
+    bool edgeHasPatient(uint32_t edgeId, int patientID) const {
+        size_t word = static_cast<size_t>(patientID) / 64;
+        if (patientID < 0 || word >= patientWords) return false;
+        return (edgePatients[edgeId * patientWords + word] >> (patientID % 64)) & 1u;
+    }
+};
+
+void buildCSR(const Graph& g, CSRGraph& csr);
+
+#endif // CSR_GRAPH_H
@@ -0,0 +1,44 @@
+// Released under the GNU GPLv3; see LICENSE for details.
+// Developed by Boucher Lab and Slizovskiy Lab.
+
+#ifndef CSV_READER_H
+#define CSV_READER_H
+
+#include <filesystem>
+#include <string>
+#include <string_view>
+#include <vector>
+
+/* Whole-file CSV reading with in-place (string_view) tokenization */
+
+// Reads the whole file into buffer with a single read. Returns false if it cannot be opened.
+bool readFileToBuffer(const std::filesystem::path& filename, std::string& buffer);
+
+// Calls fn(line) for every line of text, without the line terminator ("\n" or "\r\n").
+template <typename Fn>
+void forEachLine(std::string_view text, Fn&& fn) {
+    size_t pos = 0;
+    while (pos < text.size()) {
+        size_t end = text.find('\n', pos);
+        if (end == std::string_view::npos) end = text.size();
+        std::string_view line = text.substr(pos, end - pos);
+        if (!line.empty() && line.back() == '\r') line.remove_suffix(1);
+        fn(line);
+        pos = end + 1;
+    }
+}
+
+// Splits line at commas into views of the line, reusing the vector's storage. Like
+// std::getline tokenization, a trailing empty field after the last comma is dropped.
+inline void splitFields(std::string_view line, std::vector<std::string_view>& fields) {
+    fields.clear();
+    size_t pos = 0;
+    while (pos < line.size()) {
+        size_t comma = line.find(',', pos);
+        if (comma == std::string_view::npos) comma = line.size();
+        fields.push_back(line.substr(pos, comma - pos));
+        pos = comma + 1;
+    }
+}
+
+#endif // CSV_READER_H
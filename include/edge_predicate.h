@@ -0,0 +1,92 @@
+// Released under the GNU GPLv3; see LICENSE for details.
+// Developed by Boucher Lab and Slizovskiy Lab.
+
+#ifndef EDGE_PREDICATE_H
+#define EDGE_PREDICATE_H
+
+#include <cstdint>
+#include <map>
+#include <string>
+#include <vector>
+#include "Timepoint.h"
+#include "entity_catalog.h"
+#include "graph_index.h"
+#include "graph_view.h"
+#include "patient_set.h"
+
+// ------------------ Colocalization edge table ------------------
+// The colocalization edges of an indexed graph as one column per attribute (row r is the
+// r-th colocalization edge in Graph::edges order), so a predicate is a tight loop over one
+// or two arrays. Patient sets are stored row-major with a fixed number of words per row.
+// Like the GraphIndex it is built from, the table is only valid while the graph is unchanged.
+
+struct ColoEdgeTable {
+    const GraphIndex* index = nullptr;
+    std::vector<uint32_t> edgeIds;            // dense edge id in the GraphIndex
+    std::vector<int32_t> argIds;              // ARG endpoint, -1 if neither endpoint is an ARG
+    std::vector<int32_t> mgeIds;              // MGE endpoint, -1 if neither endpoint is an MGE
+    std::vector<CatalogCode> argGroups;
+    std::vector<CatalogCode> resistances;
+    std::vector<CatalogCode> mgeGroups;
+    std::vector<uint8_t> requiresSNP;         // ARG endpoint requires SNP confirmation
+    std::vector<uint8_t> timepoints;          // timepoint ordinal of the colocalization
+    std::vector<uint32_t> patientCounts;
+    size_t patientWords = 0;                  // words per row in patients
+    std::vector<uint64_t> patients;
+
+    size_t size() const { return edgeIds.size(); }
+};
+
+void buildColoEdgeTable(const GraphIndex& index, ColoEdgeTable& table);
+
+// ------------------ Edge predicates ------------------
+// A tree of criteria on colocalization edges: leaves test one column, All / Any nodes are
+// conjunctions / disjunctions of their children (an empty All matches every edge, an empty
+// Any none). Names are resolved when a leaf is made; an unknown name is reported and gives
+// a leaf that matches nothing. Compose with & and |, e.g.
+//     EdgePredicate::disease("CDI", masks) & EdgePredicate::mgeGroup("plasmid")
+//         & EdgePredicate::timepoints(Timepoint::PostFMT_001, Timepoint::PostFMT_030)
+
+struct EdgePredicate {
+    enum class Kind : uint8_t {
+        All, Any, None,
+        Patients,        // shares a patient with patients
+        ARG, MGE,        // entity id
+        ARGGroup, MGEGroup, Resistance,   // catalog code
+        RequiresSNP,     // flag
+        Timepoints,      // ordinal in [first, last]
+        MinPatients,     // at least value patients
+    };
+
+    Kind kind = Kind::All;
+    int32_t value = 0;
+    uint8_t first = 0, last = 0;
+    PatientSet patients;
+    std::vector<EdgePredicate> children;
+
+    static EdgePredicate all(std::vector<EdgePredicate> children = {});
+    static EdgePredicate any(std::vector<EdgePredicate> children = {});
+    static EdgePredicate none();
+
+    static EdgePredicate disease(const std::string& disease, const std::map<std::string, PatientSet>& diseaseMasks);
+    static EdgePredicate patientsIn(const PatientSet& patients);
+    static EdgePredicate arg(const std::string& argName);
+    static EdgePredicate mge(const std::string& mgeName);
+    static EdgePredicate argGroup(const std::string& groupName);
+    static EdgePredicate mgeGroup(const std::string& groupName);
+    static EdgePredicate resistance(const std::string& resistanceClass);
+    static EdgePredicate requiresSNPConfirmation(bool required = true);
+    // Inclusive, in timeline order (Donor, PreFMT, then the post-FMT days)
+    static EdgePredicate timepoints(Timepoint first, Timepoint last);
+    static EdgePredicate minPatients(int count);
+};
+
+EdgePredicate operator&(EdgePredicate a, EdgePredicate b);
+EdgePredicate operator|(EdgePredicate a, EdgePredicate b);
+
+// The colocalization edges matching predicate, their endpoints and the temporal edges between
+// those endpoints (the subgraph shape of the filterGraphBy* functions). The tree is evaluated
+// block by block in a single pass over the table.
+GraphView filterGraphByPredicate(const ColoEdgeTable& table, const EdgePredicate& predicate);
+
+#endif // EDGE_PREDICATE_H
@@ -0,0 +1,113 @@
+// Released under the GNU GPLv3; see LICENSE for details.
+// Developed by Boucher Lab and Slizovskiy Lab.
+
+#ifndef ENTITY_CATALOG_H
+#define ENTITY_CATALOG_H
+
+#include <cstddef>
+#include <cstdint>
+#include <string_view>
+
+// ------------------ Entity catalog ------------------
+// Struct-of-arrays copy of the ARG and MGE reference tables. Every entity has a dense
+// index (ascending external id) and its name, label and codes sit in parallel columns at
+// that index. ARG groups, resistance classes and MGE groups are small integer codes into
+// name tables sorted by name, so code order is name order. Graph nodes keep the external
+// ids, which are what the exported files show.
+//
+// The catalog only holds views. The built-in one is generated at build time from the TSV
+// tables in CONET_CATALOG_DIR (see tools/gen_catalog.cpp) into constexpr arrays, so it
+// needs no dynamic initialization; catalog_loader.h loads others at runtime.
+
+using CatalogCode = uint16_t;
+constexpr CatalogCode kNoCatalogCode = 0xFFFF;   // entity has no group / resistance entry
+
+// Read-only view of a column: pointer + length.
+template <typename T>
+struct CatalogColumn {
+    const T* data = nullptr;
+    size_t count = 0;
+
+    constexpr size_t size() const { return count; }
+    constexpr bool empty() const { return count == 0; }
+    constexpr const T& operator[](size_t i) const { return data[i]; }
+    constexpr const T* begin() const { return data; }
+    constexpr const T* end() const { return data + count; }
+};
+
+// Reverse-index entry; reverse indexes are sorted by name, then id.
+struct CatalogNameEntry {
+    std::string_view name;
+    int id;
+};
+
+struct EntityCatalog {
+    CatalogColumn<int> argIds;                       // dense index -> ARG id
+    CatalogColumn<std::string_view> argNames;
+    CatalogColumn<CatalogCode> argGroups;            // codes into argGroupNames
+    CatalogColumn<CatalogCode> argResistances;       // codes into resistanceNames
+    CatalogColumn<uint8_t> argRequiresSNP;
+    CatalogColumn<std::string_view> argGroupNames;
+    CatalogColumn<std::string_view> resistanceNames;
+
+    CatalogColumn<int> mgeIds;                       // dense index -> MGE id
+    CatalogColumn<std::string_view> mgeNames;        // empty if the MGE has no accession name
+    CatalogColumn<std::string_view> mgeLabels;       // empty if the MGE has no display label
+    CatalogColumn<CatalogCode> mgeGroups;            // codes into mgeGroupNames
+    CatalogColumn<std::string_view> mgeGroupNames;
+
+    CatalogColumn<int32_t> argIndexById;             // external id -> dense index, -1 if absent
+    CatalogColumn<int32_t> mgeIndexById;
+
+    CatalogColumn<CatalogNameEntry> argsByName;
+    CatalogColumn<CatalogNameEntry> mgesByName;
+    CatalogColumn<CatalogNameEntry> mgesByLabel;
+
+    int argIndex(int id) const {
+        return id >= 0 && static_cast<size_t>(id) < argIndexById.size() ? argIndexById[id] : -1;
+    }
+    int mgeIndex(int id) const {
+        return id >= 0 && static_cast<size_t>(id) < mgeIndexById.size() ? mgeIndexById[id] : -1;
+    }
+
+    bool hasARG(int id) const { return argIndex(id) >= 0 && !argNames[argIndex(id)].empty(); }
+    bool hasMGE(int id) const { return mgeIndex(id) >= 0 && !mgeNames[mgeIndex(id)].empty(); }
+
+    std::string_view argName(int id) const;        // "Unknown ARG" if not in the catalog
+    std::string_view mgeName(int id) const;        // "Unknown MGE" if not in the catalog
+    std::string_view mgeLabel(int id) const;       // display label, else the accession name
+
+    CatalogCode argGroup(int id) const;
+    CatalogCode argResistance(int id) const;
+    CatalogCode mgeGroup(int id) const;
+    bool requiresSNPConfirmation(int argID) const;
+
+    std::string_view argGroupName(CatalogCode code) const;   // "Unknown ARG Group" for kNoCatalogCode
+    std::string_view mgeGroupName(CatalogCode code) const;   // "Unknown MGE Group" for kNoCatalogCode
+    std::string_view resistanceName(CatalogCode code) const; // empty for kNoCatalogCode
+
+    // Name -> code / id lookups; kNoCatalogCode or -1 if unknown. A name shared by several
+    // entities resolves to the lowest id.
+    CatalogCode findARGGroup(std::string_view name) const;
+    CatalogCode findMGEGroup(std::string_view name) const;
+    CatalogCode findResistance(std::string_view name) const;
+    int findARG(std::string_view name) const;
+    int findMGE(std::string_view name) const;
+    int findMGEByLabel(std::string_view label) const;   // falls back to the accession name
+};
+
+// The catalog generated into the binary at build time.
+const EntityCatalog& builtinEntityCatalog();
+
+// The process-wide catalog: the one installed with setEntityCatalog, else the built-in one.
+const EntityCatalog& entityCatalog();
+
+// Installs catalog (nullptr restores the built-in one). It must outlive every later use of
+// entityCatalog(); install it before parsing, since graphs store the ids it resolves.
+void setEntityCatalog(const EntityCatalog* catalog);
+
+// Hash over everything parseData reads from a catalog (ids, names, SNP flags, resistance
+// classes); a graph built with one catalog is only valid under catalogs with the same value.
+uint64_t catalogFingerprint(const EntityCatalog& catalog);
+
+#endif // ENTITY_CATALOG_H
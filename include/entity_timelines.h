@@ -0,0 +1,49 @@
+// Released under the GNU GPLv3; see LICENSE for details.
+// Developed by Boucher Lab and Slizovskiy Lab.
+
+#ifndef ENTITY_TIMELINES_H
+#define ENTITY_TIMELINES_H
+
+#include <array>
+#include <cstdint>
+#include <vector>
+#include "Timepoint.h"
+#include "graph.h"
+
+// ------------------ Entity timeline index ------------------
+// Per-ARG and per-MGE summary of the colocalization edges, built in one pass over a Graph:
+// the timepoints at which the entity is colocalized with each partner (edges with at least
+// one patient), and its colocalization degree at each timepoint. Timeline drill-downs and
+// the bulk export read this instead of scanning the edges per query. Entities are kept in
+// ascending id order; rebuild the index whenever the graph changes.
+
+struct EntityPartnerTimeline {
+    int partnerID;                 // MGE id for an ARG, ARG id for an MGE
+    TimepointMask timepoints;
+};
+
+struct EntityTimeline {
+    int id;
+    bool isARG;
+    std::vector<EntityPartnerTimeline> partners;          // ascending partner id
+    std::array<uint32_t, kTimepointCount> degree{};       // colocalization edges per timepoint ordinal
+};
+
+class EntityTimelineIndex {
+public:
+    // nullptr if the entity has no colocalization edge
+    const EntityTimeline* find(bool isARG, int id) const;
+
+    const std::vector<EntityTimeline>& args() const { return args_; }
+    const std::vector<EntityTimeline>& mges() const { return mges_; }
+
+private:
+    friend void buildEntityTimelineIndex(const Graph& graph, EntityTimelineIndex& index);
+
+    std::vector<EntityTimeline> args_;
+    std::vector<EntityTimeline> mges_;
+};
+
+void buildEntityTimelineIndex(const Graph& graph, EntityTimelineIndex& index);
+
+#endif // ENTITY_TIMELINES_H
@@ -5,13 +5,16 @@
 #define EXPORT_H
 
 #include <string>
+#include <string_view>
 #include "graph.h"
+#include "entity_catalog.h"
 
 std::string getNodeName(const Node& node);
 std::string getNodeLabel(const Node& node);
 // std::string getTimepointColor(const Timepoint& tp);
 bool isTemporalEdge(const Edge& edge);  
 std::string getMGEGroupShape(const std::string& groupName);
+std::string_view getMGEGroupShape(CatalogCode group);
 void exportToDot(const Graph& g, const std::string& filename, bool showLabels = true);
 void exportParentTemporalGraphDot(const Graph& g, const std::string& filename, bool showLabels=true);
 #endif
\ No newline at end of file
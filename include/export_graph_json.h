@@ -5,13 +5,27 @@
 #include <string>
 #include <map>
 #include "graph.h"
+#include "graph_view.h"
+#include "individual_timelines.h"
+#include "entity_timelines.h"
 
-bool exportGraphToJsonSimple(const Graph& g, const std::string& outPathStr, const std::map<int, std::string>& patientToDiseaseMap);
+// compact = true writes the JSON without indentation (same content as the indented form).
+bool exportGraphToJsonSimple(const Graph& g, const std::string& outPathStr, const std::map<int, std::string>& patientToDiseaseMap, bool compact = false);
 
-bool exportParentGraphToJson(const Graph& g, const std::string& outPathStr, const std::map<int, std::string>& patientToDiseaseMap, bool showLabels = true);
+bool exportParentGraphToJson(const Graph& g, const std::string& outPathStr, const std::map<int, std::string>& patientToDiseaseMap, bool showLabels = true, bool compact = false);
+
+// Same output for a subgraph view (e.g. a composition of the GraphIndex filters), written
+// straight from the base graph's edges without materializing the subgraph.
+bool exportGraphToJsonSimple(const GraphView& view, const std::string& outPathStr, const std::map<int, std::string>& patientToDiseaseMap, bool compact = false);
+bool exportParentGraphToJson(const GraphView& view, const std::string& outPathStr, const std::map<int, std::string>& patientToDiseaseMap, bool showLabels = true, bool compact = false);
 
 void exportColocalizationsToJSONByDisease(
-    const std::map<std::tuple<int,int,int>, std::set<Timepoint>>& colocalizationByIndividual,
+    const IndividualTimelines& colocalizationByIndividual,
     const std::map<int, std::string>& patientToDiseaseMap,
     const std::string& jsonOutputPath  // path to the final JSON file
 );
+
+// Every ARG and MGE of the index with its partners' timepoints and its degree per timepoint,
+// timepoints in chronological order:
+// {"args": [{"id", "name", "partners": [{"id", "name", "timepoints"}], "timepoints": [{"degree", "timepoint"}]}], "mges": [...]}
+bool exportEntityTimelinesToJson(const EntityTimelineIndex& index, const std::string& outPathStr, bool compact = false);
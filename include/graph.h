@@ -14,6 +14,7 @@
 #include <tuple>
 #include <ostream>
 #include "Timepoint.h"
+#include "patient_set.h"
 
 // ------------------ Node ------------------
 
@@ -28,16 +29,8 @@ struct Node {
         if (id != other.id) return id < other.id;
         if (isARG != other.isARG) return isARG < other.isARG;
 
-        // If they are the same entity, use custom chronological sorting for timepoints
-        Timepoint tp1 = timepoint;
-        Timepoint tp2 = other.timepoint;
-
-        // If one is Donor and the other isn't, Donor always comes first.
-        if (tp1 == Timepoint::Donor && tp2 != Timepoint::Donor) return true;
-        if (tp1 != Timepoint::Donor && tp2 == Timepoint::Donor) return false;
-
-        // Otherwise, sort by the standard numerical order (PreFMT < PostFMT).
-        return static_cast<int>(tp1) < static_cast<int>(tp2);
+        // If they are the same entity, sort chronologically (Donor, PreFMT, PostFMT days)
+        return timepointOrdinal(timepoint) < timepointOrdinal(other.timepoint);
     }
 
     bool operator==(const Node& other) const {
@@ -63,23 +56,25 @@ namespace std {
 
 // ------------------ Edge ------------------
 
+// An edge is keyed by (source, target, isColo). The payload (individuals, weight) is
+// not part of the key, so it is mutable and can be updated in place while the edge
+// sits in Graph::edges, without an erase/reinsert.
 struct Edge {
     Node source;
     Node target;
     bool isColo;
-    std::set<int> individuals;
-    int weight = 0;
+    mutable PatientSet individuals;
+    mutable int weight = 0;
     
 
     bool operator<(const Edge& other) const {
-        return std::tie(source, target, isColo, weight) < std::tie(other.source, other.target, other.isColo, other.weight);
+        return std::tie(source, target, isColo) < std::tie(other.source, other.target, other.isColo);
     }
 
     bool operator==(const Edge& other) const {
         return source == other.source &&
                target == other.target &&
-               isColo == other.isColo &&
-               weight == other.weight;
+               isColo == other.isColo;
     }
 
 };
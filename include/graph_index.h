@@ -0,0 +1,44 @@
+// Released under the GNU GPLv3; see LICENSE for details.
+// Developed by Boucher Lab and Slizovskiy Lab.
+
+#ifndef GRAPH_INDEX_H
+#define GRAPH_INDEX_H
+
+#include <cstdint>
+#include <unordered_map>
+#include <vector>
+#include "graph.h"
+#include "entity_catalog.h"
+
+// ------------------ Graph index ------------------
+// Secondary indexes over a built Graph for entity-scoped subgraph extraction (the
+// frontend's per-ARG / per-MGE / per-group drill-downs). Nodes and edges get dense ids
+// in Graph::nodes / Graph::edges order; colocalization edges are listed per ARG id, per
+// MGE id and per MGE group code, and temporal edges per source node, so a filter only
+// touches edges at the nodes it returns. The index points into the graph: build it after
+// addTemporalEdges and rebuild it whenever the graph changes.
+
+struct GraphIndex {
+    std::vector<const Node*> nodes;                  // dense node id -> node
+    std::vector<const Edge*> edges;                  // dense edge id -> edge
+    std::unordered_map<Node, uint32_t> nodeIndex;
+
+    std::vector<uint32_t> edgeSources;               // dense edge id -> source node id
+    std::vector<uint32_t> edgeTargets;               // dense edge id -> target node id
+
+    std::vector<uint32_t> temporalOffsets;           // nodes.size() + 1 entries
+    std::vector<uint32_t> temporalEdgeIds;           // temporal edges leaving each node
+
+    // Colocalization edge ids per entity, ascending
+    std::unordered_map<int, std::vector<uint32_t>> coloEdgesByARG;
+    std::unordered_map<int, std::vector<uint32_t>> coloEdgesByMGE;
+    std::vector<std::vector<uint32_t>> coloEdgesByMGEGroup;   // by group code; last slot: no group
+
+    const std::vector<uint32_t>& argEdges(int argID) const;
+    const std::vector<uint32_t>& mgeEdges(int mgeID) const;
+    const std::vector<uint32_t>& mgeGroupEdges(CatalogCode group) const;
+};
+
+void buildGraphIndex(const Graph& g, GraphIndex& index);
+
+#endif // GRAPH_INDEX_H
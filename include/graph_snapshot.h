@@ -0,0 +1,49 @@
+// Released under the GNU GPLv3; see LICENSE for details.
+// Developed by Boucher Lab and Slizovskiy Lab.
+
+#ifndef GRAPH_SNAPSHOT_H
+#define GRAPH_SNAPSHOT_H
+
+#include <filesystem>
+#include <map>
+#include <set>
+#include <string>
+#include <tuple>
+#include <vector>
+#include "graph.h"
+#include "individual_timelines.h"
+
+// ------------------ Graph snapshot ------------------
+// Versioned binary image of a built graph: nodes, colocalization and temporal edges with
+// their patient bitsets and weights, the patient -> disease map and the per-individual
+// timelines from traverseGraph. Every section is a flat array of fixed-size records, so
+// loading maps the file and decodes the records in place, without tokenizing or label
+// lookups. A snapshot remembers the size and modification time of the CSV it was built
+// from, the parse options and the fingerprint of the entity catalog that resolved the
+// labels; loadGraphSnapshot rejects it when any of them changed. Delta CSVs folded in with
+// --append are recorded the same way (path, size, modification time), so a snapshot never
+// silently holds rows that are not in its recorded inputs.
+
+struct SnapshotSource {
+    std::filesystem::path dataFile;
+    bool includeSNPConfirmationARGs;
+    bool excludeMetals;
+    std::vector<std::filesystem::path> appliedDeltas;   // canonical paths, in the order appended
+};
+
+bool saveGraphSnapshot(const std::filesystem::path& snapshotFile, const SnapshotSource& source, const Graph& graph,
+                       const std::map<int, std::string>& patientToDiseaseMap,
+                       const IndividualTimelines& colocalizationByIndividual);
+
+// Returns false (leaving the outputs untouched) if the snapshot is missing, stale, not a
+// snapshot of this format version, or was built from other delta files than
+// source.appliedDeltas.
+bool loadGraphSnapshot(const std::filesystem::path& snapshotFile, const SnapshotSource& source, Graph& graph,
+                       std::map<int, std::string>& patientToDiseaseMap,
+                       IndividualTimelines& colocalizationByIndividual);
+
+// Delta files recorded in a snapshot of this format version, whether or not it is still
+// current, so a rebuild can re-apply them; empty if there is no such snapshot.
+std::vector<std::filesystem::path> snapshotAppliedDeltas(const std::filesystem::path& snapshotFile);
+
+#endif // GRAPH_SNAPSHOT_H
@@ -8,6 +8,14 @@
 #include <string>
 #include <unordered_set>
 #include <map>
+#include "patient_set.h"
+#include "graph_index.h"
+#include "graph_view.h"
+
+// Disease name -> set of its patients, so per-disease membership and counts are
+// bit operations on Edge::individuals.
+using DiseaseMasks = std::map<std::string, PatientSet>;
+DiseaseMasks buildDiseaseMasks(const std::map<int, std::string>& patientToDiseaseMap);
 
 Graph filterGraphByARGName(const Graph& g, const std::string& argName);
 Graph filterGraphByMGEName(const Graph& g, const std::string& mgeName);
@@ -16,4 +24,15 @@ Graph filterGraphByTimepoint(const Graph& g, const std::string& timepointCategor
 Graph filterGraphByARGAndMGENames(const Graph& g, const std::string& argName, const std::string& mgeName);
 Graph filterGraphByDisease(const Graph& g, const std::string& disease, const std::map<int, std::string>& patientToDiseaseMap);
 
+// Same subgraphs as the filters above, as views of an indexed graph: nothing is copied, and
+// views compose, e.g. filterGraphByDisease(...) & filterGraphByMGEGroup(...) is the subgraph
+// of filterGraphByMGEGroup(filterGraphByDisease(g, ...), ...). The entity
+// filters read the index and cost O(result); disease and timepoint filters test each edge.
+GraphView filterGraphByARGName(const GraphIndex& index, const std::string& argName);
+GraphView filterGraphByMGEName(const GraphIndex& index, const std::string& mgeName);
+GraphView filterGraphByMGEGroup(const GraphIndex& index, const std::string& groupName);
+GraphView filterGraphByTimepoint(const GraphIndex& index, const std::string& timepointCategory);
+GraphView filterGraphByARGAndMGENames(const GraphIndex& index, const std::string& argName, const std::string& mgeName);
+GraphView filterGraphByDisease(const GraphIndex& index, const std::string& disease, const std::map<int, std::string>& patientToDiseaseMap);
+
 #endif // GRAPH_UTILS_H
\ No newline at end of file
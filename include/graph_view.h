@@ -0,0 +1,120 @@
+// Released under the GNU GPLv3; see LICENSE for details.
+// Developed by Boucher Lab and Slizovskiy Lab.
+
+#ifndef GRAPH_VIEW_H
+#define GRAPH_VIEW_H
+
+#include <cstddef>
+#include <cstdint>
+#include <iterator>
+#include <vector>
+#include "bit_utils.h"
+#include "graph.h"
+#include "graph_index.h"
+
+// ------------------ GraphView ------------------
+// Subgraph of an indexed Graph as two bit masks over the GraphIndex dense ids, one for
+// nodes and one for edges. Nothing is copied: iterating a view yields references to the
+// base graph's Node and Edge objects, in Graph::nodes / Graph::edges order. Views of the
+// same index compose with & and |, which keep every selected edge's endpoints selected.
+// a & b is the slice both filters agree on: the colocalization edges of both views, their
+// endpoints, and the temporal edges of both views between those endpoints, i.e. what
+// chaining the filters over Graph copies gives. a | b is the union of the two subgraphs.
+// materialize() makes a standalone Graph copy when one is needed. A view is only valid
+// while its index and graph are.
+
+class GraphView {
+public:
+    // Walks the set bits of a mask and yields the corresponding element of items.
+    template <typename T>
+    class Range {
+    public:
+        class const_iterator {
+        public:
+            using iterator_category = std::forward_iterator_tag;
+            using value_type = T;
+            using difference_type = std::ptrdiff_t;
+            using pointer = const T*;
+            using reference = const T&;
+
+            const_iterator(const std::vector<std::uint64_t>* words, const std::vector<const T*>* items, size_t wordIndex)
+                : words_(words), items_(items), wordIndex_(wordIndex), remaining_(0) {
+                if (wordIndex_ < words_->size()) remaining_ = (*words_)[wordIndex_];
+                skipEmptyWords();
+            }
+
+            const T& operator*() const { return *(*items_)[wordIndex_ * 64 + countTrailingZeros64(remaining_)]; }
+            const T* operator->() const { return &**this; }
+
+            const_iterator& operator++() {
+                remaining_ &= remaining_ - 1;
+                skipEmptyWords();
+                return *this;
+            }
+
+            bool operator==(const const_iterator& other) const {
+                return wordIndex_ == other.wordIndex_ && remaining_ == other.remaining_;
+            }
+            bool operator!=(const const_iterator& other) const { return !(*this == other); }
+
+        private:
+            void skipEmptyWords() {
+                while (remaining_ == 0 && wordIndex_ < words_->size()) {
+                    if (++wordIndex_ < words_->size()) remaining_ = (*words_)[wordIndex_];
+                }
+            }
+
+            const std::vector<std::uint64_t>* words_;
+            const std::vector<const T*>* items_;
+            size_t wordIndex_;
+            std::uint64_t remaining_;
+        };
+
+        Range(const std::vector<std::uint64_t>& words, const std::vector<const T*>& items) : words_(&words), items_(&items) {}
+
+        const_iterator begin() const { return const_iterator(words_, items_, 0); }
+        const_iterator end() const { return const_iterator(words_, items_, words_->size()); }
+
+    private:
+        const std::vector<std::uint64_t>* words_;
+        const std::vector<const T*>* items_;
+    };
+
+    // Empty view of index's graph
+    explicit GraphView(const GraphIndex& index);
+
+    // The whole graph
+    static GraphView all(const GraphIndex& index);
+
+    const GraphIndex& index() const { return *index_; }
+
+    void selectNode(uint32_t nodeId) { nodeWords_[nodeId / 64] |= std::uint64_t{1} << (nodeId % 64); }
+    void selectEdge(uint32_t edgeId) { edgeWords_[edgeId / 64] |= std::uint64_t{1} << (edgeId % 64); }
+    bool hasNode(uint32_t nodeId) const { return (nodeWords_[nodeId / 64] >> (nodeId % 64)) & 1u; }
+    bool hasEdge(uint32_t edgeId) const { return (edgeWords_[edgeId / 64] >> (edgeId % 64)) & 1u; }
+
+    Range<Node> nodes() const { return Range<Node>(nodeWords_, index_->nodes); }
+    Range<Edge> edges() const { return Range<Edge>(edgeWords_, index_->edges); }
+    size_t nodeCount() const;
+    size_t edgeCount() const;
+    bool empty() const { return nodeCount() == 0; }
+
+    GraphView& operator&=(const GraphView& other);
+    GraphView& operator|=(const GraphView& other);
+
+    Graph materialize() const;
+
+private:
+    // Reselects the nodes from the selected colocalization edges and drops the temporal
+    // edges that no longer join two selected nodes.
+    void keepColocalizationEndpoints();
+
+    const GraphIndex* index_;
+    std::vector<std::uint64_t> nodeWords_;   // bit = dense node id
+    std::vector<std::uint64_t> edgeWords_;   // bit = dense edge id
+};
+
+inline GraphView operator&(GraphView a, const GraphView& b) { return a &= b; }
+inline GraphView operator|(GraphView a, const GraphView& b) { return a |= b; }
+
+#endif // GRAPH_VIEW_H
@@ -4,16 +4,11 @@
 #ifndef ID_MAPS_H
 #define ID_MAPS_H
 
-#include <unordered_map>
 #include <string>
+#include <string_view>
 
-extern const std::unordered_map<int, std::string> argIdMap;
-extern const std::unordered_map<int, std::string> mgeIdMap;
-extern const std::unordered_map<int, std::string> mgeNameMap;
-extern const std::unordered_map<int, std::string> argGroupMap;
-extern const std::unordered_map<int, bool> argIDSNPConfirmation;
-extern const std::unordered_map<int, std::string> argResistanceMap;
-extern const std::unordered_map<int, std::string> mgeGroupMap;
+// Name / id conveniences over entityCatalog() (see entity_catalog.h), which holds the
+// ARG and MGE reference tables.
 
 std::string getARGName(int id);
 std::string getMGEName(int id);
@@ -22,9 +17,9 @@ std::string getARGGroupName(int id);
 std::string getARGResistance(const std::string& name);
 std::string getMGEGroupName(int id);
 
-int getARGId(const std::string& name);
-int getMGEId(const std::string& name);
-int getMGEIdByName(const std::string& name);
-int getARGGroupId(const std::string& name);
+int getARGId(std::string_view name);
+int getMGEId(std::string_view name);
+int getMGEIdByName(std::string_view name);
+int getARGGroupId(std::string_view name);
 
 #endif
@@ -0,0 +1,34 @@
+// Released under the GNU GPLv3; see LICENSE for details.
+// Developed by Boucher Lab and Slizovskiy Lab.
+
+#ifndef INCREMENTAL_H
+#define INCREMENTAL_H
+
+#include <filesystem>
+#include <map>
+#include <set>
+#include <string>
+#include <tuple>
+#include "graph.h"
+#include "individual_timelines.h"
+#include "entity_catalog.h"
+
+// ------------------ Incremental cohort append ------------------
+// Adds a delta CSV (same layout as the input data, e.g. new patients or new timepoints of
+// existing patients) to an already built cohort instead of rebuilding it. Colocalization
+// edges and per-individual timelines only ever grow, so the delta's are merged in; the
+// temporal chains of the patients in the delta are taken out and rebuilt, since a new
+// timepoint can split an existing chain step. The result equals a full rebuild from the
+// base rows followed by the delta rows.
+
+struct CohortDelta {
+    PatientSet patients;               // patients with rows in the delta file
+    std::set<std::string> diseases;    // diseases whose per-disease outputs changed
+    std::set<CatalogCode> mgeGroups;   // MGE group codes whose per-group outputs changed
+};
+
+bool appendCohortDelta(const std::filesystem::path& deltaFile, Graph& graph, std::map<int, std::string>& patientToDiseaseMap,
+                       IndividualTimelines& colocalizationByIndividual,
+                       bool includeSNPConfirmationARGs, bool excludeMetals, CohortDelta& delta);
+
+#endif // INCREMENTAL_H
@@ -0,0 +1,87 @@
+// Released under the GNU GPLv3; see LICENSE for details.
+// Developed by Boucher Lab and Slizovskiy Lab.
+
+#ifndef INDIVIDUAL_TIMELINES_H
+#define INDIVIDUAL_TIMELINES_H
+
+#include <cstddef>
+#include <cstdint>
+#include <tuple>
+#include <utility>
+#include <vector>
+#include "Timepoint.h"
+
+// ------------------ IndividualTimelines ------------------
+// (patient, ARG, MGE) -> TimepointMask as one contiguous array sorted by key, i.e. the
+// iteration order of the std::map it replaces. Rows are added in batches: each batch is
+// sorted once, rows of the same key are OR-ed together and the result is merged into the
+// table. A patient's timelines are a contiguous slice; an ARG's timelines are reached
+// through a secondary index ordered by (ARG, MGE, patient).
+
+class IndividualTimelines {
+public:
+    using key_type = std::tuple<int, int, int>;          // (patient, ARG, MGE)
+    using value_type = std::pair<key_type, TimepointMask>;
+    using const_iterator = std::vector<value_type>::const_iterator;
+
+    // Contiguous run of rows, e.g. the timelines of one patient.
+    struct Range {
+        const_iterator first;
+        const_iterator last;
+
+        const_iterator begin() const { return first; }
+        const_iterator end() const { return last; }
+        size_t size() const { return static_cast<size_t>(last - first); }
+        bool empty() const { return first == last; }
+    };
+
+    // Merges rows (any order, repeated keys allowed) into the table.
+    void add(std::vector<value_type> rows);
+
+    void clear() {
+        rows_.clear();
+        argOrder_.clear();
+    }
+
+    size_t size() const { return rows_.size(); }
+    bool empty() const { return rows_.empty(); }
+    const_iterator begin() const { return rows_.begin(); }
+    const_iterator end() const { return rows_.end(); }
+    const value_type& operator[](size_t i) const { return rows_[i]; }
+
+    const_iterator find(const key_type& key) const;
+
+    // Timepoints of key, or 0 if there is no such timeline.
+    TimepointMask timepoints(const key_type& key) const {
+        const_iterator it = find(key);
+        return it != rows_.end() ? it->second : 0;
+    }
+
+    Range patientTimelines(int patientID) const;
+
+    // Calls fn(row) for every timeline of argID, in (MGE, patient) order.
+    template <typename Fn>
+    void forEachARGTimeline(int argID, Fn&& fn) const {
+        for (size_t i = argLowerBound(argID); i < argOrder_.size(); ++i) {
+            const value_type& row = rows_[argOrder_[i]];
+            if (std::get<1>(row.first) != argID) break;
+            fn(row);
+        }
+    }
+
+    // Bytes held by the table and its ARG index.
+    size_t memoryBytes() const {
+        return rows_.capacity() * sizeof(value_type) + argOrder_.capacity() * sizeof(std::uint32_t);
+    }
+
+    bool operator==(const IndividualTimelines& other) const { return rows_ == other.rows_; }
+    bool operator!=(const IndividualTimelines& other) const { return !(*this == other); }
+
+private:
+    size_t argLowerBound(int argID) const;
+
+    std::vector<value_type> rows_;          // sorted by key, keys unique
+    std::vector<std::uint32_t> argOrder_;   // row indices ordered by (ARG, MGE, patient)
+};
+
+#endif // INDIVIDUAL_TIMELINES_H
@@ -0,0 +1,64 @@
+// Released under the GNU GPLv3; see LICENSE for details.
+// Developed by Boucher Lab and Slizovskiy Lab.
+
+#ifndef JSON_WRITER_H
+#define JSON_WRITER_H
+
+#include <ostream>
+#include <string>
+#include <string_view>
+#include <vector>
+
+// ------------------ JsonWriter ------------------
+// Streaming JSON emitter: values go straight into an output buffer that is flushed to the
+// stream in large blocks, so no document tree is built. With indent >= 0 the layout is
+// byte-for-byte that of nlohmann::json::dump(indent); with indent < 0 it matches dump()
+// (compact). nlohmann objects sort their keys, so callers emit keys in sorted order to
+// reproduce its output.
+
+class JsonWriter {
+public:
+    explicit JsonWriter(std::ostream& out, int indent = 2);
+    ~JsonWriter();
+
+    JsonWriter(const JsonWriter&) = delete;
+    JsonWriter& operator=(const JsonWriter&) = delete;
+
+    void beginObject();
+    void endObject();
+    void beginArray();
+    void endArray();
+    void key(std::string_view name);
+
+    void value(std::string_view text);
+    void value(const char* text) { value(std::string_view(text)); }
+    void value(const std::string& text) { value(std::string_view(text)); }
+    void value(int number);
+    void value(bool flag);
+    void value(double number);
+
+    // key(name) followed by value(v)
+    template <typename T>
+    void field(std::string_view name, const T& v) {
+        key(name);
+        value(v);
+    }
+
+    // Writes any buffered output to the stream.
+    void flush();
+
+private:
+    void beforeValue();
+    void newline(size_t depth);
+    void open(char bracket);
+    void close(char bracket);
+    void raw(std::string_view text);
+
+    std::ostream& out_;
+    int indent_;
+    std::string buffer_;
+    std::vector<bool> hasElements_;   // one entry per open container
+    bool afterKey_ = false;
+};
+
+#endif // JSON_WRITER_H
@@ -7,6 +7,7 @@
 #include <string>
 #include <filesystem>
 #include <map> // Required for std::map
+#include <vector>
 #include "graph.h"
 
 namespace std {
@@ -19,9 +20,31 @@ namespace std {
 }
 
 
+// A node a patient's colocalizations touch, one per parsed cell endpoint (repeats allowed).
+// parseData can emit these so the temporal chains are built without rescanning the edges.
+struct PatientNode {
+    int patientID;
+    Node node;
+};
+using PatientNodes = std::vector<PatientNode>;
+
 // The signature of parseData is updated to include a map for patient-disease associations.
-void parseData(const std::filesystem::path& filename, Graph& graph, std::map<int, std::string>& patientToDiseaseMap, bool includeSNPConfirmationARGs, bool excludeMetals);
+// numThreads > 1 parses line-aligned chunks of the file concurrently; the result is identical to numThreads = 1.
+// patientNodes, when given, receives the (patient, node) pairs of every colocalization added.
+void parseData(const std::filesystem::path& filename, Graph& graph, std::map<int, std::string>& patientToDiseaseMap, bool includeSNPConfirmationARGs, bool excludeMetals, unsigned numThreads = 1,
+               PatientNodes* patientNodes = nullptr);
 void addEdge(Graph& graph, const Node& src, const Node& tgt, bool isColo, int patientID = -1);
 void addTemporalEdges(Graph& graph);
 
+// Same temporal edges from parseData's patient nodes. Patients are partitioned across
+// numThreads workers that build their chains and collect steps privately; the steps are
+// unioned into weight-1 edges, so the graph is the same for any thread count.
+void addTemporalEdges(Graph& graph, PatientNodes patientNodes, unsigned numThreads = 1);
+
+// Incremental updates: merge a separately parsed graph, and add or take back the temporal
+// chains of a subset of patients (steps other patients still take are kept).
+void mergeGraph(Graph& graph, const Graph& other);
+void addTemporalEdges(Graph& graph, const PatientSet& patients);
+void removeTemporalEdges(Graph& graph, const PatientSet& patients);
+
 #endif // PARSER_H
\ No newline at end of file
@@ -0,0 +1,156 @@
+// Released under the GNU GPLv3; see LICENSE for details.
+// Developed by Boucher Lab and Slizovskiy Lab.
+
+#ifndef PATIENT_SET_H
+#define PATIENT_SET_H
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <iterator>
+#include <vector>
+#include "bit_utils.h"
+
+// ------------------ PatientSet ------------------
+// Set of patient IDs stored as a bitset (bit i = patient i). Patient IDs are a small
+// dense range, so membership is a bit test and unions/intersections are word-wise
+// operations. Iteration yields IDs in ascending order, like the std::set<int> it
+// replaces. Negative IDs are not representable and are ignored by insert().
+
+// Largest patient ID the parser accepts: a set never needs more than 1024 words, and rows
+// with IDs outside [0, kMaxPatientID] are skipped with a warning instead of being dropped
+// from their edges or growing every bitset.
+constexpr int kMaxPatientID = 65535;
+
+class PatientSet {
+public:
+    class const_iterator {
+    public:
+        using iterator_category = std::forward_iterator_tag;
+        using value_type = int;
+        using difference_type = std::ptrdiff_t;
+        using pointer = const int*;
+        using reference = int;
+
+        const_iterator(const std::vector<std::uint64_t>* words, size_t wordIndex)
+            : words_(words), wordIndex_(wordIndex), remaining_(0) {
+            if (wordIndex_ < words_->size()) remaining_ = (*words_)[wordIndex_];
+            skipEmptyWords();
+        }
+
+        int operator*() const {
+            return static_cast<int>(wordIndex_ * 64) + countTrailingZeros64(remaining_);
+        }
+
+        const_iterator& operator++() {
+            remaining_ &= remaining_ - 1;
+            skipEmptyWords();
+            return *this;
+        }
+
+        const_iterator operator++(int) {
+            const_iterator previous = *this;
+            ++*this;
+            return previous;
+        }
+
+        bool operator==(const const_iterator& other) const {
+            return wordIndex_ == other.wordIndex_ && remaining_ == other.remaining_;
+        }
+        bool operator!=(const const_iterator& other) const { return !(*this == other); }
+
+    private:
+        void skipEmptyWords() {
+            while (remaining_ == 0 && wordIndex_ < words_->size()) {
+                if (++wordIndex_ < words_->size()) remaining_ = (*words_)[wordIndex_];
+            }
+        }
+
+        const std::vector<std::uint64_t>* words_;
+        size_t wordIndex_;
+        std::uint64_t remaining_;
+    };
+
+    PatientSet() = default;
+
+    // Adopts count raw bitset words (bit i = patient i), e.g. from a CSR or snapshot buffer.
+    PatientSet(const std::uint64_t* words, size_t count) : words_(words, words + count) {}
+
+    void insert(int patientID) {
+        if (patientID < 0) return;
+        size_t word = static_cast<size_t>(patientID) / 64;
+        if (word >= words_.size()) words_.resize(word + 1, 0);
+        words_[word] |= std::uint64_t{1} << (patientID % 64);
+    }
+
+    bool contains(int patientID) const {
+        size_t word = static_cast<size_t>(patientID) / 64;
+        if (patientID < 0 || word >= words_.size()) return false;
+        return (words_[word] >> (patientID % 64)) & 1u;
+    }
+
+    size_t count(int patientID) const { return contains(patientID) ? 1 : 0; }
+
+    size_t size() const {
+        size_t total = 0;
+        for (std::uint64_t w : words_) total += popcount64(w);
+        return total;
+    }
+
+    bool empty() const {
+        for (std::uint64_t w : words_) {
+            if (w) return false;
+        }
+        return true;
+    }
+
+    // Largest patient ID in the set, or -1 if empty.
+    int maxID() const {
+        for (size_t i = words_.size(); i-- > 0;) {
+            if (words_[i]) return static_cast<int>(i * 64) + highestBit64(words_[i]);
+        }
+        return -1;
+    }
+
+    PatientSet& operator|=(const PatientSet& other) {
+        if (other.words_.size() > words_.size()) words_.resize(other.words_.size(), 0);
+        for (size_t i = 0; i < other.words_.size(); ++i) words_[i] |= other.words_[i];
+        return *this;
+    }
+
+    bool intersects(const PatientSet& other) const {
+        size_t n = std::min(words_.size(), other.words_.size());
+        for (size_t i = 0; i < n; ++i) {
+            if (words_[i] & other.words_[i]) return true;
+        }
+        return false;
+    }
+
+    size_t intersectionCount(const PatientSet& other) const {
+        size_t n = std::min(words_.size(), other.words_.size());
+        size_t total = 0;
+        for (size_t i = 0; i < n; ++i) total += popcount64(words_[i] & other.words_[i]);
+        return total;
+    }
+
+    bool operator==(const PatientSet& other) const {
+        size_t n = std::max(words_.size(), other.words_.size());
+        for (size_t i = 0; i < n; ++i) {
+            std::uint64_t a = i < words_.size() ? words_[i] : 0;
+            std::uint64_t b = i < other.words_.size() ? other.words_[i] : 0;
+            if (a != b) return false;
+        }
+        return true;
+    }
+    bool operator!=(const PatientSet& other) const { return !(*this == other); }
+
+    const std::vector<std::uint64_t>& words() const { return words_; }
+
+    const_iterator begin() const { return const_iterator(&words_, 0); }
+    const_iterator end() const { return const_iterator(&words_, words_.size()); }
+
+private:
+    std::vector<std::uint64_t> words_;
+};
+
+#endif // PATIENT_SET_H
@@ -9,18 +9,21 @@
 #include <tuple>
 #include <set>
 #include "graph.h"
+#include "csr_graph.h"
 #include "Timepoint.h"
 #include "analysis.h"
 #include "id_maps.h"
+#include "entity_catalog.h"
 #include "config_loader.h"
 #include "traversal.h"
+#include "graph_utils.h"
+#include "thread_pool.h"
 #include <filesystem>
 #include <algorithm>
 #include <fstream>
 #include <iostream>
 #include <regex>
 
-std::string getMGEGroupName(int id);
 namespace fs = std::filesystem;
 fs::path temporal_dynamics_emerge;
 fs::path temporal_dynamics_disappear;
@@ -35,40 +38,39 @@ Config cfg = loadConfig("config/paths.json");
 
 
 bool isPostFMT(const Timepoint& tp) {
-    return toString(tp).find("post") != std::string::npos;
+    TimepointPhase phase = timepointPhase(tp);
+    return phase != TimepointPhase::Donor && phase != TimepointPhase::Pre;
 }
 
 bool isPreFMT(const Timepoint& tp) {
-    return toString(tp).find("pre") != std::string::npos;
+    return timepointPhase(tp) == TimepointPhase::Pre;
 }
 
 bool isDonor(const Timepoint& tp) {
-    return toString(tp).find("donor") != std::string::npos;
+    return timepointPhase(tp) == TimepointPhase::Donor;
 }
 
-static inline bool isPostBin1(Timepoint tp) { int v = static_cast<int>(tp); return v >= 1  && v <= 30; }
-static inline bool isPostBin2(Timepoint tp) { int v = static_cast<int>(tp); return v >= 31 && v <= 60; }
-static inline bool isPostBin3(Timepoint tp) { int v = static_cast<int>(tp); return v >= 61; }
-
-// In Post stages, highest bin wins if multiple present
-static inline int postBinOf(const std::set<Timepoint>& s) {
-    bool b1 = false, b2 = false, b3 = false;
-    for (auto tp : s) {
-        if (!b1 && isPostBin1(tp)) b1 = true;
-        else if (!b2 && isPostBin2(tp)) b2 = true;
-        else if (!b3 && isPostBin3(tp)) b3 = true;
-        if (b1 && b2 && b3) break;
-    }
-    if (b3) return 3; // post_3 (61+)
-    if (b2) return 2; // post_2 (31–60)
-    if (b1) return 1; // post_1 (1–30)
-    return 0;         // no post
+// Donor / pre / post flags and post bin of one timeline; each is a test against a phase mask.
+struct TimelinePhases {
+    bool donor;
+    bool pre;
+    bool post;
+    int postBin;
+};
+
+static inline TimelinePhases classifyTimeline(TimepointMask tps) {
+    return {hasDonor(tps), hasPreFMT(tps), hasPostFMT(tps), postBinOf(tps)};
+}
+
+// Whether a timeline has exactly the given donor / pre / post pattern
+static inline bool matchesPhases(TimepointMask tps, bool donorStatus, bool preFMTStatus, bool postFMTStatus) {
+    return hasDonor(tps) == donorStatus && hasPreFMT(tps) == preFMTStatus && hasPostFMT(tps) == postFMTStatus;
 }
 
 /********************************* Patientwise Colocalizations ********************************/
 void getPatientwiseColocalizationsByCriteria(
     const Graph& graph,
-    const std::map<std::tuple<int, int, int>, std::set<Timepoint>>& colocalizationByIndividual,
+    const IndividualTimelines& colocalizationByIndividual,
     bool donorStatus,
     bool preFMTStatus,
     bool postFMTStatus,
@@ -76,24 +78,16 @@ void getPatientwiseColocalizationsByCriteria(
     const std::string& csvFile,
     bool append
 ) {
-    std::map<std::tuple<int, int, int>, std::set<Timepoint>> filteredColocs;
+    std::vector<IndividualTimelines::value_type> matched;
 
     for (const auto& [tuple, tps] : colocalizationByIndividual) {
-        bool hasDonor = std::any_of(tps.begin(), tps.end(), [](const Timepoint& tp) {
-            return tp == Timepoint::Donor;
-        });
-        bool hasPreFMT = std::any_of(tps.begin(), tps.end(), [](const Timepoint& tp) {
-            return isPreFMT(tp);
-        });
-        bool hasPostFMT = std::any_of(tps.begin(), tps.end(), [](const Timepoint& tp) {
-            return isPostFMT(tp);
-        });
-
         // Match against provided pattern
-        if ((hasDonor == donorStatus) && (hasPreFMT == preFMTStatus) && (hasPostFMT == postFMTStatus)) {
-            filteredColocs.insert({tuple, tps});
+        if (matchesPhases(tps, donorStatus, preFMTStatus, postFMTStatus)) {
+            matched.push_back({tuple, tps});
         }
     }
+    IndividualTimelines filteredColocs;
+    filteredColocs.add(std::move(matched));
 
     std::cout << "Colocalizations (" << label << "): " << filteredColocs.size() << "\n";
     // getTopARGMGEPairsByFrequency(filteredColocs);
@@ -107,7 +101,7 @@ void getPatientwiseColocalizationsByCriteria(
 
 /********************************* Prominent Entities ********************************/
 void getTopARGMGEPairsByFrequency(
-    const std::map<std::tuple<int, int, int>, std::set<Timepoint>>& colocalizations,
+    const IndividualTimelines& colocalizations,
     int topN // default: print all
 ) {
     std::map<std::pair<int, int>, int> countMap;
@@ -134,13 +128,13 @@ void getTopARGMGEPairsByFrequency(
         int mgeID = pair.second;
 
         std::cout << "ARG: ";
-        if (argIdMap.count(argID))
+        if (entityCatalog().hasARG(argID))
             std::cout << getARGName(argID) << " (" << getARGGroupName(argID) << ")";
         else
             std::cout << "Unknown ARG ID " << argID;
 
         std::cout << ", MGE: ";
-        if (mgeIdMap.count(mgeID))
+        if (entityCatalog().hasMGE(mgeID))
             std::cout << getMGEName(mgeID);
         else
             std::cout << "Unknown MGE ID " << mgeID;
@@ -154,32 +148,45 @@ void getTopARGMGEPairsByFrequency(
 
 
 void getTopARGMGEPairsByFrequencyWODonor(
-    const std::map<std::tuple<int, int, int>, std::set<Timepoint>>& colocalizations,
+    const IndividualTimelines& colocalizations,
     int topN,
     const std::map<int, std::string>& patientToDiseaseMap, const std::string& top_colocalizations_output)
 {
-    std::map<std::pair<int, int>, int> countMap;
-    std::map<std::pair<int, int>, std::map<std::string, int>> diseaseCountMap;
-    std::set<std::string> diseaseSet;
-
+    // Patients per (ARG, MGE) pair; per-disease counts are popcounts against disease masks.
+    std::map<std::pair<int, int>, PatientSet> pairPatients;
     for (const auto& [tuple, tps] : colocalizations) {
         int patientID = std::get<0>(tuple);
         int argID     = std::get<1>(tuple);
         int mgeID     = std::get<2>(tuple);
 
-        bool hasNonDonor = std::any_of(tps.begin(), tps.end(),
-            [](const Timepoint& tp){ return tp != Timepoint::Donor; });
-        if (!hasNonDonor) continue;
+        if (!hasPreFMT(tps) && !hasPostFMT(tps)) continue;  // donor-only timeline
+
+        pairPatients[{argID, mgeID}].insert(patientID);
+    }
+
+    DiseaseMasks diseaseMasks = buildDiseaseMasks(patientToDiseaseMap);
+    PatientSet knownPatients;
+    for (const auto& [disease, mask] : diseaseMasks) knownPatients |= mask;
 
-        auto key = std::make_pair(argID, mgeID);
-        countMap[key]++;
+    std::map<std::pair<int, int>, int> countMap;
+    std::map<std::pair<int, int>, std::map<std::string, int>> diseaseCountMap;
+    std::set<std::string> diseaseSet;
 
-        std::string disease = "Unknown";
-        if (patientToDiseaseMap.count(patientID))
-            disease = patientToDiseaseMap.at(patientID);
+    for (const auto& [key, patients] : pairPatients) {
+        int total = static_cast<int>(patients.size());
+        countMap[key] = total;
 
-        diseaseCountMap[key][disease]++;
-        diseaseSet.insert(disease);
+        for (const auto& [disease, mask] : diseaseMasks) {
+            int c = static_cast<int>(patients.intersectionCount(mask));
+            if (c == 0) continue;
+            diseaseCountMap[key][disease] = c;
+            diseaseSet.insert(disease);
+        }
+        int unknown = total - static_cast<int>(patients.intersectionCount(knownPatients));
+        if (unknown > 0) {
+            diseaseCountMap[key]["Unknown"] = unknown;
+            diseaseSet.insert("Unknown");
+        }
     }
 
     // Sort diseases for consistent column order
@@ -229,7 +236,7 @@ void getTopARGMGEPairsByFrequencyWODonor(
 
 
 void mostProminentEntities(const Graph& g) {
-    std::map<std::tuple<int, int, int>, std::set<Timepoint>> colocalizationByIndividual;
+    IndividualTimelines colocalizationByIndividual;
     traverseGraph(g, colocalizationByIndividual);
 
 
@@ -283,7 +290,7 @@ void getConnectedMGEs(const Graph& graph, int argID) {
     std::cout << "ARG ID " << argID << " is connected to MGE IDs:\n";
     for (int mge : connectedMGEs) {
         std::cout << "  - MGE " << mge;
-        if (mgeIdMap.count(mge)) std::cout << " (" << mgeIdMap.at(mge) << ")";
+        if (entityCatalog().hasMGE(mge)) std::cout << " (" << entityCatalog().mgeName(mge) << ")";
         std::cout << "\n";
     }
 }
@@ -292,29 +299,20 @@ void getConnectedMGEs(const Graph& graph, int argID) {
 
 /***************************************** Write Functions *********************************************/
 
-/* Write temporal dynamics counts for a specific disease */
-void writeTemporalDynamicsCountsForDisease(
-    const std::string& disease,
-    std::map<std::tuple<int,int,int>,std::set<Timepoint>>& colocalizationByIndividual,
-    const std::map<int,std::string>& patientToDiseaseMap)
-{
-    std::map<std::tuple<int,int,int,int,int>,int> comboCounts;
-
-    for (auto& [key,tps] : colocalizationByIndividual) {
-        int patientID = std::get<0>(key);
-        if (!patientToDiseaseMap.count(patientID) ||
-            patientToDiseaseMap.at(patientID) != disease) continue;
-
-        int argID = std::get<1>(key);
-        int mgeID = std::get<2>(key);
+static std::string diseaseOutputFile(const std::string& disease) {
+    return "viz/output/disease_type/" + disease + ".csv";
+}
 
-        bool donor = std::any_of(tps.begin(),tps.end(),isDonor);
-        bool pre   = std::any_of(tps.begin(),tps.end(),isPreFMT);
-        int post   = postBinOf(tps);
+static std::string mgeGroupOutputFile(const std::string& group) {
+    // remove any filesystem-unfriendly characters not just beginning and end
+    std::string filename = std::regex_replace(group, std::regex(R"([\/\\:\*\?"<>|])"), "_");
+    return cfg.output_mge_group + "/" + filename + ".csv";
+}
 
-        comboCounts[{argID,mgeID,donor,pre,post}]++;
-    }
+// (ARG, MGE, donor, pre, post) -> number of patients
+using ComboCounts = std::map<std::tuple<int,int,int,int,int>,int>;
 
+static void writeComboCountsCSV(const std::string& filename, const ComboCounts& comboCounts) {
     std::vector<std::vector<std::string>> rows;
     for (auto& [k,cnt] : comboCounts) {
         int argID,mgeID,donor,pre,post;
@@ -330,83 +328,18 @@ void writeTemporalDynamicsCountsForDisease(
         });
     }
 
-    writeCSV("viz/output/disease_type/" + disease + ".csv",
+    writeCSV(filename,
         {"ARG_ID","MGE_ID","Donor","Pre","Post","PatientCount"},
         rows);
 }
 
-
-/* write a CSV for all diseases */
-void writeAllDiseasesTemporalDynamicsCounts(
-    std::map<std::tuple<int, int, int>, std::set<Timepoint>>& colocalizationByIndividual,
-    const std::map<int, std::string>& patientToDiseaseMap
-) {
-    std::set<std::string> diseases;
-    for (const auto& [pid, dz] : patientToDiseaseMap) diseases.insert(dz);
-    for (const auto& dz : diseases)
-        writeTemporalDynamicsCountsForDisease(dz, colocalizationByIndividual, patientToDiseaseMap);
-}
-
-
-/* Write temporal dynamics counts for a specific MGE group */
-void writeTemporalDynamicsCountsForMGEGroup(const std::map<std::tuple<int,int,int>,std::set<Timepoint>>& colocalizationByIndividual){
-    std::unordered_map<std::string,
-    std::map<std::tuple<int,int,int,int,int>,int>> groupedCounts;
-
-    for (auto& [key,tps] : colocalizationByIndividual) {
-        int argID = std::get<1>(key);
-        int mgeID = std::get<2>(key);
-        std::string group = getMGEGroupName(mgeID);
-
-        bool donor = std::any_of(tps.begin(),tps.end(),isDonor);
-        bool pre   = std::any_of(tps.begin(),tps.end(),isPreFMT);
-        bool post  = std::any_of(tps.begin(),tps.end(),isPostFMT);
-
-        groupedCounts[group][{argID,mgeID,donor,pre,post}]++;
-    }
-
-    for (auto& [group,comboCounts] : groupedCounts) {
-        std::vector<std::vector<std::string>> rows;
-        for (auto& [k,cnt] : comboCounts) {
-            int argID,mgeID,donor,pre,post;
-            std::tie(argID,mgeID,donor,pre,post)=k;
-
-            rows.push_back({
-                getARGName(argID),
-                getMGEName(mgeID),
-                std::to_string(donor),
-                std::to_string(pre),
-                std::to_string(post),
-                std::to_string(cnt)
-            });
-        }
-// remove any filesystem-unfriendly characters not just beginning and end
-        std::string filename = group;  // copy, modifiable
-        filename = std::regex_replace(filename,std::regex(R"([\/\\:\*\?"<>|])"), "_");
-
-        writeCSV(cfg.output_mge_group + "/"+ filename + ".csv",
-            {"ARG_ID","MGE_ID","Donor","Pre","Post","PatientCount"},
-            rows);
-    }
-
-}
-
-/* Write colocalizations to a CSV file */
-void writeColocalizationsToCSV(
-    const std::map<std::tuple<int,int,int>, std::set<Timepoint>>& colocs,
+/* Write per (ARG, MGE) patient counts to a CSV file */
+static void writeAggregatedColocalizationsCSV(
+    const std::map<std::pair<int,int>, PatientSet>& aggregated,
     const std::string& filename,
     const std::string& label,
     bool append)
 {
-    std::map<std::pair<int,int>, std::set<int>> aggregated;
-
-    for (const auto& [tuple,tps] : colocs) {
-        int argId = std::get<1>(tuple);
-        int mgeId = std::get<2>(tuple);
-        int patientId = std::get<0>(tuple);
-        aggregated[{argId,mgeId}].insert(patientId);
-    }
-
     std::vector<std::vector<std::string>> rows;
     for (auto& [pair,patients] : aggregated) {
         rows.push_back({
@@ -423,10 +356,29 @@ void writeColocalizationsToCSV(
         append);
 }
 
+/* Write colocalizations to a CSV file */
+void writeColocalizationsToCSV(
+    const IndividualTimelines& colocs,
+    const std::string& filename,
+    const std::string& label,
+    bool append)
+{
+    std::map<std::pair<int,int>, PatientSet> aggregated;
+
+    for (const auto& [tuple,tps] : colocs) {
+        int argId = std::get<1>(tuple);
+        int mgeId = std::get<2>(tuple);
+        int patientId = std::get<0>(tuple);
+        aggregated[{argId,mgeId}].insert(patientId);
+    }
+
+    writeAggregatedColocalizationsCSV(aggregated, filename, label, append);
+}
+
 
 /* Export colocalizations to seperate files based on temporal dynamics */
 void exportColocalizations(const Graph& g,
-    const std::map<std::tuple<int,int,int>, std::set<Timepoint>>& colocalizationByIndividual) 
+    const IndividualTimelines& colocalizationByIndividual) 
 {
     temporal_dynamics_emerge = fs::path(cfg.output_emerge);
     temporal_dynamics_transfer = fs::path(cfg.output_transfer);
@@ -455,10 +407,7 @@ void exportColocalizations(const Graph& g,
 
 
 /* Write graph node/edge counts to a CSV file */
-void writeGraphStatisticsCSV(
-    const Graph& g,
-    const std::unordered_map<Node,std::unordered_set<Node>>& adjacency,
-    const std::string& filename)
+static void writeGraphStatisticsRow(const Graph& g, size_t adjacencyNodes, const std::string& filename)
 {
     size_t total_nodes = g.nodes.size();
     size_t total_edges = g.edges.size();
@@ -476,10 +425,29 @@ void writeGraphStatisticsCSV(
             std::to_string(mge_count),
             std::to_string(colo_edges),
             std::to_string(temporal_edges),
-            std::to_string(adjacency.size())
+            std::to_string(adjacencyNodes)
         }});
 }
 
+void writeGraphStatisticsCSV(
+    const Graph& g,
+    const std::unordered_map<Node,std::unordered_set<Node>>& adjacency,
+    const std::string& filename)
+{
+    writeGraphStatisticsRow(g, adjacency.size(), filename);
+}
+
+/* Same statistics from the CSR snapshot; adjacency nodes are nodes with any outgoing neighbor */
+void writeGraphStatisticsCSV(const Graph& g, const CSRGraph& csr, const std::string& filename)
+{
+    size_t adjacencyNodes = 0;
+    for (size_t n = 0; n < csr.nodeCount(); ++n) {
+        if (csr.coloOffsets[n] != csr.coloOffsets[n + 1] || csr.temporalOffsets[n] != csr.temporalOffsets[n + 1])
+            adjacencyNodes++;
+    }
+    writeGraphStatisticsRow(g, adjacencyNodes, filename);
+}
+
 
 /* Generic CSV writing function */
 void writeCSV(
@@ -515,7 +483,7 @@ void writeCSV(
 void analyzeColocalizations(const Graph& g, 
                             const std::unordered_map<Node, std::unordered_set<Node>>& adjacency) {
 
-    std::map<std::tuple<int, int, int>, std::set<Timepoint>> colocalizationByIndividual;
+    IndividualTimelines colocalizationByIndividual;
     traverseGraph(g, colocalizationByIndividual);
 
     std::cout << "Patientwise Colocalization dynamics over time:\n";
@@ -536,7 +504,7 @@ void analyzeColocalizations(const Graph& g,
 
 void analyzeColocalizationsCollectively(const Graph& g, 
                                          const std::unordered_map<Node, std::unordered_set<Node>>& adjacency) {
-    std::map<std::tuple<int, int, int>, std::set<Timepoint>> colocalizationByIndividual;
+    IndividualTimelines colocalizationByIndividual;
     traverseGraph(g, colocalizationByIndividual);
     std::map<std::pair<int, int>, std::set<int>> globalPairToPatients;
     std::cout << "Colocalization dynamics over time:\n";
@@ -558,30 +526,24 @@ void analyzeColocalizationsCollectively(const Graph& g,
 
 
 void getColocalizationsByCriteria(
-    const std::map<std::tuple<int, int, int>, std::set<Timepoint>>& colocalizationByIndividual,
+    const IndividualTimelines& colocalizationByIndividual,
     bool donorStatus,
     bool preFMTStatus,
     bool postFMTStatus,
     std::map<std::pair<int, int>, std::set<int>>& globalPairToPatients
 ) {
     // Step 1: Determine globally valid (ARG, MGE) pairs
-    std::map<std::pair<int, int>, std::set<Timepoint>> globalTimepoints;
+    std::map<std::pair<int, int>, TimepointMask> globalTimepoints;
 
     for (const auto& [tuple, tps] : colocalizationByIndividual) {
         int argID = std::get<1>(tuple);
         int mgeID = std::get<2>(tuple);
-        globalTimepoints[{argID, mgeID}].insert(tps.begin(), tps.end());
+        globalTimepoints[{argID, mgeID}] |= tps;
     }
 
     std::set<std::pair<int, int>> validPairs;
     for (const auto& [pair, tps] : globalTimepoints) {
-        bool hasDonor   = std::any_of(tps.begin(), tps.end(), [](const Timepoint& tp){ return isDonor(tp); });
-        bool hasPreFMT  = std::any_of(tps.begin(), tps.end(), [](const Timepoint& tp){ return isPreFMT(tp); });
-        bool hasPostFMT = std::any_of(tps.begin(), tps.end(), [](const Timepoint& tp){ return isPostFMT(tp); });
-
-        if (hasDonor == donorStatus &&
-            hasPreFMT == preFMTStatus &&
-            hasPostFMT == postFMTStatus) {
+        if (matchesPhases(tps, donorStatus, preFMTStatus, postFMTStatus)) {
             validPairs.insert(pair);
         }
     }
@@ -595,13 +557,7 @@ void getColocalizationsByCriteria(
 
         if (!validPairs.count(pair)) continue;
 
-        bool hasDonor   = std::any_of(tps.begin(), tps.end(), [](const Timepoint& tp) { return isDonor(tp); });
-        bool hasPreFMT  = std::any_of(tps.begin(), tps.end(), [](const Timepoint& tp) { return isPreFMT(tp); });
-        bool hasPostFMT = std::any_of(tps.begin(), tps.end(), [](const Timepoint& tp) { return isPostFMT(tp); });
-
-        if (hasDonor == donorStatus &&
-            hasPreFMT == preFMTStatus &&
-            hasPostFMT == postFMTStatus) {
+        if (matchesPhases(tps, donorStatus, preFMTStatus, postFMTStatus)) {
             globalPairToPatients[pair].insert(patientID);
         }
     }
@@ -632,11 +588,11 @@ void getTopARGMGEPairsByUniquePatients(
         int mgeID = pair.second;
 
         std::cout << "ARG: ";
-        if (argIdMap.count(argID)) std::cout << getARGName(argID) << " (" << getARGGroupName(argID) << ")";
+        if (entityCatalog().hasARG(argID)) std::cout << getARGName(argID) << " (" << getARGGroupName(argID) << ")";
         else std::cout << "Unknown ARG ID " << argID;
 
         std::cout << ", MGE: ";
-        if (mgeIdMap.count(mgeID)) std::cout << getMGEName(mgeID);
+        if (entityCatalog().hasMGE(mgeID)) std::cout << getMGEName(mgeID);
         else std::cout << "Unknown MGE ID " << mgeID;
 
         std::cout << ",Patients: " << count << "\n";
@@ -645,8 +601,15 @@ void getTopARGMGEPairsByUniquePatients(
     // std::cout << "Total unique colocalizations: " << freqList.size() << "\n";
 }
 
-void writeDetailedCSV(
-    const std::map<std::tuple<int, int, int>, std::set<Timepoint>>& colocs,
+// Detailed rows are written from a timeline map or from a list of its keys.
+static const std::tuple<int, int, int>& timelineKey(const std::tuple<int, int, int>& key) { return key; }
+static const std::tuple<int, int, int>& timelineKey(const IndividualTimelines::value_type& entry) {
+    return entry.first;
+}
+
+template <typename Timelines>
+static void writeDetailedRows(
+    const Timelines& colocs,
     const std::string& filename,
     const std::string& label,
     bool append
@@ -659,19 +622,15 @@ void writeDetailedCSV(
         file << "ARG_Name,MGE_Name,Patient_ID,Label\n"; 
     }
 
-    for (const auto& [tuple, tps] : colocs) {
+    const EntityCatalog& catalog = entityCatalog();
+    for (const auto& entry : colocs) {
+        const std::tuple<int, int, int>& tuple = timelineKey(entry);
         int patientId = std::get<0>(tuple);
         int argId     = std::get<1>(tuple);
         int mgeId     = std::get<2>(tuple);
 
-        std::string argName = getARGName(argId);
-        std::string mgeName = getMGEName(mgeId);
-
-        if (argName.empty()) argName = "Unknown_ARG_" + std::to_string(argId);
-        if (mgeName.empty()) mgeName = "Unknown_MGE_" + std::to_string(mgeId);
-
-        file << argName << ","
-             << mgeName << ","
+        file << catalog.argName(argId) << ","
+             << catalog.mgeName(mgeId) << ","
              << patientId << "," 
              << label << "\n";
     }
@@ -679,8 +638,17 @@ void writeDetailedCSV(
     std::cout << "Detailed list written to " << filename << "\n";
 }
 
+void writeDetailedCSV(
+    const IndividualTimelines& colocs,
+    const std::string& filename,
+    const std::string& label,
+    bool append
+) {
+    writeDetailedRows(colocs, filename, label, append);
+}
+
 void getDetailedColocalizationsByCriteria(
-    const std::map<std::tuple<int, int, int>, std::set<Timepoint>>& colocalizationByIndividual,
+    const IndividualTimelines& colocalizationByIndividual,
     bool donorStatus,
     bool preFMTStatus,
     bool postFMTStatus,
@@ -688,39 +656,32 @@ void getDetailedColocalizationsByCriteria(
     const std::string& csvFile,
     bool append
 ) {
-    std::map<std::tuple<int, int, int>, std::set<Timepoint>> filteredColocs;
+    std::vector<IndividualTimelines::value_type> matched;
 
     for (const auto& [tuple, tps] : colocalizationByIndividual) {
-        bool hasDonor = std::any_of(tps.begin(), tps.end(), [](const Timepoint& tp) {
-            return tp == Timepoint::Donor;
-        });
-        bool hasPreFMT = std::any_of(tps.begin(), tps.end(), [](const Timepoint& tp) {
-            return isPreFMT(tp);
-        });
-        bool hasPostFMT = std::any_of(tps.begin(), tps.end(), [](const Timepoint& tp) {
-            return isPostFMT(tp);
-        });
-
-        if ((hasDonor == donorStatus) && (hasPreFMT == preFMTStatus) && (hasPostFMT == postFMTStatus)) {
-            filteredColocs.insert({tuple, tps});
+        if (matchesPhases(tps, donorStatus, preFMTStatus, postFMTStatus)) {
+            matched.push_back({tuple, tps});
         }
     }
+    IndividualTimelines filteredColocs;
+    filteredColocs.add(std::move(matched));
 
     if (!csvFile.empty()) {
         writeDetailedCSV(filteredColocs, csvFile, label, append);
     }
 }
 
+static std::string makeDetailedPath(const fs::path& p) {
+    std::string s = p.string();
+    size_t dot = s.find_last_of('.');
+    if(dot != std::string::npos) s.insert(dot, "_detailed");
+    else s += "_detailed";
+    return s;
+}
+
 void exportDetailedTemporalDynamics(
-    const std::map<std::tuple<int,int,int>, std::set<Timepoint>>& colocalizationByIndividual) 
+    const IndividualTimelines& colocalizationByIndividual) 
 {
-    auto makeDetailedPath = [](fs::path p) {
-        std::string s = p.string();
-        size_t dot = s.find_last_of('.');
-        if(dot != std::string::npos) s.insert(dot, "_detailed");
-        else s += "_detailed";
-        return s;
-    };
 
     // Emerge
     getDetailedColocalizationsByCriteria(colocalizationByIndividual,
@@ -746,4 +707,112 @@ void exportDetailedTemporalDynamics(
 }
 
 
+/* Fused temporal-dynamics export: one sweep over colocalizationByIndividual classifies every
+   timeline once and feeds the emerge/disappear/transfer/persist CSVs (summary and detailed),
+   the per-disease CSVs (viz/output/disease_type) and the per-MGE-group CSVs. The transition
+   CSVs and console output match exportColocalizations. diseases / mgeGroups restrict the per-disease and
+   per-group files to the listed diseases and MGE group codes (null writes all); a listed
+   disease that no longer has patients loses its file. */
+void exportTemporalDynamics(
+    const IndividualTimelines& colocalizationByIndividual,
+    const std::map<int, std::string>& patientToDiseaseMap,
+    const std::set<std::string>* diseases,
+    const std::set<CatalogCode>* mgeGroups)
+{
+    struct TransitionSink {
+        bool donor, pre, post;
+        std::string label;
+        std::string file;
+        bool append;
+        std::map<std::pair<int,int>, PatientSet> patientsByPair;
+        std::vector<std::tuple<int,int,int>> timelines;
+    };
+    // Same order, labels and append flags as exportColocalizations / exportDetailedTemporalDynamics
+    TransitionSink sinks[] = {
+        {false, false, true, "PostFMT Only",            cfg.output_emerge,    false, {}, {}},
+        {false, true,  false, "PreFMT Only",            cfg.output_disappear, false, {}, {}},
+        {true,  true,  false, "Donor & PreFMT Only",    cfg.output_disappear, true,  {}, {}},
+        {true,  false, true, "Donor & PostFMT Only",    cfg.output_transfer,  true,  {}, {}},
+        {false, true,  true, "PreFMT & PostFMT Only",   cfg.output_persist,   false, {}, {}},
+        {true,  true,  true, "PreFMT, Donor & PostFMT", cfg.output_persist,   true,  {}, {}},
+    };
+    int sinkOf[8] = {-1, -1, -1, -1, -1, -1, -1, -1};  // indexed by donor<<2 | pre<<1 | post
+    for (int i = 0; i < static_cast<int>(std::size(sinks)); ++i) {
+        sinkOf[sinks[i].donor << 2 | sinks[i].pre << 1 | sinks[i].post] = i;
+    }
+
+    // Diseases in name order; patients map to the index of their disease
+    std::set<std::string> diseaseSet;
+    for (const auto& [pid, dz] : patientToDiseaseMap) diseaseSet.insert(dz);
+    std::vector<std::string> diseaseNames;
+    std::map<std::string, int> diseaseIndex;
+    for (const auto& dz : diseaseSet) {
+        if (diseases && !diseases->count(dz)) continue;
+        diseaseIndex[dz] = static_cast<int>(diseaseNames.size());
+        diseaseNames.push_back(dz);
+    }
+    std::unordered_map<int, int> diseaseOfPatient;
+    for (const auto& [pid, dz] : patientToDiseaseMap) {
+        auto it = diseaseIndex.find(dz);
+        if (it != diseaseIndex.end()) diseaseOfPatient[pid] = it->second;
+    }
+    std::vector<ComboCounts> diseaseCounts(diseaseNames.size());
+
+    // Per-group counts indexed by MGE group code; the last slot holds MGEs without a group
+    const EntityCatalog& catalog = entityCatalog();
+    const size_t groupSlots = catalog.mgeGroupNames.size() + 1;
+    auto groupSlot = [&](CatalogCode group) { return std::min<size_t>(group, groupSlots - 1); };
+    std::vector<ComboCounts> groupCounts(groupSlots);
+    std::vector<bool> groupWritten(groupSlots, mgeGroups == nullptr);
+    if (mgeGroups) {
+        for (CatalogCode group : *mgeGroups) groupWritten[groupSlot(group)] = true;
+    }
+
+    for (const auto& [key, tps] : colocalizationByIndividual) {
+        auto [patientID, argID, mgeID] = key;
+        TimelinePhases phases = classifyTimeline(tps);
+
+        int sink = sinkOf[phases.donor << 2 | phases.pre << 1 | phases.post];
+        if (sink >= 0) {
+            sinks[sink].patientsByPair[{argID, mgeID}].insert(patientID);
+            sinks[sink].timelines.push_back(key);
+        }
+
+        auto disease = diseaseOfPatient.find(patientID);
+        if (disease != diseaseOfPatient.end()) {
+            diseaseCounts[disease->second][{argID, mgeID, phases.donor, phases.pre, phases.postBin}]++;
+        }
+
+        size_t group = groupSlot(catalog.mgeGroup(mgeID));
+        if (groupWritten[group]) groupCounts[group][{argID, mgeID, phases.donor, phases.pre, phases.post}]++;
+    }
+
+    // Per-disease and per-group files are independent, so they are written by pool tasks
+    // while this thread writes the transition CSVs, which share files and console output.
+    ThreadPool pool;
+    std::vector<std::future<void>> tasks;
+    for (size_t i = 0; i < diseaseNames.size(); ++i) {
+        tasks.push_back(pool.submit([&, i] { writeComboCountsCSV(diseaseOutputFile(diseaseNames[i]), diseaseCounts[i]); }));
+    }
+    for (size_t i = 0; i < groupSlots; ++i) {
+        if (groupCounts[i].empty()) continue;
+        std::string group(catalog.mgeGroupName(static_cast<CatalogCode>(i)));
+        tasks.push_back(pool.submit([&, i, group] { writeComboCountsCSV(mgeGroupOutputFile(group), groupCounts[i]); }));
+    }
+
+    for (const auto& sink : sinks) {
+        std::cout << "Colocalizations (" << sink.label << "): " << sink.timelines.size() << "\n";
+        writeAggregatedColocalizationsCSV(sink.patientsByPair, sink.file, sink.label, sink.append);
+    }
+    for (const auto& sink : sinks) {
+        writeDetailedRows(sink.timelines, makeDetailedPath(sink.file), sink.label, sink.append);
+    }
+    std::cout << "\n[SUCCESS] Detailed datasets with Patient IDs have been generated.\n";
 
+    if (diseases) {
+        for (const auto& dz : *diseases) {
+            if (!diseaseSet.count(dz)) fs::remove(diseaseOutputFile(dz));
+        }
+    }
+    waitAll(tasks);
+}
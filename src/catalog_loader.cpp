@@ -0,0 +1,353 @@
+// Released under the GNU GPLv3; see LICENSE for details.
+// Developed by Boucher Lab and Slizovskiy Lab.
+
+#include "../include/catalog_loader.h"
+#include "../include/csv_reader.h"
+#include <algorithm>
+#include <cstring>
+#include <fstream>
+#include <iostream>
+#include <memory>
+#include <mutex>
+#include <type_traits>
+#include <unordered_map>
+#include <vector>
+
+/* Load the entity catalog from TSV tables, with a binary cache of the derived columns */
+
+namespace {
+
+// Bump whenever a record layout, the column list or the meaning of a field changes.
+constexpr std::uint32_t kCatalogCacheVersion = 2;
+constexpr char kCatalogCacheMagic[8] = {'C', 'O', 'N', 'E', 'T', 'C', 'A', 'T'};
+constexpr std::uint32_t kByteOrderMark = 0x01020304;
+constexpr size_t kColumnCount = 17;
+
+// Calls fn on every column of data, in file order.
+template <typename Data, typename Fn>
+void forEachColumn(Data& data, Fn&& fn) {
+    fn(data.argIds);
+    fn(data.argNames);
+    fn(data.argGroups);
+    fn(data.argResistances);
+    fn(data.argRequiresSNP);
+    fn(data.argGroupNames);
+    fn(data.resistanceNames);
+    fn(data.mgeIds);
+    fn(data.mgeNames);
+    fn(data.mgeLabels);
+    fn(data.mgeGroups);
+    fn(data.mgeGroupNames);
+    fn(data.argIndexById);
+    fn(data.mgeIndexById);
+    fn(data.argsByName);
+    fn(data.mgesByName);
+    fn(data.mgesByLabel);
+}
+
+// File layout: header, the canonical paths of the two tables, the string pool, then one
+// section per column in forEachColumn order, each padded to a multiple of 8 bytes. Numeric columns are stored as is, string columns
+// as StringRecords and reverse indexes as NameRecords into the pool.
+struct CatalogCacheHeader {
+    char magic[8];
+    std::uint32_t version;
+    std::uint32_t byteOrder;
+    std::uint64_t argsSize;
+    std::int64_t argsModified;
+    std::uint64_t mgesSize;
+    std::int64_t mgesModified;
+    std::uint32_t argsPathBytes;
+    std::uint32_t mgesPathBytes;
+    std::uint64_t stringBytes;
+    std::uint64_t columnCounts[kColumnCount];
+};
+
+struct StringRecord {
+    std::uint32_t offset;
+    std::uint32_t length;
+};
+
+struct NameRecord {
+    std::uint32_t offset;
+    std::uint32_t length;
+    std::int32_t id;
+    std::uint32_t reserved;
+};
+
+static_assert(sizeof(CatalogCacheHeader) == 200 && sizeof(StringRecord) == 8 && sizeof(NameRecord) == 16,
+              "catalog cache records must not contain padding");
+static_assert(std::is_trivially_copyable_v<CatalogCacheHeader>, "catalog cache records are copied as raw bytes");
+
+size_t padded(size_t bytes) { return (bytes + 7) & ~size_t{7}; }
+
+// Bytes per stored element of a column
+template <typename T>
+constexpr size_t recordSize() {
+    if constexpr (std::is_same_v<T, std::string_view>) return sizeof(StringRecord);
+    else if constexpr (std::is_same_v<T, CatalogNameEntry>) return sizeof(NameRecord);
+    else return sizeof(T);
+}
+
+struct SourceStamp {
+    std::uint64_t size = 0;
+    std::int64_t modified = 0;
+};
+
+bool stampSource(const std::filesystem::path& file, SourceStamp& stamp) {
+    std::error_code ec;
+    stamp.size = std::filesystem::file_size(file, ec);
+    if (ec) return false;
+    auto modified = std::filesystem::last_write_time(file, ec);
+    if (ec) return false;
+    stamp.modified = static_cast<std::int64_t>(modified.time_since_epoch().count());
+    return true;
+}
+
+// The path a cache records for a table, so one cache file is never reused for other tables
+// that happen to have the same size and modification time.
+std::string sourcePath(const std::filesystem::path& file) {
+    std::error_code ec;
+    std::filesystem::path canonical = std::filesystem::weakly_canonical(file, ec);
+    return (ec ? std::filesystem::absolute(file, ec) : canonical).string();
+}
+
+// Collects the string pool and the encoded column sections.
+class CacheWriter {
+public:
+    template <typename T>
+    void operator()(const std::vector<T>& column) {
+        std::vector<char>& section = sections_.emplace_back();
+        counts_.push_back(column.size());
+        section.resize(column.size() * recordSize<T>());
+        char* out = section.data();
+        for (const T& value : column) {
+            if constexpr (std::is_same_v<T, std::string_view>) {
+                StringRecord record = intern(value);
+                std::memcpy(out, &record, sizeof(record));
+            } else if constexpr (std::is_same_v<T, CatalogNameEntry>) {
+                StringRecord name = intern(value.name);
+                NameRecord record = {name.offset, name.length, value.id, 0};
+                std::memcpy(out, &record, sizeof(record));
+            } else {
+                std::memcpy(out, &value, sizeof(value));
+            }
+            out += recordSize<T>();
+        }
+    }
+
+    const std::vector<char>& pool() const { return pool_; }
+    const std::vector<std::vector<char>>& sections() const { return sections_; }
+    const std::vector<std::uint64_t>& counts() const { return counts_; }
+
+private:
+    StringRecord intern(std::string_view text) {
+        auto [it, inserted] = offsets_.emplace(text, static_cast<std::uint32_t>(pool_.size()));
+        if (inserted) pool_.insert(pool_.end(), text.begin(), text.end());
+        return {it->second, static_cast<std::uint32_t>(text.size())};
+    }
+
+    std::vector<char> pool_;
+    std::unordered_map<std::string_view, std::uint32_t> offsets_;
+    std::vector<std::vector<char>> sections_;
+    std::vector<std::uint64_t> counts_;
+};
+
+// Decodes the column sections into data, whose stringPool already holds the pool.
+class CacheReader {
+public:
+    CacheReader(const char* cursor, const std::uint64_t* counts) : cursor_(cursor), counts_(counts) {}
+
+    template <typename T>
+    void operator()(std::vector<T>& column) {
+        size_t count = counts_[index_++];
+        const char* in = cursor_;
+        cursor_ += padded(count * recordSize<T>());
+        column.clear();
+        column.reserve(count);
+        for (size_t i = 0; i < count; ++i, in += recordSize<T>()) {
+            if constexpr (std::is_same_v<T, std::string_view>) {
+                StringRecord record;
+                std::memcpy(&record, in, sizeof(record));
+                column.push_back(view(record.offset, record.length));
+            } else if constexpr (std::is_same_v<T, CatalogNameEntry>) {
+                NameRecord record;
+                std::memcpy(&record, in, sizeof(record));
+                column.push_back({view(record.offset, record.length), record.id});
+            } else {
+                T value;
+                std::memcpy(&value, in, sizeof(value));
+                column.push_back(value);
+            }
+        }
+    }
+
+    void setPool(std::string_view pool) { pool_ = pool; }
+    bool ok() const { return ok_; }
+
+private:
+    std::string_view view(std::uint32_t offset, std::uint32_t length) {
+        if (std::uint64_t{offset} + length > pool_.size()) {
+            ok_ = false;
+            return {};
+        }
+        return pool_.substr(offset, length);
+    }
+
+    const char* cursor_;
+    const std::uint64_t* counts_;
+    size_t index_ = 0;
+    std::string_view pool_;
+    bool ok_ = true;
+};
+
+// Structural checks on restored columns, so a damaged cache cannot cause out-of-range lookups.
+bool consistent(const CatalogData& data) {
+    auto codesWithin = [](const std::vector<CatalogCode>& codes, size_t names) {
+        return std::all_of(codes.begin(), codes.end(), [names](CatalogCode code) { return code == kNoCatalogCode || code < names; });
+    };
+    auto indexesWithin = [](const std::vector<std::int32_t>& index, size_t entities) {
+        return std::all_of(index.begin(), index.end(), [entities](std::int32_t i) { return i >= -1 && i < static_cast<std::int64_t>(entities); });
+    };
+    const size_t args = data.argIds.size();
+    const size_t mges = data.mgeIds.size();
+    return data.argNames.size() == args && data.argGroups.size() == args && data.argResistances.size() == args &&
+           data.argRequiresSNP.size() == args && data.mgeNames.size() == mges && data.mgeLabels.size() == mges &&
+           data.mgeGroups.size() == mges && codesWithin(data.argGroups, data.argGroupNames.size()) &&
+           codesWithin(data.argResistances, data.resistanceNames.size()) && codesWithin(data.mgeGroups, data.mgeGroupNames.size()) &&
+           indexesWithin(data.argIndexById, args) && indexesWithin(data.mgeIndexById, mges);
+}
+
+} // namespace
+
+bool saveCatalogCache(const std::filesystem::path& cacheFile, const CatalogSource& source, const CatalogData& data) {
+    SourceStamp args, mges;
+    if (!stampSource(source.argsFile, args) || !stampSource(source.mgesFile, mges)) {
+        std::cerr << "Warning: Not writing catalog cache, cannot stat the catalog tables" << std::endl;
+        return false;
+    }
+
+    CacheWriter writer;
+    forEachColumn(data, writer);
+
+    CatalogCacheHeader header = {};
+    std::memcpy(header.magic, kCatalogCacheMagic, sizeof(kCatalogCacheMagic));
+    header.version = kCatalogCacheVersion;
+    header.byteOrder = kByteOrderMark;
+    header.argsSize = args.size;
+    header.argsModified = args.modified;
+    header.mgesSize = mges.size;
+    header.mgesModified = mges.modified;
+    std::string paths = sourcePath(source.argsFile);
+    header.argsPathBytes = static_cast<std::uint32_t>(paths.size());
+    paths += sourcePath(source.mgesFile);
+    header.mgesPathBytes = static_cast<std::uint32_t>(paths.size() - header.argsPathBytes);
+    header.stringBytes = writer.pool().size();
+    std::copy(writer.counts().begin(), writer.counts().end(), header.columnCounts);
+
+    // Write next to the target and rename, so a reader never sees a half-written file.
+    static const char zeros[8] = {};
+    auto writeSection = [](std::ofstream& out, const std::vector<char>& bytes) {
+        out.write(bytes.data(), static_cast<std::streamsize>(bytes.size()));
+        out.write(zeros, static_cast<std::streamsize>(padded(bytes.size()) - bytes.size()));
+    };
+    std::error_code ec;
+    if (cacheFile.has_parent_path()) std::filesystem::create_directories(cacheFile.parent_path(), ec);
+    std::filesystem::path partial = cacheFile;
+    partial += ".tmp";
+    {
+        std::ofstream out(partial, std::ios::binary | std::ios::trunc);
+        out.write(reinterpret_cast<const char*>(&header), sizeof(header));
+        writeSection(out, std::vector<char>(paths.begin(), paths.end()));
+        writeSection(out, writer.pool());
+        for (const auto& section : writer.sections()) writeSection(out, section);
+        if (!out) {
+            std::cerr << "Warning: Could not write catalog cache: " << partial << std::endl;
+            return false;
+        }
+    }
+    std::filesystem::rename(partial, cacheFile, ec);
+    if (ec) {
+        std::cerr << "Warning: Could not write catalog cache: " << cacheFile << std::endl;
+        return false;
+    }
+    return true;
+}
+
+bool loadCatalogCache(const std::filesystem::path& cacheFile, const CatalogSource& source, CatalogData& data) {
+    std::string file;
+    if (!readFileToBuffer(cacheFile, file) || file.size() < sizeof(CatalogCacheHeader)) return false;
+
+    CatalogCacheHeader header;
+    std::memcpy(&header, file.data(), sizeof(header));
+    if (std::memcmp(header.magic, kCatalogCacheMagic, sizeof(kCatalogCacheMagic)) != 0 ||
+        header.version != kCatalogCacheVersion || header.byteOrder != kByteOrderMark) {
+        return false;
+    }
+
+    SourceStamp args, mges;
+    if (!stampSource(source.argsFile, args) || !stampSource(source.mgesFile, mges) ||
+        args.size != header.argsSize || args.modified != header.argsModified ||
+        mges.size != header.mgesSize || mges.modified != header.mgesModified) {
+        return false;
+    }
+
+    const size_t pathBytes = padded(std::uint64_t{header.argsPathBytes} + header.mgesPathBytes);
+    size_t expected = sizeof(CatalogCacheHeader) + pathBytes + padded(header.stringBytes);
+    size_t column = 0;
+    forEachColumn(data, [&](const auto& values) {
+        using T = typename std::decay_t<decltype(values)>::value_type;
+        expected += padded(header.columnCounts[column++] * recordSize<T>());
+    });
+    if (file.size() != expected) {
+        std::cerr << "Warning: Ignoring truncated catalog cache: " << cacheFile << std::endl;
+        return false;
+    }
+
+    const char* paths = file.data() + sizeof(CatalogCacheHeader);
+    if (std::string_view(paths, header.argsPathBytes) != sourcePath(source.argsFile) ||
+        std::string_view(paths + header.argsPathBytes, header.mgesPathBytes) != sourcePath(source.mgesFile)) {
+        return false;
+    }
+
+    const char* pool = paths + pathBytes;
+    data.tables = CatalogTables{};
+    data.stringPool.assign(pool, header.stringBytes);
+    CacheReader reader(pool + padded(header.stringBytes), header.columnCounts);
+    reader.setPool(data.stringPool);
+    forEachColumn(data, reader);
+    if (!reader.ok() || !consistent(data)) {
+        std::cerr << "Warning: Ignoring corrupt catalog cache: " << cacheFile << std::endl;
+        buildCatalogData(CatalogTables{}, data);
+        return false;
+    }
+    return true;
+}
+
+bool loadCatalogData(const CatalogSource& source, CatalogData& data) {
+    if (!source.cacheFile.empty() && loadCatalogCache(source.cacheFile, source, data)) return true;
+
+    CatalogTables tables;
+    if (!readCatalogTables(source.argsFile, source.mgesFile, tables)) return false;
+    buildCatalogData(std::move(tables), data);
+    if (!source.cacheFile.empty()) saveCatalogCache(source.cacheFile, source, data);
+    return true;
+}
+
+bool loadEntityCatalog(const CatalogSource& source) {
+    struct LoadedCatalog {
+        CatalogData data;
+        EntityCatalog view;
+    };
+    // Every catalog ever installed is kept, since callers may still hold views into it.
+    static std::mutex mutex;
+    static std::vector<std::unique_ptr<LoadedCatalog>> loaded;
+
+    auto catalog = std::make_unique<LoadedCatalog>();
+    if (!loadCatalogData(source, catalog->data)) return false;
+    catalog->view = catalog->data.view();
+
+    std::lock_guard<std::mutex> lock(mutex);
+    setEntityCatalog(&catalog->view);
+    loaded.push_back(std::move(catalog));
+    return true;
+}
@@ -0,0 +1,173 @@
+// Released under the GNU GPLv3; see LICENSE for details.
+// Developed by Boucher Lab and Slizovskiy Lab.
+
+#include <algorithm>
+#include <charconv>
+#include <iostream>
+#include <set>
+#include "../include/catalog_tables.h"
+#include "../include/csv_reader.h"
+
+// Splits line at tabs, keeping empty fields.
+static void splitTabs(std::string_view line, std::vector<std::string_view>& fields) {
+    fields.clear();
+    size_t pos = 0;
+    while (true) {
+        size_t tab = line.find('\t', pos);
+        if (tab == std::string_view::npos) {
+            fields.push_back(line.substr(pos));
+            return;
+        }
+        fields.push_back(line.substr(pos, tab - pos));
+        pos = tab + 1;
+    }
+}
+
+// Ids index flat id -> dense index tables, so they are capped well below INT_MAX.
+constexpr int kMaxCatalogId = 1 << 24;
+
+static bool parseId(std::string_view field, int& id) {
+    auto [end, ec] = std::from_chars(field.data(), field.data() + field.size(), id);
+    return ec == std::errc() && end == field.data() + field.size() && id >= 0 && id < kMaxCatalogId;
+}
+
+// Calls row(fields) for every data row of file with exactly columns fields and a valid id.
+template <typename Fn>
+static bool forEachCatalogRow(const std::filesystem::path& file, size_t columns, Fn&& row) {
+    std::string buffer;
+    if (!readFileToBuffer(file, buffer)) {
+        std::cerr << "Warning: Could not open catalog table: " << file << std::endl;
+        return false;
+    }
+    std::vector<std::string_view> fields;
+    size_t lineNumber = 0;
+    forEachLine(buffer, [&](std::string_view line) {
+        if (++lineNumber == 1 || line.empty()) return;
+        splitTabs(line, fields);
+        int id;
+        if (fields.size() != columns || !parseId(fields[0], id)) {
+            std::cerr << "Warning: Skipping malformed catalog row " << file.filename().string() << ":" << lineNumber << std::endl;
+            return;
+        }
+        row(id, fields);
+    });
+    return true;
+}
+
+// Sorts rows by id and drops all but the first row of a repeated id.
+template <typename Row>
+static void sortUniqueById(std::vector<Row>& rows, const std::filesystem::path& table) {
+    std::stable_sort(rows.begin(), rows.end(), [](const Row& a, const Row& b) { return a.id < b.id; });
+    auto last = std::unique(rows.begin(), rows.end(), [](const Row& a, const Row& b) { return a.id == b.id; });
+    if (last != rows.end()) {
+        std::cerr << "Warning: " << (rows.end() - last) << " repeated ids ignored in " << table << std::endl;
+        rows.erase(last, rows.end());
+    }
+}
+
+bool readCatalogTables(const std::filesystem::path& argsFile, const std::filesystem::path& mgesFile, CatalogTables& tables) {
+    tables = CatalogTables{};
+    bool ok = forEachCatalogRow(argsFile, 5, [&](int id, const std::vector<std::string_view>& f) {
+        tables.args.push_back({id, std::string(f[1]), std::string(f[2]), std::string(f[3]), f[4] == "1"});
+    });
+    ok = forEachCatalogRow(mgesFile, 4, [&](int id, const std::vector<std::string_view>& f) {
+        tables.mges.push_back({id, std::string(f[1]), std::string(f[2]), std::string(f[3])});
+    }) && ok;
+    sortUniqueById(tables.args, argsFile);
+    sortUniqueById(tables.mges, mgesFile);
+    return ok;
+}
+
+
+/* Column derivation */
+
+// Sorted distinct non-empty values of one field, i.e. its code -> name table.
+template <typename Row, typename Field>
+static std::vector<std::string_view> nameTable(const std::vector<Row>& rows, Field field) {
+    std::set<std::string_view> names;
+    for (const Row& row : rows) {
+        std::string_view name = row.*field;
+        if (!name.empty()) names.insert(name);
+    }
+    return {names.begin(), names.end()};
+}
+
+static CatalogCode codeOf(const std::vector<std::string_view>& names, std::string_view name) {
+    auto it = std::lower_bound(names.begin(), names.end(), name);
+    return it != names.end() && *it == name ? static_cast<CatalogCode>(it - names.begin()) : kNoCatalogCode;
+}
+
+static std::vector<int32_t> indexById(const std::vector<int>& ids) {
+    std::vector<int32_t> index(ids.empty() ? 0 : ids.back() + 1, -1);
+    for (size_t i = 0; i < ids.size(); ++i) index[ids[i]] = static_cast<int32_t>(i);
+    return index;
+}
+
+template <typename Row, typename Field>
+static std::vector<CatalogNameEntry> reverseIndex(const std::vector<Row>& rows, Field field) {
+    std::vector<CatalogNameEntry> index;
+    for (const Row& row : rows) {
+        std::string_view name = row.*field;
+        if (!name.empty()) index.push_back({name, row.id});
+    }
+    std::sort(index.begin(), index.end(), [](const CatalogNameEntry& a, const CatalogNameEntry& b) {
+        return a.name != b.name ? a.name < b.name : a.id < b.id;
+    });
+    return index;
+}
+
+void buildCatalogData(CatalogTables tables, CatalogData& data) {
+    data.tables = std::move(tables);
+    data.stringPool.clear();
+    const auto& args = data.tables.args;
+    const auto& mges = data.tables.mges;
+
+    data.argGroupNames = nameTable(args, &CatalogArgRow::group);
+    data.resistanceNames = nameTable(args, &CatalogArgRow::resistance);
+    data.argIds.clear();
+    data.argNames.clear();
+    data.argGroups.clear();
+    data.argResistances.clear();
+    data.argRequiresSNP.clear();
+    for (const CatalogArgRow& row : args) {
+        data.argIds.push_back(row.id);
+        data.argNames.push_back(row.name);
+        data.argGroups.push_back(codeOf(data.argGroupNames, row.group));
+        data.argResistances.push_back(codeOf(data.resistanceNames, row.resistance));
+        data.argRequiresSNP.push_back(row.requiresSNPConfirmation);
+    }
+
+    data.mgeGroupNames = nameTable(mges, &CatalogMGERow::group);
+    data.mgeIds.clear();
+    data.mgeNames.clear();
+    data.mgeLabels.clear();
+    data.mgeGroups.clear();
+    for (const CatalogMGERow& row : mges) {
+        data.mgeIds.push_back(row.id);
+        data.mgeNames.push_back(row.name);
+        data.mgeLabels.push_back(row.label);
+        data.mgeGroups.push_back(codeOf(data.mgeGroupNames, row.group));
+    }
+
+    data.argIndexById = indexById(data.argIds);
+    data.mgeIndexById = indexById(data.mgeIds);
+    data.argsByName = reverseIndex(args, &CatalogArgRow::name);
+    data.mgesByName = reverseIndex(mges, &CatalogMGERow::name);
+    data.mgesByLabel = reverseIndex(mges, &CatalogMGERow::label);
+}
+
+template <typename T>
+static CatalogColumn<T> columnOf(const std::vector<T>& values) {
+    return {values.data(), values.size()};
+}
+
+EntityCatalog CatalogData::view() const {
+    return {
+        columnOf(argIds), columnOf(argNames), columnOf(argGroups), columnOf(argResistances),
+        columnOf(argRequiresSNP), columnOf(argGroupNames), columnOf(resistanceNames),
+        columnOf(mgeIds), columnOf(mgeNames), columnOf(mgeLabels), columnOf(mgeGroups),
+        columnOf(mgeGroupNames),
+        columnOf(argIndexById), columnOf(mgeIndexById),
+        columnOf(argsByName), columnOf(mgesByName), columnOf(mgesByLabel),
+    };
+}
@@ -16,6 +16,12 @@ Config loadConfig(const std::string& filename) {
 
     Config cfg;
     cfg.input_data_path = j.at("input").at("input_data").get<std::string>();
+    cfg.graph_snapshot_path = j.at("input").value("graph_snapshot", "");
+
+    auto catalog = j.at("input").value("catalog", nlohmann::json::object());
+    cfg.catalog_args_path  = catalog.value("args", "");
+    cfg.catalog_mges_path  = catalog.value("mges", "");
+    cfg.catalog_cache_path = catalog.value("cache", "");
 
     auto output = j.at("output");
     cfg.output_base       = output.at("base").get<std::string>();
@@ -36,6 +42,7 @@ Config loadConfig(const std::string& filename) {
     cfg.viz_interaction        = j.at("viz").at("interaction_json").get<std::string>();
     cfg.viz_parent             = j.at("viz").at("parent_json").get<std::string>();
     cfg.viz_temporal_dynamics  = j.at("viz").at("temporal_dynamics_disease").get<std::string>();
+    cfg.viz_entity_timelines   = j.at("viz").value("entity_timelines", "");
 
     return cfg;
 }
@@ -0,0 +1,98 @@
+// Released under the GNU GPLv3; see LICENSE for details.
+// Developed by Boucher Lab and Slizovskiy Lab.
+
+#include <algorithm>
+#include <iostream>
+#include <utility>
+#include "../include/csr_graph.h"
+
+// Sorts every node's neighbor range by neighbor index, keeping edge ids aligned.
+static void sortNeighborRanges(const std::vector<uint32_t>& offsets, std::vector<uint32_t>& neighbors, std::vector<uint32_t>& edgeIds) {
+    std::vector<std::pair<uint32_t, uint32_t>> scratch;
+    for (size_t n = 0; n + 1 < offsets.size(); ++n) {
+        uint32_t begin = offsets[n], end = offsets[n + 1];
+        if (end - begin < 2) continue;
+        scratch.clear();
+        for (uint32_t k = begin; k < end; ++k) scratch.emplace_back(neighbors[k], edgeIds[k]);
+        std::sort(scratch.begin(), scratch.end());
+        for (uint32_t k = begin; k < end; ++k) {
+            neighbors[k] = scratch[k - begin].first;
+            edgeIds[k] = scratch[k - begin].second;
+        }
+    }
+}
+
+void buildCSR(const Graph& g, CSRGraph& csr) {
+    csr = CSRGraph{};
+    csr.nodes.assign(g.nodes.begin(), g.nodes.end());
+    csr.nodeIndex.reserve(csr.nodes.size());
+    for (uint32_t i = 0; i < csr.nodes.size(); ++i) {
+        csr.nodeIndex.emplace(csr.nodes[i], i);
+    }
+
+    for (const Edge& edge : g.edges) {
+        csr.patientWords = std::max(csr.patientWords, edge.individuals.words().size());
+    }
+
+    // Pass 1: edge attributes and degrees.
+    const size_t n = csr.nodes.size();
+    struct ResolvedEdge { uint32_t source; uint32_t target; bool isColo; };
+    std::vector<ResolvedEdge> resolved;  // indexed by edge id
+    resolved.reserve(g.edges.size());
+    csr.coloOffsets.assign(n + 1, 0);
+    csr.temporalOffsets.assign(n + 1, 0);
+    csr.edgeAttrs.reserve(g.edges.size());
+    csr.edgePatients.assign(g.edges.size() * csr.patientWords, 0);
+
+    for (const Edge& edge : g.edges) {
+        int s = csr.indexOf(edge.source);
+        int t = csr.indexOf(edge.target);
+        if (s < 0 || t < 0) {
+            std::cerr << "Warning: edge endpoint missing from graph nodes (ID " << edge.source.id << ", " << edge.target.id << ")\n";
+            continue;
+        }
+        uint32_t edgeId = static_cast<uint32_t>(csr.edgeAttrs.size());
+        csr.edgeAttrs.push_back({edge.weight, static_cast<int>(edge.individuals.size())});
+        const auto& words = edge.individuals.words();
+        std::copy(words.begin(), words.end(), csr.edgePatients.begin() + edgeId * csr.patientWords);
+        resolved.push_back({static_cast<uint32_t>(s), static_cast<uint32_t>(t), edge.isColo});
+
+        if (edge.isColo) {
+            csr.coloOffsets[s + 1]++;
+            csr.coloOffsets[t + 1]++;
+        } else {
+            csr.temporalOffsets[s + 1]++;
+        }
+    }
+    csr.edgePatients.resize(csr.edgeAttrs.size() * csr.patientWords);
+
+    for (size_t i = 0; i < n; ++i) {
+        csr.coloOffsets[i + 1] += csr.coloOffsets[i];
+        csr.temporalOffsets[i + 1] += csr.temporalOffsets[i];
+    }
+
+    // Pass 2: scatter neighbors into their ranges.
+    csr.coloNeighbors.resize(csr.coloOffsets[n]);
+    csr.coloEdgeIds.resize(csr.coloOffsets[n]);
+    csr.temporalNeighbors.resize(csr.temporalOffsets[n]);
+    csr.temporalEdgeIds.resize(csr.temporalOffsets[n]);
+
+    std::vector<uint32_t> coloFill(csr.coloOffsets.begin(), csr.coloOffsets.end() - 1);
+    std::vector<uint32_t> temporalFill(csr.temporalOffsets.begin(), csr.temporalOffsets.end() - 1);
+
+    for (uint32_t edgeId = 0; edgeId < resolved.size(); ++edgeId) {
+        auto [s, t, isColo] = resolved[edgeId];
+        if (isColo) {
+            csr.coloNeighbors[coloFill[s]] = t;
+            csr.coloEdgeIds[coloFill[s]++] = edgeId;
+            csr.coloNeighbors[coloFill[t]] = s;
+            csr.coloEdgeIds[coloFill[t]++] = edgeId;
+        } else {
+            csr.temporalNeighbors[temporalFill[s]] = t;
+            csr.temporalEdgeIds[temporalFill[s]++] = edgeId;
+        }
+    }
+
+    sortNeighborRanges(csr.coloOffsets, csr.coloNeighbors, csr.coloEdgeIds);
+    sortNeighborRanges(csr.temporalOffsets, csr.temporalNeighbors, csr.temporalEdgeIds);
+}
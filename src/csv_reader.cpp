@@ -0,0 +1,15 @@
+// Released under the GNU GPLv3; see LICENSE for details.
+// Developed by Boucher Lab and Slizovskiy Lab.
+
+#include <fstream>
+#include "../include/csv_reader.h"
+
+bool readFileToBuffer(const std::filesystem::path& filename, std::string& buffer) {
+    std::ifstream in(filename, std::ios::binary | std::ios::ate);
+    if (!in) return false;
+
+    std::streamsize size = in.tellg();
+    in.seekg(0, std::ios::beg);
+    buffer.resize(static_cast<size_t>(size));
+    return size == 0 || static_cast<bool>(in.read(buffer.data(), size));
+}
@@ -0,0 +1,286 @@
+// Released under the GNU GPLv3; see LICENSE for details.
+// Developed by Boucher Lab and Slizovskiy Lab.
+
+#include <algorithm>
+#include <iostream>
+#include "../include/edge_predicate.h"
+#include "../include/id_maps.h"
+
+/* Table */
+
+void buildColoEdgeTable(const GraphIndex& index, ColoEdgeTable& table) {
+    table = ColoEdgeTable{};
+    table.index = &index;
+
+    const EntityCatalog& catalog = entityCatalog();
+    for (uint32_t e = 0; e < index.edges.size(); ++e) {
+        const Edge& edge = *index.edges[e];
+        if (!edge.isColo) continue;
+        table.patientWords = std::max(table.patientWords, edge.individuals.words().size());
+
+        const Node* arg = edge.source.isARG ? &edge.source : edge.target.isARG ? &edge.target : nullptr;
+        const Node* mge = !edge.source.isARG ? &edge.source : !edge.target.isARG ? &edge.target : nullptr;
+        table.edgeIds.push_back(e);
+        table.argIds.push_back(arg ? arg->id : -1);
+        table.mgeIds.push_back(mge ? mge->id : -1);
+        table.argGroups.push_back(arg ? catalog.argGroup(arg->id) : kNoCatalogCode);
+        table.resistances.push_back(arg ? catalog.argResistance(arg->id) : kNoCatalogCode);
+        table.mgeGroups.push_back(mge ? catalog.mgeGroup(mge->id) : kNoCatalogCode);
+        table.requiresSNP.push_back(arg && arg->requiresSNPConfirmation);
+        table.timepoints.push_back(static_cast<uint8_t>(timepointOrdinal(edge.source.timepoint)));
+        table.patientCounts.push_back(static_cast<uint32_t>(edge.individuals.size()));
+    }
+
+    table.patients.assign(table.size() * table.patientWords, 0);
+    for (size_t r = 0; r < table.size(); ++r) {
+        const std::vector<uint64_t>& words = index.edges[table.edgeIds[r]]->individuals.words();
+        std::copy(words.begin(), words.end(), table.patients.begin() + r * table.patientWords);
+    }
+}
+
+/* Predicates */
+
+static EdgePredicate leaf(EdgePredicate::Kind kind, int32_t value) {
+    EdgePredicate predicate;
+    predicate.kind = kind;
+    predicate.value = value;
+    return predicate;
+}
+
+EdgePredicate EdgePredicate::all(std::vector<EdgePredicate> children) {
+    EdgePredicate predicate;
+    predicate.kind = Kind::All;
+    predicate.children = std::move(children);
+    return predicate;
+}
+
+EdgePredicate EdgePredicate::any(std::vector<EdgePredicate> children) {
+    EdgePredicate predicate;
+    predicate.kind = Kind::Any;
+    predicate.children = std::move(children);
+    return predicate;
+}
+
+EdgePredicate EdgePredicate::none() { return leaf(Kind::None, 0); }
+
+EdgePredicate EdgePredicate::disease(const std::string& disease, const std::map<std::string, PatientSet>& diseaseMasks) {
+    auto it = diseaseMasks.find(disease);
+    if (it == diseaseMasks.end() || it->second.empty()) {
+        std::cerr << "Warning: No patients found for disease '" << disease << "'.\n";
+        return none();
+    }
+    return patientsIn(it->second);
+}
+
+EdgePredicate EdgePredicate::patientsIn(const PatientSet& patients) {
+    EdgePredicate predicate = leaf(Kind::Patients, 0);
+    predicate.patients = patients;
+    return predicate;
+}
+
+EdgePredicate EdgePredicate::arg(const std::string& argName) {
+    int argID = getARGId(argName);
+    if (argID == -1) {
+        std::cerr << "ARG not found: " << argName << "\n";
+        return none();
+    }
+    return leaf(Kind::ARG, argID);
+}
+
+EdgePredicate EdgePredicate::mge(const std::string& mgeName) {
+    int mgeID = getMGEIdByName(mgeName);
+    if (mgeID == -1) {
+        std::cerr << "MGE not found: " << mgeName << "\n";
+        return none();
+    }
+    return leaf(Kind::MGE, mgeID);
+}
+
+EdgePredicate EdgePredicate::argGroup(const std::string& groupName) {
+    CatalogCode group = entityCatalog().findARGGroup(groupName);
+    if (group == kNoCatalogCode) {
+        std::cerr << "No ARGs found for group: " << groupName << "\n";
+        return none();
+    }
+    return leaf(Kind::ARGGroup, group);
+}
+
+EdgePredicate EdgePredicate::mgeGroup(const std::string& groupName) {
+    CatalogCode group = entityCatalog().findMGEGroup(groupName);
+    if (group == kNoCatalogCode) {
+        std::cerr << "No MGEs found for group: " << groupName << "\n";
+        return none();
+    }
+    return leaf(Kind::MGEGroup, group);
+}
+
+EdgePredicate EdgePredicate::resistance(const std::string& resistanceClass) {
+    CatalogCode code = entityCatalog().findResistance(resistanceClass);
+    if (code == kNoCatalogCode) {
+        std::cerr << "No ARGs found for resistance class: " << resistanceClass << "\n";
+        return none();
+    }
+    return leaf(Kind::Resistance, code);
+}
+
+EdgePredicate EdgePredicate::requiresSNPConfirmation(bool required) {
+    return leaf(Kind::RequiresSNP, required ? 1 : 0);
+}
+
+EdgePredicate EdgePredicate::timepoints(Timepoint first, Timepoint last) {
+    EdgePredicate predicate = leaf(Kind::Timepoints, 0);
+    predicate.first = static_cast<uint8_t>(timepointOrdinal(first));
+    predicate.last = static_cast<uint8_t>(timepointOrdinal(last));
+    return predicate;
+}
+
+EdgePredicate EdgePredicate::minPatients(int count) { return leaf(Kind::MinPatients, count); }
+
+// Appends b to a's children when a already is a node of that kind, so chains stay flat.
+static EdgePredicate combine(EdgePredicate::Kind kind, EdgePredicate a, EdgePredicate b) {
+    if (a.kind != kind) {
+        EdgePredicate node;
+        node.kind = kind;
+        node.children.push_back(std::move(a));
+        a = std::move(node);
+    }
+    if (b.kind == kind) {
+        for (EdgePredicate& child : b.children) a.children.push_back(std::move(child));
+    } else {
+        a.children.push_back(std::move(b));
+    }
+    return a;
+}
+
+EdgePredicate operator&(EdgePredicate a, EdgePredicate b) {
+    return combine(EdgePredicate::Kind::All, std::move(a), std::move(b));
+}
+
+EdgePredicate operator|(EdgePredicate a, EdgePredicate b) {
+    return combine(EdgePredicate::Kind::Any, std::move(a), std::move(b));
+}
+
+/* Evaluation */
+
+namespace {
+
+// Rows per block: the selection bytes of every tree level stay in L1 while a block is evaluated
+constexpr size_t kBlockRows = 1024;
+
+// One selection buffer per tree depth, reused across blocks
+struct Scratch {
+    std::vector<std::vector<uint8_t>> levels;
+
+    uint8_t* at(size_t depth) {
+        if (levels.size() <= depth) levels.resize(depth + 1, std::vector<uint8_t>(kBlockRows));
+        return levels[depth].data();
+    }
+};
+
+template <typename T, typename Test>
+void testColumn(const std::vector<T>& column, size_t begin, size_t count, uint8_t* out, Test test) {
+    const T* values = column.data() + begin;
+    for (size_t i = 0; i < count; ++i) out[i] = test(values[i]);
+}
+
+// out[i] = whether row begin + i matches predicate
+void evaluate(const ColoEdgeTable& table, const EdgePredicate& predicate, size_t begin, size_t count,
+              uint8_t* out, Scratch& scratch, size_t depth) {
+    using Kind = EdgePredicate::Kind;
+    const int32_t value = predicate.value;
+    switch (predicate.kind) {
+    case Kind::All:
+    case Kind::Any: {
+        const bool isAll = predicate.kind == Kind::All;
+        std::fill(out, out + count, isAll ? 1 : 0);
+        uint8_t* child = scratch.at(depth);
+        for (const EdgePredicate& c : predicate.children) {
+            evaluate(table, c, begin, count, child, scratch, depth + 1);
+            if (isAll) {
+                for (size_t i = 0; i < count; ++i) out[i] &= child[i];
+            } else {
+                for (size_t i = 0; i < count; ++i) out[i] |= child[i];
+            }
+        }
+        break;
+    }
+    case Kind::None:
+        std::fill(out, out + count, 0);
+        break;
+    case Kind::Patients: {
+        const size_t words = table.patientWords;
+        std::vector<uint64_t> mask(predicate.patients.words());
+        mask.resize(words, 0);
+        const uint64_t* rows = table.patients.data() + begin * words;
+        for (size_t i = 0; i < count; ++i) {
+            uint64_t shared = 0;
+            for (size_t w = 0; w < words; ++w) shared |= rows[i * words + w] & mask[w];
+            out[i] = shared != 0;
+        }
+        break;
+    }
+    case Kind::ARG:
+        testColumn(table.argIds, begin, count, out, [value](int32_t id) { return id == value; });
+        break;
+    case Kind::MGE:
+        testColumn(table.mgeIds, begin, count, out, [value](int32_t id) { return id == value; });
+        break;
+    case Kind::ARGGroup:
+        testColumn(table.argGroups, begin, count, out, [value](CatalogCode code) { return code == value; });
+        break;
+    case Kind::MGEGroup:
+        testColumn(table.mgeGroups, begin, count, out, [value](CatalogCode code) { return code == value; });
+        break;
+    case Kind::Resistance:
+        testColumn(table.resistances, begin, count, out, [value](CatalogCode code) { return code == value; });
+        break;
+    case Kind::RequiresSNP:
+        testColumn(table.requiresSNP, begin, count, out, [value](uint8_t flag) { return flag == value; });
+        break;
+    case Kind::Timepoints: {
+        const uint8_t first = predicate.first, last = predicate.last;
+        testColumn(table.timepoints, begin, count, out, [first, last](uint8_t tp) { return (tp >= first) & (tp <= last); });
+        break;
+    }
+    case Kind::MinPatients: {
+        const uint32_t minimum = value < 0 ? 0u : static_cast<uint32_t>(value);
+        testColumn(table.patientCounts, begin, count, out, [minimum](uint32_t n) { return n >= minimum; });
+        break;
+    }
+    }
+}
+
+} // namespace
+
+GraphView filterGraphByPredicate(const ColoEdgeTable& table, const EdgePredicate& predicate) {
+    const GraphIndex& index = *table.index;
+    GraphView view(index);
+    Scratch scratch;
+    std::vector<uint8_t> selected(kBlockRows);
+    std::vector<uint32_t> nodeIds;
+
+    for (size_t begin = 0; begin < table.size(); begin += kBlockRows) {
+        const size_t count = std::min(kBlockRows, table.size() - begin);
+        evaluate(table, predicate, begin, count, selected.data(), scratch, 0);
+        for (size_t i = 0; i < count; ++i) {
+            if (!selected[i]) continue;
+            uint32_t e = table.edgeIds[begin + i];
+            view.selectEdge(e);
+            nodeIds.push_back(index.edgeSources[e]);
+            nodeIds.push_back(index.edgeTargets[e]);
+        }
+    }
+
+    std::sort(nodeIds.begin(), nodeIds.end());
+    nodeIds.erase(std::unique(nodeIds.begin(), nodeIds.end()), nodeIds.end());
+    for (uint32_t n : nodeIds) view.selectNode(n);
+
+    // Temporal edges between the selected nodes
+    for (uint32_t n : nodeIds) {
+        for (uint32_t k = index.temporalOffsets[n]; k < index.temporalOffsets[n + 1]; ++k) {
+            uint32_t e = index.temporalEdgeIds[k];
+            if (view.hasNode(index.edgeTargets[e])) view.selectEdge(e);
+        }
+    }
+    return view;
+}
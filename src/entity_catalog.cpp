@@ -0,0 +1,117 @@
+// Released under the GNU GPLv3; see LICENSE for details.
+// Developed by Boucher Lab and Slizovskiy Lab.
+
+#include <algorithm>
+#include <atomic>
+#include "../include/entity_catalog.h"
+
+static CatalogCode codeAt(const CatalogColumn<CatalogCode>& column, int index) {
+    return index >= 0 ? column[index] : kNoCatalogCode;
+}
+
+static CatalogCode findCode(const CatalogColumn<std::string_view>& names, std::string_view name) {
+    auto it = std::lower_bound(names.begin(), names.end(), name);
+    return it != names.end() && *it == name ? static_cast<CatalogCode>(it - names.begin()) : kNoCatalogCode;
+}
+
+// First (lowest id) entry for name in a name-sorted reverse index, or -1.
+static int findId(const CatalogColumn<CatalogNameEntry>& index, std::string_view name) {
+    auto it = std::lower_bound(index.begin(), index.end(), name,
+        [](const CatalogNameEntry& entry, std::string_view key) { return entry.name < key; });
+    return it != index.end() && it->name == name ? it->id : -1;
+}
+
+std::string_view EntityCatalog::argName(int id) const {
+    return hasARG(id) ? argNames[argIndex(id)] : "Unknown ARG";
+}
+
+std::string_view EntityCatalog::mgeName(int id) const {
+    return hasMGE(id) ? mgeNames[mgeIndex(id)] : "Unknown MGE";
+}
+
+std::string_view EntityCatalog::mgeLabel(int id) const {
+    int index = mgeIndex(id);
+    if (index >= 0 && !mgeLabels[index].empty()) return mgeLabels[index];
+    return mgeName(id);
+}
+
+CatalogCode EntityCatalog::argGroup(int id) const { return codeAt(argGroups, argIndex(id)); }
+CatalogCode EntityCatalog::argResistance(int id) const { return codeAt(argResistances, argIndex(id)); }
+CatalogCode EntityCatalog::mgeGroup(int id) const { return codeAt(mgeGroups, mgeIndex(id)); }
+
+bool EntityCatalog::requiresSNPConfirmation(int argID) const {
+    int index = argIndex(argID);
+    return index >= 0 && argRequiresSNP[index];
+}
+
+std::string_view EntityCatalog::argGroupName(CatalogCode code) const {
+    return code < argGroupNames.size() ? argGroupNames[code] : "Unknown ARG Group";
+}
+
+std::string_view EntityCatalog::mgeGroupName(CatalogCode code) const {
+    return code < mgeGroupNames.size() ? mgeGroupNames[code] : "Unknown MGE Group";
+}
+
+std::string_view EntityCatalog::resistanceName(CatalogCode code) const {
+    return code < resistanceNames.size() ? resistanceNames[code] : std::string_view();
+}
+
+CatalogCode EntityCatalog::findARGGroup(std::string_view name) const { return findCode(argGroupNames, name); }
+CatalogCode EntityCatalog::findMGEGroup(std::string_view name) const { return findCode(mgeGroupNames, name); }
+CatalogCode EntityCatalog::findResistance(std::string_view name) const { return findCode(resistanceNames, name); }
+int EntityCatalog::findARG(std::string_view name) const { return findId(argsByName, name); }
+int EntityCatalog::findMGE(std::string_view name) const { return findId(mgesByName, name); }
+
+int EntityCatalog::findMGEByLabel(std::string_view label) const {
+    int id = findId(mgesByLabel, label);
+    return id != -1 ? id : findMGE(label);
+}
+
+
+static std::atomic<const EntityCatalog*> installedCatalog{nullptr};
+
+const EntityCatalog& entityCatalog() {
+    const EntityCatalog* catalog = installedCatalog.load(std::memory_order_acquire);
+    return catalog ? *catalog : builtinEntityCatalog();
+}
+
+void setEntityCatalog(const EntityCatalog* catalog) {
+    installedCatalog.store(catalog, std::memory_order_release);
+}
+
+// FNV-1a, fed field by field with separators so adjacent strings cannot run together.
+namespace {
+struct Fnv1a {
+    uint64_t hash = 0xcbf29ce484222325ull;
+
+    void bytes(const void* data, size_t size) {
+        const auto* p = static_cast<const unsigned char*>(data);
+        for (size_t i = 0; i < size; ++i) {
+            hash ^= p[i];
+            hash *= 0x100000001b3ull;
+        }
+    }
+    void number(int64_t value) { bytes(&value, sizeof(value)); }
+    void text(std::string_view value) {
+        number(static_cast<int64_t>(value.size()));
+        bytes(value.data(), value.size());
+    }
+};
+} // namespace
+
+uint64_t catalogFingerprint(const EntityCatalog& catalog) {
+    Fnv1a fnv;
+    fnv.number(static_cast<int64_t>(catalog.argIds.size()));
+    for (size_t i = 0; i < catalog.argIds.size(); ++i) {
+        fnv.number(catalog.argIds[i]);
+        fnv.text(catalog.argNames[i]);
+        fnv.number(catalog.argRequiresSNP[i]);
+        fnv.text(catalog.resistanceName(catalog.argResistances[i]));
+    }
+    fnv.number(static_cast<int64_t>(catalog.mgeIds.size()));
+    for (size_t i = 0; i < catalog.mgeIds.size(); ++i) {
+        fnv.number(catalog.mgeIds[i]);
+        fnv.text(catalog.mgeNames[i]);
+    }
+    return fnv.hash;
+}
@@ -0,0 +1,60 @@
+// Released under the GNU GPLv3; see LICENSE for details.
+// Developed by Boucher Lab and Slizovskiy Lab.
+
+#include <algorithm>
+#include <tuple>
+#include "../include/entity_timelines.h"
+
+namespace {
+
+// One colocalization edge seen from one of its endpoints
+struct EndpointRow {
+    int id;
+    int partnerID;         // -1 if the other endpoint has the same type
+    int ordinal;
+    bool withPatients;
+};
+
+// Folds rows (sorted by entity, then partner) into one timeline per entity.
+void foldRows(std::vector<EndpointRow>& rows, bool isARG, std::vector<EntityTimeline>& timelines) {
+    std::sort(rows.begin(), rows.end(), [](const EndpointRow& a, const EndpointRow& b) {
+        return std::tie(a.id, a.partnerID) < std::tie(b.id, b.partnerID);
+    });
+    for (const EndpointRow& row : rows) {
+        if (timelines.empty() || timelines.back().id != row.id) timelines.push_back(EntityTimeline{row.id, isARG, {}, {}});
+        EntityTimeline& timeline = timelines.back();
+        timeline.degree[row.ordinal]++;
+
+        if (row.partnerID < 0 || !row.withPatients) continue;
+        if (timeline.partners.empty() || timeline.partners.back().partnerID != row.partnerID) {
+            timeline.partners.push_back({row.partnerID, 0});
+        }
+        timeline.partners.back().timepoints |= TimepointMask{1} << row.ordinal;
+    }
+}
+
+} // namespace
+
+const EntityTimeline* EntityTimelineIndex::find(bool isARG, int id) const {
+    const std::vector<EntityTimeline>& timelines = isARG ? args_ : mges_;
+    auto it = std::lower_bound(timelines.begin(), timelines.end(), id,
+                               [](const EntityTimeline& timeline, int key) { return timeline.id < key; });
+    return it != timelines.end() && it->id == id ? &*it : nullptr;
+}
+
+void buildEntityTimelineIndex(const Graph& graph, EntityTimelineIndex& index) {
+    index = EntityTimelineIndex{};
+    std::vector<EndpointRow> argRows, mgeRows;
+    for (const Edge& edge : graph.edges) {
+        if (!edge.isColo) continue;
+        const bool mixed = edge.source.isARG != edge.target.isARG;
+        const bool withPatients = !edge.individuals.empty();
+        for (const Node* endpoint : {&edge.source, &edge.target}) {
+            const Node& other = endpoint == &edge.source ? edge.target : edge.source;
+            EndpointRow row{endpoint->id, mixed ? other.id : -1, timepointOrdinal(endpoint->timepoint), withPatients};
+            (endpoint->isARG ? argRows : mgeRows).push_back(row);
+        }
+    }
+    foldRows(argRows, true, index.args_);
+    foldRows(mgeRows, false, index.mges_);
+}
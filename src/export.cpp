@@ -8,8 +8,10 @@
 #include <map>
 #include <utility>
 #include <algorithm>
+#include <vector>
 #include "graph.h"
 #include "id_maps.h"
+#include "entity_catalog.h"
 #include "export.h"
 
 std::string getNodeName(const Node& node) {
@@ -20,19 +22,17 @@ std::string getNodeName(const Node& node) {
 }
 
 std::string getNodeLabel(const Node& node) {
-    std::string label = node.isARG ? getARGName(node.id) : getMGENameForLabel(node.id);
+    const EntityCatalog& catalog = entityCatalog();
+    std::string label(node.isARG ? catalog.argName(node.id) : catalog.mgeLabel(node.id));
     label += "\\n" + toString(node.timepoint);
     return label;
 }
 
 std::string getTimepointColor(const Timepoint& tp) {
-    int timeValue = static_cast<int>(tp);
-    if (timeValue == 1000) return "\"yellow\"";
-    if (timeValue == 0)  return "\"red\"";
-    if (timeValue > 0 && timeValue < 31) return "\"#99D2FF\""; 
-    if (timeValue > 30 && timeValue < 61) return "\"#4D9DFF\""; 
-    if (timeValue > 60) return "\"#3A6EFF\"";
-    return "\"green\""; // Fallback for any unexpected values
+    // Indexed by TimepointPhase
+    static const std::string phaseColors[] = {"\"yellow\"", "\"red\"", "\"#99D2FF\"", "\"#4D9DFF\"", "\"#3A6EFF\""};
+    if (!isKnownTimepoint(tp)) return "\"green\""; // Fallback for any unexpected values
+    return phaseColors[static_cast<int>(timepointPhase(tp))];
 }
 
 bool isTemporalEdge(const Edge& edge) {
@@ -70,6 +70,18 @@ std::string getMGEGroupShape(const std::string& groupName) {
     return "box"; // Default for UNCLASSIFIED or others
 }
 
+// Shape per MGE group code, resolved once per group.
+std::string_view getMGEGroupShape(CatalogCode group) {
+    static const std::vector<std::string> shapes = [] {
+        const EntityCatalog& catalog = entityCatalog();
+        std::vector<std::string> byCode;
+        for (std::string_view name : catalog.mgeGroupNames) byCode.push_back(getMGEGroupShape(std::string(name)));
+        byCode.push_back(getMGEGroupShape(std::string(catalog.mgeGroupName(kNoCatalogCode))));
+        return byCode;
+    }();
+    return shapes[std::min<size_t>(group, shapes.size() - 1)];
+}
+
 // void exportToDot(const Graph& g, const std::string& filename, bool showLabels) {
 //     std::ofstream file(filename);
 //     file << "digraph G {\n";
@@ -10,59 +10,77 @@
 #include <set> 
 #include "../include/graph.h"
 #include "../include/id_maps.h"
+#include "../include/entity_catalog.h"
 #include "../include/export.h"
 #include "../external/json.hpp"
 #include "../include/graph.h"
 #include "../include/Timepoint.h"
 #include "../include/analysis.h"
 #include "../include/parser.h" 
+#include "../include/graph_utils.h"
+#include "../include/graph_view.h"
+#include "../include/json_writer.h"
+#include "../include/entity_timelines.h"
 
 using nlohmann::json;
 namespace fs = std::filesystem;
 
 
+// Indexed by TimepointPhase
+static const std::string kPhaseColors[] = {"yellow", "red", "#99D2FF", "#4D9DFF", "#3A6EFF"};
+
 static std::string getTimepointColor(const Timepoint& tp) {
-    int timeValue = static_cast<int>(tp);
-    if (timeValue == 1000) return "yellow";
-    if (timeValue == 0)    return "red";
-    if (timeValue > 0 && timeValue < 31) return "#99D2FF";
-    if (timeValue > 30 && timeValue < 61) return "#4D9DFF";
-    if (timeValue > 60)    return "#3A6EFF";
-    return "green"; // fallback
+    if (!isKnownTimepoint(tp)) return "green"; // fallback
+    return kPhaseColors[static_cast<int>(timepointPhase(tp))];
 }
 
 static std::string getTimepointCategory(const Timepoint& tp) {
-    int timeValue = static_cast<int>(tp);
-    if (timeValue == 1000) return "donor";
-    if (timeValue == 0)    return "pre";
-    if (timeValue > 0 && timeValue < 31) return "post1";
-    if (timeValue > 30 && timeValue < 61) return "post2";
-    if (timeValue > 60)    return "post3";
-    return "unknown"; // Fallback for any unexpected values
+    if (!isKnownTimepoint(tp)) return "unknown"; // Fallback for any unexpected values
+    return std::string(timepointPhaseName(timepointPhase(tp)));
 }
 
 
 auto timepointOrder = [](Timepoint tp) -> int {
-    if (tp == Timepoint::Donor) return -1;
-    if (tp == Timepoint::PreFMT) return 0;
-    return static_cast<int>(tp);
+    return timepointOrdinal(tp);
 };
 
 std::string getLabel(const Node& node) {
-    std::string label = node.isARG ? getARGName(node.id) : getMGENameForLabel(node.id);
-    return label;
+    const EntityCatalog& catalog = entityCatalog();
+    return std::string(node.isARG ? catalog.argName(node.id) : catalog.mgeLabel(node.id));
 }
 
 
-bool exportGraphToJsonSimple(const Graph& g, const std::string& outPathStr, const std::map<int, std::string>& patientToDiseaseMap) {
-    json j;
-    j["nodes"] = json::array();
-    j["links"] = json::array();
+// Both graph exporters stream through JsonWriter instead of building a json DOM. Keys are
+// written in the sorted order nlohmann::json objects use, so the files are unchanged.
+
+static const char* temporalLinkColor(Timepoint src_tp, Timepoint tgt_tp) {
+    bool tgt_is_post = (tgt_tp != Timepoint::Donor && tgt_tp != Timepoint::PreFMT);
+    if (src_tp == Timepoint::Donor && tgt_tp == Timepoint::PreFMT)      return "#006400";
+    else if (src_tp == Timepoint::Donor && tgt_is_post)                 return "#4B0082";
+    else if (src_tp == Timepoint::PreFMT && tgt_is_post)                return "orange";
+    else                                                                return "black";
+}
+
+// Shared by the Graph and GraphView overloads; edges is anything iterable over const Edge&
+// in Graph::edges order.
+template <typename Edges>
+static bool writeGraphJsonSimple(const Edges& edges, const std::string& outPathStr, const std::map<int, std::string>& patientToDiseaseMap, bool compact) {
+    std::ofstream out(outPathStr);
+    if (!out) {
+        std::cerr << "[exportGraphToJsonSimple] Cannot open " << outPathStr << " for write\n";
+        return false;
+    }
+    JsonWriter json(out, compact ? -1 : 2);
+    json.beginObject();
 
+    const DiseaseMasks diseaseMasks = buildDiseaseMasks(patientToDiseaseMap);
     std::unordered_set<Node> active_nodes;
     std::set<std::pair<Node, Node>> processedColoEdges;
+    size_t linkCount = 0;
 
-    for (const Edge& edge : g.edges) {
+    json.key("links");
+    json.beginArray();
+    for (const Edge& edge : edges) {
         if (edge.source == edge.target) continue;
 
         active_nodes.insert(edge.source);
@@ -72,7 +90,6 @@ bool exportGraphToJsonSimple(const Graph& g, const std::string& outPathStr, cons
         std::string color;
         double penwidth = 4.0;
         std::string type = "other";
-        json diseases = json::array();
         if (edge.isColo) {
             auto canon = std::minmax(edge.source, edge.target);
             if (processedColoEdges.count(canon)) continue;
@@ -80,93 +97,88 @@ bool exportGraphToJsonSimple(const Graph& g, const std::string& outPathStr, cons
             style = "solid";
             color = "#696969";
             type  = "colocalization";
-            std::set<std::string> diseaseSet; 
-            for (int patientID : edge.individuals) {
-                auto it = patientToDiseaseMap.find(patientID);
-                if (it != patientToDiseaseMap.end()) {
-                    diseaseSet.insert(it->second); 
-                }
-            }
-            for (const auto& diseaseName : diseaseSet) {
-                diseases.push_back(diseaseName);
-            }
             int count = static_cast<int>(edge.individuals.size());
             if (count > 1) penwidth = 4.0 + (count - 1) * 2.0;
             penwidth = std::min(10.0, penwidth);
         } 
-        else if (!edge.isColo) {
+        else {
             style = "dashed";
             type  = "temporal";
             int w = edge.weight;
             if (w > 1) penwidth = 4.0 + (w - 1) * 2.0;
             penwidth = std::min(10.0, penwidth);
-            Timepoint src_tp = edge.source.timepoint;
-            Timepoint tgt_tp = edge.target.timepoint;
-            bool tgt_is_post = (tgt_tp != Timepoint::Donor && tgt_tp != Timepoint::PreFMT);
-            if (src_tp == Timepoint::Donor && tgt_tp == Timepoint::PreFMT)      color = "#006400";
-            else if (src_tp == Timepoint::Donor && tgt_is_post)                 color = "#4B0082";
-            else if (src_tp == Timepoint::PreFMT && tgt_is_post)                color = "orange";
-            else                                                                color = "black";
+            color = temporalLinkColor(edge.source.timepoint, edge.target.timepoint);
         } 
-        else {
-            style = "solid";
-            color = "#808080";
+
+        json.beginObject();
+        json.field("color", color);
+        json.key("diseases");
+        json.beginArray();
+        if (edge.isColo) {
+            for (const auto& [diseaseName, mask] : diseaseMasks) {
+                if (edge.individuals.intersects(mask)) json.value(diseaseName);
+            }
         }
-        j["links"].push_back({
-            {"source", getNodeName(edge.source)},
-            {"target", getNodeName(edge.target)},
-            {"individualCount", static_cast<int>(edge.individuals.size())},
-            {"style", style},
-            {"color", color},
-            {"penwidth", penwidth},
-            {"isColo", edge.isColo},
-            {"type", type},
-            {"diseases", diseases}
-        });
+        json.endArray();
+        json.field("individualCount", static_cast<int>(edge.individuals.size()));
+        json.field("isColo", edge.isColo);
+        json.field("penwidth", penwidth);
+        json.field("source", getNodeName(edge.source));
+        json.field("style", style);
+        json.field("target", getNodeName(edge.target));
+        json.field("type", type);
+        json.endObject();
+        ++linkCount;
     }
+    json.endArray();
 
+    const EntityCatalog& catalog = entityCatalog();
+    json.key("nodes");
+    json.beginArray();
     for (const Node& n : active_nodes) {
-        std::string shape;
-        std::string mgeGroup = ""; 
-
-        if (n.isARG) {
-            shape = "circle";
-        } else {
-            mgeGroup = getMGEGroupName(n.id);
-            shape = getMGEGroupShape(mgeGroup);
+        std::string_view shape = "circle";
+        std::string_view mgeGroup;
+
+        if (!n.isARG) {
+            CatalogCode group = catalog.mgeGroup(n.id);
+            mgeGroup = catalog.mgeGroupName(group);
+            shape = getMGEGroupShape(group);
         }
 
-        j["nodes"].push_back({
-            {"id",                getNodeName(n)},
-            {"label",             getLabel(n)},
-            {"isARG",             n.isARG},
-            {"timepoint",         static_cast<int>(n.timepoint)},
-            {"color",             getTimepointColor(n.timepoint)},
-            {"shape",             shape},
-            {"mgeGroup",          mgeGroup},
-            {"timepointCategory", getTimepointCategory(n.timepoint)}
-        });
+        json.beginObject();
+        json.field("color",             getTimepointColor(n.timepoint));
+        json.field("id",                getNodeName(n));
+        json.field("isARG",             n.isARG);
+        json.field("label",             n.isARG ? catalog.argName(n.id) : catalog.mgeLabel(n.id));
+        json.field("mgeGroup",          mgeGroup);
+        json.field("shape",             shape);
+        json.field("timepoint",         static_cast<int>(n.timepoint));
+        json.field("timepointCategory", getTimepointCategory(n.timepoint));
+        json.endObject();
     }
+    json.endArray();
 
-    std::ofstream out(outPathStr);
-    if (!out) {
-        std::cerr << "[exportGraphToJsonSimple] Cannot open " << outPathStr << " for write\n";
-        return false;
-    }
-    out << j.dump(2) << '\n';
+    json.endObject();
+    json.flush();
+    out << '\n';
 
-    std::cerr << "[exportGraphToJsonSimple] Wrote nodes=" << j["nodes"].size()
-              << " links=" << j["links"].size()
+    std::cerr << "[exportGraphToJsonSimple] Wrote nodes=" << active_nodes.size()
+              << " links=" << linkCount
               << " to " << outPathStr << "\n";
     return true;
 }
 
+bool exportGraphToJsonSimple(const Graph& g, const std::string& outPathStr, const std::map<int, std::string>& patientToDiseaseMap, bool compact) {
+    return writeGraphJsonSimple(g.edges, outPathStr, patientToDiseaseMap, compact);
+}
+
+bool exportGraphToJsonSimple(const GraphView& view, const std::string& outPathStr, const std::map<int, std::string>& patientToDiseaseMap, bool compact) {
+    return writeGraphJsonSimple(view.edges(), outPathStr, patientToDiseaseMap, compact);
+}
 
-bool exportParentGraphToJson(const Graph& g, const std::string& outPathStr, const std::map<int, std::string>& patientToDiseaseMap, bool showLabels) {
-    json j;
-    j["nodes"] = json::array();
-    j["links"] = json::array();
 
+template <typename Edges>
+static bool writeParentGraphJson(const Edges& edges, const std::string& outPathStr, const std::map<int, std::string>& patientToDiseaseMap, bool showLabels, bool compact) {
     struct ParentNodeInfo {
         std::string name;
         Timepoint tp;
@@ -174,11 +186,24 @@ bool exportParentGraphToJson(const Graph& g, const std::string& outPathStr, cons
         int mgeId;
     };
 
+    // Everything a parent node needs in the output; nodes follow the links in the file,
+    // so they are collected first. Names are looked up in the catalog when written.
+    struct ParentNodeRecord {
+        std::string name;
+        int argId;
+        int mgeId;
+        Timepoint tp;
+        CatalogCode group;
+        std::vector<std::pair<std::string, int>> diseaseCounts;
+    };
+
+    const DiseaseMasks diseaseMasks = buildDiseaseMasks(patientToDiseaseMap);
     int colocCounter = 0;
     std::map<std::tuple<int,int,Timepoint>, std::string> uniqueParents;
     std::map<std::pair<int,int>, std::vector<ParentNodeInfo>> colocMap;
+    std::vector<ParentNodeRecord> parentRecords;
 
-    for (const Edge& edge : g.edges) {
+    for (const Edge& edge : edges) {
         if (!edge.isColo) continue;
 
         const Node& argNode = edge.source.isARG ? edge.source : edge.target;
@@ -193,56 +218,32 @@ bool exportParentGraphToJson(const Graph& g, const std::string& outPathStr, cons
             std::string parentName = "Parent_" + std::to_string(++colocCounter);
             uniqueParents[key] = parentName;
 
-            std::string color = getTimepointColor(tp);
-            std::string groupName = getMGEGroupName(mgeId);
-            std::string shape = getMGEGroupShape(groupName);
-            std::string label = showLabels ? (getARGName(argId) + "+" + getMGENameForLabel(mgeId)) : "";
-            
-            std::set<std::string> diseaseSet;
-            std::map<std::string, std::set<int>> diseaseToIndividualsLocal; // local per colocalization
-
-            // collect diseases + individuals for this edge only
-            for (int patientID : edge.individuals) {
-                auto it = patientToDiseaseMap.find(patientID);
-                if (it != patientToDiseaseMap.end()) {
-                    diseaseSet.insert(it->second);
-                    diseaseToIndividualsLocal[it->second].insert(patientID);
-                }
-            }
+            ParentNodeRecord record = {parentName, argId, mgeId, tp, entityCatalog().mgeGroup(mgeId), {}};
 
-            // convert diseases list
-            json diseases = json::array();
-            for (const auto& diseaseName : diseaseSet) {
-                diseases.push_back(diseaseName);
+            // diseases + patient count per disease for this colocalization/timepoint
+            for (const auto& [diseaseName, mask] : diseaseMasks) {
+                int count = static_cast<int>(edge.individuals.intersectionCount(mask));
+                if (count == 0) continue;
+                record.diseaseCounts.emplace_back(diseaseName, count);
             }
-
-            // convert to JSON: disease → patient count (for this colocalization/timepoint)
-            json diseaseCounts = json::object();
-            for (const auto& [diseaseName, individuals] : diseaseToIndividualsLocal) {
-                diseaseCounts[diseaseName] = static_cast<int>(individuals.size());
-            }
-
-
-            j["nodes"].push_back({
-                {"id",                parentName},
-                {"label",             label},
-                {"argId",             argId},
-                {"mgeId",             mgeId},
-                {"timepoint",         static_cast<int>(tp)},
-                {"color",             color},
-                {"shape",             shape},
-                {"diseases",          diseases},
-                {"diseaseCounts",     diseaseCounts},
-                {"mgeGroup",          groupName}, 
-                {"timepointCategory", getTimepointCategory(tp)}
-            });
+            parentRecords.push_back(std::move(record));
         }
 
         auto pairKey = std::make_pair(argId, mgeId);
         colocMap[pairKey].push_back({uniqueParents[key], tp, argId, mgeId});
     }
 
-    // ... (The temporal link-processing loop remains unchanged) ...
+    std::ofstream out(outPathStr);
+    if (!out) {
+        std::cerr << "[exportParentGraphToJson] Cannot open " << outPathStr << " for write\n";
+        return false;
+    }
+    JsonWriter json(out, compact ? -1 : 2);
+    json.beginObject();
+
+    size_t linkCount = 0;
+    json.key("links");
+    json.beginArray();
     for (auto& entry : colocMap) {
         auto& parentNodes = entry.second;
         std::sort(parentNodes.begin(), parentNodes.end(),
@@ -254,40 +255,69 @@ bool exportParentGraphToJson(const Graph& g, const std::string& outPathStr, cons
             if (parentNodes[i].tp == parentNodes[i+1].tp || parentNodes[i].name == parentNodes[i+1].name) {
                 continue;
             }
-            Timepoint src_tp = parentNodes[i].tp;
-            Timepoint tgt_tp = parentNodes[i+1].tp;
-            bool tgt_is_post = (tgt_tp != Timepoint::Donor && tgt_tp != Timepoint::PreFMT);
-            std::string color;
-            if (src_tp == Timepoint::Donor && tgt_tp == Timepoint::PreFMT)      color = "#006400";
-            else if (src_tp == Timepoint::Donor && tgt_is_post)                 color = "#4B0082";
-            else if (src_tp == Timepoint::PreFMT && tgt_is_post)                color = "orange";
-            else                                                                color = "black";
-
-            j["links"].push_back({
-                {"source", parentNodes[i].name},
-                {"target", parentNodes[i+1].name},
-                {"style", "dashed"},
-                {"color", color},
-                {"penwidth", 5.0},
-                {"isColo", false},
-                {"type", "temporal"}
-            });
+            json.beginObject();
+            json.field("color", temporalLinkColor(parentNodes[i].tp, parentNodes[i+1].tp));
+            json.field("isColo", false);
+            json.field("penwidth", 5.0);
+            json.field("source", parentNodes[i].name);
+            json.field("style", "dashed");
+            json.field("target", parentNodes[i+1].name);
+            json.field("type", "temporal");
+            json.endObject();
+            ++linkCount;
         }
     }
-
-    std::ofstream out(outPathStr);
-    if (!out) {
-        std::cerr << "[exportParentGraphToJson] Cannot open " << outPathStr << " for write\n";
-        return false;
+    json.endArray();
+
+    const EntityCatalog& catalog = entityCatalog();
+    std::string label;
+    json.key("nodes");
+    json.beginArray();
+    for (const ParentNodeRecord& node : parentRecords) {
+        label.clear();
+        if (showLabels) {
+            label.append(catalog.argName(node.argId)).append("+").append(catalog.mgeLabel(node.mgeId));
+        }
+        json.beginObject();
+        json.field("argId", node.argId);
+        json.field("color", getTimepointColor(node.tp));
+        json.key("diseaseCounts");
+        json.beginObject();
+        for (const auto& [diseaseName, count] : node.diseaseCounts) json.field(diseaseName, count);
+        json.endObject();
+        json.key("diseases");
+        json.beginArray();
+        for (const auto& [diseaseName, count] : node.diseaseCounts) json.value(diseaseName);
+        json.endArray();
+        json.field("id", node.name);
+        json.field("label", label);
+        json.field("mgeGroup", catalog.mgeGroupName(node.group));
+        json.field("mgeId", node.mgeId);
+        json.field("shape", getMGEGroupShape(node.group));
+        json.field("timepoint", static_cast<int>(node.tp));
+        json.field("timepointCategory", getTimepointCategory(node.tp));
+        json.endObject();
     }
-    out << j.dump(2) << '\n';
+    json.endArray();
 
-    std::cerr << "[exportParentGraphToJson] Wrote parent-nodes=" << j["nodes"].size()
-              << " links=" << j["links"].size()
+    json.endObject();
+    json.flush();
+    out << '\n';
+
+    std::cerr << "[exportParentGraphToJson] Wrote parent-nodes=" << parentRecords.size()
+              << " links=" << linkCount
               << " to " << outPathStr << "\n";
     return true;
 }
 
+bool exportParentGraphToJson(const Graph& g, const std::string& outPathStr, const std::map<int, std::string>& patientToDiseaseMap, bool showLabels, bool compact) {
+    return writeParentGraphJson(g.edges, outPathStr, patientToDiseaseMap, showLabels, compact);
+}
+
+bool exportParentGraphToJson(const GraphView& view, const std::string& outPathStr, const std::map<int, std::string>& patientToDiseaseMap, bool showLabels, bool compact) {
+    return writeParentGraphJson(view.edges(), outPathStr, patientToDiseaseMap, showLabels, compact);
+}
+
 
 
 // void exportColocalizationsToJSONByDisease(
@@ -360,11 +390,11 @@ bool exportParentGraphToJson(const Graph& g, const std::string& outPathStr, cons
 
 
 void exportColocalizationsToJSONByDisease(
-    const std::map<std::tuple<int,int,int>, std::set<Timepoint>>& colocalizationByIndividual,
+    const IndividualTimelines& colocalizationByIndividual,
     const std::map<int, std::string>& patientToDiseaseMap,
     const std::string& jsonOutputPath  // path to the final JSON file
 ) {
-    std::map<std::string, std::map<std::string, std::map<std::string, int>>> diseaseColocCounts;
+    std::map<std::string, std::map<std::pair<int,int>, std::map<std::string, int>>> diseaseColocCounts;
 
     // Build counts by disease → colocalization → status
     for (const auto& [tuple, tps] : colocalizationByIndividual) {
@@ -373,29 +403,37 @@ void exportColocalizationsToJSONByDisease(
         const int mgeID     = std::get<2>(tuple);
         std::string disease = patientToDiseaseMap.at(patientID);
 
-        bool hasDonor = std::any_of(tps.begin(), tps.end(), [](const Timepoint& tp){ return isDonor(tp); });
-        bool hasPre   = std::any_of(tps.begin(), tps.end(), [](const Timepoint& tp){ return isPreFMT(tp); });
-        bool hasPost  = std::any_of(tps.begin(), tps.end(), [](const Timepoint& tp){ return isPostFMT(tp); });
+        bool donor = hasDonor(tps);
+        bool pre   = hasPreFMT(tps);
+        bool post  = hasPostFMT(tps);
 
         std::string status;
-        if (hasPost && !hasPre && !hasDonor) status = "emerged";
-        else if (hasPre && !hasPost && !hasDonor) status = "disappeared";
-        else if (hasDonor && hasPost && !hasPre) status = "transferred";
-        else if (hasPre && hasPost) status = "persisted";
+        if (post && !pre && !donor) status = "emerged";
+        else if (pre && !post && !donor) status = "disappeared";
+        else if (donor && post && !pre) status = "transferred";
+        else if (pre && post) status = "persisted";
         else continue; // skip other patterns
 
-        std::string pairName = getARGName(argID) + "–" + getMGEName(mgeID);
-        diseaseColocCounts[disease][pairName][status]++;
+        diseaseColocCounts[disease][{argID, mgeID}][status]++;
     }
 
     // Build JSON structure
     json rootJson = json::object();  // use object instead of array
 
+    const EntityCatalog& catalog = entityCatalog();
     for (const auto& [disease, colocMap] : diseaseColocCounts) {
         json diseaseArray = json::array();
 
-        for (const auto& [pair, statusMap] : colocMap) {
-            for (const auto& [status, count] : statusMap) {
+        // Colocalizations are listed by "ARG–MGE" name
+        std::map<std::string, const std::map<std::string, int>*> byName;
+        for (const auto& [ids, statusMap] : colocMap) {
+            std::string pairName(catalog.argName(ids.first));
+            pairName.append("–").append(catalog.mgeName(ids.second));
+            byName.emplace(std::move(pairName), &statusMap);
+        }
+
+        for (const auto& [pair, statusMap] : byName) {
+            for (const auto& [status, count] : *statusMap) {
                 diseaseArray.push_back({
                     {"colocalization", pair},
                     {"status", status},
@@ -415,3 +453,65 @@ void exportColocalizationsToJSONByDisease(
     all << std::setw(2) << rootJson << std::endl;
     all.close();
 }
+
+
+static void writeEntityTimelines(JsonWriter& json, const std::vector<EntityTimeline>& timelines, bool isARG) {
+    const EntityCatalog& catalog = entityCatalog();
+    json.beginArray();
+    for (const EntityTimeline& timeline : timelines) {
+        json.beginObject();
+        json.field("id", timeline.id);
+        json.field("name", isARG ? catalog.argName(timeline.id) : catalog.mgeName(timeline.id));
+
+        json.key("partners");
+        json.beginArray();
+        for (const EntityPartnerTimeline& partner : timeline.partners) {
+            json.beginObject();
+            json.field("id", partner.partnerID);
+            json.field("name", isARG ? catalog.mgeName(partner.partnerID) : catalog.argName(partner.partnerID));
+            json.key("timepoints");
+            json.beginArray();
+            for (TimepointMask rest = partner.timepoints; rest; rest &= rest - 1) {
+                json.value(timepointName(timepointAt(countTrailingZeros64(rest))));
+            }
+            json.endArray();
+            json.endObject();
+        }
+        json.endArray();
+
+        json.key("timepoints");
+        json.beginArray();
+        for (int ordinal = 0; ordinal < kTimepointCount; ++ordinal) {
+            if (!timeline.degree[ordinal]) continue;
+            json.beginObject();
+            json.field("degree", static_cast<int>(timeline.degree[ordinal]));
+            json.field("timepoint", timepointName(timepointAt(ordinal)));
+            json.endObject();
+        }
+        json.endArray();
+        json.endObject();
+    }
+    json.endArray();
+}
+
+bool exportEntityTimelinesToJson(const EntityTimelineIndex& index, const std::string& outPathStr, bool compact) {
+    std::ofstream out(outPathStr);
+    if (!out) {
+        std::cerr << "[exportEntityTimelinesToJson] Cannot open " << outPathStr << " for write\n";
+        return false;
+    }
+    JsonWriter json(out, compact ? -1 : 2);
+    json.beginObject();
+    json.key("args");
+    writeEntityTimelines(json, index.args(), true);
+    json.key("mges");
+    writeEntityTimelines(json, index.mges(), false);
+    json.endObject();
+    json.flush();
+    out << '\n';
+
+    std::cerr << "[exportEntityTimelinesToJson] Wrote args=" << index.args().size()
+              << " mges=" << index.mges().size()
+              << " to " << outPathStr << "\n";
+    return true;
+}
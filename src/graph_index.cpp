@@ -0,0 +1,73 @@
+// Released under the GNU GPLv3; see LICENSE for details.
+// Developed by Boucher Lab and Slizovskiy Lab.
+
+#include <algorithm>
+#include <iostream>
+#include "../include/graph_index.h"
+
+static const std::vector<uint32_t> kNoEdges;
+
+const std::vector<uint32_t>& GraphIndex::argEdges(int argID) const {
+    auto it = coloEdgesByARG.find(argID);
+    return it != coloEdgesByARG.end() ? it->second : kNoEdges;
+}
+
+const std::vector<uint32_t>& GraphIndex::mgeEdges(int mgeID) const {
+    auto it = coloEdgesByMGE.find(mgeID);
+    return it != coloEdgesByMGE.end() ? it->second : kNoEdges;
+}
+
+const std::vector<uint32_t>& GraphIndex::mgeGroupEdges(CatalogCode group) const {
+    if (coloEdgesByMGEGroup.empty()) return kNoEdges;
+    return coloEdgesByMGEGroup[std::min<size_t>(group, coloEdgesByMGEGroup.size() - 1)];
+}
+
+void buildGraphIndex(const Graph& g, GraphIndex& index) {
+    index = GraphIndex{};
+    index.nodes.reserve(g.nodes.size());
+    index.nodeIndex.reserve(g.nodes.size());
+    for (const Node& node : g.nodes) {
+        index.nodeIndex.emplace(node, static_cast<uint32_t>(index.nodes.size()));
+        index.nodes.push_back(&node);
+    }
+
+    const EntityCatalog& catalog = entityCatalog();
+    const size_t groupSlots = catalog.mgeGroupNames.size() + 1;
+    index.coloEdgesByMGEGroup.resize(groupSlots);
+    index.temporalOffsets.assign(index.nodes.size() + 1, 0);
+
+    // Pass 1: resolve endpoints, list colocalization edges, count temporal out-degrees.
+    for (const Edge& edge : g.edges) {
+        auto source = index.nodeIndex.find(edge.source);
+        auto target = index.nodeIndex.find(edge.target);
+        if (source == index.nodeIndex.end() || target == index.nodeIndex.end()) {
+            std::cerr << "Warning: edge endpoint missing from graph nodes (ID " << edge.source.id << ", " << edge.target.id << ")\n";
+            continue;
+        }
+        uint32_t edgeId = static_cast<uint32_t>(index.edges.size());
+        index.edges.push_back(&edge);
+        index.edgeSources.push_back(source->second);
+        index.edgeTargets.push_back(target->second);
+
+        if (!edge.isColo) {
+            index.temporalOffsets[source->second + 1]++;
+            continue;
+        }
+        for (const Node* endpoint : {&edge.source, &edge.target}) {
+            if (endpoint->isARG) {
+                index.coloEdgesByARG[endpoint->id].push_back(edgeId);
+            } else {
+                index.coloEdgesByMGE[endpoint->id].push_back(edgeId);
+                index.coloEdgesByMGEGroup[std::min<size_t>(catalog.mgeGroup(endpoint->id), groupSlots - 1)].push_back(edgeId);
+            }
+        }
+    }
+
+    // Pass 2: temporal edges grouped by source node.
+    for (size_t n = 0; n < index.nodes.size(); ++n) index.temporalOffsets[n + 1] += index.temporalOffsets[n];
+    index.temporalEdgeIds.resize(index.temporalOffsets.back());
+    std::vector<uint32_t> fill(index.temporalOffsets.begin(), index.temporalOffsets.end() - 1);
+    for (uint32_t e = 0; e < index.edges.size(); ++e) {
+        if (!index.edges[e]->isColo) index.temporalEdgeIds[fill[index.edgeSources[e]]++] = e;
+    }
+}
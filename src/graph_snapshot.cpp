@@ -0,0 +1,420 @@
+// Released under the GNU GPLv3; see LICENSE for details.
+// Developed by Boucher Lab and Slizovskiy Lab.
+
+#include "../include/graph_snapshot.h"
+#include "../include/csv_reader.h"
+#include "../include/entity_catalog.h"
+#include <algorithm>
+#include <cstdint>
+#include <cstring>
+#include <fstream>
+#include <iostream>
+#include <type_traits>
+#include <unordered_map>
+#include <vector>
+
+#ifndef _WIN32
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+/* Save / load the built graph as a memory-mappable binary snapshot */
+
+namespace {
+
+// Bump whenever a record layout or the meaning of a field changes.
+constexpr std::uint32_t kSnapshotVersion = 3;
+constexpr char kSnapshotMagic[8] = {'C', 'O', 'N', 'E', 'T', 'S', 'N', 'P'};
+constexpr std::uint32_t kByteOrderMark = 0x01020304;
+
+enum SnapshotFlags : std::uint32_t {
+    kIncludeSNPConfirmationARGs = 1u << 0,
+    kExcludeMetals = 1u << 1,
+};
+
+// File layout: header, then the node, edge, patient-word, disease, string, timeline and
+// delta sections in that order, each padded to a multiple of 8 bytes.
+struct SnapshotHeader {
+    char magic[8];
+    std::uint32_t version;
+    std::uint32_t byteOrder;
+    std::uint64_t sourceSize;
+    std::int64_t sourceModified;
+    std::uint32_t flags;
+    std::uint32_t patientWords;   // 64-bit words per edge patient bitset
+    std::uint64_t nodeCount;
+    std::uint64_t edgeCount;
+    std::uint64_t diseaseCount;
+    std::uint64_t stringBytes;
+    std::uint64_t timelineCount;
+    std::uint64_t catalogFingerprint;   // of the entity catalog that resolved the labels
+    std::uint64_t deltaCount;
+};
+
+struct NodeRecord {
+    std::int32_t id;
+    std::uint8_t isARG;
+    std::uint8_t timepointOrdinal;
+    std::uint8_t requiresSNPConfirmation;
+    std::uint8_t reserved;
+};
+
+struct EdgeRecord {
+    std::uint32_t source;         // index into the node section
+    std::uint32_t target;
+    std::int32_t weight;
+    std::uint32_t isColo;
+};
+
+struct DiseaseRecord {
+    std::int32_t patientID;
+    std::uint32_t nameOffset;     // into the string section
+    std::uint32_t nameLength;
+    std::uint32_t reserved;
+};
+
+struct TimelineRecord {
+    std::int32_t patientID;
+    std::int32_t argID;
+    std::int32_t mgeID;
+    std::uint32_t reserved;
+    TimepointMask timepoints;     // bit i = timepoint with ordinal i
+};
+
+// A delta CSV appended to the cohort, stamped like the data file
+struct DeltaRecord {
+    std::uint64_t size;
+    std::int64_t modified;
+    std::uint32_t pathOffset;     // into the string section
+    std::uint32_t pathLength;
+};
+
+static_assert(sizeof(SnapshotHeader) == 96 && sizeof(NodeRecord) == 8 && sizeof(EdgeRecord) == 16 &&
+              sizeof(DiseaseRecord) == 16 && sizeof(TimelineRecord) == 24 && sizeof(DeltaRecord) == 24,
+              "snapshot records must not contain padding");
+static_assert(std::is_trivially_copyable_v<SnapshotHeader>, "snapshot records are copied as raw bytes");
+
+size_t padded(size_t bytes) { return (bytes + 7) & ~size_t{7}; }
+
+struct SourceStamp {
+    std::uint64_t size = 0;
+    std::int64_t modified = 0;
+};
+
+bool stampSource(const std::filesystem::path& dataFile, SourceStamp& stamp) {
+    std::error_code ec;
+    stamp.size = std::filesystem::file_size(dataFile, ec);
+    if (ec) return false;
+    auto modified = std::filesystem::last_write_time(dataFile, ec);
+    if (ec) return false;
+    stamp.modified = static_cast<std::int64_t>(modified.time_since_epoch().count());
+    return true;
+}
+
+std::uint32_t sourceFlags(const SnapshotSource& source) {
+    return (source.includeSNPConfirmationARGs ? kIncludeSNPConfirmationARGs : 0u) |
+           (source.excludeMetals ? kExcludeMetals : 0u);
+}
+
+template <typename T>
+void writeSection(std::ofstream& out, const std::vector<T>& records) {
+    size_t bytes = records.size() * sizeof(T);
+    out.write(reinterpret_cast<const char*>(records.data()), static_cast<std::streamsize>(bytes));
+    static const char zeros[8] = {};
+    out.write(zeros, static_cast<std::streamsize>(padded(bytes) - bytes));
+}
+
+// Read-only view of a whole file: mmap on POSIX, a single buffered read elsewhere.
+class MappedFile {
+public:
+    explicit MappedFile(const std::filesystem::path& filename) {
+#ifndef _WIN32
+        int fd = ::open(filename.c_str(), O_RDONLY);
+        if (fd < 0) return;
+        struct stat info;
+        if (::fstat(fd, &info) == 0 && info.st_size > 0) {
+            void* addr = ::mmap(nullptr, static_cast<size_t>(info.st_size), PROT_READ, MAP_PRIVATE, fd, 0);
+            if (addr != MAP_FAILED) {
+                data_ = static_cast<const char*>(addr);
+                size_ = static_cast<size_t>(info.st_size);
+            }
+        }
+        ::close(fd);
+#else
+        if (readFileToBuffer(filename, buffer_)) {
+            data_ = buffer_.data();
+            size_ = buffer_.size();
+        }
+#endif
+    }
+
+    ~MappedFile() {
+#ifndef _WIN32
+        if (data_) ::munmap(const_cast<char*>(data_), size_);
+#endif
+    }
+
+    MappedFile(const MappedFile&) = delete;
+    MappedFile& operator=(const MappedFile&) = delete;
+
+    const char* data() const { return data_; }
+    size_t size() const { return size_; }
+
+private:
+    const char* data_ = nullptr;
+    size_t size_ = 0;
+#ifdef _WIN32
+    std::string buffer_;
+#endif
+};
+
+// Where each section of a mapped snapshot starts; null if the file is not a complete snapshot
+// of this format version.
+struct SnapshotSections {
+    SnapshotHeader header;
+    const NodeRecord* nodes = nullptr;
+    const EdgeRecord* edges = nullptr;
+    const std::uint64_t* patients = nullptr;
+    const DiseaseRecord* diseases = nullptr;
+    const char* strings = nullptr;
+    const TimelineRecord* timelines = nullptr;
+    const DeltaRecord* deltas = nullptr;
+};
+
+bool mapSections(const MappedFile& file, const std::filesystem::path& snapshotFile, SnapshotSections& sections) {
+    if (file.size() < sizeof(SnapshotHeader)) return false;
+    SnapshotHeader& header = sections.header;
+    std::memcpy(&header, file.data(), sizeof(header));
+    if (std::memcmp(header.magic, kSnapshotMagic, sizeof(kSnapshotMagic)) != 0 || header.version != kSnapshotVersion ||
+        header.byteOrder != kByteOrderMark) {
+        return false;
+    }
+
+    size_t nodeBytes = padded(header.nodeCount * sizeof(NodeRecord));
+    size_t edgeBytes = padded(header.edgeCount * sizeof(EdgeRecord));
+    size_t patientBytes = padded(header.edgeCount * header.patientWords * sizeof(std::uint64_t));
+    size_t diseaseBytes = padded(header.diseaseCount * sizeof(DiseaseRecord));
+    size_t stringBytes = padded(header.stringBytes);
+    size_t timelineBytes = padded(header.timelineCount * sizeof(TimelineRecord));
+    size_t deltaBytes = padded(header.deltaCount * sizeof(DeltaRecord));
+    if (file.size() != sizeof(SnapshotHeader) + nodeBytes + edgeBytes + patientBytes + diseaseBytes + stringBytes + timelineBytes + deltaBytes) {
+        std::cerr << "Warning: Ignoring truncated graph snapshot: " << snapshotFile << std::endl;
+        return false;
+    }
+
+    const char* cursor = file.data() + sizeof(SnapshotHeader);
+    auto section = [&cursor](size_t bytes) {
+        const char* begin = cursor;
+        cursor += bytes;
+        return begin;
+    };
+    sections.nodes = reinterpret_cast<const NodeRecord*>(section(nodeBytes));
+    sections.edges = reinterpret_cast<const EdgeRecord*>(section(edgeBytes));
+    sections.patients = reinterpret_cast<const std::uint64_t*>(section(patientBytes));
+    sections.diseases = reinterpret_cast<const DiseaseRecord*>(section(diseaseBytes));
+    sections.strings = section(stringBytes);
+    sections.timelines = reinterpret_cast<const TimelineRecord*>(section(timelineBytes));
+    sections.deltas = reinterpret_cast<const DeltaRecord*>(section(deltaBytes));
+    return true;
+}
+
+bool readDeltaPaths(const SnapshotSections& sections, std::vector<std::filesystem::path>& paths) {
+    const SnapshotHeader& header = sections.header;
+    for (size_t i = 0; i < header.deltaCount; ++i) {
+        const DeltaRecord& record = sections.deltas[i];
+        if (std::uint64_t{record.pathOffset} + record.pathLength > header.stringBytes) return false;
+        paths.emplace_back(std::string(sections.strings + record.pathOffset, record.pathLength));
+    }
+    return true;
+}
+
+} // namespace
+
+bool saveGraphSnapshot(const std::filesystem::path& snapshotFile, const SnapshotSource& source, const Graph& graph,
+                       const std::map<int, std::string>& patientToDiseaseMap,
+                       const IndividualTimelines& colocalizationByIndividual) {
+    SourceStamp stamp;
+    if (!stampSource(source.dataFile, stamp)) {
+        std::cerr << "Warning: Not writing graph snapshot, cannot stat " << source.dataFile << std::endl;
+        return false;
+    }
+
+    std::vector<NodeRecord> nodes;
+    std::unordered_map<Node, std::uint32_t> nodeIndex;
+    nodes.reserve(graph.nodes.size());
+    for (const Node& node : graph.nodes) {
+        nodeIndex.emplace(node, static_cast<std::uint32_t>(nodes.size()));
+        nodes.push_back({node.id, node.isARG, static_cast<std::uint8_t>(timepointOrdinal(node.timepoint)),
+                         node.requiresSNPConfirmation, 0});
+    }
+
+    size_t patientWords = 0;
+    for (const Edge& edge : graph.edges) patientWords = std::max(patientWords, edge.individuals.words().size());
+
+    std::vector<EdgeRecord> edges;
+    std::vector<std::uint64_t> patients(graph.edges.size() * patientWords, 0);
+    edges.reserve(graph.edges.size());
+    for (const Edge& edge : graph.edges) {
+        auto source = nodeIndex.find(edge.source);
+        auto target = nodeIndex.find(edge.target);
+        if (source == nodeIndex.end() || target == nodeIndex.end()) {
+            std::cerr << "Warning: Not writing graph snapshot, edge endpoint missing from node set" << std::endl;
+            return false;
+        }
+        const auto& words = edge.individuals.words();
+        std::copy(words.begin(), words.end(), patients.begin() + edges.size() * patientWords);
+        edges.push_back({source->second, target->second, edge.weight, edge.isColo});
+    }
+
+    std::vector<DiseaseRecord> diseases;
+    std::vector<char> strings;
+    for (const auto& [patientID, disease] : patientToDiseaseMap) {
+        diseases.push_back({patientID, static_cast<std::uint32_t>(strings.size()), static_cast<std::uint32_t>(disease.size()), 0});
+        strings.insert(strings.end(), disease.begin(), disease.end());
+    }
+
+    std::vector<DeltaRecord> deltas;
+    for (const std::filesystem::path& deltaFile : source.appliedDeltas) {
+        SourceStamp deltaStamp;
+        if (!stampSource(deltaFile, deltaStamp)) {
+            std::cerr << "Warning: Not writing graph snapshot, cannot stat " << deltaFile << std::endl;
+            return false;
+        }
+        std::string path = deltaFile.string();
+        deltas.push_back({deltaStamp.size, deltaStamp.modified, static_cast<std::uint32_t>(strings.size()), static_cast<std::uint32_t>(path.size())});
+        strings.insert(strings.end(), path.begin(), path.end());
+    }
+
+    std::vector<TimelineRecord> timelines;
+    timelines.reserve(colocalizationByIndividual.size());
+    for (const auto& [key, timepoints] : colocalizationByIndividual) {
+        timelines.push_back({std::get<0>(key), std::get<1>(key), std::get<2>(key), 0, timepoints});
+    }
+
+    SnapshotHeader header = {};
+    std::memcpy(header.magic, kSnapshotMagic, sizeof(kSnapshotMagic));
+    header.version = kSnapshotVersion;
+    header.byteOrder = kByteOrderMark;
+    header.sourceSize = stamp.size;
+    header.sourceModified = stamp.modified;
+    header.flags = sourceFlags(source);
+    header.patientWords = static_cast<std::uint32_t>(patientWords);
+    header.nodeCount = nodes.size();
+    header.edgeCount = edges.size();
+    header.diseaseCount = diseases.size();
+    header.stringBytes = strings.size();
+    header.timelineCount = timelines.size();
+    header.catalogFingerprint = catalogFingerprint(entityCatalog());
+    header.deltaCount = deltas.size();
+
+    // Write next to the target and rename, so a reader never maps a half-written file.
+    std::error_code ec;
+    if (snapshotFile.has_parent_path()) std::filesystem::create_directories(snapshotFile.parent_path(), ec);
+    std::filesystem::path partial = snapshotFile;
+    partial += ".tmp";
+    {
+        std::ofstream out(partial, std::ios::binary | std::ios::trunc);
+        out.write(reinterpret_cast<const char*>(&header), sizeof(header));
+        writeSection(out, nodes);
+        writeSection(out, edges);
+        writeSection(out, patients);
+        writeSection(out, diseases);
+        writeSection(out, strings);
+        writeSection(out, timelines);
+        writeSection(out, deltas);
+        if (!out) {
+            std::cerr << "Warning: Could not write graph snapshot: " << partial << std::endl;
+            return false;
+        }
+    }
+    std::filesystem::rename(partial, snapshotFile, ec);
+    if (ec) {
+        std::cerr << "Warning: Could not write graph snapshot: " << snapshotFile << std::endl;
+        return false;
+    }
+    return true;
+}
+
+bool loadGraphSnapshot(const std::filesystem::path& snapshotFile, const SnapshotSource& source, Graph& graph,
+                       std::map<int, std::string>& patientToDiseaseMap,
+                       IndividualTimelines& colocalizationByIndividual) {
+    MappedFile file(snapshotFile);
+    SnapshotSections sections;
+    if (!mapSections(file, snapshotFile, sections)) return false;
+    const SnapshotHeader& header = sections.header;
+    if (header.flags != sourceFlags(source) || header.catalogFingerprint != catalogFingerprint(entityCatalog())) {
+        return false;
+    }
+
+    SourceStamp stamp;
+    if (!stampSource(source.dataFile, stamp) || stamp.size != header.sourceSize || stamp.modified != header.sourceModified) {
+        return false;
+    }
+
+    // The same delta files, in the same order, each unchanged since it was appended
+    std::vector<std::filesystem::path> deltaPaths;
+    if (!readDeltaPaths(sections, deltaPaths) || deltaPaths != source.appliedDeltas) return false;
+    for (size_t i = 0; i < deltaPaths.size(); ++i) {
+        if (!stampSource(deltaPaths[i], stamp) || stamp.size != sections.deltas[i].size || stamp.modified != sections.deltas[i].modified) {
+            return false;
+        }
+    }
+
+    size_t patientWords = header.patientWords;
+    const NodeRecord* nodeRecords = sections.nodes;
+    const EdgeRecord* edgeRecords = sections.edges;
+    const std::uint64_t* patientRecords = sections.patients;
+    const DiseaseRecord* diseaseRecords = sections.diseases;
+    const char* strings = sections.strings;
+    const TimelineRecord* timelineRecords = sections.timelines;
+
+    // Records were written in container order, so every insert goes at the end.
+    Graph loaded;
+    std::vector<Node> nodes;
+    nodes.reserve(header.nodeCount);
+    for (size_t i = 0; i < header.nodeCount; ++i) {
+        const NodeRecord& record = nodeRecords[i];
+        if (record.timepointOrdinal >= kTimepointCount) return false;
+        nodes.push_back({record.id, record.isARG != 0, timepointAt(record.timepointOrdinal), record.requiresSNPConfirmation != 0});
+        loaded.nodes.insert(loaded.nodes.end(), nodes.back());
+    }
+
+    for (size_t i = 0; i < header.edgeCount; ++i) {
+        const EdgeRecord& record = edgeRecords[i];
+        if (record.source >= nodes.size() || record.target >= nodes.size()) return false;
+        loaded.edges.insert(loaded.edges.end(), Edge{nodes[record.source], nodes[record.target], record.isColo != 0,
+                                                     PatientSet(patientRecords + i * patientWords, patientWords), record.weight});
+    }
+
+    std::map<int, std::string> diseases;
+    for (size_t i = 0; i < header.diseaseCount; ++i) {
+        const DiseaseRecord& record = diseaseRecords[i];
+        if (std::uint64_t{record.nameOffset} + record.nameLength > header.stringBytes) return false;
+        diseases.emplace_hint(diseases.end(), record.patientID, std::string(strings + record.nameOffset, record.nameLength));
+    }
+
+    std::vector<IndividualTimelines::value_type> timelineRows;
+    timelineRows.reserve(header.timelineCount);
+    for (size_t i = 0; i < header.timelineCount; ++i) {
+        const TimelineRecord& record = timelineRecords[i];
+        if (record.timepoints & ~kAllTimepointsMask) return false;
+        timelineRows.push_back({std::make_tuple(record.patientID, record.argID, record.mgeID), record.timepoints});
+    }
+    IndividualTimelines timelines;
+    timelines.add(std::move(timelineRows));
+
+    graph = std::move(loaded);
+    patientToDiseaseMap = std::move(diseases);
+    colocalizationByIndividual = std::move(timelines);
+    return true;
+}
+
+std::vector<std::filesystem::path> snapshotAppliedDeltas(const std::filesystem::path& snapshotFile) {
+    std::vector<std::filesystem::path> paths;
+    MappedFile file(snapshotFile);
+    SnapshotSections sections;
+    if (!mapSections(file, snapshotFile, sections) || !readDeltaPaths(sections, paths)) paths.clear();
+    return paths;
+}
@@ -3,8 +3,11 @@
 
 #include "graph_utils.h"
 #include "id_maps.h"
+#include "entity_catalog.h"
+#include <algorithm>
 #include <iostream>
 #include <unordered_set>
+#include <vector>
 
 Graph filterGraphByARGAndMGENames(const Graph& g, const std::string& argName, const std::string& mgeName) {
     int argID = getARGId(argName);
@@ -59,24 +62,26 @@ Graph filterGraphByARGAndMGENames(const Graph& g, const std::string& argName, co
     return subgraph;
 }
 
+// Whether tp falls in the "donor", "pre" or "post" timepoint category.
+static bool matchesTimepointCategory(Timepoint tp, const std::string& timepointCategory) {
+    if (timepointCategory == "donor") {
+        return tp == Timepoint::Donor;
+    }
+    if (timepointCategory == "pre") {
+        return tp == Timepoint::PreFMT;
+    }
+    if (timepointCategory == "post") {
+        return tp != Timepoint::Donor && tp != Timepoint::PreFMT;
+    }
+    return false;
+}
+
 Graph filterGraphByTimepoint(const Graph& g, const std::string& timepointCategory) {
     Graph subgraph;
 
-    auto matchesCategory = [&](Timepoint tp) {
-        if (timepointCategory == "donor") {
-            return tp == Timepoint::Donor;
-        }
-        if (timepointCategory == "pre") {
-            return tp == Timepoint::PreFMT;
-        }
-        if (timepointCategory == "post") {
-            return tp != Timepoint::Donor && tp != Timepoint::PreFMT;
-        }
-        return false;
-    };
-
     for (const auto& edge : g.edges) {
-        if (matchesCategory(edge.source.timepoint) && matchesCategory(edge.target.timepoint)) {
+        if (matchesTimepointCategory(edge.source.timepoint, timepointCategory) &&
+            matchesTimepointCategory(edge.target.timepoint, timepointCategory)) {
             subgraph.nodes.insert(edge.source);
             subgraph.nodes.insert(edge.target);
             subgraph.edges.insert(edge);
@@ -173,14 +178,9 @@ Graph filterGraphByMGEName(const Graph& g, const std::string& mgeName) {
 }
 
 Graph filterGraphByMGEGroup(const Graph& g, const std::string& groupName) {
-    std::unordered_set<int> mgeIDsInGroup;
-    for (const auto& [id, name] : mgeGroupMap) {
-        if (name == groupName) {
-            mgeIDsInGroup.insert(id);
-        }
-    }
-
-    if (mgeIDsInGroup.empty()) {
+    const EntityCatalog& catalog = entityCatalog();
+    CatalogCode group = catalog.findMGEGroup(groupName);
+    if (group == kNoCatalogCode) {
         std::cerr << "No MGEs found for group: " << groupName << "\n";
         return {};
     }
@@ -192,8 +192,8 @@ Graph filterGraphByMGEGroup(const Graph& g, const std::string& groupName) {
     for (const Edge& edge : g.edges) {
         if (!edge.isColo) continue;
 
-        bool sourceInGroup = !edge.source.isARG && mgeIDsInGroup.count(edge.source.id);
-        bool targetInGroup = !edge.target.isARG && mgeIDsInGroup.count(edge.target.id);
+        bool sourceInGroup = !edge.source.isARG && catalog.mgeGroup(edge.source.id) == group;
+        bool targetInGroup = !edge.target.isARG && catalog.mgeGroup(edge.target.id) == group;
 
         if (sourceInGroup || targetInGroup) {
             subgraph.edges.insert(edge);
@@ -220,9 +220,17 @@ Graph filterGraphByMGEGroup(const Graph& g, const std::string& groupName) {
 }
 
 
+DiseaseMasks buildDiseaseMasks(const std::map<int, std::string>& patientToDiseaseMap) {
+    DiseaseMasks masks;
+    for (const auto& [patientID, diseaseName] : patientToDiseaseMap) {
+        masks[diseaseName].insert(patientID);
+    }
+    return masks;
+}
+
 Graph filterGraphByDisease(const Graph& g, const std::string& disease, const std::map<int, std::string>& patientToDiseaseMap) {
     // Step 1: Find all patient IDs that match the target disease.
-    std::set<int> targetPatientIDs;
+    PatientSet targetPatientIDs;
     for (const auto& [patientID, diseaseName] : patientToDiseaseMap) {
         if (diseaseName == disease) {
             targetPatientIDs.insert(patientID);
@@ -238,12 +246,9 @@ Graph filterGraphByDisease(const Graph& g, const std::string& disease, const std
     std::unordered_set<Node> relevant_nodes;
     for (const auto& edge : g.edges) {
         if (!edge.isColo) continue;
-        for (int patientID : edge.individuals) {
-            if (targetPatientIDs.count(patientID)) {
-                relevant_nodes.insert(edge.source);
-                relevant_nodes.insert(edge.target);
-                break; 
-            }
+        if (edge.individuals.intersects(targetPatientIDs)) {
+            relevant_nodes.insert(edge.source);
+            relevant_nodes.insert(edge.target);
         }
     }
     
@@ -259,4 +264,129 @@ Graph filterGraphByDisease(const Graph& g, const std::string& disease, const std
     }
     
     return subgraph;
-}
\ No newline at end of file
+}
+
+
+/* Indexed drill-downs */
+
+static void sortUnique(std::vector<uint32_t>& ids) {
+    std::sort(ids.begin(), ids.end());
+    ids.erase(std::unique(ids.begin(), ids.end()), ids.end());
+}
+
+// The colocalization edges of coloEdgeIds accepted by keep, their endpoints and the temporal
+// edges between those endpoints.
+template <typename Keep>
+static GraphView indexedSubgraph(const GraphIndex& index, const std::vector<uint32_t>& coloEdgeIds, Keep keep) {
+    GraphView view(index);
+    std::vector<uint32_t> nodeIds;
+    for (uint32_t e : coloEdgeIds) {
+        if (!keep(*index.edges[e])) continue;
+        view.selectEdge(e);
+        nodeIds.push_back(index.edgeSources[e]);
+        nodeIds.push_back(index.edgeTargets[e]);
+    }
+    sortUnique(nodeIds);
+    for (uint32_t n : nodeIds) view.selectNode(n);
+
+    for (uint32_t n : nodeIds) {
+        for (uint32_t k = index.temporalOffsets[n]; k < index.temporalOffsets[n + 1]; ++k) {
+            uint32_t e = index.temporalEdgeIds[k];
+            if (view.hasNode(index.edgeTargets[e])) view.selectEdge(e);
+        }
+    }
+    return view;
+}
+
+static bool anyEdge(const Edge&) { return true; }
+
+GraphView filterGraphByARGName(const GraphIndex& index, const std::string& argName) {
+    int argID = getARGId(argName);
+    if (argID == -1) {
+        std::cerr << "ARG not found: " << argName << "\n";
+        return GraphView(index);
+    }
+    return indexedSubgraph(index, index.argEdges(argID), anyEdge);
+}
+
+GraphView filterGraphByMGEName(const GraphIndex& index, const std::string& mgeName) {
+    int mgeID = getMGEIdByName(mgeName);
+    if (mgeID == -1) {
+        std::cerr << "MGE not found: " << mgeName << "\n";
+        return GraphView(index);
+    }
+    return indexedSubgraph(index, index.mgeEdges(mgeID), anyEdge);
+}
+
+GraphView filterGraphByMGEGroup(const GraphIndex& index, const std::string& groupName) {
+    CatalogCode group = entityCatalog().findMGEGroup(groupName);
+    if (group == kNoCatalogCode) {
+        std::cerr << "No MGEs found for group: " << groupName << "\n";
+        return GraphView(index);
+    }
+    return indexedSubgraph(index, index.mgeGroupEdges(group), anyEdge);
+}
+
+GraphView filterGraphByARGAndMGENames(const GraphIndex& index, const std::string& argName, const std::string& mgeName) {
+    int argID = getARGId(argName);
+    if (argID == -1) {
+        std::cerr << "ARG not found: " << argName << "\n";
+        return GraphView(index);
+    }
+    int mgeID = getMGEIdByName(mgeName);
+    if (mgeID == -1) {
+        std::cerr << "MGE not found: " << mgeName << "\n";
+        return GraphView(index);
+    }
+
+    // The ARG's edge list, narrowed to edges whose other endpoint is the MGE
+    return indexedSubgraph(index, index.argEdges(argID), [argID, mgeID](const Edge& edge) {
+        return (edge.source.isARG && edge.source.id == argID && !edge.target.isARG && edge.target.id == mgeID) ||
+               (!edge.source.isARG && edge.source.id == mgeID && edge.target.isARG && edge.target.id == argID);
+    });
+}
+
+GraphView filterGraphByTimepoint(const GraphIndex& index, const std::string& timepointCategory) {
+    GraphView view(index);
+    for (uint32_t e = 0; e < index.edges.size(); ++e) {
+        const Edge& edge = *index.edges[e];
+        if (matchesTimepointCategory(edge.source.timepoint, timepointCategory) &&
+            matchesTimepointCategory(edge.target.timepoint, timepointCategory)) {
+            view.selectEdge(e);
+            view.selectNode(index.edgeSources[e]);
+            view.selectNode(index.edgeTargets[e]);
+        }
+    }
+
+    if (view.empty()) {
+        std::cerr << "Warning: No nodes found for timepoint category '" << timepointCategory 
+                  << "'. The resulting graph will be empty.\n";
+    }
+    return view;
+}
+
+GraphView filterGraphByDisease(const GraphIndex& index, const std::string& disease, const std::map<int, std::string>& patientToDiseaseMap) {
+    PatientSet targetPatientIDs;
+    for (const auto& [patientID, diseaseName] : patientToDiseaseMap) {
+        if (diseaseName == disease) targetPatientIDs.insert(patientID);
+    }
+
+    GraphView view(index);
+    if (targetPatientIDs.empty()) {
+        std::cerr << "Warning: No patients found for disease '" << disease << "'. The resulting graph will be empty.\n";
+        return view;
+    }
+
+    // Nodes of the disease's colocalizations, then every edge between two of them
+    for (uint32_t e = 0; e < index.edges.size(); ++e) {
+        const Edge& edge = *index.edges[e];
+        if (edge.isColo && edge.individuals.intersects(targetPatientIDs)) {
+            view.selectNode(index.edgeSources[e]);
+            view.selectNode(index.edgeTargets[e]);
+        }
+    }
+    for (uint32_t e = 0; e < index.edges.size(); ++e) {
+        if (view.hasNode(index.edgeSources[e]) && view.hasNode(index.edgeTargets[e])) view.selectEdge(e);
+    }
+    return view;
+}
@@ -0,0 +1,74 @@
+// Released under the GNU GPLv3; see LICENSE for details.
+// Developed by Boucher Lab and Slizovskiy Lab.
+
+#include <algorithm>
+#include <stdexcept>
+#include "../include/graph_view.h"
+
+static size_t wordsFor(size_t bits) { return (bits + 63) / 64; }
+
+// Calls fn(i) for every set bit i of words, in ascending order.
+template <typename Fn>
+static void forEachSetBit(const std::vector<std::uint64_t>& words, Fn&& fn) {
+    for (size_t w = 0; w < words.size(); ++w) {
+        for (std::uint64_t bits = words[w]; bits; bits &= bits - 1) {
+            fn(static_cast<uint32_t>(w * 64 + countTrailingZeros64(bits)));
+        }
+    }
+}
+
+static size_t countBits(const std::vector<std::uint64_t>& words) {
+    size_t total = 0;
+    for (std::uint64_t w : words) total += popcount64(w);
+    return total;
+}
+
+GraphView::GraphView(const GraphIndex& index)
+    : index_(&index), nodeWords_(wordsFor(index.nodes.size()), 0), edgeWords_(wordsFor(index.edges.size()), 0) {}
+
+GraphView GraphView::all(const GraphIndex& index) {
+    GraphView view(index);
+    for (uint32_t n = 0; n < index.nodes.size(); ++n) view.selectNode(n);
+    for (uint32_t e = 0; e < index.edges.size(); ++e) view.selectEdge(e);
+    return view;
+}
+
+size_t GraphView::nodeCount() const { return countBits(nodeWords_); }
+size_t GraphView::edgeCount() const { return countBits(edgeWords_); }
+
+// Intersecting the node masks as well would keep nodes that are in each view for a
+// different reason, and temporal edges between them; the nodes follow the shared
+// colocalization edges instead.
+GraphView& GraphView::operator&=(const GraphView& other) {
+    if (index_ != other.index_) throw std::invalid_argument("GraphView: views of different graph indexes");
+    for (size_t i = 0; i < edgeWords_.size(); ++i) edgeWords_[i] &= other.edgeWords_[i];
+    keepColocalizationEndpoints();
+    return *this;
+}
+
+void GraphView::keepColocalizationEndpoints() {
+    std::fill(nodeWords_.begin(), nodeWords_.end(), 0);
+    forEachSetBit(edgeWords_, [this](uint32_t e) {
+        if (!index_->edges[e]->isColo) return;
+        selectNode(index_->edgeSources[e]);
+        selectNode(index_->edgeTargets[e]);
+    });
+    forEachSetBit(edgeWords_, [this](uint32_t e) {
+        if (index_->edges[e]->isColo || (hasNode(index_->edgeSources[e]) && hasNode(index_->edgeTargets[e]))) return;
+        edgeWords_[e / 64] &= ~(std::uint64_t{1} << (e % 64));
+    });
+}
+
+GraphView& GraphView::operator|=(const GraphView& other) {
+    if (index_ != other.index_) throw std::invalid_argument("GraphView: views of different graph indexes");
+    for (size_t i = 0; i < nodeWords_.size(); ++i) nodeWords_[i] |= other.nodeWords_[i];
+    for (size_t i = 0; i < edgeWords_.size(); ++i) edgeWords_[i] |= other.edgeWords_[i];
+    return *this;
+}
+
+Graph GraphView::materialize() const {
+    Graph graph;
+    for (const Node& node : nodes()) graph.nodes.insert(graph.nodes.end(), node);
+    for (const Edge& edge : edges()) graph.edges.insert(graph.edges.end(), edge);
+    return graph;
+}
@@ -2,10826 +2,35 @@
 // Developed by Boucher Lab and Slizovskiy Lab.
 
 #include "../include/id_maps.h"
+#include "../include/entity_catalog.h"
 
 
-std::string getARGName(int id) {
-    auto it = argIdMap.find(id);
-    return it != argIdMap.end() ? it->second : "Unknown ARG";
-}
-
-std::string getMGEName(int id) {
-    auto it = mgeIdMap.find(id);
-    return it != mgeIdMap.end() ? it->second : "Unknown MGE";
-}
-
-std::string getMGENameForLabel(int id) {
-    auto it = mgeNameMap.find(id);
-    if (it != mgeNameMap.end()) {
-        return it->second;
-    }
-    return getMGEName(id);
-}
-
+// Convenience copies for console output; exporters read entityCatalog() directly.
+std::string getARGName(int id) { return std::string(entityCatalog().argName(id)); }
+std::string getMGEName(int id) { return std::string(entityCatalog().mgeName(id)); }
+std::string getMGENameForLabel(int id) { return std::string(entityCatalog().mgeLabel(id)); }
 
 std::string getARGGroupName(int id) {
-    auto it = argGroupMap.find(id);
-    return it != argGroupMap.end() ? it->second : "Unknown ARG Group";
+    const EntityCatalog& catalog = entityCatalog();
+    return std::string(catalog.argGroupName(catalog.argGroup(id)));
 }
 
 std::string getMGEGroupName(int id) {
-    auto it = mgeGroupMap.find(id);
-    return it != mgeGroupMap.end() ? it->second : "Unknown MGE Group";
+    const EntityCatalog& catalog = entityCatalog();
+    return std::string(catalog.mgeGroupName(catalog.mgeGroup(id)));
 }
 
+int getARGId(std::string_view name) { return entityCatalog().findARG(name); }
+int getMGEId(std::string_view name) { return entityCatalog().findMGE(name); }
+int getMGEIdByName(std::string_view name) { return entityCatalog().findMGEByLabel(name); }
 
-int getARGId(const std::string& name) {
-    for (const auto& [id, argName] : argIdMap) {
-        if (argName == name)
-            return id;
-    }
-    return -1; // Not found
-}
-
-int getMGEId(const std::string& name) {
-    for (const auto& [id, mgeName] : mgeIdMap) {
-        if (mgeName == name)
-            return id;
-    }
-    return -1; // Not found
-}
-
-int getMGEIdByName(const std::string& name) {
-    for (const auto& [id, mgeName] : mgeNameMap) {
-        if (mgeName == name)
-            return id;
-    }
-    for (const auto& [id, mgeName] : mgeIdMap) {
-        if (mgeName == name)
-            return id;
+// Lowest ARG id in the named ARG group, or -1.
+int getARGGroupId(std::string_view name) {
+    const EntityCatalog& catalog = entityCatalog();
+    CatalogCode group = catalog.findARGGroup(name);
+    if (group == kNoCatalogCode) return -1;
+    for (size_t i = 0; i < catalog.argIds.size(); ++i) {
+        if (catalog.argGroups[i] == group) return catalog.argIds[i];
     }
     return -1;
 }
-
-int getARGGroupId(const std::string& name) {
-    for (const auto& [id, groupName] : argGroupMap) {
-        if (groupName == name)
-            return id;
-    }
-    return -1; // Not found
-}
-
-const std::unordered_map<int, std::string> argIdMap = {
-    {1, "A16S"},
-    {2, "AAC3"},
-    {3, "AAC6-PRIME"},
-    {4, "ACN"},
-    {5, "ACRA"},
-    {6, "ACRB"},
-    {7, "ACRD"},
-    {8, "ACRR"},
-    {9, "ACRS"},
-    {10, "AMPCR"},
-    {11, "AMPH"},
-    {12, "ANT3-DPRIME"},
-    {13, "ANT6"},
-    {14, "APH3-DPRIME"},
-    {15, "APH3-PRIME"},
-    {16, "APH6"},
-    {17, "ARIR"},
-    {18, "ARNT"},
-    {19, "ARR"},
-    {20, "ARSA"},
-    {21, "ARSB"},
-    {22, "ARSBM"},
-    {23, "ARSCM"},
-    {24, "ARSDM"},
-    {25, "ARSP"},
-    {26, "ARSRM"},
-    {27, "ASMA"},
-    {28, "ASR"},
-    {29, "BACA"},
-    {30, "BAES"},
-    {31, "BCR"},
-    {32, "BHSA"},
-    {33, "BLA1"},
-    {34, "BLAEC"},
-    {35, "BLAZ"},
-    {36, "CADX"},
-    {37, "CAP16S"},
-    {38, "CATA"},
-    {39, "CDEA"},
-    {40, "CEPA"},
-    {41, "CEPAB"},
-    {42, "CFX"},
-    {43, "CHAA"},
-    {44, "CLS"},
-    {45, "CMY"},
-    {46, "COMR"},
-    {47, "COPA"},
-    {48, "CORA"},
-    {49, "CORB"},
-    {50, "CORC"},
-    {51, "CPXAR"},
-    {52, "CRP"},
-    {53, "CTX"},
-    {54, "CUEO"},
-    {55, "CUER"},
-    {56, "CUID"},
-    {57, "CUSA"},
-    {58, "CUSB"},
-    {59, "CUSC"},
-    {60, "CUSR"},
-    {61, "CUSS"},
-    {62, "CUTA"},
-    {63, "CUTC"},
-    {64, "DFRA"},
-    {65, "DFRC"},
-    {66, "DFRE"},
-    {67, "DFRF"},
-    {68, "DHA"},
-    {69, "DNAK"},
-    {70, "DSBA"},
-    {71, "DSBC"},
-    {72, "EATAV"},
-    {73, "EFMA"},
-    {74, "EMEA"},
-    {75, "EMMDR"},
-    {76, "EMRB"},
-    {77, "EMRD"},
-    {78, "EMRK"},
-    {79, "EMRR"},
-    {80, "EMRY"},
-    {81, "EPTA"},
-    {82, "EPTB"},
-    {83, "ERMB"},
-    {84, "ERMC"},
-    {85, "ERMF"},
-    {86, "ERMX"},
-    {87, "EVGA"},
-    {88, "FABG"},
-    {89, "FABI"},
-    {90, "FECD"},
-    {91, "FETA"},
-    {92, "FETB"},
-    {93, "FIEF"},
-    {94, "FLOR"},
-    {95, "FOLP"},
-    {96, "FOSA"},
-    {97, "FUSA"},
-    {98, "GADA"},
-    {99, "GADC"},
-    {100, "GADX"},
-    {101, "GLPF"},
-    {102, "GLPT"},
-    {103, "GYRA"},
-    {104, "GYRB"},
-    {105, "GYRBA"},
-    {106, "HDEA"},
-    {107, "HNS"},
-    {108, "ICLR"},
-    {109, "ILES"},
-    {110, "KDEA"},
-    {111, "KDPE"},
-    {112, "KEXD"},
-    {113, "KMRA"},
-    {114, "KPC"},
-    {115, "KPN"},
-    {116, "KPNE"},
-    {117, "KPNF"},
-    {118, "KPNO"},
-    {119, "LEN"},
-    {120, "LMRD"},
-    {121, "LNUA"},
-    {122, "LNUC"},
-    {123, "LNUG"},
-    {124, "LPDT"},
-    {125, "LPTD"},
-    {126, "LSA"},
-    {127, "MARA"},
-    {128, "MARR"},
-    {129, "MCR"},
-    {130, "MDE"},
-    {131, "MDFA"},
-    {132, "MDTA"},
-    {133, "MDTB"},
-    {134, "MDTJ"},
-    {135, "MDTK"},
-    {136, "MDTM"},
-    {137, "MECA"},
-    {138, "MEFA"},
-    {139, "MEFE"},
-    {140, "MERA"},
-    {141, "MERD"},
-    {142, "MERR"},
-    {143, "MERR1"},
-    {144, "MERR2"},
-    {145, "MERT"},
-    {146, "MGTA"},
-    {147, "MLS23S"},
-    {148, "MNTH"},
-    {149, "MNTP"},
-    {150, "MNTR"},
-    {151, "MODA"},
-    {152, "MODC"},
-    {153, "MPHA"},
-    {154, "MPRF"},
-    {155, "MSBA"},
-    {156, "MSRD"},
-    {157, "MURA"},
-    {158, "MVRC"},
-    {159, "NCRA"},
-    {160, "NCRAN"},
-    {161, "NFSA"},
-    {162, "NHAA"},
-    {163, "NHAB"},
-    {164, "NIKC"},
-    {165, "NIRA"},
-    {166, "NMPC"},
-    {167, "NORA"},
-    {168, "O23S"},
-    {169, "OMP36"},
-    {170, "OMP37"},
-    {171, "OMPA"},
-    {172, "OMPD"},
-    {173, "OMPF"},
-    {174, "OMPFB"},
-    {175, "OMPK36"},
-    {176, "OQXA"},
-    {177, "OQXB"},
-    {178, "ORN"},
-    {179, "OXA"},
-    {180, "OXY"},
-    {181, "OXYRKP"},
-    {182, "PARC"},
-    {183, "PARE"},
-    {184, "PAREF"},
-    {185, "PATB"},
-    {186, "PBP4B"},
-    {187, "PCOA"},
-    {188, "PCOE"},
-    {189, "PHOB"},
-    {190, "PHOR"},
-    {191, "PITA"},
-    {192, "PMRF"},
-    {193, "PSTC"},
-    {194, "PSTS"},
-    {195, "PTSL"},
-    {196, "QACEDELTA1"},
-    {197, "QACG"},
-    {198, "QNRB"},
-    {199, "QNRD"},
-    {200, "QNRS"},
-    {201, "RAMR"},
-    {202, "RCNR"},
-    {203, "RMTC"},
-    {204, "ROBA"},
-    {205, "RPOB"},
-    {206, "RPOS"},
-    {207, "RPSA"},
-    {208, "RPSL"},
-    {209, "RRS"},
-    {210, "RRSA"},
-    {211, "RRSC"},
-    {212, "RRSH"},
-    {213, "SAT"},
-    {214, "SDEY"},
-    {215, "SHV"},
-    {216, "SILA"},
-    {217, "SILB"},
-    {218, "SILC"},
-    {219, "SILE"},
-    {220, "SILF"},
-    {221, "SILP"},
-    {222, "SILS"},
-    {223, "SITABCD"},
-    {224, "SMDA"},
-    {225, "SMVA"},
-    {226, "SODA"},
-    {227, "SODB"},
-    {228, "SOXRB"},
-    {229, "SUGE"},
-    {230, "SULI"},
-    {231, "SULII"},
-    {232, "SULIII"},
-    {233, "TEHA"},
-    {234, "TEM"},
-    {235, "TERB"},
-    {236, "TERD"},
-    {237, "TERW"},
-    {238, "TERZ"},
-    {239, "TET16S"},
-    {240, "TET40"},
-    {241, "TETA"},
-    {242, "TETA46"},
-    {243, "TETB"},
-    {244, "TETD"},
-    {245, "TETM"},
-    {246, "TETO"},
-    {247, "TETQ"},
-    {248, "TETR"},
-    {249, "TETW"},
-    {250, "TETX"},
-    {251, "TOLC"},
-    {252, "TUFAB"},
-    {253, "UGD"},
-    {254, "UHPT"},
-    {255, "VANC"},
-    {256, "VANHA"},
-    {257, "VANRA"},
-    {258, "YBTP"},
-    {259, "YCHH"},
-    {260, "YDEI"},
-    {261, "YDEO"},
-    {262, "YDEP"},
-    {263, "YGJH"},
-    {264, "YJAA"},
-    {265, "YJCG"},
-    {266, "YODB"},
-    {267, "YOGI"},
-    {268, "ZINT"},
-    {269, "ZNTA"},
-    {270, "ZNTR"},
-    {271, "ZNUA"},
-    {272, "ZNUC"},
-    {273, "ZRAS"},
-    {274, "ZUPT"},
-    {275, "ZUR"}
-};
-
-const std::unordered_map<int, bool> argIDSNPConfirmation = {
-    {1, true},
-    {2, false},
-    {3, false},
-    {4, false},
-    {5, false},
-    {6, true},
-    {7, false},
-    {8, true},
-    {9, false},
-    {10, true},
-    {11, false},
-    {12, false},
-    {13, false},
-    {14, false},
-    {15, false},
-    {16, false},
-    {17, false},
-    {18, false},
-    {19, false},
-    {20, false},
-    {21, false},
-    {22, false},
-    {23, false},
-    {24, false},
-    {25, false},
-    {26, false},
-    {27, false},
-    {28, false},
-    {29, false},
-    {30, false},
-    {31, false},
-    {32, false},
-    {33, false},
-    {34, false},
-    {35, false},
-    {36, false},
-    {37, true},
-    {38, false},
-    {39, false},
-    {40, false},
-    {41, false},
-    {42, false},
-    {43, false},
-    {44, true},
-    {45, false},
-    {46, false},
-    {47, false},
-    {48, false},
-    {49, false},
-    {50, false},
-    {51, false},
-    {52, false},
-    {53, false},
-    {54, false},
-    {55, false},
-    {56, false},
-    {57, false},
-    {58, false},
-    {59, false},
-    {60, false},
-    {61, false},
-    {62, false},
-    {63, false},
-    {64, false},
-    {65, true},
-    {66, false},
-    {67, false},
-    {68, false},
-    {69, false},
-    {70, false},
-    {71, false},
-    {72, true},
-    {73, false},
-    {74, false},
-    {75, false},
-    {76, false},
-    {77, false},
-    {78, false},
-    {79, false},
-    {80, false},
-    {81, false},
-    {82, false},
-    {83, false},
-    {84, false},
-    {85, false},
-    {86, false},
-    {87, false},
-    {88, true},
-    {89, false},
-    {90, false},
-    {91, false},
-    {92, false},
-    {93, false},
-    {94, false},
-    {95, true},
-    {96, false},
-    {97, true},
-    {98, false},
-    {99, false},
-    {100, false},
-    {101, false},
-    {102, true},
-    {103, true},
-    {104, true},
-    {105, true},
-    {106, false},
-    {107, false},
-    {108, false},
-    {109, true},
-    {110, false},
-    {111, false},
-    {112, false},
-    {113, false},
-    {114, false},
-    {115, false},
-    {116, false},
-    {117, false},
-    {118, false},
-    {119, false},
-    {120, false},
-    {121, false},
-    {122, false},
-    {123, false},
-    {124, false},
-    {125, false},
-    {126, false},
-    {127, false},
-    {128, false},
-    {129, false},
-    {130, false},
-    {131, false},
-    {132, false},
-    {133, false},
-    {134, false},
-    {135, false},
-    {136, false},
-    {137, false},
-    {138, false},
-    {139, false},
-    {140, false},
-    {141, false},
-    {142, false},
-    {143, false},
-    {144, false},
-    {145, false},
-    {146, false},
-    {147, true},
-    {148, false},
-    {149, false},
-    {150, false},
-    {151, false},
-    {152, false},
-    {153, false},
-    {154, false},
-    {155, false},
-    {156, false},
-    {157, true},
-    {158, false},
-    {159, false},
-    {160, false},
-    {161, false},
-    {162, false},
-    {163, false},
-    {164, false},
-    {165, false},
-    {166, false},
-    {167, false},
-    {168, true},
-    {169, true},
-    {170, false},
-    {171, false},
-    {172, false},
-    {173, true},
-    {174, true},
-    {175, true},
-    {176, false},
-    {177, false},
-    {178, false},
-    {179, false},
-    {180, false},
-    {181, false},
-    {182, true},
-    {183, true},
-    {184, true},
-    {185, false},
-    {186, false},
-    {187, false},
-    {188, false},
-    {189, true},
-    {190, false},
-    {191, false},
-    {192, false},
-    {193, false},
-    {194, false},
-    {195, true},
-    {196, false},
-    {197, false},
-    {198, false},
-    {199, false},
-    {200, false},
-    {201, true},
-    {202, false},
-    {203, false},
-    {204, false},
-    {205, true},
-    {206, false},
-    {207, true},
-    {208, true},
-    {209, true},
-    {210, true},
-    {211, true},
-    {212, true},
-    {213, false},
-    {214, false},
-    {215, false},
-    {216, false},
-    {217, false},
-    {218, false},
-    {219, false},
-    {220, false},
-    {221, false},
-    {222, false},
-    {223, false},
-    {224, false},
-    {225, false},
-    {226, false},
-    {227, false},
-    {228, false},
-    {229, false},
-    {230, false},
-    {231, false},
-    {232, false},
-    {233, false},
-    {234, false},
-    {235, false},
-    {236, false},
-    {237, false},
-    {238, false},
-    {239, true},
-    {240, false},
-    {241, false},
-    {242, false},
-    {243, false},
-    {244, false},
-    {245, false},
-    {246, false},
-    {247, false},
-    {248, true},
-    {249, false},
-    {250, false},
-    {251, false},
-    {252, true},
-    {253, false},
-    {254, true},
-    {255, false},
-    {256, false},
-    {257, false},
-    {258, false},
-    {259, false},
-    {260, false},
-    {261, false},
-    {262, false},
-    {263, false},
-    {264, false},
-    {265, false},
-    {266, false},
-    {267, false},
-    {268, false},
-    {269, false},
-    {270, false},
-    {271, false},
-    {272, false},
-    {273, false},
-    {274, false},
-    {275, false}
-};
-
-const std::unordered_map<int, std::string> mgeNameMap = {
-    {1001, "Col3M_1__JX514065"},
-{1002, "FII(pBK30683)_1__KF954760"},
-{1003, "ISMae23"},
-{1004, "ISSod5"},
-{1005, "ISEhe4"},
-{1006, "ISCco4"},
-{1007, "ISBcy1"},
-{1008, "ISCco2"},
-{1009, "ISGba2"},
-{1010, "ISEch6"},
-{1011, "ISLgar5"},
-{1012, "ISAcma24"},
-{1013, "ISBope1"},
-{1014, "ISBaov1"},
-{1015, "ISKpn53"},
-{1016, "IS1191"},
-{1017, "IncB/O/K/Z_2__GU256641"},
-{1018, "IncFIA(HI1)_1_HI1_AF250878"},
-{1019, "IncFII(S)_1__CP000858"},
-{1020, "IncFII(SARC14)_1_SARC14_JQ418540"},
-{1021, "IncFII_1_pKP91_CP000966"},
-{1022, "IncHI2_1__BX664015"},
-{1023, "IncI1_1_Alpha_AP005147"},
-{1024, "ISAzo13"},
-{1025, "ISPsy37"},
-{1026, "ISNma19"},
-{1027, "ISNvsp1"},
-{1028, "ISPpu35"},
-{1029, "P91278ORF_002"},
-{1030, "ISCaq1"},
-{1031, "IS15DII"},
-{1032, "ISCARN102"},
-{1033, "YPA_CD0061"},
-{1034, "ISBuhy1"},
-{1035, "ISPpa9"},
-{1036, "ISChy9"},
-{1037, "ISFsp17"},
-{1038, "ISBph1"},
-{1039, "SSP_RS12525"},
-{1040, "SDY_P027"},
-{1041, "ISNiba2"},
-{1042, "SDY_P093"},
-{1043, "SDY_P103"},
-{1044, "SDY_P059"},
-{1045, "SDY_P060"},
-{1046, "SDY_P061"},
-{1047, "ISAcp3"},
-{1048, "ISStvi1"},
-{1049, "ISPman1"},
-{1050, "ISMav7"},
-{1051, "ISAs30"},
-{1052, "ISPa63"},
-{1053, "ISMpo10"},
-{1054, "ISStsp5"},
-{1055, "ISKpn28"},
-{1056, "pO86A1_p028"},
-{1057, "pO86A1_p036"},
-{1058, "pO86A1_p129"},
-{1059, "pO86A1_p130"},
-{1060, "ISTwi1"},
-{1061, "ISSma5"},
-{1062, "ISAli15"},
-{1063, "ISLar1"},
-{1064, "ISVa11"},
-{1065, "ISAzs18"},
-{1066, "SC155"},
-{1067, "IS3506"},
-{1068, "ISHwa17"},
-{1069, "ISPle1"},
-{1070, "SC108"},
-{1071, "ISNpu15"},
-{1072, "ISHahy5"},
-{1073, "ISCth8"},
-{1074, "ISAlw27"},
-{1075, "ISAfa1"},
-{1076, "ISSphsp17"},
-{1077, "ISRel15"},
-{1078, "ISDka1"},
-{1079, "SC177"},
-{1080, "ISAeme17"},
-{1081, "ISKmi4"},
-{1082, "ISPko4"},
-{1083, "ISKpn52"},
-{1084, "ISCte5"},
-{1085, "ISMex43"},
-{1086, "ISMex43"},
-{1087, "ISLil1"},
-{1088, "ISTsu2"},
-{1089, "SC173"},
-{1090, "SC174"},
-{1091, "SC169"},
-{1092, "IS406"},
-{1093, "ISAasp1"},
-{1094, "ISVapa4"},
-{1095, "ISRba8"},
-{1096, "ISPep1"},
-{1097, "ISAfe4"},
-{1098, "IS641"},
-{1099, "ISNisp6"},
-{1100, "SC168"},
-{1101, "ISAnba1"},
-{1102, "ISSma9"},
-{1103, "ISDes1"},
-{1104, "ISHaha2"},
-{1105, "ISPa43"},
-{1106, "ISSlo1"},
-{1107, "ISSphsp22"},
-{1108, "ISCARN103"},
-{1109, "ISMav6"},
-{1110, "ISAzs32"},
-{1111, "Meso_4375"},
-{1112, "Meso_4376"},
-{1113, "YP_pCD93"},
-{1114, "ISPye31"},
-{1115, "ISCte8"},
-{1116, "ISNco1"},
-{1117, "ISTer1"},
-{1118, "ISAeca7"},
-{1119, "UTI89_P007"},
-{1120, "ISPa54"},
-{1121, "Tn5393"},
-{1122, "ISPa35"},
-{1123, "ISVa17"},
-{1124, "ISKpn71"},
-{1125, "ISVei6"},
-{1126, "ISHalh2"},
-{1127, "ISHel2"},
-{1128, "ISBlo10"},
-{1129, "ISGst5"},
-{1130, "ISPye45"},
-{1131, "ISCbo10"},
-{1132, "UTI89_P034"},
-{1133, "ISNml2"},
-{1134, "UTI89_P038"},
-{1135, "UTI89_P039"},
-{1136, "UTI89_P044"},
-{1137, "UTI89_P067"},
-{1138, "ISDds1"},
-{1139, "ISPa85"},
-{1140, "ISPye17"},
-{1141, "ISNamo21"},
-{1142, "ISNph3"},
-{1143, "ISCARN97"},
-{1144, "ISSde13"},
-{1145, "ISRhosp2"},
-{1146, "ISActu1"},
-{1147, "TnXax1"},
-{1148, "TnBth2"},
-{1149, "ISHvo14"},
-{1150, "ISGys1"},
-{1151, "ISPa20"},
-{1152, "ISRel15"},
-{1153, "TnShfr1"},
-{1154, "ISAlg1"},
-{1155, "ISBce2"},
-{1156, "LH0113"},
-{1157, "ISThma1"},
-{1158, "ISSma27"},
-{1159, "ISWpi13"},
-{1160, "LH0187"},
-{1161, "LH0188"},
-{1162, "ISKox3"},
-{1163, "LH0151"},
-{1164, "LH0156"},
-{1165, "ISMhu7"},
-{1166, "ISBlo6"},
-{1167, "ISSma15"},
-{1168, "ISVbsp5"},
-{1169, "ISPsy41"},
-{1170, "ISCausp3"},
-{1171, "ISLil1"},
-{1172, "ISTvo5"},
-{1173, "LH0074"},
-{1174, "ISRhru5"},
-{1175, "ISHam2"},
-{1176, "ISShfr5"},
-{1177, "ISNml4"},
-{1178, "ISPosp5"},
-{1179, "ISDssp2"},
-{1180, "ISPa197"},
-{1181, "ISArsp6"},
-{1182, "ISBos1"},
-{1183, "ISSod21"},
-{1184, "ISCausp3"},
-{1185, "ISAoba1"},
-{1186, "ISBce14"},
-{1187, "ISMst1"},
-{1188, "ISHtu4"},
-{1189, "ISLve2"},
-{1190, "TnAs3"},
-{1191, "ISPeat2"},
-{1192, "IS200G"},
-{1193, "ISPpu36"},
-{1194, "ISHarch1"},
-{1195, "ISCco3"},
-{1196, "ISCth9"},
-{1197, "SSON_P007"},
-{1198, "SSON_P173"},
-{1199, "SSON_P188"},
-{1200, "SSON_P193"},
-{1201, "SSON_P202"},
-{1202, "ISPa111"},
-{1203, "SSON_P237"},
-{1204, "SSON_P070"},
-{1205, "pG8786_034"},
-{1206, "ISLiv1"},
-{1207, "ISTte3"},
-{1208, "ISSphsp18"},
-{1209, "ISCARN98"},
-{1210, "ISPsy2"},
-{1211, "ISPen1"},
-{1212, "ISHahy9"},
-{1213, "ISMin1"},
-{1214, "ISBli10"},
-{1215, "ISOpb2"},
-{1216, "ISCtet1"},
-{1217, "ISFba4"},
-{1218, "O2ColV194"},
-{1219, "ISClsp8"},
-{1220, "ISLmo10"},
-{1221, "ISHwa12"},
-{1222, "ISMahy8"},
-{1223, "ISDesp4"},
-{1224, "TnAs1"},
-{1225, "ISSaco2"},
-{1226, "ISCph11"},
-{1227, "ISLmo11"},
-{1228, "ISPlsp1"},
-{1229, "ISBrsp11"},
-{1230, "ISBuhy1"},
-{1231, "ISEc47"},
-{1232, "ISClsp4"},
-{1233, "ISCre2"},
-{1234, "ISAasp1"},
-{1235, "ISLiv3"},
-{1236, "ISCsp3"},
-{1237, "O2ColV174"},
-{1238, "ISMco4"},
-{1239, "ISBvi2"},
-{1240, "O2ColV178"},
-{1241, "ISHhu9"},
-{1242, "O2ColV37"},
-{1243, "O2ColV38"},
-{1244, "ISSod14"},
-{1245, "TnAs2"},
-{1246, "ISAba64"},
-{1247, "ISCARN25"},
-{1248, "ISBosp1"},
-{1249, "ISKpn8"},
-{1250, "ISDeal1"},
-{1251, "IS200H"},
-{1252, "ISKpn28"},
-{1253, "O2ColV51"},
-{1254, "ISBcl1"},
-{1255, "Tn4430"},
-{1256, "ISAau1"},
-{1257, "ISChy9"},
-{1258, "ISPye8"},
-{1259, "ISHko4"},
-{1260, "ISHvo4"},
-{1261, "ISWpi13"},
-{1262, "ISHar6"},
-{1263, "ISCARN45"},
-{1264, "ISThu1"},
-{1265, "ISFw2"},
-{1266, "ISSphsp8"},
-{1267, "ISHahl1"},
-{1268, "ISCfr12"},
-{1269, "ISHco2"},
-{1270, "ISEc83"},
-{1271, "IS1X2"},
-{1272, "TnAs3"},
-{1273, "ISPph3"},
-{1274, "ISSphsp10"},
-{1275, "ISCbo6"},
-{1276, "ISMysp5"},
-{1277, "ISXca5"},
-{1278, "O2ColV69"},
-{1279, "O2ColV78"},
-{1280, "O2ColV79"},
-{1281, "O2ColV80"},
-{1282, "O2ColV81"},
-{1283, "O2ColV82"},
-{1284, "O2ColV83"},
-{1285, "O2ColV84"},
-{1286, "O2ColV85"},
-{1287, "ISHph1"},
-{1288, "ISSph3"},
-{1289, "ISRpa10"},
-{1290, "ISRso12"},
-{1291, "ISNpu2"},
-{1292, "O2ColV91"},
-{1293, "O2ColV93"},
-{1294, "O2ColV95"},
-{1295, "O2ColV96"},
-{1296, "IS3507"},
-{1297, "ISHtu2"},
-{1298, "ISMags1"},
-{1299, "ISBth13"},
-{1300, "ISPko4"},
-{1301, "ISCARN4"},
-{1302, "ISSma19"},
-{1303, "ISShsp4"},
-{1304, "ISShes11"},
-{1305, "pMOL30_100"},
-{1306, "ISLla3"},
-{1307, "ISNamo16"},
-{1308, "ISAs30"},
-{1309, "ISMno28"},
-{1310, "pSK639_p07"},
-{1311, "Neut_2562"},
-{1312, "Neut_2564"},
-{1313, "ISSme2"},
-{1314, "IS1356"},
-{1315, "IS231K"},
-{1316, "ISKpn47"},
-{1317, "ISRel3"},
-{1318, "ISCausp3"},
-{1319, "ISCysp11"},
-{1320, "ISRel16"},
-{1321, "pKJK5_39"},
-{1322, "ISAli10"},
-{1323, "ISMex41"},
-{1324, "pMS260_p04"},
-{1325, "ISShes11"},
-{1326, "ISSma18"},
-{1327, "ISHvo12"},
-{1328, "gene:plasmid:13101"},
-{1329, "ISMav7"},
-{1330, "ISAs30"},
-{1331, "ISPa63"},
-{1332, "ISMysp4"},
-{1333, "ISMpo10"},
-{1334, "ISMav7"},
-{1335, "ISAs30"},
-{1336, "ISPa63"},
-{1337, "ISBth19"},
-{1338, "ISBj11"},
-{1339, "ISCfr25"},
-{1340, "gene:plasmid:13249"},
-{1341, "ISSma21"},
-{1342, "ISWpi2"},
-{1343, "ISEnfa7"},
-{1344, "ISAba42"},
-{1345, "ISSeq2"},
-{1346, "ISSta1"},
-{1347, "ISPsy20"},
-{1348, "ISGvi4"},
-{1349, "ISSth1b"},
-{1350, "ISMac9"},
-{1351, "ISOmba1"},
-{1352, "TnBth2"},
-{1353, "ISCku3"},
-{1354, "ISVgsp1"},
-{1355, "ISHahy3"},
-{1356, "ISDet4"},
-{1357, "ISTfo1"},
-{1358, "ISHarch2"},
-{1359, "ISLhe63"},
-{1360, "ISAasp1"},
-{1361, "IS30D"},
-{1362, "ISNiba3"},
-{1363, "ISPph3"},
-{1364, "ISBsp4"},
-{1365, "ISSwo1"},
-{1366, "TnBth2"},
-{1367, "ISNamo8"},
-{1368, "ISCade1"},
-{1369, "ISMch5"},
-{1370, "ISPye33"},
-{1371, "ISAs30"},
-{1372, "ISAzo1"},
-{1373, "ISAs30"},
-{1374, "ISPye33"},
-{1375, "ISPye33"},
-{1376, "ISAs30"},
-{1377, "ISCef1"},
-{1378, "ISMgi2"},
-{1379, "IS1221A"},
-{1380, "pRE25p55"},
-{1381, "ISCsc1"},
-{1382, "LACR_D11"},
-{1383, "ISPasp3"},
-{1384, "ISDsp3"},
-{1385, "IS1151"},
-{1386, "ISDesu1"},
-{1387, "ISPaen1"},
-{1388, "ISPto7"},
-{1389, "ISCth13"},
-{1390, "ISMsi3"},
-{1391, "ISHma16"},
-{1392, "IS1549"},
-{1393, "ISKpn66"},
-{1394, "ISSpu12"},
-{1395, "ISPsy35"},
-{1396, "ISArsp6"},
-{1397, "ISFba4"},
-{1398, "ISAzo13"},
-{1399, "ISMno26"},
-{1400, "ISAlw14"},
-{1401, "ISSm3"},
-{1402, "ISVei2"},
-{1403, "ISRsp2"},
-{1404, "IS15"},
-{1405, "IS15DIV"},
-{1406, "ISAli15"},
-{1407, "P99018ORF_005"},
-{1408, "ISCaq1"},
-{1409, "ISEcl6"},
-{1410, "ISCbo10"},
-{1411, "ISHce1"},
-{1412, "ISAoba1"},
-{1413, "YE_RS21125"},
-{1414, "IS1000B"},
-{1415, "ISAtu2"},
-{1416, "ISHla9"},
-{1417, "ISClte2"},
-{1418, "ISMac7"},
-{1419, "ISAfer1"},
-{1420, "ISBlo6"},
-{1421, "IS605"},
-{1422, "ISOan2"},
-{1423, "ISPpu10"},
-{1424, "ISRme15"},
-{1425, "IS660"},
-{1426, "ISPfr18"},
-{1427, "ISAlw7"},
-{1428, "ISPosp5"},
-{1429, "O2R_109"},
-{1430, "O2R_110"},
-{1431, "ISSpn2"},
-{1432, "ISAjo4"},
-{1433, "ISTni2"},
-{1434, "ISKpn31"},
-{1435, "TnEc2"},
-{1436, "ISShes11"},
-{1437, "ISMsi3"},
-{1438, "ISMsi3"},
-{1439, "gene:plasmid:141403"},
-{1440, "ISPpu15"},
-{1441, "ISPlba3"},
-{1442, "ISNph29"},
-{1443, "ISGva2"},
-{1444, "ISSpal1"},
-{1445, "ISNwi4"},
-{1446, "ISCasp4"},
-{1447, "ISClj1"},
-{1448, "ISAbe14"},
-{1449, "ISPst2"},
-{1450, "ISWosp5"},
-{1451, "SBO_P109"},
-{1452, "SBO_P146"},
-{1453, "SBO_P009"},
-{1454, "SBO_P057"},
-{1455, "SBO_P061"},
-{1456, "ISPye50"},
-{1457, "SBO_P086"},
-{1458, "ISAs29"},
-{1459, "ISMpo8"},
-{1460, "pCTX-M3_004"},
-{1461, "ISCps6"},
-{1462, "ISAma5"},
-{1463, "ISGbr1"},
-{1464, "ISBmu30"},
-{1465, "ISSphsp19"},
-{1466, "ISPa64"},
-{1467, "ISPye9"},
-{1468, "IS1090"},
-{1469, "TnAs3"},
-{1470, "ISFnu2"},
-{1471, "ISMesp5"},
-{1472, "ISThsp8"},
-{1473, "ISMav6"},
-{1474, "ISBth20"},
-{1475, "IS406"},
-{1476, "pCTX-M3_077"},
-{1477, "ISHati3"},
-{1478, "ISNoc2"},
-{1479, "pCTX-M3_082"},
-{1480, "ISLcr2"},
-{1481, "ISFtu4"},
-{1482, "ISPa98"},
-{1483, "ISMae13"},
-{1484, "Tn4430"},
-{1485, "ISMae26"},
-{1486, "ISShes11"},
-{1487, "Sbal_4420"},
-{1488, "ISBlma4"},
-{1489, "YPN_MT0040"},
-{1490, "ISAli13"},
-{1491, "ISPa40"},
-{1492, "ISWpi1"},
-{1493, "ISHam1"},
-{1494, "ISSphsp2"},
-{1495, "ISRm14"},
-{1496, "ISNg1"},
-{1497, "ISGsp1"},
-{1498, "ISAcif1"},
-{1499, "pC15-1a_001"},
-{1500, "pC15-1a_045"},
-{1501, "pC15-1a_046"},
-{1502, "pC15-1a_047"},
-{1503, "ISCtet1"},
-{1504, "ISBcl1"},
-{1505, "ISChpi1"},
-{1506, "ISStma19"},
-{1507, "pC15-1a_014"},
-{1508, "SNSL254_pSN254_0142"},
-{1509, "pTP10_p01"},
-{1510, "pTP10_p02"},
-{1511, "ISPvu1"},
-{1512, "ISBmo1"},
-{1513, "pTP10_p30"},
-{1514, "pB8_004"},
-{1515, "ISDssp4"},
-{1516, "ISAtsp1"},
-{1517, "ISEfa7"},
-{1518, "ISLesp3"},
-{1519, "ISRsp2"},
-{1520, "ISBam2"},
-{1521, "ISAisp2"},
-{1522, "IST445"},
-{1523, "ISVisp1"},
-{1524, "pCoo068"},
-{1525, "pCoo069"},
-{1526, "pCoo070"},
-{1527, "ISBvu3"},
-{1528, "ISShdy3"},
-{1529, "TnBth1"},
-{1530, "ISMomu1"},
-{1531, "ISHor2"},
-{1532, "ISNesp1"},
-{1533, "TnXo19"},
-{1534, "ISMae2"},
-{1535, "pCoo061"},
-{1536, "pCoo058"},
-{1537, "pCoo062"},
-{1538, "ISBce18"},
-{1539, "TnBth2"},
-{1540, "ISBth6"},
-{1541, "ISPpu10"},
-{1542, "pCoo090"},
-{1543, "ISAau4"},
-{1544, "ISRor6"},
-{1545, "ISHwa12"},
-{1546, "ISPsko1"},
-{1547, "pCoo005"},
-{1548, "pCoo007"},
-{1549, "pCoo022"},
-{1550, "ISAeme17"},
-{1551, "ISShdy1"},
-{1552, "gene:plasmid:151429"},
-{1553, "ISNph23"},
-{1554, "ASA_P4G086"},
-{1555, "ISMex22"},
-{1556, "pUO1_39"},
-{1557, "pUO1_40"},
-{1558, "pUO1_41"},
-{1559, "pUO1_44"},
-{1560, "IS100X"},
-{1561, "ISRmsp1"},
-{1562, "ISPeth3"},
-{1563, "ISEisp1"},
-{1564, "ISHli14"},
-{1565, "ISVsa19"},
-{1566, "ISDaba1"},
-{1567, "ISChy3"},
-{1568, "ISCasp3"},
-{1569, "ISFac7"},
-{1570, "ISAzs22"},
-{1571, "ISPar1"},
-{1572, "ISLiv3"},
-{1573, "ISAlw22"},
-{1574, "ISLgar5"},
-{1575, "ISWch2"},
-{1576, "ISC1173a"},
-{1577, "ISVa17"},
-{1578, "ISAeme14"},
-{1579, "ISPfr21"},
-{1580, "IS5D"},
-{1581, "ISEcret9"},
-{1582, "ISAzvi6"},
-{1583, "ISTeha7"},
-{1584, "ISNamo22"},
-{1585, "ISAlw15"},
-{1586, "ISMyo2"},
-{1587, "ISBhu1"},
-{1588, "ISPa38"},
-{1589, "ISEae1"},
-{1590, "ISEhe3"},
-{1591, "ISGob5"},
-{1592, "ISPa97"},
-{1593, "ISVsp16"},
-{1594, "ISSysp7"},
-{1595, "ISLar4"},
-{1596, "ISLmo21"},
-{1597, "ISArsp14"},
-{1598, "ISFac11"},
-{1599, "ISBth7"},
-{1600, "ISKpn13"},
-{1601, "ISTca1"},
-{1602, "ISXau4"},
-{1603, "ISCb3"},
-{1604, "ISRpa1"},
-{1605, "ISEc27"},
-{1606, "ISLdr1"},
-{1607, "ISPssp4"},
-{1608, "ISLmo7"},
-{1609, "ISArch2"},
-{1610, "ISWpi1"},
-{1611, "ISAzs20"},
-{1612, "ISTvo2"},
-{1613, "ISGpa2"},
-{1614, "ISBlma6"},
-{1615, "ISPaac1"},
-{1616, "ISMba15"},
-{1617, "ISBli24"},
-{1618, "ISBth10"},
-{1619, "ISAau2"},
-{1620, "ISMex22"},
-{1621, "ISArsp8"},
-{1622, "ISTsu1"},
-{1623, "ISAps1"},
-{1624, "ISLad6"},
-{1625, "ISPa77"},
-{1626, "ISBfun4"},
-{1627, "ISLil2"},
-{1628, "ISAcma12"},
-{1629, "ISPa40"},
-{1630, "ISShfr7"},
-{1631, "ISAdh3"},
-{1632, "ISHam1"},
-{1633, "IS3509"},
-{1634, "ISAnsp4"},
-{1635, "ISFnu9"},
-{1636, "ISKqu3"},
-{1637, "ISCau1"},
-{1638, "ISMpo10"},
-{1639, "ISH7A"},
-{1640, "TnEc4"},
-{1641, "SMR0246"},
-{1642, "SMR0245"},
-{1643, "ISAme2"},
-{1644, "ISTgr1"},
-{1645, "ISCfe1"},
-{1646, "ISArsp7"},
-{1647, "ISKpn34"},
-{1648, "ISArsp14"},
-{1649, "IS1419"},
-{1650, "ISPst5"},
-{1651, "ISShfr4"},
-{1652, "ISAzvi2"},
-{1653, "ISBf6"},
-{1654, "ISVsp10"},
-{1655, "ISSisp1"},
-{1656, "ISMma10"},
-{1657, "ISMafe1"},
-{1658, "ISRsp8"},
-{1659, "SMR0116"},
-{1660, "ISCausp3"},
-{1661, "ISArsp15"},
-{1662, "ISShes13"},
-{1663, "ISLgr1"},
-{1664, "ISPpr7"},
-{1665, "ISPsy39"},
-{1666, "IS1221F"},
-{1667, "ISPa42"},
-{1668, "ISMags1"},
-{1669, "ISMssp1"},
-{1670, "ISSc1"},
-{1671, "ISMha7"},
-{1672, "ISPeat2"},
-{1673, "Tn4430"},
-{1674, "ISNhu2"},
-{1675, "ISSeq4"},
-{1676, "ISDssp2"},
-{1677, "IS1351"},
-{1678, "ISRhsp5"},
-{1679, "ISMin1"},
-{1680, "ISAnsp1"},
-{1681, "ISMlu2"},
-{1682, "ISAzs24"},
-{1683, "ISHma17"},
-{1684, "ISTgr1"},
-{1685, "IS1136"},
-{1686, "ISAli20"},
-{1687, "ISBli29"},
-{1688, "ISHli11"},
-{1689, "pFBAOT6.72"},
-{1690, "MITEAeme1"},
-{1691, "ISCARN33"},
-{1692, "ISDge1"},
-{1693, "ISAli18"},
-{1694, "pFBAOT6.87"},
-{1695, "ISPye52"},
-{1696, "ISAzs18"},
-{1697, "ISH3B"},
-{1698, "ISBith1"},
-{1699, "gene:plasmid:154450"},
-{1700, "ISRhru1"},
-{1701, "ISMno30"},
-{1702, "ISThba1"},
-{1703, "ISTesp4"},
-{1704, "ISAve1"},
-{1705, "IS231E"},
-{1706, "ISSfl3"},
-{1707, "EF_RS16420"},
-{1708, "ISSma20"},
-{1709, "ISSba14"},
-{1710, "ISCco7"},
-{1711, "ISBam3"},
-{1712, "LV135"},
-{1713, "ISAbe16"},
-{1714, "ISMysp3"},
-{1715, "ISLho3"},
-{1716, "ISXo14"},
-{1717, "ISMae22"},
-{1718, "ISArsp6"},
-{1719, "ISMi1"},
-{1720, "TnAs3"},
-{1721, "TnBth2"},
-{1722, "ISWpi1"},
-{1723, "ISCsa9"},
-{1724, "ISTvo2"},
-{1725, "ISCsc1"},
-{1726, "ISAar21"},
-{1727, "ISBdb1"},
-{1728, "LV097"},
-{1729, "ISGrh1"},
-{1730, "ISChy6"},
-{1731, "LV082"},
-{1732, "ISXci1"},
-{1733, "ISMno34"},
-{1734, "ISChy4"},
-{1735, "ISOpi1"},
-{1736, "ISOpi1"},
-{1737, "ISGob7"},
-{1738, "ISCte5"},
-{1739, "ISCku10"},
-{1740, "ISAar7"},
-{1741, "LV010"},
-{1742, "IS1087B"},
-{1743, "ISHsal4"},
-{1744, "ISNma16"},
-{1745, "TnXo19"},
-{1746, "LV130"},
-{1747, "ISClba2"},
-{1748, "ISChba3"},
-{1749, "LV176"},
-{1750, "ISHam1"},
-{1751, "ISAmde1"},
-{1752, "LV030"},
-{1753, "ISAzs20"},
-{1754, "ISPpu9"},
-{1755, "ISSfl11"},
-{1756, "ISPa111"},
-{1757, "ISAzo4"},
-{1758, "ISAli13"},
-{1759, "ISBfun2"},
-{1760, "PV139"},
-{1761, "ISAeca1"},
-{1762, "ISHne5"},
-{1763, "ISDvu5"},
-{1764, "ISMno9"},
-{1765, "ISKpn19"},
-{1766, "ISVisp7"},
-{1767, "ISHwa5"},
-{1768, "ISBthe6"},
-{1769, "ISDpr9"},
-{1770, "EF_RS16005"},
-{1771, "Tn4430"},
-{1772, "ISMae26"},
-{1773, "IS1221A"},
-{1774, "ISLbu1"},
-{1775, "ISVlu1"},
-{1776, "ISCco2"},
-{1777, "Tn5403"},
-{1778, "pRUM_p20"},
-{1779, "pOU1113_82"},
-{1780, "ISMex37"},
-{1781, "pOU1113_33"},
-{1782, "pEP36_023"},
-{1783, "ISHals1"},
-{1784, "ISSphsp9"},
-{1785, "ISCce1"},
-{1786, "ISPsy4"},
-{1787, "ISHvo17"},
-{1788, "ISCARN68"},
-{1789, "ISPa197"},
-{1790, "ISFop1"},
-{1791, "pB171_017"},
-{1792, "ISAeca7"},
-{1793, "ISPlu17"},
-{1794, "L7030"},
-{1795, "L7045"},
-{1796, "ISPcc2"},
-{1797, "pB171_029"},
-{1798, "pB171_050"},
-{1799, "pB171_060"},
-{1800, "ISPaes2"},
-{1801, "pB171_064"},
-{1802, "pB171_065"},
-{1803, "ISMhu10"},
-{1804, "R721_03"},
-{1805, "R721_04"},
-{1806, "ISBmu3"},
-{1807, "ISMch7"},
-{1808, "ISFK1"},
-{1809, "ISNov4"},
-{1810, "gene:plasmid:158823"},
-{1811, "gene:plasmid:158830"},
-{1812, "gene:plasmid:158835"},
-{1813, "gene:plasmid:158836"},
-{1814, "gene:plasmid:158837"},
-{1815, "gene:plasmid:158838"},
-{1816, "gene:plasmid:158858"},
-{1817, "gene:plasmid:158860"},
-{1818, "gene:plasmid:158872"},
-{1819, "gene:plasmid:158874"},
-{1820, "gene:plasmid:158895"},
-{1821, "gene:plasmid:158896"},
-{1822, "gene:plasmid:158907"},
-{1823, "gene:plasmid:158916"},
-{1824, "ISAtu6"},
-{1825, "ISGsp1"},
-{1826, "ISBli3"},
-{1827, "ISAcif1"},
-{1828, "ISAeme19"},
-{1829, "ISOan8"},
-{1830, "ISRop2"},
-{1831, "p165897_064"},
-{1832, "p165897_065"},
-{1833, "p165897_074"},
-{1834, "ISEmo1"},
-{1835, "ISHgi15"},
-{1836, "ISCARN78"},
-{1837, "p165897_086"},
-{1838, "p165897_096"},
-{1839, "ISArsp6"},
-{1840, "ISRpa9"},
-{1841, "ISPye33"},
-{1842, "ISPpu23"},
-{1843, "ISPman1"},
-{1844, "ISBlo10"},
-{1845, "p165897_104"},
-{1846, "ISEc63"},
-{1847, "ISCysp20"},
-{1848, "ISBko1"},
-{1849, "ISPcc2"},
-{1850, "pO157p31"},
-{1851, "ISPlu17"},
-{1852, "ISCsa1"},
-{1853, "ISCfr3"},
-{1854, "ISBun2"},
-{1855, "ISAcp1"},
-{1856, "ISMaau1"},
-{1857, "R46_065"},
-{1858, "ISLar6"},
-{1859, "ISSc1"},
-{1860, "pMRC01_001"},
-{1861, "ISFnu4"},
-{1862, "ISPze1"},
-{1863, "ISGsp4"},
-{1864, "ISXoo14"},
-{1865, "pli0049"},
-{1866, "ISNisp6"},
-{1867, "ISHtu1"},
-{1868, "ISAeca7"},
-{1869, "gene:plasmid:19399"},
-{1870, "gene:plasmid:19401"},
-{1871, "gene:plasmid:19402"},
-{1872, "gene:plasmid:19403"},
-{1873, "gene:plasmid:19404"},
-{1874, "gene:plasmid:19405"},
-{1875, "gene:plasmid:19406"},
-{1876, "gene:plasmid:19407"},
-{1877, "gene:plasmid:19408"},
-{1878, "gene:plasmid:19409"},
-{1879, "gene:plasmid:19413"},
-{1880, "gene:plasmid:19426"},
-{1881, "gene:plasmid:19447"},
-{1882, "gene:plasmid:19451"},
-{1883, "gene:plasmid:19453"},
-{1884, "gene:plasmid:19454"},
-{1885, "gene:plasmid:19455"},
-{1886, "gene:plasmid:19456"},
-{1887, "gene:plasmid:19464"},
-{1888, "gene:plasmid:19467"},
-{1889, "gene:plasmid:19468"},
-{1890, "gene:plasmid:19489"},
-{1891, "gene:plasmid:19493"},
-{1892, "gene:plasmid:19497"},
-{1893, "gene:plasmid:19506"},
-{1894, "ISAcsp6"},
-{1895, "ISHwa12"},
-{1896, "ISNg1"},
-{1897, "ISGsp1"},
-{1898, "IS1X2"},
-{1899, "ISMsi3"},
-{1900, "ISVsp13"},
-{1901, "ISClph1"},
-{1902, "ISTvi2"},
-{1903, "gene:plasmid:19874"},
-{1904, "ISBvu1"},
-{1905, "ISBf3"},
-{1906, "ISSph15"},
-{1907, "ST585_p228"},
-{1908, "ISCsa5"},
-{1909, "IS903B"},
-{1910, "ISCsp4"},
-{1911, "IS1311"},
-{1912, "ISMcte1"},
-{1913, "ISNpe7"},
-{1914, "ISArsp14"},
-{1915, "ISMav7"},
-{1916, "ISArsp14"},
-{1917, "ISMme1"},
-{1918, "IS881"},
-{1919, "TnAs3"},
-{1920, "RS_RS21560"},
-{1921, "ISThsp19"},
-{1922, "ISArsp14"},
-{1923, "ISRe46"},
-{1924, "ISPme2"},
-{1925, "ISStma12"},
-{1926, "ISSma15"},
-{1927, "ISPein1"},
-{1928, "ISBrba1"},
-{1929, "ISNwa2"},
-{1930, "ISCsc1"},
-{1931, "ISApr8"},
-{1932, "TnEc3"},
-{1933, "ISTwi1"},
-{1934, "ISAur1"},
-{1935, "HCM1.169"},
-{1936, "ISPa7"},
-{1937, "ISNha8"},
-{1938, "ISVch3"},
-{1939, "ISPpa4"},
-{1940, "ISPa30"},
-{1941, "ISHarch20"},
-{1942, "ISCfr26"},
-{1943, "ISPa196"},
-{1944, "ISAlw11"},
-{1945, "HCM1.201"},
-{1946, "ISCaje5"},
-{1947, "ISAcsp6"},
-{1948, "ISVsp13"},
-{1949, "ISPor1"},
-{1950, "ISGdi16"},
-{1951, "ISMtsp9"},
-{1952, "ISCaa2"},
-{1953, "ISAzch1"},
-{1954, "R27_p046"},
-{1955, "ISNarch6"},
-{1956, "ISRop2"},
-{1957, "ISAau4"},
-{1958, "ISAar8"},
-{1959, "ISArsp13"},
-{1960, "ISPein1"},
-{1961, "ISSma18"},
-{1962, "ISStsp3"},
-{1963, "ISEsa1"},
-{1964, "ISVsp4"},
-{1965, "ISAav1"},
-{1966, "ISEsa1"},
-{1967, "ISPa127"},
-{1968, "ISAlw27"},
-{1969, "ISAbe14"},
-{1970, "ISGst4"},
-{1971, "ISHgi14"},
-{1972, "ISHla19"},
-{1973, "ISTsu1"},
-{1974, "ISHarch17"},
-{1975, "ISMesp5"},
-{1976, "ISArsp10"},
-{1977, "R27_p148"},
-{1978, "ISMba7"},
-{1979, "ISKpn37"},
-{1980, "ISCech1"},
-{1981, "ISSfl7"},
-{1982, "ISPa159"},
-{1983, "ISEcret1"},
-{1984, "gene:plasmid:24674"},
-{1985, "gene:plasmid:24693"},
-{1986, "gene:plasmid:24694"},
-{1987, "gene:plasmid:24696"},
-{1988, "gene:plasmid:24697"},
-{1989, "gene:plasmid:24698"},
-{1990, "gene:plasmid:24699"},
-{1991, "gene:plasmid:24704"},
-{1992, "gene:plasmid:24705"},
-{1993, "gene:plasmid:24706"},
-{1994, "gene:plasmid:24707"},
-{1995, "gene:plasmid:24709"},
-{1996, "gene:plasmid:24710"},
-{1997, "gene:plasmid:24721"},
-{1998, "gene:plasmid:24743"},
-{1999, "gene:plasmid:24751"},
-{2000, "gene:plasmid:24760"},
-{2001, "gene:plasmid:24763"},
-{2002, "gene:plasmid:24764"},
-{2003, "gene:plasmid:24765"},
-{2004, "gene:plasmid:24766"},
-{2005, "gene:plasmid:24768"},
-{2006, "gene:plasmid:24769"},
-{2007, "gene:plasmid:24770"},
-{2008, "gene:plasmid:24771"},
-{2009, "gene:plasmid:24773"},
-{2010, "gene:plasmid:24775"},
-{2011, "gene:plasmid:24776"},
-{2012, "gene:plasmid:24777"},
-{2013, "gene:plasmid:24778"},
-{2014, "gene:plasmid:24779"},
-{2015, "gene:plasmid:24780"},
-{2016, "gene:plasmid:24781"},
-{2017, "gene:plasmid:24791"},
-{2018, "gene:plasmid:24792"},
-{2019, "gene:plasmid:24793"},
-{2020, "gene:plasmid:24796"},
-{2021, "gene:plasmid:24797"},
-{2022, "gene:plasmid:24799"},
-{2023, "gene:plasmid:24800"},
-{2024, "gene:plasmid:24804"},
-{2025, "gene:plasmid:24805"},
-{2026, "gene:plasmid:24806"},
-{2027, "gene:plasmid:24807"},
-{2028, "ISShes13"},
-{2029, "ST42906_p020"},
-{2030, "ST42906_p019"},
-{2031, "ISDds9"},
-{2032, "pWR501_0022"},
-{2033, "pWR501_0034"},
-{2034, "pWR501_0127"},
-{2035, "pWR501_0170"},
-{2036, "ISEhe2"},
-{2037, "ISLead2"},
-{2038, "ISCwa6"},
-{2039, "pWR501_0231"},
-{2040, "pWR501_0243"},
-{2041, "pWR501_0266"},
-{2042, "CP0013"},
-{2043, "CP0017"},
-{2044, "CP0028"},
-{2045, "CP0107"},
-{2046, "CP0223"},
-{2047, "CP0269"},
-{2048, "ISPko6"},
-{2049, "ISPsy46"},
-{2050, "ISGst3"},
-{2051, "ISMae26"},
-{2052, "IS231T"},
-{2053, "gene:plasmid:28967"},
-{2054, "ISCb4"},
-{2055, "ISFsp3"},
-{2056, "ISMex41"},
-{2057, "ISSma18"},
-{2058, "YPCD1.97c"},
-{2059, "ISPth1"},
-{2060, "gene:plasmid:30991"},
-{2061, "ISBlma4"},
-{2062, "gene:plasmid:77695"},
-{2063, "ECp088.2c"},
-{2064, "ISSph9"},
-{2065, "pLEW279a_p08"},
-{2066, "ISAmi2"},
-{2067, "ISCrfl1"},
-{2068, "YPDSF_4131"},
-{2069, "YpIP275_pIP1202_0178"},
-{2070, "ISSpu24"},
-{2071, "ISPpu35"},
-{2072, "ISHko1"},
-{2073, "ISPpu23"},
-{2074, "ISPein1"},
-{2075, "ISArsp6"},
-{2076, "TnXax1"},
-{2077, "YpIP275_pIP1202_0183"},
-{2078, "ISMex18"},
-{2079, "ISPa40"},
-{2080, "YpIP275_pIP1202_0169"},
-{2081, "ISKpn66"},
-{2082, "ISSma10"},
-{2083, "ISPsy37"},
-{2084, "ISSpu12"},
-{2085, "ISMasp7"},
-{2086, "ISNme5"},
-{2087, "OANT_RS23200"},
-{2088, "ISAcsp6"},
-{2089, "ISBcl1"},
-{2090, "ISChpi1"},
-{2091, "ISNg1"},
-{2092, "ISGsp1"},
-{2093, "ISBli14"},
-{2094, "ISPye37"},
-{2095, "ISPcc2"},
-{2096, "ISPlu17"},
-{2097, "ISMex22"},
-{2098, "ISAeca7"},
-{2099, "ISSaci1"},
-{2100, "SF0157_p77"},
-{2101, "SF0157_p76"},
-{2102, "SF0157_p75"},
-{2103, "ISCfr27"},
-{2104, "ISLse3"},
-{2105, "ISDku2"},
-{2106, "ISCsc1"},
-{2107, "IS1630"},
-{2108, "ISVasp1"},
-{2109, "ISRle3"},
-{2110, "ISGrh1"},
-{2111, "ISAcba1"},
-{2112, "ISCARN98"},
-{2113, "ISCbt4"},
-{2114, "ISHam1"},
-{2115, "IS1076"},
-{2116, "ESA_RS20510"},
-{2117, "ESA_RS20500"},
-{2118, "ISSma15"},
-{2119, "ISPto4"},
-{2120, "pGdh442_32"},
-{2121, "ISElsp1"},
-{2122, "ISSm4"},
-{2123, "ISPasp3"},
-{2124, "ISMch7"},
-{2125, "ISFK1"},
-{2126, "ISBmu3"},
-{2127, "D616_p80027"},
-{2128, "ISSpu24"},
-{2129, "ISPye29"},
-{2130, "ISDssp4"},
-{2131, "ISThma1"},
-{2132, "IS231K"},
-{2133, "ISVpa6"},
-{2134, "ISAcma19"},
-{2135, "D616_p80056"},
-{2136, "ISSphsp19"},
-{2137, "ISNpe31"},
-{2138, "ISSph3"},
-{2139, "ISPa78"},
-{2140, "KPN_pKPN3p05930"},
-{2141, "KPN_pKPN3p05931"},
-{2142, "ISMex31"},
-{2143, "ISAzo17"},
-{2144, "ISSse1"},
-{2145, "ISHam1"},
-{2146, "ISTvo2"},
-{2147, "ISAzs20"},
-{2148, "ISWpi1"},
-{2149, "KPN_pKPN3p05955"},
-{2150, "KPN_pKPN3p05956"},
-{2151, "KPN_pKPN3p05957"},
-{2152, "ISVisp7"},
-{2153, "IS1151"},
-{2154, "ISKpn52"},
-{2155, "IS607"},
-{2156, "KPN_pKPN3p05962"},
-{2157, "KPN_pKPN3p05963"},
-{2158, "ISCni2"},
-{2159, "ISLsa2"},
-{2160, "ISUnCu20"},
-{2161, "ISMma14"},
-{2162, "ISMyba1"},
-{2163, "ISEnca1"},
-{2164, "ISAzs18"},
-{2165, "ISCade1"},
-{2166, "ISSyth3"},
-{2167, "ISPsy42"},
-{2168, "ISBrsp9"},
-{2169, "ISDesu1"},
-{2170, "ISAs23"},
-{2171, "ISBos1"},
-{2172, "TnBth2"},
-{2173, "KPN_pKPN3p05990"},
-{2174, "ISBsu3"},
-{2175, "ISRpa9"},
-{2176, "ISAfe13"},
-{2177, "ISSsu8"},
-{2178, "ISSma29"},
-{2179, "ISDebc4"},
-{2180, "ISArsp6"},
-{2181, "ISAlw8"},
-{2182, "ISSba4"},
-{2183, "ISRm14"},
-{2184, "ISPa60"},
-{2185, "ISPye2"},
-{2186, "ISMdi27"},
-{2187, "ISDsac1"},
-{2188, "ISCbe5"},
-{2189, "ISMst1"},
-{2190, "ISUnCu7"},
-{2191, "ISMex38"},
-{2192, "ISArch23"},
-{2193, "ISCph13"},
-{2194, "ISSfl1"},
-{2195, "ISPrmu1"},
-{2196, "ISPa43"},
-{2197, "ISBli27"},
-{2198, "ISSphsp19"},
-{2199, "ISSma31"},
-{2200, "ISHahy10"},
-{2201, "ISLmo7"},
-{2202, "ISCfr3"},
-{2203, "ISAve5"},
-{2204, "ISBmu7"},
-{2205, "IS1554"},
-{2206, "ISMch5"},
-{2207, "ISPa25"},
-{2208, "ISAzo10"},
-{2209, "ISWco1"},
-{2210, "KPN_pKPN3p05874"},
-{2211, "ISAba48"},
-{2212, "ISHar1"},
-{2213, "ISHph1"},
-{2214, "ISLad2"},
-{2215, "ISFnu4"},
-{2216, "KPN_pKPN3p05884"},
-{2217, "ISArsp6"},
-{2218, "ISAcas3"},
-{2219, "ISRer3"},
-{2220, "ISSma12"},
-{2221, "ISStsp4"},
-{2222, "ISMmo2"},
-{2223, "ISShes9"},
-{2224, "ISMgi3"},
-{2225, "KPN_pKPN3p05894"},
-{2226, "KPN_pKPN3p05895"},
-{2227, "KPN_pKPN3p05896"},
-{2228, "ISPpu19"},
-{2229, "ISApr2"},
-{2230, "ISPye53"},
-{2231, "ISGrh1"},
-{2232, "ISAli18"},
-{2233, "ISRhtr1"},
-{2234, "IS1421"},
-{2235, "KPN_pKPN3p05904"},
-{2236, "KPN_pKPN3p05905"},
-{2237, "KPN_pKPN3p05906"},
-{2238, "KPN_pKPN3p05907"},
-{2239, "KPN_pKPN3p05908"},
-{2240, "ISDpr6"},
-{2241, "ISGsu3"},
-{2242, "ISCku10"},
-{2243, "ISMbov6"},
-{2244, "ISCla1"},
-{2245, "ISMbov5"},
-{2246, "TnXo19"},
-{2247, "MITEHhi1"},
-{2248, "ISSma22"},
-{2249, "ISJli1"},
-{2250, "ISKpn33"},
-{2251, "ISCud1"},
-{2252, "ISSod2"},
-{2253, "TnAs1"},
-{2254, "ISAzs17"},
-{2255, "ISBsp4"},
-{2256, "YPE_4165"},
-{2257, "ISDli1"},
-{2258, "ISArch25"},
-{2259, "ISMyca1"},
-{2260, "Bcep1808_7242"},
-{2261, "Bcep1808_7244"},
-{2262, "ISSm3"},
-{2263, "ISPein1"},
-{2264, "ISSma10"},
-{2265, "ISCARN102"},
-{2266, "ISKpn64"},
-{2267, "ISMasp7"},
-{2268, "ISHje2"},
-{2269, "ISPsy43"},
-{2270, "ISPsy35"},
-{2271, "ISGba3"},
-{2272, "ISLasa2"},
-{2273, "SNSL254_pSN254_0139"},
-{2274, "ISAzs9"},
-{2275, "ISAjo1"},
-{2276, "ISAri1"},
-{2277, "ISUnCu10"},
-{2278, "IS120"},
-{2279, "ISHko1"},
-{2280, "ISNfl1"},
-{2281, "ISCasp2"},
-{2282, "ISSusp4"},
-{2283, "ISAs16"},
-{2284, "ISSphsp20"},
-{2285, "ISArsp14"},
-{2286, "ISLead2"},
-{2287, "ISRor8"},
-{2288, "ISMno26"},
-{2289, "TnXax1"},
-{2290, "ISPye13"},
-{2291, "ISSfl1"},
-{2292, "ISRm10-1"},
-{2293, "ISTna1"},
-{2294, "ISSysp4"},
-{2295, "ISArsp16"},
-{2296, "ISCausp3"},
-{2297, "ISAlw22"},
-{2298, "ISEcret7"},
-{2299, "ISFba4"},
-{2300, "ISRta3"},
-{2301, "ISWpi16"},
-{2302, "ISCac2"},
-{2303, "ISChba4"},
-{2304, "ISBli29"},
-{2305, "ISMbu2"},
-{2306, "ISHti4"},
-{2307, "ISPa159"},
-{2308, "ISAar34"},
-{2309, "ISMaq1"},
-{2310, "ISAzs36"},
-{2311, "ISAli3"},
-{2312, "ISNma21"},
-{2313, "ISEce1"},
-{2314, "ISStin1"},
-{2315, "ISAs10"},
-{2316, "ISBce15"},
-{2317, "ISShdy4"},
-{2318, "ISHar3"},
-{2319, "ISPye26"},
-{2320, "ISTsu2"},
-{2321, "ISAlw14"},
-{2322, "SNSL254_pSN254_0140"},
-{2323, "ISAeca3"},
-{2324, "ISHwa17"},
-{2325, "ISTeha3"},
-{2326, "ISMsi5"},
-{2327, "ISAar44"},
-{2328, "ISLre2"},
-{2329, "ISMtsp8"},
-{2330, "ISAtba1"},
-{2331, "ISPansp1"},
-{2332, "ISA0963-7"},
-{2333, "ISPa111"},
-{2334, "ISKpn1"},
-{2335, "KPN_pKPN5p08237"},
-{2336, "ISSma17"},
-{2337, "ISArsp14"},
-{2338, "ISPa65"},
-{2339, "IS1511"},
-{2340, "ISNarch6"},
-{2341, "ISAlw10"},
-{2342, "ISCbo10"},
-{2343, "KPN_pKPN5p08254"},
-{2344, "KPN_pKPN5p08257"},
-{2345, "ISSac1"},
-{2346, "ISPye33"},
-{2347, "ISBj1"},
-{2348, "ISTca1"},
-{2349, "ISXau4"},
-{2350, "ISAlw34"},
-{2351, "ISCARN109"},
-{2352, "ISAzs17"},
-{2353, "Ent638_4320"},
-{2354, "ISKpn50"},
-{2355, "ISVch4"},
-{2356, "Ent638_4224"},
-{2357, "ISKpn23"},
-{2358, "ISSma27"},
-{2359, "ISAzs17"},
-{2360, "ISCARN77"},
-{2361, "ISArsp5"},
-{2362, "ISJsp4"},
-{2363, "ISNisp6"},
-{2364, "ISRosp4"},
-{2365, "ISPa64"},
-{2366, "ISPa126"},
-{2367, "ISRjo4"},
-{2368, "ISPath1"},
-{2369, "ISAve5"},
-{2370, "ISSiac5"},
-{2371, "ISMyo2"},
-{2372, "ISSsac1"},
-{2373, "ISAlw34"},
-{2374, "IS1087B"},
-{2375, "ISPa157"},
-{2376, "ISBj3"},
-{2377, "ISHgi10"},
-{2378, "ISAbe14"},
-{2379, "ISPfr13"},
-{2380, "ISWosp5"},
-{2381, "ISAlw8"},
-{2382, "ISArsp9"},
-{2383, "ISSba4"},
-{2384, "ISFpe1"},
-{2385, "TnXo19"},
-{2386, "ISTeha7"},
-{2387, "ISClsp7"},
-{2388, "ISPye2"},
-{2389, "ISCbt4"},
-{2390, "ISCbe5"},
-{2391, "ISSau4"},
-{2392, "ISCfr14"},
-{2393, "ISCaa11"},
-{2394, "ISAzs38"},
-{2395, "ISUnCu7"},
-{2396, "ISRop1"},
-{2397, "ISVisp3"},
-{2398, "IS1631"},
-{2399, "ISNiba2"},
-{2400, "ISArch23"},
-{2401, "ISCph13"},
-{2402, "ISSfl1"},
-{2403, "ISPrmu1"},
-{2404, "ISPa43"},
-{2405, "ISSma31"},
-{2406, "ISHahy10"},
-{2407, "ISLmo7"},
-{2408, "ISAve5"},
-{2409, "ISBmu7"},
-{2410, "IS1554"},
-{2411, "ISMch5"},
-{2412, "ISPa25"},
-{2413, "ISAzo10"},
-{2414, "ISCysp13"},
-{2415, "ISArsp6"},
-{2416, "ISAcas3"},
-{2417, "ISChy3"},
-{2418, "ISSma17"},
-{2419, "KPN_pKPN4p07047"},
-{2420, "ISCARN30"},
-{2421, "ISPye33"},
-{2422, "ISRo1"},
-{2423, "ISPpu27"},
-{2424, "ISAli13"},
-{2425, "IS1595"},
-{2426, "ISMra4"},
-{2427, "ISArsp9"},
-{2428, "ISSphsp8"},
-{2429, "ISJsp3"},
-{2430, "TnAs3"},
-{2431, "IS1602"},
-{2432, "ISRme9"},
-{2433, "ISPa74"},
-{2434, "ISAzo6"},
-{2435, "IS1389-B"},
-{2436, "ISBmu7"},
-{2437, "ISPye58"},
-{2438, "ISLdr1"},
-{2439, "ISSphsp2"},
-{2440, "ISLmo21"},
-{2441, "ISKpn33"},
-{2442, "ISKpn74"},
-{2443, "ISPein1"},
-{2444, "ISEnfa2"},
-{2445, "b0553"},
-{2446, "ISCwa3"},
-{2447, "ISPmar3"},
-{2448, "ISPesp2"},
-{2449, "ISXoo7"},
-{2450, "ISArsp11"},
-{2451, "TnShfr1"},
-{2452, "ISRsp13"},
-{2453, "ISCysp21"},
-{2454, "ISAjo4"},
-{2455, "ISNol1"},
-{2456, "b1545"},
-{2457, "ISHarch2"},
-{2458, "ISXne1"},
-{2459, "ISHati3"},
-{2460, "ISC1173a"},
-{2461, "ISBcy1"},
-{2462, "ISEc58"},
-{2463, "ISBce20"},
-{2464, "ISThsp20"},
-{2465, "ISBeg1"},
-{2466, "ISSsu5"},
-{2467, "ISMba12"},
-{2468, "ISPep1"},
-{2469, "ISBth5"},
-{2470, "IS1245"},
-{2471, "ISClba1"},
-{2472, "ISFps1"},
-{2473, "ISRso9"},
-{2474, "ISMba6"},
-{2475, "ISVer1"},
-{2476, "ISCth13"},
-{2477, "ISCpo1"},
-{2478, "ISBf11"},
-{2479, "ISNagr3"},
-{2480, "ISSpn5"},
-{2481, "ISTcSa"},
-{2482, "ISMno23"},
-{2483, "ISXoo7"},
-{2484, "ISRo1"},
-{2485, "ISHahy7"},
-{2486, "ISC1913"},
-{2487, "ISMeth1"},
-{2488, "ISvMimi_2"},
-{2489, "ISClhy1"},
-{2490, "ISWen1"},
-{2491, "ISMag1"},
-{2492, "ISIMb1"},
-{2493, "ISDsba1"},
-{2494, "ISCaesp1"},
-{2495, "ISHyma1"},
-{2496, "ISVsa19"},
-{2497, "ISSc1"},
-{2498, "ISPa128"},
-{2499, "ISHgi8"},
-{2500, "ISClj1"},
-{2501, "ISHvo18"},
-{2502, "ISNco1"},
-{2503, "ISSm4"},
-{2504, "ISSwo2"},
-{2505, "ISPha2"},
-{2506, "ISGte1"},
-{2507, "IS679"},
-{2508, "ISVapa4"},
-{2509, "ISThni1"},
-{2510, "ISStma20"},
-{2511, "ISKox1"},
-{2512, "ISPa164"},
-{2513, "ISRme4"},
-{2514, "ISHahy9"},
-{2515, "ISFtu5"},
-{2516, "ISCpsp1"},
-{2517, "MICBce6"},
-{2518, "ISCaa3"},
-{2519, "ISBj5_B"},
-{2520, "IS16"},
-{2521, "ISPye12"},
-{2522, "ISAs24"},
-{2523, "ISTrsp2"},
-{2524, "ISNpu7"},
-{2525, "IS882"},
-{2526, "ISAasp1"},
-{2527, "ISNma25"},
-{2528, "ISCARN89"},
-{2529, "ISSpe4"},
-{2530, "ISCfr3"},
-{2531, "ISCbo10"},
-{2532, "ISMsy1"},
-{2533, "ISMssp1"},
-{2534, "ISKpn52"},
-{2535, "ISLpn1"},
-{2536, "ISMahy12"},
-{2537, "ISPin4"},
-{2538, "ISGst5"},
-{2539, "ISPmo1"},
-{2540, "ISCaal1"},
-{2541, "ISSphsp7"},
-{2542, "ISLbp3"},
-{2543, "ISSro1"},
-{2544, "ISSpo4"},
-{2545, "ISHahy6"},
-{2546, "ISMaca1"},
-{2547, "ISAcp4"},
-{2548, "ISDin1"},
-{2549, "ISBci1"},
-{2550, "ISAjo4"},
-{2551, "ISNph10"},
-{2552, "ISSymo1"},
-{2553, "ISLjo2"},
-{2554, "ISBope1"},
-{2555, "ISDeba1"},
-{2556, "ISKpn33"},
-{2557, "EcE24377A_0815"},
-{2558, "ISLmo21"},
-{2559, "ISCul1"},
-{2560, "ISPye17"},
-{2561, "ISBli35"},
-{2562, "ISMlu1"},
-{2563, "ISCaal1"},
-{2564, "ISCsa7"},
-{2565, "ISSusp1"},
-{2566, "ISVha1"},
-{2567, "ISBaps1"},
-{2568, "ISKpn33"},
-{2569, "EcE24377A_0817"},
-{2570, "ISAzs35"},
-{2571, "ISHati3"},
-{2572, "ISAtba1"},
-{2573, "ISBmu7"},
-{2574, "MICBce4"},
-{2575, "ISAur1"},
-{2576, "ISAar7"},
-{2577, "ISNisp7"},
-{2578, "ISPma1"},
-{2579, "ISNaoc1"},
-{2580, "ISStin6"},
-{2581, "ISBfun4"},
-{2582, "ISHarch15"},
-{2583, "ISAs6"},
-{2584, "ISSfl9"},
-{2585, "ISEc47"},
-{2586, "ISKpn33"},
-{2587, "ISClsp3"},
-{2588, "ISLiv1"},
-{2589, "ISGes1"},
-{2590, "ISSjo1"},
-{2591, "ISMhu7"},
-{2592, "ISEc62"},
-{2593, "ISAba62"},
-{2594, "ISPlu15"},
-{2595, "ISBvi3"},
-{2596, "ISStma1"},
-{2597, "ISSen7"},
-{2598, "ISCte4"},
-{2599, "ISSma15"},
-{2600, "ISCausp3"},
-{2601, "ISAlis1"},
-{2602, "ISXoo7"},
-{2603, "IS2621"},
-{2604, "ISAbc2"},
-{2605, "ISVpa4"},
-{2606, "ISMru1"},
-{2607, "ISGaba1"},
-{2608, "ISAzs19"},
-{2609, "EcE24377A_2228"},
-{2610, "ISSwo1"},
-{2611, "ISCth8"},
-{2612, "ISPsas1"},
-{2613, "ISArsp6"},
-{2614, "ISMba12"},
-{2615, "EcE24377A_1758"},
-{2616, "ISHwa21"},
-{2617, "EcE24377A_1760"},
-{2618, "ISCro2"},
-{2619, "EcE24377A_1757"},
-{2620, "EcE24377A_1759"},
-{2621, "ISSsu5"},
-{2622, "ISEch11"},
-{2623, "ISPa30"},
-{2624, "ISKmi4"},
-{2625, "IS1245"},
-{2626, "ISSme2"},
-{2627, "ISSsu13"},
-{2628, "ISMac10"},
-{2629, "ISPsy30"},
-{2630, "ISShvi3"},
-{2631, "ISClsp9"},
-{2632, "ISBce12"},
-{2633, "ISXne1"},
-{2634, "ISFlsp1"},
-{2635, "ISPin3"},
-{2636, "ISAtba1"},
-{2637, "TnEc2"},
-{2638, "ISMdi13"},
-{2639, "SDY_2762"},
-{2640, "ISPfr13"},
-{2641, "ISSph13"},
-{2642, "ISPfr5"},
-{2643, "ISEvi1"},
-{2644, "ISNph14"},
-{2645, "ISSod9"},
-{2646, "ISEfa11"},
-{2647, "TnXo19"},
-{2648, "ISMpo9"},
-{2649, "ISEc92"},
-{2650, "ISFersp1"},
-{2651, "ISPa97"},
-{2652, "ISVch7"},
-{2653, "ISPsas1"},
-{2654, "ISAzo14"},
-{2655, "ISRsp18"},
-{2656, "TnXo19"},
-{2657, "ISPa86"},
-{2658, "ISCfr13"},
-{2659, "ISSph16"},
-{2660, "ISKpn63"},
-{2661, "ISRe46"},
-{2662, "ISSoEn2"},
-{2663, "ISLil2"},
-{2664, "ISPa81"},
-{2665, "ISLad2"},
-{2666, "ISHalh1"},
-{2667, "ISRhru6"},
-{2668, "ISVsa19"},
-{2669, "ISSis4"},
-{2670, "IS1631"},
-{2671, "ISKpn80"},
-{2672, "ISMlu14"},
-{2673, "ISPa22"},
-{2674, "ISRein1"},
-{2675, "ISEc10"},
-{2676, "ISCap3"},
-{2677, "ISShwo5"},
-{2678, "ISPa127"},
-{2679, "ISHlsp1"},
-{2680, "ISPsp17"},
-{2681, "ISMae43"},
-{2682, "ISThsp10"},
-{2683, "ISArsp14"},
-{2684, "ISPeth4"},
-{2685, "ISDph1"},
-{2686, "ISSphsp7"},
-{2687, "ISOih1"},
-{2688, "ISEc51"},
-{2689, "SERP1584"},
-{2690, "SERP1587"},
-{2691, "ISEce1"},
-{2692, "ISAot1"},
-{2693, "ISEfa5"},
-{2694, "ISPpu23"},
-{2695, "IS231T"},
-{2696, "ISAba1"},
-{2697, "SBO_4162"},
-{2698, "IS1X1"},
-{2699, "ISPre3"},
-{2700, "ISRsp21"},
-{2701, "ISBf11"},
-{2702, "ISCrsa1"},
-{2703, "SBO_0966"},
-{2704, "SBO_0967"},
-{2705, "ISLhe66"},
-{2706, "ISHbo6"},
-{2707, "ISBrsp8"},
-{2708, "ISVa20"},
-{2709, "SBO_0975"},
-{2710, "ISSde1"},
-{2711, "ISXba1"},
-{2712, "ISLisp1"},
-{2713, "ISDce1"},
-{2714, "ISCef7"},
-{2715, "ISNma21"},
-{2716, "ISAlw13"},
-{2717, "ISPye18"},
-{2718, "ISEc78"},
-{2719, "ISAli3"},
-{2720, "ISThy1"},
-{2721, "ISHor2"},
-{2722, "ISRle2"},
-{2723, "ISAeme5"},
-{2724, "ISGst1"},
-{2725, "ISMgi4"},
-{2726, "IS630"},
-{2727, "ISAzo1"},
-{2728, "ISFsp3"},
-{2729, "ISKra2"},
-{2730, "ISSen11"},
-{2731, "ISAs25"},
-{2732, "ISPye44"},
-{2733, "IS1071"},
-{2734, "ISPph2"},
-{2735, "ISSpo8"},
-{2736, "ISRsp21"},
-{2737, "ISApr7"},
-{2738, "ISMno38"},
-{2739, "ISButh5"},
-{2740, "ISSod4"},
-{2741, "ISTvo1"},
-{2742, "IS1600"},
-{2743, "ISMex29"},
-{2744, "ISPa82"},
-{2745, "ISMaq3"},
-{2746, "ISKpn85"},
-{2747, "ISPa100"},
-{2748, "MITEHsal3"},
-{2749, "ISNiba3"},
-{2750, "ISAzs17"},
-{2751, "ISVch12"},
-{2752, "ISRor6"},
-{2753, "ISHde2"},
-{2754, "ISXac2"},
-{2755, "ISLar3"},
-{2756, "ISPfa2"},
-{2757, "ISSpmu3"},
-{2758, "IS469"},
-{2759, "ISSsu15"},
-{2760, "ISAs25"},
-{2761, "ISTko1"},
-{2762, "ISAs29"},
-{2763, "ISPar1"},
-{2764, "IS1397"},
-{2765, "ISEhe2"},
-{2766, "ISCep2"},
-{2767, "ISCrsp1"},
-{2768, "ISEc49"},
-{2769, "ISBli11"},
-{2770, "ISBcen27"},
-{2771, "IS1240"},
-{2772, "ISAar18"},
-{2773, "ISCysp17"},
-{2774, "ISEc25"},
-{2775, "ISAtba1"},
-{2776, "ISRel1"},
-{2777, "ISMch1"},
-{2778, "ISVapa3"},
-{2779, "ISPsy42"},
-{2780, "ISCysp17"},
-{2781, "ISNsp5"},
-{2782, "ISChy4"},
-{2783, "ISCARN110"},
-{2784, "ISSyth2"},
-{2785, "ISLmo7"},
-{2786, "ISPein1"},
-{2787, "ISKpn15"},
-{2788, "ISStma14"},
-{2789, "ISCc1"},
-{2790, "ISCli1"},
-{2791, "IS4351"},
-{2792, "ISVisp4"},
-{2793, "ISEch6"},
-{2794, "ISAcde2"},
-{2795, "ISPpu36"},
-{2796, "ISMno8"},
-{2797, "ISAcp1"},
-{2798, "ISPye2"},
-{2799, "ISHaar1"},
-{2800, "TnEc4"},
-{2801, "ISSysp3"},
-{2802, "ISCysp6"},
-{2803, "ISAfe12"},
-{2804, "ISMex32"},
-{2805, "ISMiva1"},
-{2806, "ISDku1"},
-{2807, "ISMno1"},
-{2808, "ISSphsp13"},
-{2809, "ISCARN115"},
-{2810, "ISAar22"},
-{2811, "ISRssp9"},
-{2812, "ISRaq1"},
-{2813, "ISNamo16"},
-{2814, "ISSma27"},
-{2815, "ISCps5"},
-{2816, "ISMags1"},
-{2817, "ISHati3"},
-{2818, "ISRssp2"},
-{2819, "ISAs14"},
-{2820, "ISHch3"},
-{2821, "ISSod14"},
-{2822, "IS1550"},
-{2823, "ISChy9"},
-{2824, "ISMae42"},
-{2825, "ISPa128"},
-{2826, "ISPmar3"},
-{2827, "ISAeca7"},
-{2828, "ISVei6"},
-{2829, "ISGps1"},
-{2830, "ISPye14"},
-{2831, "ISCARN47"},
-{2832, "ISPa43"},
-{2833, "ISPst10"},
-{2834, "ISNamo22"},
-{2835, "ISMac15"},
-{2836, "ISUnCu2"},
-{2837, "ISRe46"},
-{2838, "ISBith1"},
-{2839, "ISAzo21"},
-{2840, "ISPa33"},
-{2841, "ISMhu4"},
-{2842, "IS1162"},
-{2843, "ISHuha2"},
-{2844, "ISPa42"},
-{2845, "ISNagr2"},
-{2846, "TnShfr1"},
-{2847, "ISSma27"},
-{2848, "ISNch1"},
-{2849, "ISHarch12"},
-{2850, "ISEas1"},
-{2851, "ISDsh1"},
-{2852, "ISMex43"},
-{2853, "ISSer2"},
-{2854, "Tn4430"},
-{2855, "ISArsp6"},
-{2856, "ISAlisp1"},
-{2857, "ISPsy40"},
-{2858, "ISEfa17"},
-{2859, "ISSphsp15"},
-{2860, "ISEhe3"},
-{2861, "ISAlw9"},
-{2862, "ISGme2"},
-{2863, "ISHarch18"},
-{2864, "ISGob4"},
-{2865, "ISKpn25"},
-{2866, "ISNpe24"},
-{2867, "ISBt3"},
-{2868, "ISAba20"},
-{2869, "ISHli7"},
-{2870, "ISMaa1"},
-{2871, "IS1372"},
-{2872, "ISVer3"},
-{2873, "ISBlma9"},
-{2874, "ISPa97"},
-{2875, "ISEli1"},
-{2876, "ISNoc2"},
-{2877, "ISAzs17"},
-{2878, "ISYal1"},
-{2879, "ISAsh1"},
-{2880, "ISBthe4"},
-{2881, "ISNiba2"},
-{2882, "ISPna2"},
-{2883, "ISPpu27"},
-{2884, "ISPa108"},
-{2885, "ISSma17"},
-{2886, "ISAcc2"},
-{2887, "ISCfr27"},
-{2888, "ISDsp4"},
-{2889, "ISNov1"},
-{2890, "ISLpn9"},
-{2891, "ISDsba2"},
-{2892, "ISPrst3"},
-{2893, "ISAbc1"},
-{2894, "ISTrsp1"},
-{2895, "ISAav3"},
-{2896, "ISBth14"},
-{2897, "ISBast1"},
-{2898, "ISPpr11"},
-{2899, "ISRssp6"},
-{2900, "ISPa126"},
-{2901, "ISCte3"},
-{2902, "ISPye49"},
-{2903, "ISPeth2"},
-{2904, "ISAeme19"},
-{2905, "ISMae9"},
-{2906, "ISPpu27"},
-{2907, "ISMtsp23"},
-{2908, "IS1032"},
-{2909, "ISAba58"},
-{2910, "ISAlw6"},
-{2911, "ISSmsp1"},
-{2912, "ISAba15"},
-{2913, "ISEc93"},
-{2914, "ISCwa5"},
-{2915, "ISSde12"},
-{2916, "ISCpe7"},
-{2917, "ISHsal9"},
-{2918, "ISNph6"},
-{2919, "ISStso2"},
-{2920, "ISAar7"},
-{2921, "ISNpe24"},
-{2922, "ISPeth1"},
-{2923, "ISHahy15"},
-{2924, "ISCbo6"},
-{2925, "ISVa5"},
-{2926, "ISCbo8"},
-{2927, "ISCbo4"},
-{2928, "ISMfu1"},
-{2929, "ISCARN80"},
-{2930, "ISCysp23"},
-{2931, "ISCtet1"},
-{2932, "ISMbu7"},
-{2933, "ISRisp1"},
-{2934, "ISCcl1"},
-{2935, "ISTeha6"},
-{2936, "ISBlma9"},
-{2937, "ISVer3"},
-{2938, "IS1372"},
-{2939, "ISMaa1"},
-{2940, "ISHli7"},
-{2941, "ISBt3"},
-{2942, "ISCot1"},
-{2943, "ISNpe24"},
-{2944, "ISKpn25"},
-{2945, "ISGob4"},
-{2946, "ISHarch18"},
-{2947, "ISGme2"},
-{2948, "ISAlw9"},
-{2949, "ISEhe3"},
-{2950, "ISSphsp15"},
-{2951, "ISEfa17"},
-{2952, "ISPsy40"},
-{2953, "ISAlisp1"},
-{2954, "ISArsp6"},
-{2955, "Tn4430"},
-{2956, "ISSer2"},
-{2957, "ISMex43"},
-{2958, "ISDsh1"},
-{2959, "ISBfun1"},
-{2960, "ISHarch12"},
-{2961, "ISDith1"},
-{2962, "ISSma27"},
-{2963, "TnShfr1"},
-{2964, "ISLho1"},
-{2965, "ISRhtr1"},
-{2966, "ISPa42"},
-{2967, "ISHuha2"},
-{2968, "ISNagr2"},
-{2969, "ISAcur1"},
-{2970, "IS1162"},
-{2971, "ISMae40"},
-{2972, "ISBos2"},
-{2973, "ISKpn71"},
-{2974, "TnDra1"},
-{2975, "ISPa97"},
-{2976, "ISStsp11"},
-{2977, "ISMamu1"},
-{2978, "ISNml1"},
-{2979, "SC1223"},
-{2980, "ISXba1"},
-{2981, "ISTrsp1"},
-{2982, "ISAve5"},
-{2983, "ISArsp6"},
-{2984, "ISSysp6"},
-{2985, "ISPye44"},
-{2986, "ISPsp17"},
-{2987, "ISPa90"},
-{2988, "ISSsu6"},
-{2989, "ISAcur1"},
-{2990, "ISAri1"},
-{2991, "ISHko5"},
-{2992, "ISEf1"},
-{2993, "ISSgl1"},
-{2994, "ISNpu10"},
-{2995, "ISCARN1"},
-{2996, "ISRsp13"},
-{2997, "ISPsko2"},
-{2998, "ISEc29"},
-{2999, "ISNpe13"},
-{3000, "ISLhe66"},
-{3001, "ISMpo2"},
-{3002, "ISMno3"},
-{3003, "ISAbe12"},
-{3004, "ISCfe1"},
-{3005, "ISCysp23"},
-{3006, "ISBli35"},
-{3007, "ISLmo21"},
-{3008, "ISKpn74"},
-{3009, "IS1122"},
-{3010, "ISRtr5"},
-{3011, "ISHwa17"},
-{3012, "ISSri1"},
-{3013, "ISSphsp7"},
-{3014, "ISGbsp1"},
-{3015, "ISFop4"},
-{3016, "IS1203"},
-{3017, "ISBope1"},
-{3018, "ISKpn15"},
-{3019, "ISMra4"},
-{3020, "ISTni1"},
-{3021, "ISCARN110"},
-{3022, "ISBxe2"},
-{3023, "ISEnu1"},
-{3024, "ISPsy42"},
-{3025, "ISMal1"},
-{3026, "ISShdy4"},
-{3027, "ISGob4"},
-{3028, "ISHahy2"},
-{3029, "ISAba57"},
-{3030, "ISSod22"},
-{3031, "ISCARN94"},
-{3032, "ISSpe3"},
-{3033, "ISCldi1"},
-{3034, "ISHvo10"},
-{3035, "ISMasa2"},
-{3036, "ISSbo1"},
-{3037, "ISPye60"},
-{3038, "ISNph23"},
-{3039, "ISNamo2"},
-{3040, "ISAlac1"},
-{3041, "ISAtu6"},
-{3042, "Tn5393"},
-{3043, "ISAar18"},
-{3044, "ISCausp3"},
-{3045, "ISRor7"},
-{3046, "ISEc45"},
-{3047, "ISGsu3"},
-{3048, "ISNiba1"},
-{3049, "ISAva6"},
-{3050, "ISNe2"},
-{3051, "ISLin2"},
-{3052, "ISArsp6"},
-{3053, "ISMomu1"},
-{3054, "ISMasp1"},
-{3055, "ISSpmu2"},
-{3056, "ISVsa13"},
-{3057, "ISA0963-6"},
-{3058, "ISFba4"},
-{3059, "ISDvu2"},
-{3060, "ISMdi5"},
-{3061, "ISMdi5"},
-{3062, "ISLbp4"},
-{3063, "ISKpn74"},
-{3064, "ISGbsp1"},
-{3065, "ISGbe1"},
-{3066, "ISMdi7"},
-{3067, "ISSav4"},
-{3068, "ISPsy42"},
-{3069, "ISSphsp7"},
-{3070, "ISVer1"},
-{3071, "ISBope1"},
-{3072, "ISKpn15"},
-{3073, "IS1476"},
-{3074, "ISBxe1"},
-{3075, "ISNisp3"},
-{3076, "ISSco2"},
-{3077, "ISSma28"},
-{3078, "ISKpn47"},
-{3079, "ISGeob3"},
-{3080, "ISHame2"},
-{3081, "ISTisp1"},
-{3082, "ISAcma18"},
-{3083, "ISPmo2"},
-{3084, "ISHwa17"},
-{3085, "ISNsp5"},
-{3086, "ISPae1"},
-{3087, "ISSphsp7"},
-{3088, "ISVer1"},
-{3089, "ISXa1"},
-{3090, "ISEsa1"},
-{3091, "ISPat1"},
-{3092, "IS1490"},
-{3093, "gene:proph:176804"},
-{3094, "gene:proph:176805"},
-{3095, "gene:proph:176806"},
-{3096, "gene:proph:176807"},
-{3097, "gene:proph:176808"},
-{3098, "gene:proph:176809"},
-{3099, "gene:proph:176810"},
-{3100, "gene:proph:176811"},
-{3101, "gene:proph:176812"},
-{3102, "gene:proph:176813"},
-{3103, "gene:proph:176814"},
-{3104, "gene:proph:176816"},
-{3105, "gene:proph:176817"},
-{3106, "gene:proph:176818"},
-{3107, "gene:proph:176819"},
-{3108, "gene:proph:176820"},
-{3109, "gene:proph:176821"},
-{3110, "gene:proph:176822"},
-{3111, "gene:proph:176823"},
-{3112, "gene:proph:176824"},
-{3113, "gene:proph:176825"},
-{3114, "gene:proph:176826"},
-{3115, "gene:proph:176827"},
-{3116, "gene:proph:176828"},
-{3117, "gene:proph:176829"},
-{3118, "gene:proph:176830"},
-{3119, "gene:proph:176831"},
-{3120, "gene:proph:176832"},
-{3121, "gene:proph:176833"},
-{3122, "gene:proph:176835"},
-{3123, "gene:proph:176836"},
-{3124, "gene:proph:176839"},
-{3125, "gene:proph:176840"},
-{3126, "gene:proph:176844"},
-{3127, "gene:proph:176845"},
-{3128, "gene:proph:176848"},
-{3129, "gene:proph:176849"},
-{3130, "gene:proph:176850"},
-{3131, "gene:proph:176852"},
-{3132, "gene:proph:176855"},
-{3133, "gene:proph:176860"},
-{3134, "gene:proph:176861"},
-{3135, "gene:proph:176862"},
-{3136, "gene:proph:176863"},
-{3137, "gene:proph:176864"},
-{3138, "gene:proph:176866"},
-{3139, "gene:proph:176867"},
-{3140, "gene:proph:176869"},
-{3141, "gene:proph:176870"},
-{3142, "gene:proph:176871"},
-{3143, "gene:proph:176873"},
-{3144, "gene:proph:176874"},
-{3145, "gene:proph:176876"},
-{3146, "gene:proph:176877"},
-{3147, "gene:proph:176880"},
-{3148, "gene:proph:176881"},
-{3149, "gene:proph:176884"},
-{3150, "gene:proph:176887"},
-{3151, "gene:proph:176888"},
-{3152, "gene:proph:176890"},
-{3153, "gene:proph:176891"},
-{3154, "gene:proph:176892"},
-{3155, "gene:proph:176893"},
-{3156, "gene:proph:176895"},
-{3157, "gene:proph:176897"},
-{3158, "gene:proph:176902"},
-{3159, "gene:proph:176905"},
-{3160, "gene:proph:176906"},
-{3161, "gene:proph:176909"},
-{3162, "gene:proph:176910"},
-{3163, "gene:proph:176914"},
-{3164, "gene:proph:176915"},
-{3165, "gene:proph:176916"},
-{3166, "gene:proph:176917"},
-{3167, "gene:proph:176920"},
-{3168, "gene:proph:176921"},
-{3169, "gene:proph:176922"},
-{3170, "gene:proph:176924"},
-{3171, "gene:proph:176925"},
-{3172, "gene:proph:177426"},
-{3173, "gene:proph:177428"},
-{3174, "gene:proph:177429"},
-{3175, "gene:proph:177439"},
-{3176, "gene:proph:177440"},
-{3177, "gene:proph:177441"},
-{3178, "gene:proph:177442"},
-{3179, "gene:proph:177446"},
-{3180, "gene:proph:177447"},
-{3181, "gene:proph:177459"},
-{3182, "gene:proph:177474"},
-{3183, "gene:proph:177482"},
-{3184, "gene:proph:177484"},
-{3185, "gene:proph:177498"},
-{3186, "gene:proph:177500"},
-{3187, "gene:proph:177501"},
-{3188, "gene:proph:177510"},
-{3189, "gene:proph:177511"},
-{3190, "gene:proph:177540"},
-{3191, "gene:proph:177541"},
-{3192, "gene:proph:177543"},
-{3193, "gene:proph:177548"},
-{3194, "gene:proph:177552"},
-{3195, "gene:proph:177557"},
-{3196, "gene:proph:177560"},
-{3197, "gene:proph:177562"},
-{3198, "gene:proph:177575"},
-{3199, "gene:proph:177577"},
-{3200, "gene:proph:177582"},
-{3201, "gene:proph:177584"},
-{3202, "gene:proph:177585"},
-{3203, "gene:proph:177586"},
-{3204, "gene:proph:177595"},
-{3205, "gene:proph:177598"},
-{3206, "gene:proph:177611"},
-{3207, "gene:proph:177615"},
-{3208, "gene:proph:177619"},
-{3209, "gene:proph:177620"},
-{3210, "gene:proph:177621"},
-{3211, "gene:proph:177622"},
-{3212, "gene:proph:177628"},
-{3213, "gene:proph:177629"},
-{3214, "gene:proph:177630"},
-{3215, "gene:proph:177631"},
-{3216, "gene:proph:177632"},
-{3217, "gene:proph:177640"},
-{3218, "gene:proph:177660"},
-{3219, "gene:proph:177683"},
-{3220, "gene:proph:177685"},
-{3221, "gene:proph:177695"},
-{3222, "gene:proph:177696"},
-{3223, "gene:proph:179201"},
-{3224, "gene:proph:179204"},
-{3225, "gene:proph:179208"},
-{3226, "gene:proph:179217"},
-{3227, "gene:proph:179228"},
-{3228, "gene:proph:179244"},
-{3229, "gene:proph:179246"},
-{3230, "gene:proph:179247"},
-{3231, "gene:proph:179258"},
-{3232, "gene:proph:179286"},
-{3233, "gene:proph:179287"},
-{3234, "gene:proph:179289"},
-{3235, "gene:proph:179290"},
-{3236, "gene:proph:179305"},
-{3237, "gene:proph:179307"},
-{3238, "gene:proph:179308"},
-{3239, "gene:proph:179321"},
-{3240, "gene:proph:179335"},
-{3241, "gene:proph:179343"},
-{3242, "gene:proph:179346"},
-{3243, "gene:proph:179364"},
-{3244, "gene:proph:179383"},
-{3245, "gene:proph:179389"},
-{3246, "gene:proph:179390"},
-{3247, "gene:proph:179392"},
-{3248, "gene:proph:179393"},
-{3249, "gene:proph:179395"},
-{3250, "gene:proph:179396"},
-{3251, "gene:proph:179402"},
-{3252, "gene:proph:179418"},
-{3253, "gene:proph:179420"},
-{3254, "gene:proph:179425"},
-{3255, "gene:proph:179426"},
-{3256, "gene:proph:179429"},
-{3257, "gene:proph:179430"},
-{3258, "gene:proph:179432"},
-{3259, "gene:proph:179433"},
-{3260, "gene:proph:179434"},
-{3261, "gene:proph:179435"},
-{3262, "gene:proph:179436"},
-{3263, "gene:proph:179438"},
-{3264, "gene:proph:179439"},
-{3265, "gene:proph:179440"},
-{3266, "gene:proph:179442"},
-{3267, "gene:proph:179443"},
-{3268, "gene:proph:179445"},
-{3269, "gene:proph:179446"},
-{3270, "gene:proph:179447"},
-{3271, "gene:proph:179448"},
-{3272, "gene:proph:179451"},
-{3273, "gene:proph:179452"},
-{3274, "gene:proph:179453"},
-{3275, "gene:proph:179454"},
-{3276, "gene:proph:179456"},
-{3277, "gene:proph:179457"},
-{3278, "gene:proph:179459"},
-{3279, "gene:proph:179460"},
-{3280, "gene:proph:179463"},
-{3281, "gene:proph:179464"},
-{3282, "gene:proph:179465"},
-{3283, "gene:proph:179467"},
-{3284, "gene:proph:179468"},
-{3285, "gene:proph:179469"},
-{3286, "gene:proph:179470"},
-{3287, "gene:proph:179471"},
-{3288, "gene:proph:179473"},
-{3289, "gene:proph:179474"},
-{3290, "gene:proph:179475"},
-{3291, "gene:proph:179476"},
-{3292, "gene:proph:179478"},
-{3293, "gene:proph:179481"},
-{3294, "gene:proph:179482"},
-{3295, "gene:proph:179483"},
-{3296, "gene:proph:179485"},
-{3297, "gene:proph:179486"},
-{3298, "gene:proph:179489"},
-{3299, "gene:proph:179490"},
-{3300, "gene:proph:181032"},
-{3301, "gene:proph:181033"},
-{3302, "gene:proph:181034"},
-{3303, "gene:proph:181036"},
-{3304, "gene:proph:181037"},
-{3305, "gene:proph:181038"},
-{3306, "gene:proph:181039"},
-{3307, "gene:proph:181040"},
-{3308, "gene:proph:181041"},
-{3309, "gene:proph:181047"},
-{3310, "gene:proph:181048"},
-{3311, "gene:proph:181050"},
-{3312, "gene:proph:181052"},
-{3313, "gene:proph:181054"},
-{3314, "gene:proph:181055"},
-{3315, "gene:proph:181056"},
-{3316, "gene:proph:181057"},
-{3317, "gene:proph:181058"},
-{3318, "gene:proph:181059"},
-{3319, "gene:proph:181060"},
-{3320, "gene:proph:181061"},
-{3321, "gene:proph:181062"},
-{3322, "gene:proph:181065"},
-{3323, "gene:proph:181067"},
-{3324, "gene:proph:181068"},
-{3325, "gene:proph:181069"},
-{3326, "gene:proph:181070"},
-{3327, "gene:proph:181071"},
-{3328, "gene:proph:181073"},
-{3329, "gene:proph:181074"},
-{3330, "gene:proph:181075"},
-{3331, "gene:proph:181076"},
-{3332, "gene:proph:181077"},
-{3333, "gene:proph:181078"},
-{3334, "gene:proph:181080"},
-{3335, "gene:proph:181081"},
-{3336, "gene:proph:181082"},
-{3337, "gene:proph:181083"},
-{3338, "gene:proph:181084"},
-{3339, "gene:proph:181085"},
-{3340, "gene:proph:181086"},
-{3341, "gene:proph:181087"},
-{3342, "gene:proph:181089"},
-{3343, "gene:proph:181090"},
-{3344, "gene:proph:181091"},
-{3345, "gene:proph:181092"},
-{3346, "gene:proph:181093"},
-{3347, "gene:proph:181094"},
-{3348, "gene:proph:181095"},
-{3349, "gene:proph:181096"},
-{3350, "gene:proph:181097"},
-{3351, "gene:proph:181098"},
-{3352, "gene:proph:181099"},
-{3353, "gene:proph:181100"},
-{3354, "gene:proph:181101"},
-{3355, "gene:proph:181102"},
-{3356, "gene:proph:181103"},
-{3357, "gene:proph:181104"},
-{3358, "gene:proph:181109"},
-{3359, "gene:proph:181110"},
-{3360, "gene:proph:181111"},
-{3361, "gene:proph:181113"},
-{3362, "gene:proph:181119"},
-{3363, "gene:proph:181121"},
-{3364, "gene:proph:181125"},
-{3365, "gene:proph:181127"},
-{3366, "gene:proph:181128"},
-{3367, "gene:proph:181129"},
-{3368, "gene:proph:181132"},
-{3369, "gene:proph:181133"},
-{3370, "gene:proph:181134"},
-{3371, "gene:proph:181136"},
-{3372, "gene:proph:181137"},
-{3373, "gene:proph:181138"},
-{3374, "gene:proph:181139"},
-{3375, "gene:proph:181140"},
-{3376, "gene:proph:181141"},
-{3377, "gene:proph:181145"},
-{3378, "gene:proph:181147"},
-{3379, "gene:proph:181148"},
-{3380, "gene:proph:181149"},
-{3381, "gene:proph:181151"},
-{3382, "gene:proph:181153"},
-{3383, "gene:proph:181154"},
-{3384, "gene:proph:181155"},
-{3385, "gene:proph:181157"},
-{3386, "gene:proph:181158"},
-{3387, "gene:proph:181159"},
-{3388, "gene:proph:181161"},
-{3389, "gene:proph:181162"},
-{3390, "gene:proph:181163"},
-{3391, "gene:proph:181165"},
-{3392, "gene:proph:181166"},
-{3393, "gene:proph:181167"},
-{3394, "gene:proph:181168"},
-{3395, "gene:proph:181169"},
-{3396, "gene:proph:181170"},
-{3397, "gene:proph:181171"},
-{3398, "gene:proph:181172"},
-{3399, "gene:proph:181173"},
-{3400, "gene:proph:181174"},
-{3401, "gene:proph:181175"},
-{3402, "gene:proph:181177"},
-{3403, "gene:proph:181179"},
-{3404, "gene:proph:181180"},
-{3405, "gene:proph:181182"},
-{3406, "gene:proph:181184"},
-{3407, "gene:proph:181191"},
-{3408, "gene:proph:181192"},
-{3409, "gene:proph:181193"},
-{3410, "gene:proph:181194"},
-{3411, "gene:proph:181195"},
-{3412, "gene:proph:181197"},
-{3413, "gene:proph:181201"},
-{3414, "gene:proph:181203"},
-{3415, "gene:proph:181206"},
-{3416, "gene:proph:181208"},
-{3417, "gene:proph:181209"},
-{3418, "gene:proph:181210"},
-{3419, "gene:proph:181211"},
-{3420, "gene:proph:181212"},
-{3421, "gene:proph:181213"},
-{3422, "gene:proph:181215"},
-{3423, "gene:proph:181217"},
-{3424, "gene:proph:181218"},
-{3425, "gene:proph:181220"},
-{3426, "gene:proph:181222"},
-{3427, "gene:proph:181223"},
-{3428, "gene:proph:181224"},
-{3429, "gene:proph:181225"},
-{3430, "gene:proph:181233"},
-{3431, "gene:proph:181234"},
-{3432, "gene:proph:181237"},
-{3433, "gene:proph:181239"},
-{3434, "gene:proph:181241"},
-{3435, "gene:proph:181242"},
-{3436, "gene:proph:181243"},
-{3437, "gene:proph:181244"},
-{3438, "gene:proph:181245"},
-{3439, "gene:proph:181247"},
-{3440, "gene:proph:181257"},
-{3441, "gene:proph:181258"},
-{3442, "gene:proph:181259"},
-{3443, "gene:proph:181266"},
-{3444, "gene:proph:181267"},
-{3445, "gene:proph:181272"},
-{3446, "gene:proph:181284"},
-{3447, "gene:proph:181285"},
-{3448, "gene:proph:181287"},
-{3449, "gene:proph:181290"},
-{3450, "gene:proph:181291"},
-{3451, "gene:proph:181292"},
-{3452, "gene:proph:181293"},
-{3453, "gene:proph:181296"},
-{3454, "gene:proph:181298"},
-{3455, "gene:proph:181300"},
-{3456, "gene:proph:181302"},
-{3457, "gene:proph:181304"},
-{3458, "gene:proph:181305"},
-{3459, "gene:proph:181306"},
-{3460, "gene:proph:181307"},
-{3461, "gene:proph:181308"},
-{3462, "gene:proph:181310"},
-{3463, "gene:proph:181311"},
-{3464, "gene:proph:181312"},
-{3465, "gene:proph:181314"},
-{3466, "gene:proph:181315"},
-{3467, "gene:proph:181316"},
-{3468, "gene:proph:181317"},
-{3469, "gene:proph:181318"},
-{3470, "gene:proph:181321"},
-{3471, "gene:proph:181322"},
-{3472, "gene:proph:181323"},
-{3473, "gene:proph:181324"},
-{3474, "gene:proph:181667"},
-{3475, "gene:proph:181669"},
-{3476, "gene:proph:181670"},
-{3477, "gene:proph:182641"},
-{3478, "gene:proph:182647"},
-{3479, "gene:proph:182649"},
-{3480, "gene:proph:182915"},
-{3481, "gene:proph:182916"},
-{3482, "gene:proph:182917"},
-{3483, "gene:proph:182918"},
-{3484, "gene:proph:182923"},
-{3485, "gene:proph:182924"},
-{3486, "gene:proph:182925"},
-{3487, "gene:proph:182926"},
-{3488, "gene:proph:182930"},
-{3489, "gene:proph:182931"},
-{3490, "gene:proph:182932"},
-{3491, "gene:proph:182947"},
-{3492, "gene:proph:182948"},
-{3493, "gene:proph:182949"},
-{3494, "gene:proph:182951"},
-{3495, "gene:proph:182952"},
-{3496, "gene:proph:182953"},
-{3497, "gene:proph:182958"},
-{3498, "gene:proph:182959"},
-{3499, "gene:proph:182965"},
-{3500, "gene:proph:182966"},
-{3501, "gene:proph:182970"},
-{3502, "gene:proph:182973"},
-{3503, "gene:proph:182974"},
-{3504, "gene:proph:182975"},
-{3505, "gene:proph:182978"},
-{3506, "gene:proph:182979"},
-{3507, "gene:proph:182980"},
-{3508, "gene:proph:182981"},
-{3509, "gene:proph:182982"},
-{3510, "gene:proph:182983"},
-{3511, "gene:proph:182984"},
-{3512, "gene:proph:182991"},
-{3513, "gene:proph:182994"},
-{3514, "gene:proph:182995"},
-{3515, "gene:proph:182997"},
-{3516, "gene:proph:182999"},
-{3517, "gene:proph:183000"},
-{3518, "gene:proph:183003"},
-{3519, "gene:proph:183006"},
-{3520, "gene:proph:183007"},
-{3521, "gene:proph:183009"},
-{3522, "gene:proph:183010"},
-{3523, "gene:proph:183012"},
-{3524, "gene:proph:183015"},
-{3525, "gene:proph:183019"},
-{3526, "gene:proph:183022"},
-{3527, "gene:proph:183023"},
-{3528, "gene:proph:183024"},
-{3529, "gene:proph:183025"},
-{3530, "gene:proph:183028"},
-{3531, "gene:proph:183029"},
-{3532, "gene:proph:183030"},
-{3533, "gene:proph:183032"},
-{3534, "gene:proph:183034"},
-{3535, "gene:proph:183035"},
-{3536, "gene:proph:183041"},
-{3537, "gene:proph:183043"},
-{3538, "gene:proph:183059"},
-{3539, "gene:proph:183085"},
-{3540, "gene:proph:183542"},
-{3541, "gene:proph:183544"},
-{3542, "gene:proph:183545"},
-{3543, "gene:proph:183546"},
-{3544, "gene:proph:183548"},
-{3545, "gene:proph:183549"},
-{3546, "gene:proph:183551"},
-{3547, "gene:proph:183552"},
-{3548, "gene:proph:183553"},
-{3549, "gene:proph:183562"},
-{3550, "gene:proph:183569"},
-{3551, "gene:proph:183570"},
-{3552, "gene:proph:183571"},
-{3553, "gene:proph:183572"},
-{3554, "gene:proph:183581"},
-{3555, "gene:proph:183583"},
-{3556, "gene:proph:183597"},
-{3557, "gene:proph:183598"},
-{3558, "gene:proph:183612"},
-{3559, "gene:proph:183615"},
-{3560, "gene:proph:183616"},
-{3561, "gene:proph:183617"},
-{3562, "gene:proph:183618"},
-{3563, "gene:proph:183625"},
-{3564, "gene:proph:183626"},
-{3565, "gene:proph:183629"},
-{3566, "gene:proph:183635"},
-{3567, "gene:proph:183636"},
-{3568, "gene:proph:183637"},
-{3569, "gene:proph:183644"},
-{3570, "gene:proph:183651"},
-{3571, "gene:proph:183652"},
-{3572, "gene:proph:183653"},
-{3573, "gene:proph:183654"},
-{3574, "gene:proph:183655"},
-{3575, "gene:proph:183656"},
-{3576, "gene:proph:183657"},
-{3577, "gene:proph:183658"},
-{3578, "gene:proph:183659"},
-{3579, "gene:proph:183660"},
-{3580, "gene:proph:183661"},
-{3581, "gene:proph:183662"},
-{3582, "gene:proph:183663"},
-{3583, "gene:proph:183664"},
-{3584, "gene:proph:183665"},
-{3585, "gene:proph:183666"},
-{3586, "gene:proph:183667"},
-{3587, "gene:proph:183668"},
-{3588, "gene:proph:183775"},
-{3589, "gene:proph:183779"},
-{3590, "gene:proph:184396"},
-{3591, "gene:proph:184397"},
-{3592, "gene:proph:184398"},
-{3593, "gene:proph:184574"},
-{3594, "gene:proph:184629"},
-{3595, "gene:proph:184639"},
-{3596, "gene:proph:184642"},
-{3597, "gene:proph:184643"},
-{3598, "gene:proph:184644"},
-{3599, "gene:proph:184664"},
-{3600, "gene:proph:184723"},
-{3601, "gene:proph:184757"},
-{3602, "gene:proph:184777"},
-{3603, "gene:proph:184793"},
-{3604, "gene:proph:184879"},
-{3605, "gene:proph:184884"},
-{3606, "gene:proph:184889"},
-{3607, "gene:proph:184890"},
-{3608, "gene:proph:184891"},
-{3609, "gene:proph:184893"},
-{3610, "gene:proph:184896"},
-{3611, "gene:proph:184898"},
-{3612, "gene:proph:184899"},
-{3613, "gene:proph:184901"},
-{3614, "gene:proph:184902"},
-{3615, "gene:proph:184903"},
-{3616, "gene:proph:184904"},
-{3617, "gene:proph:184905"},
-{3618, "gene:proph:184906"},
-{3619, "gene:proph:184908"},
-{3620, "gene:proph:184910"},
-{3621, "gene:proph:184911"},
-{3622, "gene:proph:184912"},
-{3623, "gene:proph:184913"},
-{3624, "gene:proph:184917"},
-{3625, "gene:proph:184921"},
-{3626, "gene:proph:184960"},
-{3627, "gene:proph:184970"},
-{3628, "gene:proph:184990"},
-{3629, "gene:vir:10066"},
-{3630, "gene:vir:10085"},
-{3631, "gene:vir:100922"},
-{3632, "gene:vir:100923"},
-{3633, "gene:vir:10093"},
-{3634, "gene:vir:100972"},
-{3635, "gene:vir:10117"},
-{3636, "gene:vir:10129"},
-{3637, "gene:vir:101322"},
-{3638, "gene:vir:101323"},
-{3639, "gene:vir:101325"},
-{3640, "gene:vir:101326"},
-{3641, "gene:vir:101327"},
-{3642, "gene:vir:101333"},
-{3643, "gene:vir:101336"},
-{3644, "gene:vir:101337"},
-{3645, "gene:vir:101338"},
-{3646, "gene:vir:101339"},
-{3647, "gene:vir:101355"},
-{3648, "gene:vir:101356"},
-{3649, "gene:vir:101358"},
-{3650, "gene:vir:101359"},
-{3651, "gene:vir:101366"},
-{3652, "gene:vir:101367"},
-{3653, "gene:vir:101368"},
-{3654, "gene:vir:101369"},
-{3655, "gene:vir:101370"},
-{3656, "gene:vir:101372"},
-{3657, "gene:vir:101382"},
-{3658, "gene:vir:101385"},
-{3659, "gene:vir:101387"},
-{3660, "gene:vir:101388"},
-{3661, "gene:vir:101391"},
-{3662, "gene:vir:101393"},
-{3663, "gene:vir:101394"},
-{3664, "gene:vir:101397"},
-{3665, "gene:vir:101398"},
-{3666, "gene:vir:101399"},
-{3667, "gene:vir:101404"},
-{3668, "gene:vir:101410"},
-{3669, "gene:vir:101413"},
-{3670, "gene:vir:101417"},
-{3671, "gene:vir:101419"},
-{3672, "gene:vir:101420"},
-{3673, "gene:vir:101424"},
-{3674, "gene:vir:101425"},
-{3675, "gene:vir:101427"},
-{3676, "gene:vir:101428"},
-{3677, "gene:vir:10148"},
-{3678, "gene:vir:10152"},
-{3679, "gene:vir:10162"},
-{3680, "gene:vir:10190"},
-{3681, "gene:vir:10232"},
-{3682, "gene:vir:10237"},
-{3683, "gene:vir:10248"},
-{3684, "gene:vir:10250"},
-{3685, "gene:vir:10270"},
-{3686, "gene:vir:102971"},
-{3687, "gene:vir:1042"},
-{3688, "gene:vir:104367"},
-{3689, "gene:vir:104372"},
-{3690, "gene:vir:104379"},
-{3691, "gene:vir:104384"},
-{3692, "gene:vir:104390"},
-{3693, "gene:vir:104392"},
-{3694, "gene:vir:104393"},
-{3695, "gene:vir:104394"},
-{3696, "gene:vir:104395"},
-{3697, "gene:vir:104397"},
-{3698, "gene:vir:104398"},
-{3699, "gene:vir:104409"},
-{3700, "gene:vir:104414"},
-{3701, "gene:vir:104416"},
-{3702, "gene:vir:104422"},
-{3703, "gene:vir:104426"},
-{3704, "gene:vir:104435"},
-{3705, "gene:vir:104438"},
-{3706, "gene:vir:1050"},
-{3707, "gene:vir:105028"},
-{3708, "gene:vir:105031"},
-{3709, "gene:vir:105035"},
-{3710, "gene:vir:105038"},
-{3711, "gene:vir:105039"},
-{3712, "gene:vir:105041"},
-{3713, "gene:vir:105043"},
-{3714, "gene:vir:105044"},
-{3715, "gene:vir:105050"},
-{3716, "gene:vir:105055"},
-{3717, "gene:vir:105059"},
-{3718, "gene:vir:105063"},
-{3719, "gene:vir:105064"},
-{3720, "gene:vir:105067"},
-{3721, "gene:vir:105083"},
-{3722, "gene:vir:105087"},
-{3723, "gene:vir:105088"},
-{3724, "gene:vir:105089"},
-{3725, "gene:vir:105366"},
-{3726, "gene:vir:105367"},
-{3727, "gene:vir:105370"},
-{3728, "gene:vir:105371"},
-{3729, "gene:vir:105373"},
-{3730, "gene:vir:105375"},
-{3731, "gene:vir:105377"},
-{3732, "gene:vir:105378"},
-{3733, "gene:vir:105389"},
-{3734, "gene:vir:105390"},
-{3735, "gene:vir:105392"},
-{3736, "gene:vir:105395"},
-{3737, "gene:vir:105399"},
-{3738, "gene:vir:105401"},
-{3739, "gene:vir:105404"},
-{3740, "gene:vir:105410"},
-{3741, "gene:vir:105414"},
-{3742, "gene:vir:105416"},
-{3743, "gene:vir:105418"},
-{3744, "gene:vir:105420"},
-{3745, "gene:vir:105421"},
-{3746, "gene:vir:105428"},
-{3747, "gene:vir:105430"},
-{3748, "gene:vir:105459"},
-{3749, "gene:vir:105460"},
-{3750, "gene:vir:105461"},
-{3751, "gene:vir:105462"},
-{3752, "gene:vir:105463"},
-{3753, "gene:vir:105464"},
-{3754, "gene:vir:105465"},
-{3755, "gene:vir:105466"},
-{3756, "gene:vir:105467"},
-{3757, "gene:vir:105468"},
-{3758, "gene:vir:105469"},
-{3759, "gene:vir:105470"},
-{3760, "gene:vir:105471"},
-{3761, "gene:vir:105472"},
-{3762, "gene:vir:105476"},
-{3763, "gene:vir:105488"},
-{3764, "gene:vir:105490"},
-{3765, "gene:vir:105492"},
-{3766, "gene:vir:105496"},
-{3767, "gene:vir:105497"},
-{3768, "gene:vir:105498"},
-{3769, "gene:vir:105503"},
-{3770, "gene:vir:105504"},
-{3771, "gene:vir:105507"},
-{3772, "gene:vir:105508"},
-{3773, "gene:vir:105509"},
-{3774, "gene:vir:105510"},
-{3775, "gene:vir:105511"},
-{3776, "gene:vir:105512"},
-{3777, "gene:vir:105513"},
-{3778, "gene:vir:105705"},
-{3779, "gene:vir:105714"},
-{3780, "gene:vir:105726"},
-{3781, "gene:vir:105727"},
-{3782, "gene:vir:105728"},
-{3783, "gene:vir:105780"},
-{3784, "gene:vir:105781"},
-{3785, "gene:vir:108417"},
-{3786, "gene:vir:108421"},
-{3787, "gene:vir:108429"},
-{3788, "gene:vir:108435"},
-{3789, "gene:vir:108541"},
-{3790, "gene:vir:108544"},
-{3791, "gene:vir:108549"},
-{3792, "gene:vir:108625"},
-{3793, "gene:vir:108626"},
-{3794, "gene:vir:108646"},
-{3795, "gene:vir:108716"},
-{3796, "gene:vir:108717"},
-{3797, "gene:vir:108718"},
-{3798, "gene:vir:108724"},
-{3799, "gene:vir:108725"},
-{3800, "gene:vir:108727"},
-{3801, "gene:vir:108728"},
-{3802, "gene:vir:1127"},
-{3803, "gene:vir:1146"},
-{3804, "gene:vir:129"},
-{3805, "gene:vir:130"},
-{3806, "gene:vir:131"},
-{3807, "gene:vir:1321"},
-{3808, "gene:vir:133"},
-{3809, "gene:vir:137"},
-{3810, "gene:vir:147"},
-{3811, "gene:vir:148"},
-{3812, "gene:vir:149"},
-{3813, "gene:vir:150"},
-{3814, "gene:vir:151"},
-{3815, "gene:vir:154"},
-{3816, "gene:vir:160"},
-{3817, "gene:vir:165"},
-{3818, "gene:vir:166"},
-{3819, "gene:vir:167"},
-{3820, "gene:vir:179"},
-{3821, "gene:vir:1826"},
-{3822, "gene:vir:1829"},
-{3823, "gene:vir:1830"},
-{3824, "gene:vir:1845"},
-{3825, "gene:vir:1849"},
-{3826, "gene:vir:1854"},
-{3827, "gene:vir:1857"},
-{3828, "gene:vir:1869"},
-{3829, "gene:vir:1870"},
-{3830, "gene:vir:1904"},
-{3831, "gene:vir:1911"},
-{3832, "gene:vir:1912"},
-{3833, "gene:vir:1914"},
-{3834, "gene:vir:1915"},
-{3835, "gene:vir:1917"},
-{3836, "gene:vir:1919"},
-{3837, "gene:vir:1921"},
-{3838, "gene:vir:1925"},
-{3839, "gene:vir:1930"},
-{3840, "gene:vir:1933"},
-{3841, "gene:vir:197"},
-{3842, "gene:vir:2013"},
-{3843, "gene:vir:2014"},
-{3844, "gene:vir:2015"},
-{3845, "gene:vir:2016"},
-{3846, "gene:vir:2017"},
-{3847, "gene:vir:2018"},
-{3848, "gene:vir:2019"},
-{3849, "gene:vir:2021"},
-{3850, "gene:vir:2022"},
-{3851, "gene:vir:2023"},
-{3852, "gene:vir:2024"},
-{3853, "gene:vir:2025"},
-{3854, "gene:vir:2026"},
-{3855, "gene:vir:2027"},
-{3856, "gene:vir:2028"},
-{3857, "gene:vir:2029"},
-{3858, "gene:vir:2030"},
-{3859, "gene:vir:2031"},
-{3860, "gene:vir:2032"},
-{3861, "gene:vir:2033"},
-{3862, "gene:vir:2035"},
-{3863, "gene:vir:2036"},
-{3864, "gene:vir:2037"},
-{3865, "gene:vir:2039"},
-{3866, "gene:vir:2040"},
-{3867, "gene:vir:2041"},
-{3868, "gene:vir:2042"},
-{3869, "gene:vir:2043"},
-{3870, "gene:vir:2044"},
-{3871, "gene:vir:2045"},
-{3872, "gene:vir:2046"},
-{3873, "gene:vir:2047"},
-{3874, "gene:vir:2048"},
-{3875, "gene:vir:2049"},
-{3876, "gene:vir:2050"},
-{3877, "gene:vir:2051"},
-{3878, "gene:vir:2052"},
-{3879, "gene:vir:209"},
-{3880, "gene:vir:2101"},
-{3881, "gene:vir:2121"},
-{3882, "gene:vir:213"},
-{3883, "gene:vir:219"},
-{3884, "gene:vir:221"},
-{3885, "gene:vir:228"},
-{3886, "gene:vir:229"},
-{3887, "gene:vir:235"},
-{3888, "gene:vir:236"},
-{3889, "gene:vir:240"},
-{3890, "gene:vir:243"},
-{3891, "gene:vir:244"},
-{3892, "gene:vir:2792"},
-{3893, "gene:vir:2854"},
-{3894, "gene:vir:2876"},
-{3895, "gene:vir:2883"},
-{3896, "gene:vir:2884"},
-{3897, "gene:vir:2918"},
-{3898, "gene:vir:3271"},
-{3899, "gene:vir:3289"},
-{3900, "gene:vir:3298"},
-{3901, "gene:vir:3403"},
-{3902, "gene:vir:3405"},
-{3903, "gene:vir:3417"},
-{3904, "gene:vir:3418"},
-{3905, "gene:vir:3419"},
-{3906, "gene:vir:3420"},
-{3907, "gene:vir:3421"},
-{3908, "gene:vir:3423"},
-{3909, "gene:vir:3424"},
-{3910, "gene:vir:3425"},
-{3911, "gene:vir:3426"},
-{3912, "gene:vir:3427"},
-{3913, "gene:vir:3428"},
-{3914, "gene:vir:3429"},
-{3915, "gene:vir:3430"},
-{3916, "gene:vir:3431"},
-{3917, "gene:vir:3432"},
-{3918, "gene:vir:3433"},
-{3919, "gene:vir:3434"},
-{3920, "gene:vir:3435"},
-{3921, "gene:vir:3436"},
-{3922, "gene:vir:3472"},
-{3923, "gene:vir:3474"},
-{3924, "gene:vir:3476"},
-{3925, "gene:vir:3477"},
-{3926, "gene:vir:3484"},
-{3927, "gene:vir:3485"},
-{3928, "gene:vir:3486"},
-{3929, "gene:vir:3487"},
-{3930, "gene:vir:3580"},
-{3931, "gene:vir:3803"},
-{3932, "gene:vir:3810"},
-{3933, "gene:vir:3834"},
-{3934, "gene:vir:3835"},
-{3935, "gene:vir:3836"},
-{3936, "gene:vir:3837"},
-{3937, "gene:vir:3838"},
-{3938, "gene:vir:3840"},
-{3939, "gene:vir:3841"},
-{3940, "gene:vir:3842"},
-{3941, "gene:vir:3843"},
-{3942, "gene:vir:3844"},
-{3943, "gene:vir:3845"},
-{3944, "gene:vir:3846"},
-{3945, "gene:vir:3847"},
-{3946, "gene:vir:3848"},
-{3947, "gene:vir:3849"},
-{3948, "gene:vir:3850"},
-{3949, "gene:vir:3851"},
-{3950, "gene:vir:3852"},
-{3951, "gene:vir:3853"},
-{3952, "gene:vir:3854"},
-{3953, "gene:vir:3855"},
-{3954, "gene:vir:3856"},
-{3955, "gene:vir:3857"},
-{3956, "gene:vir:3858"},
-{3957, "gene:vir:3859"},
-{3958, "gene:vir:3860"},
-{3959, "gene:vir:3861"},
-{3960, "gene:vir:3862"},
-{3961, "gene:vir:3864"},
-{3962, "gene:vir:3865"},
-{3963, "gene:vir:387"},
-{3964, "gene:vir:388"},
-{3965, "gene:vir:389"},
-{3966, "gene:vir:390"},
-{3967, "gene:vir:392"},
-{3968, "gene:vir:393"},
-{3969, "gene:vir:3933"},
-{3970, "gene:vir:394"},
-{3971, "gene:vir:395"},
-{3972, "gene:vir:396"},
-{3973, "gene:vir:397"},
-{3974, "gene:vir:398"},
-{3975, "gene:vir:399"},
-{3976, "gene:vir:400"},
-{3977, "gene:vir:401"},
-{3978, "gene:vir:402"},
-{3979, "gene:vir:403"},
-{3980, "gene:vir:4033"},
-{3981, "gene:vir:4035"},
-{3982, "gene:vir:404"},
-{3983, "gene:vir:4047"},
-{3984, "gene:vir:441"},
-{3985, "gene:vir:4452"},
-{3986, "gene:vir:4454"},
-{3987, "gene:vir:4456"},
-{3988, "gene:vir:446"},
-{3989, "gene:vir:4495"},
-{3990, "gene:vir:450"},
-{3991, "gene:vir:4507"},
-{3992, "gene:vir:4508"},
-{3993, "gene:vir:4509"},
-{3994, "gene:vir:4510"},
-{3995, "gene:vir:4511"},
-{3996, "gene:vir:4512"},
-{3997, "gene:vir:4514"},
-{3998, "gene:vir:4515"},
-{3999, "gene:vir:4516"},
-{4000, "gene:vir:4518"},
-{4001, "gene:vir:4519"},
-{4002, "gene:vir:4520"},
-{4003, "gene:vir:4521"},
-{4004, "gene:vir:4522"},
-{4005, "gene:vir:4523"},
-{4006, "gene:vir:4525"},
-{4007, "gene:vir:4533"},
-{4008, "gene:vir:4534"},
-{4009, "gene:vir:4535"},
-{4010, "gene:vir:4536"},
-{4011, "gene:vir:4537"},
-{4012, "gene:vir:4539"},
-{4013, "gene:vir:4542"},
-{4014, "gene:vir:4543"},
-{4015, "gene:vir:4544"},
-{4016, "gene:vir:4545"},
-{4017, "gene:vir:4546"},
-{4018, "gene:vir:4547"},
-{4019, "gene:vir:4549"},
-{4020, "gene:vir:4551"},
-{4021, "gene:vir:4552"},
-{4022, "gene:vir:4554"},
-{4023, "gene:vir:4555"},
-{4024, "gene:vir:4556"},
-{4025, "gene:vir:4557"},
-{4026, "gene:vir:4558"},
-{4027, "gene:vir:4559"},
-{4028, "gene:vir:469"},
-{4029, "gene:vir:473"},
-{4030, "gene:vir:474"},
-{4031, "gene:vir:475"},
-{4032, "gene:vir:4763"},
-{4033, "gene:vir:477"},
-{4034, "gene:vir:478"},
-{4035, "gene:vir:499"},
-{4036, "gene:vir:507"},
-{4037, "gene:vir:508"},
-{4038, "gene:vir:513"},
-{4039, "gene:vir:5691"},
-{4040, "gene:vir:5692"},
-{4041, "gene:vir:5693"},
-{4042, "gene:vir:5695"},
-{4043, "gene:vir:5696"},
-{4044, "gene:vir:5698"},
-{4045, "gene:vir:5699"},
-{4046, "gene:vir:5701"},
-{4047, "gene:vir:5704"},
-{4048, "gene:vir:5705"},
-{4049, "gene:vir:5706"},
-{4050, "gene:vir:5707"},
-{4051, "gene:vir:5708"},
-{4052, "gene:vir:5709"},
-{4053, "gene:vir:5711"},
-{4054, "gene:vir:5712"},
-{4055, "gene:vir:5713"},
-{4056, "gene:vir:5715"},
-{4057, "gene:vir:5716"},
-{4058, "gene:vir:5717"},
-{4059, "gene:vir:5718"},
-{4060, "gene:vir:5719"},
-{4061, "gene:vir:5720"},
-{4062, "gene:vir:5721"},
-{4063, "gene:vir:5722"},
-{4064, "gene:vir:5723"},
-{4065, "gene:vir:5725"},
-{4066, "gene:vir:5726"},
-{4067, "gene:vir:5727"},
-{4068, "gene:vir:5728"},
-{4069, "gene:vir:5729"},
-{4070, "gene:vir:6058"},
-{4071, "gene:vir:6059"},
-{4072, "gene:vir:6060"},
-{4073, "gene:vir:6061"},
-{4074, "gene:vir:6062"},
-{4075, "gene:vir:6063"},
-{4076, "gene:vir:6064"},
-{4077, "gene:vir:6065"},
-{4078, "gene:vir:6066"},
-{4079, "gene:vir:6067"},
-{4080, "gene:vir:6068"},
-{4081, "gene:vir:6069"},
-{4082, "gene:vir:6070"},
-{4083, "gene:vir:6071"},
-{4084, "gene:vir:6072"},
-{4085, "gene:vir:6073"},
-{4086, "gene:vir:6074"},
-{4087, "gene:vir:6075"},
-{4088, "gene:vir:6076"},
-{4089, "gene:vir:6077"},
-{4090, "gene:vir:6078"},
-{4091, "gene:vir:6079"},
-{4092, "gene:vir:6080"},
-{4093, "gene:vir:6081"},
-{4094, "gene:vir:6083"},
-{4095, "gene:vir:6084"},
-{4096, "gene:vir:6085"},
-{4097, "gene:vir:6086"},
-{4098, "gene:vir:6088"},
-{4099, "gene:vir:6093"},
-{4100, "gene:vir:6834"},
-{4101, "gene:vir:7156"},
-{4102, "gene:vir:7319"},
-{4103, "gene:vir:7343"},
-{4104, "gene:vir:7351"},
-{4105, "gene:vir:7352"},
-{4106, "gene:vir:7358"},
-{4107, "gene:vir:769"},
-{4108, "gene:vir:772"},
-{4109, "gene:vir:77584"},
-{4110, "gene:vir:77589"},
-{4111, "gene:vir:779"},
-{4112, "gene:vir:79529"},
-{4113, "gene:vir:79530"},
-{4114, "gene:vir:79536"},
-{4115, "gene:vir:79539"},
-{4116, "gene:vir:79542"},
-{4117, "gene:vir:79543"},
-{4118, "gene:vir:79544"},
-{4119, "gene:vir:79545"},
-{4120, "gene:vir:79547"},
-{4121, "gene:vir:79550"},
-{4122, "gene:vir:79551"},
-{4123, "gene:vir:79552"},
-{4124, "gene:vir:79555"},
-{4125, "gene:vir:79556"},
-{4126, "gene:vir:79557"},
-{4127, "gene:vir:79559"},
-{4128, "gene:vir:79561"},
-{4129, "gene:vir:79562"},
-{4130, "gene:vir:79564"},
-{4131, "gene:vir:79565"},
-{4132, "gene:vir:79567"},
-{4133, "gene:vir:79568"},
-{4134, "gene:vir:79569"},
-{4135, "gene:vir:79570"},
-{4136, "gene:vir:79572"},
-{4137, "gene:vir:79575"},
-{4138, "gene:vir:79577"},
-{4139, "gene:vir:79578"},
-{4140, "gene:vir:79580"},
-{4141, "gene:vir:79581"},
-{4142, "gene:vir:79582"},
-{4143, "gene:vir:79583"},
-{4144, "gene:vir:79588"},
-{4145, "gene:vir:798"},
-{4146, "gene:vir:809"},
-{4147, "gene:vir:820"},
-{4148, "gene:vir:8733"},
-{4149, "gene:vir:8772"},
-{4150, "gene:vir:8776"},
-{4151, "gene:vir:8777"},
-{4152, "gene:vir:93595"},
-{4153, "gene:vir:93603"},
-{4154, "gene:vir:93604"},
-{4155, "gene:vir:93613"},
-{4156, "gene:vir:93619"},
-{4157, "gene:vir:94754"},
-{4158, "gene:vir:95268"},
-{4159, "gene:vir:95310"},
-{4160, "gene:vir:95311"},
-{4161, "gene:vir:95312"},
-{4162, "gene:vir:95313"},
-{4163, "gene:vir:95314"},
-{4164, "gene:vir:95315"},
-{4165, "gene:vir:95317"},
-{4166, "gene:vir:95318"},
-{4167, "gene:vir:95319"},
-{4168, "gene:vir:95321"},
-{4169, "gene:vir:95322"},
-{4170, "gene:vir:95323"},
-{4171, "gene:vir:95324"},
-{4172, "gene:vir:95326"},
-{4173, "gene:vir:95327"},
-{4174, "gene:vir:95330"},
-{4175, "gene:vir:95331"},
-{4176, "gene:vir:95335"},
-{4177, "gene:vir:95339"},
-{4178, "gene:vir:95342"},
-{4179, "gene:vir:95347"},
-{4180, "gene:vir:95348"},
-{4181, "gene:vir:95349"},
-{4182, "gene:vir:95350"},
-{4183, "gene:vir:95351"},
-{4184, "gene:vir:95352"},
-{4185, "gene:vir:95353"},
-{4186, "gene:vir:95354"},
-{4187, "gene:vir:95355"},
-{4188, "gene:vir:95356"},
-{4189, "gene:vir:95357"},
-{4190, "gene:vir:95359"},
-{4191, "gene:vir:9540"},
-{4192, "gene:vir:9541"},
-{4193, "gene:vir:9572"},
-{4194, "gene:vir:96465"},
-{4195, "gene:vir:98354"},
-{4196, "gene:vir:98537"},
-{4197, "gene:vir:98538"},
-{4198, "gene:vir:98549"},
-{4199, "gene:vir:98550"},
-{4200, "gene:vir:98552"},
-{4201, "gene:vir:98554"},
-{4202, "gene:vir:98555"},
-{4203, "gene:vir:98556"},
-{4204, "gene:vir:98566"},
-{4205, "gene:vir:992"},
-{4206, "gene:vir:9949"},
-{4207, "p0111_1__AP010962"},
-{4208, "pENTAS02_1__CP003028"},
-{4209, "rep7a_8_ORF11(pRE25)_X92945"}
-};
-
-// const std::unordered_map<int, std::string> mgeIdMap = {
-//     {3, "Plasmid for gene transfer"},
-//     {4, "Transposon with multiple ARGs"},
-//     // Add more MGE entries as needed
-// };
-
-const std::unordered_map<int, std::string> mgeIdMap = {
-    {1001, "Col3M_1__JX514065"},
-    {1002, "FII(pBK30683)_1__KF954760"},
-    {1003, "ICEberg|101|Tn5385|GenBank|..."},
-    {1004, "ICEberg|127|ICEKpn342-1|Gen..."},
-    {1005, "ICEberg|129|ICEEcoED1a-1|Ge..."},
-    {1006, "ICEberg|170|Tn6103|GenBank|..."},
-    {1007, "ICEberg|327|ICEFal35896-1|G..."},
-    {1008, "ICEberg|362|Tn1311|GenBank|..."},
-    {1009, "ICEberg|399|CTn2|GenBank|AM..."},
-    {1010, "ICEberg|3|CTnDOT|GenBank|AJ..."},
-    {1011, "ICEberg|424|ICESauMu3-1|Gen..."},
-    {1012, "ICEberg|47|Tn5251(partofTn5..."},
-    {1013, "ICEberg|58|ICEBfrYCH46-1|Ge..."},
-    {1014, "ICEberg|65|CTnGERM1|GenBank..."},
-    {1015, "ICEberg|74|ICEEcIHE3034-1|G..."},
-    {1016, "ICEberg|79|ICESt3|GenBank|A..."},
-    {1017, "IncB/O/K/Z_2__GU256641"},
-    {1018, "IncFIA(HI1)_1_HI1_AF250878"},
-    {1019, "IncFII(S)_1__CP000858"},
-    {1020, "IncFII(SARC14)_1_SARC14_JQ4..."},
-    {1021, "IncFII_1_pKP91_CP000966"},
-    {1022, "IncHI2_1__BX664015"},
-    {1023, "IncI1_1_Alpha_AP005147"},
-    {1024, "gene:plasmid:109054"},
-    {1025, "gene:plasmid:109060"},
-    {1026, "gene:plasmid:109061"},
-    {1027, "gene:plasmid:109062"},
-    {1028, "gene:plasmid:109090"},
-    {1029, "gene:plasmid:109131"},
-    {1030, "gene:plasmid:109133"},
-    {1031, "gene:plasmid:109134"},
-    {1032, "gene:plasmid:109177"},
-    {1033, "gene:plasmid:109270"},
-    {1034, "gene:plasmid:109300"},
-    {1035, "gene:plasmid:110424"},
-    {1036, "gene:plasmid:111191"},
-    {1037, "gene:plasmid:111621"},
-    {1038, "gene:plasmid:112498"},
-    {1039, "gene:plasmid:112749"},
-    {1040, "gene:plasmid:114080"},
-    {1041, "gene:plasmid:114186"},
-    {1042, "gene:plasmid:114192"},
-    {1043, "gene:plasmid:114202"},
-    {1044, "gene:plasmid:114251"},
-    {1045, "gene:plasmid:114252"},
-    {1046, "gene:plasmid:114253"},
-    {1047, "gene:plasmid:115548"},
-    {1048, "gene:plasmid:115640"},
-    {1049, "gene:plasmid:116667"},
-    {1050, "gene:plasmid:117070"},
-    {1051, "gene:plasmid:117289"},
-    {1052, "gene:plasmid:117290"},
-    {1053, "gene:plasmid:117293"},
-    {1054, "gene:plasmid:117440"},
-    {1055, "gene:plasmid:117442"},
-    {1056, "gene:plasmid:117445"},
-    {1057, "gene:plasmid:117449"},
-    {1058, "gene:plasmid:117481"},
-    {1059, "gene:plasmid:117483"},
-    {1060, "gene:plasmid:117488"},
-    {1061, "gene:plasmid:117671"},
-    {1062, "gene:plasmid:117672"},
-    {1063, "gene:plasmid:117686"},
-    {1064, "gene:plasmid:117688"},
-    {1065, "gene:plasmid:117692"},
-    {1066, "gene:plasmid:117695"},
-    {1067, "gene:plasmid:117701"},
-    {1068, "gene:plasmid:117703"},
-    {1069, "gene:plasmid:117704"},
-    {1070, "gene:plasmid:117706"},
-    {1071, "gene:plasmid:117709"},
-    {1072, "gene:plasmid:117711"},
-    {1073, "gene:plasmid:117712"},
-    {1074, "gene:plasmid:117713"},
-    {1075, "gene:plasmid:117714"},
-    {1076, "gene:plasmid:117715"},
-    {1077, "gene:plasmid:117716"},
-    {1078, "gene:plasmid:117717"},
-    {1079, "gene:plasmid:117725"},
-    {1080, "gene:plasmid:117731"},
-    {1081, "gene:plasmid:117732"},
-    {1082, "gene:plasmid:117735"},
-    {1083, "gene:plasmid:117736"},
-    {1084, "gene:plasmid:117738"},
-    {1085, "gene:plasmid:117739"},
-    {1086, "gene:plasmid:117740"},
-    {1087, "gene:plasmid:117741"},
-    {1088, "gene:plasmid:117742"},
-    {1089, "gene:plasmid:117744"},
-    {1090, "gene:plasmid:117746"},
-    {1091, "gene:plasmid:117749"},
-    {1092, "gene:plasmid:117750"},
-    {1093, "gene:plasmid:117753"},
-    {1094, "gene:plasmid:117766"},
-    {1095, "gene:plasmid:117769"},
-    {1096, "gene:plasmid:117772"},
-    {1097, "gene:plasmid:117781"},
-    {1098, "gene:plasmid:117782"},
-    {1099, "gene:plasmid:117783"},
-    {1100, "gene:plasmid:117813"},
-    {1101, "gene:plasmid:117818"},
-    {1102, "gene:plasmid:117819"},
-    {1103, "gene:plasmid:117820"},
-    {1104, "gene:plasmid:117821"},
-    {1105, "gene:plasmid:117823"},
-    {1106, "gene:plasmid:117832"},
-    {1107, "gene:plasmid:117835"},
-    {1108, "gene:plasmid:117841"},
-    {1109, "gene:plasmid:118151"},
-    {1110, "gene:plasmid:118383"},
-    {1111, "gene:plasmid:118521"},
-    {1112, "gene:plasmid:118522"},
-    {1113, "gene:plasmid:119366"},
-    {1114, "gene:plasmid:119478"},
-    {1115, "gene:plasmid:119510"},
-    {1116, "gene:plasmid:119512"},
-    {1117, "gene:plasmid:119647"},
-    {1118, "gene:plasmid:119649"},
-    {1119, "gene:plasmid:119652"},
-    {1120, "gene:plasmid:119653"},
-    {1121, "gene:plasmid:119654"},
-    {1122, "gene:plasmid:119655"},
-    {1123, "gene:plasmid:119656"},
-    {1124, "gene:plasmid:119657"},
-    {1125, "gene:plasmid:119658"},
-    {1126, "gene:plasmid:119659"},
-    {1127, "gene:plasmid:119660"},
-    {1128, "gene:plasmid:119661"},
-    {1129, "gene:plasmid:119662"},
-    {1130, "gene:plasmid:119667"},
-    {1131, "gene:plasmid:119671"},
-    {1132, "gene:plasmid:119679"},
-    {1133, "gene:plasmid:119681"},
-    {1134, "gene:plasmid:119683"},
-    {1135, "gene:plasmid:119684"},
-    {1136, "gene:plasmid:119689"},
-    {1137, "gene:plasmid:119712"},
-    {1138, "gene:plasmid:119757"},
-    {1139, "gene:plasmid:119871"},
-    {1140, "gene:plasmid:120162"},
-    {1141, "gene:plasmid:120395"},
-    {1142, "gene:plasmid:120829"},
-    {1143, "gene:plasmid:121397"},
-    {1144, "gene:plasmid:121398"},
-    {1145, "gene:plasmid:121399"},
-    {1146, "gene:plasmid:121400"},
-    {1147, "gene:plasmid:121401"},
-    {1148, "gene:plasmid:121403"},
-    {1149, "gene:plasmid:121404"},
-    {1150, "gene:plasmid:121405"},
-    {1151, "gene:plasmid:121406"},
-    {1152, "gene:plasmid:121408"},
-    {1153, "gene:plasmid:121409"},
-    {1154, "gene:plasmid:121415"},
-    {1155, "gene:plasmid:121416"},
-    {1156, "gene:plasmid:121422"},
-    {1157, "gene:plasmid:121434"},
-    {1158, "gene:plasmid:121436"},
-    {1159, "gene:plasmid:121439"},
-    {1160, "gene:plasmid:121457"},
-    {1161, "gene:plasmid:121458"},
-    {1162, "gene:plasmid:121461"},
-    {1163, "gene:plasmid:121468"},
-    {1164, "gene:plasmid:121473"},
-    {1165, "gene:plasmid:121489"},
-    {1166, "gene:plasmid:121495"},
-    {1167, "gene:plasmid:121496"},
-    {1168, "gene:plasmid:121498"},
-    {1169, "gene:plasmid:121499"},
-    {1170, "gene:plasmid:121500"},
-    {1171, "gene:plasmid:121505"},
-    {1172, "gene:plasmid:121506"},
-    {1173, "gene:plasmid:121507"},
-    {1174, "gene:plasmid:121508"},
-    {1175, "gene:plasmid:121510"},
-    {1176, "gene:plasmid:121523"},
-    {1177, "gene:plasmid:121532"},
-    {1178, "gene:plasmid:121547"},
-    {1179, "gene:plasmid:121554"},
-    {1180, "gene:plasmid:121555"},
-    {1181, "gene:plasmid:121556"},
-    {1182, "gene:plasmid:121557"},
-    {1183, "gene:plasmid:121558"},
-    {1184, "gene:plasmid:121559"},
-    {1185, "gene:plasmid:121560"},
-    {1186, "gene:plasmid:121561"},
-    {1187, "gene:plasmid:121562"},
-    {1188, "gene:plasmid:121564"},
-    {1189, "gene:plasmid:121577"},
-    {1190, "gene:plasmid:121578"},
-    {1191, "gene:plasmid:121579"},
-    {1192, "gene:plasmid:121580"},
-    {1193, "gene:plasmid:121582"},
-    {1194, "gene:plasmid:121583"},
-    {1195, "gene:plasmid:121584"},
-    {1196, "gene:plasmid:121585"},
-    {1197, "gene:plasmid:121751"},
-    {1198, "gene:plasmid:121859"},
-    {1199, "gene:plasmid:121874"},
-    {1200, "gene:plasmid:121879"},
-    {1201, "gene:plasmid:121888"},
-    {1202, "gene:plasmid:121892"},
-    {1203, "gene:plasmid:121923"},
-    {1204, "gene:plasmid:121983"},
-    {1205, "gene:plasmid:122282"},
-    {1206, "gene:plasmid:122880"},
-    {1207, "gene:plasmid:122881"},
-    {1208, "gene:plasmid:122882"},
-    {1209, "gene:plasmid:123057"},
-    {1210, "gene:plasmid:123163"},
-    {1211, "gene:plasmid:123168"},
-    {1212, "gene:plasmid:123169"},
-    {1213, "gene:plasmid:123170"},
-    {1214, "gene:plasmid:123171"},
-    {1215, "gene:plasmid:123173"},
-    {1216, "gene:plasmid:123174"},
-    {1217, "gene:plasmid:123175"},
-    {1218, "gene:plasmid:123177"},
-    {1219, "gene:plasmid:123181"},
-    {1220, "gene:plasmid:123182"},
-    {1221, "gene:plasmid:123184"},
-    {1222, "gene:plasmid:123231"},
-    {1223, "gene:plasmid:123237"},
-    {1224, "gene:plasmid:123238"},
-    {1225, "gene:plasmid:123239"},
-    {1226, "gene:plasmid:123244"},
-    {1227, "gene:plasmid:123245"},
-    {1228, "gene:plasmid:123246"},
-    {1229, "gene:plasmid:123247"},
-    {1230, "gene:plasmid:123248"},
-    {1231, "gene:plasmid:123249"},
-    {1232, "gene:plasmid:123250"},
-    {1233, "gene:plasmid:123251"},
-    {1234, "gene:plasmid:123252"},
-    {1235, "gene:plasmid:123253"},
-    {1236, "gene:plasmid:123254"},
-    {1237, "gene:plasmid:123255"},
-    {1238, "gene:plasmid:123256"},
-    {1239, "gene:plasmid:123257"},
-    {1240, "gene:plasmid:123259"},
-    {1241, "gene:plasmid:123260"},
-    {1242, "gene:plasmid:123269"},
-    {1243, "gene:plasmid:123270"},
-    {1244, "gene:plasmid:123279"},
-    {1245, "gene:plasmid:123291"},
-    {1246, "gene:plasmid:123292"},
-    {1247, "gene:plasmid:123293"},
-    {1248, "gene:plasmid:123294"},
-    {1249, "gene:plasmid:123295"},
-    {1250, "gene:plasmid:123298"},
-    {1251, "gene:plasmid:123299"},
-    {1252, "gene:plasmid:123300"},
-    {1253, "gene:plasmid:123301"},
-    {1254, "gene:plasmid:123302"},
-    {1255, "gene:plasmid:123303"},
-    {1256, "gene:plasmid:123304"},
-    {1257, "gene:plasmid:123305"},
-    {1258, "gene:plasmid:123306"},
-    {1259, "gene:plasmid:123307"},
-    {1260, "gene:plasmid:123308"},
-    {1261, "gene:plasmid:123309"},
-    {1262, "gene:plasmid:123310"},
-    {1263, "gene:plasmid:123311"},
-    {1264, "gene:plasmid:123312"},
-    {1265, "gene:plasmid:123313"},
-    {1266, "gene:plasmid:123314"},
-    {1267, "gene:plasmid:123315"},
-    {1268, "gene:plasmid:123316"},
-    {1269, "gene:plasmid:123317"},
-    {1270, "gene:plasmid:123318"},
-    {1271, "gene:plasmid:123319"},
-    {1272, "gene:plasmid:123334"},
-    {1273, "gene:plasmid:123335"},
-    {1274, "gene:plasmid:123336"},
-    {1275, "gene:plasmid:123337"},
-    {1276, "gene:plasmid:123338"},
-    {1277, "gene:plasmid:123341"},
-    {1278, "gene:plasmid:123343"},
-    {1279, "gene:plasmid:123352"},
-    {1280, "gene:plasmid:123353"},
-    {1281, "gene:plasmid:123354"},
-    {1282, "gene:plasmid:123355"},
-    {1283, "gene:plasmid:123356"},
-    {1284, "gene:plasmid:123357"},
-    {1285, "gene:plasmid:123358"},
-    {1286, "gene:plasmid:123359"},
-    {1287, "gene:plasmid:123360"},
-    {1288, "gene:plasmid:123361"},
-    {1289, "gene:plasmid:123362"},
-    {1290, "gene:plasmid:123363"},
-    {1291, "gene:plasmid:123364"},
-    {1292, "gene:plasmid:123365"},
-    {1293, "gene:plasmid:123367"},
-    {1294, "gene:plasmid:123369"},
-    {1295, "gene:plasmid:123370"},
-    {1296, "gene:plasmid:123885"},
-    {1297, "gene:plasmid:123887"},
-    {1298, "gene:plasmid:123888"},
-    {1299, "gene:plasmid:123891"},
-    {1300, "gene:plasmid:124128"},
-    {1301, "gene:plasmid:124311"},
-    {1302, "gene:plasmid:124575"},
-    {1303, "gene:plasmid:124699"},
-    {1304, "gene:plasmid:124700"},
-    {1305, "gene:plasmid:124844"},
-    {1306, "gene:plasmid:124927"},
-    {1307, "gene:plasmid:124929"},
-    {1308, "gene:plasmid:125194"},
-    {1309, "gene:plasmid:125744"},
-    {1310, "gene:plasmid:126378"},
-    {1311, "gene:plasmid:127984"},
-    {1312, "gene:plasmid:127986"},
-    {1313, "gene:plasmid:128355"},
-    {1314, "gene:plasmid:128681"},
-    {1315, "gene:plasmid:128691"},
-    {1316, "gene:plasmid:128696"},
-    {1317, "gene:plasmid:128697"},
-    {1318, "gene:plasmid:128700"},
-    {1319, "gene:plasmid:128701"},
-    {1320, "gene:plasmid:128702"},
-    {1321, "gene:plasmid:129174"},
-    {1322, "gene:plasmid:130001"},
-    {1323, "gene:plasmid:130003"},
-    {1324, "gene:plasmid:130006"},
-    {1325, "gene:plasmid:130008"},
-    {1326, "gene:plasmid:130009"},
-    {1327, "gene:plasmid:130030"},
-    {1328, "gene:plasmid:13101"},
-    {1329, "gene:plasmid:131180"},
-    {1330, "gene:plasmid:131181"},
-    {1331, "gene:plasmid:131182"},
-    {1332, "gene:plasmid:131183"},
-    {1333, "gene:plasmid:131185"},
-    {1334, "gene:plasmid:131371"},
-    {1335, "gene:plasmid:131372"},
-    {1336, "gene:plasmid:131373"},
-    {1337, "gene:plasmid:13200"},
-    {1338, "gene:plasmid:13201"},
-    {1339, "gene:plasmid:13202"},
-    {1340, "gene:plasmid:13249"},
-    {1341, "gene:plasmid:13252"},
-    {1342, "gene:plasmid:133251"},
-    {1343, "gene:plasmid:133362"},
-    {1344, "gene:plasmid:133364"},
-    {1345, "gene:plasmid:133366"},
-    {1346, "gene:plasmid:133367"},
-    {1347, "gene:plasmid:133368"},
-    {1348, "gene:plasmid:133369"},
-    {1349, "gene:plasmid:133373"},
-    {1350, "gene:plasmid:133374"},
-    {1351, "gene:plasmid:133377"},
-    {1352, "gene:plasmid:133381"},
-    {1353, "gene:plasmid:133383"},
-    {1354, "gene:plasmid:133384"},
-    {1355, "gene:plasmid:133385"},
-    {1356, "gene:plasmid:133387"},
-    {1357, "gene:plasmid:133388"},
-    {1358, "gene:plasmid:133389"},
-    {1359, "gene:plasmid:133390"},
-    {1360, "gene:plasmid:133391"},
-    {1361, "gene:plasmid:133392"},
-    {1362, "gene:plasmid:133394"},
-    {1363, "gene:plasmid:133396"},
-    {1364, "gene:plasmid:133397"},
-    {1365, "gene:plasmid:133400"},
-    {1366, "gene:plasmid:133401"},
-    {1367, "gene:plasmid:133402"},
-    {1368, "gene:plasmid:133420"},
-    {1369, "gene:plasmid:133691"},
-    {1370, "gene:plasmid:134554"},
-    {1371, "gene:plasmid:134555"},
-    {1372, "gene:plasmid:134726"},
-    {1373, "gene:plasmid:134730"},
-    {1374, "gene:plasmid:134731"},
-    {1375, "gene:plasmid:134941"},
-    {1376, "gene:plasmid:134942"},
-    {1377, "gene:plasmid:135028"},
-    {1378, "gene:plasmid:135202"},
-    {1379, "gene:plasmid:135617"},
-    {1380, "gene:plasmid:135622"},
-    {1381, "gene:plasmid:135653"},
-    {1382, "gene:plasmid:135956"},
-    {1383, "gene:plasmid:135957"},
-    {1384, "gene:plasmid:135959"},
-    {1385, "gene:plasmid:135965"},
-    {1386, "gene:plasmid:135966"},
-    {1387, "gene:plasmid:135975"},
-    {1388, "gene:plasmid:135976"},
-    {1389, "gene:plasmid:135980"},
-    {1390, "gene:plasmid:135994"},
-    {1391, "gene:plasmid:136001"},
-    {1392, "gene:plasmid:136136"},
-    {1393, "gene:plasmid:136188"},
-    {1394, "gene:plasmid:136190"},
-    {1395, "gene:plasmid:136204"},
-    {1396, "gene:plasmid:136206"},
-    {1397, "gene:plasmid:136208"},
-    {1398, "gene:plasmid:136210"},
-    {1399, "gene:plasmid:136244"},
-    {1400, "gene:plasmid:136246"},
-    {1401, "gene:plasmid:136251"},
-    {1402, "gene:plasmid:136253"},
-    {1403, "gene:plasmid:136274"},
-    {1404, "gene:plasmid:136282"},
-    {1405, "gene:plasmid:136284"},
-    {1406, "gene:plasmid:136289"},
-    {1407, "gene:plasmid:136299"},
-    {1408, "gene:plasmid:136301"},
-    {1409, "gene:plasmid:136305"},
-    {1410, "gene:plasmid:136829"},
-    {1411, "gene:plasmid:136837"},
-    {1412, "gene:plasmid:136912"},
-    {1413, "gene:plasmid:136996"},
-    {1414, "gene:plasmid:138607"},
-    {1415, "gene:plasmid:138733"},
-    {1416, "gene:plasmid:138875"},
-    {1417, "gene:plasmid:139260"},
-    {1418, "gene:plasmid:139261"},
-    {1419, "gene:plasmid:139262"},
-    {1420, "gene:plasmid:139263"},
-    {1421, "gene:plasmid:139267"},
-    {1422, "gene:plasmid:139560"},
-    {1423, "gene:plasmid:139561"},
-    {1424, "gene:plasmid:139598"},
-    {1425, "gene:plasmid:139599"},
-    {1426, "gene:plasmid:139605"},
-    {1427, "gene:plasmid:139613"},
-    {1428, "gene:plasmid:139631"},
-    {1429, "gene:plasmid:139633"},
-    {1430, "gene:plasmid:139639"},
-    {1431, "gene:plasmid:139642"},
-    {1432, "gene:plasmid:139649"},
-    {1433, "gene:plasmid:139661"},
-    {1434, "gene:plasmid:139674"},
-    {1435, "gene:plasmid:140527"},
-    {1436, "gene:plasmid:140839"},
-    {1437, "gene:plasmid:140955"},
-    {1438, "gene:plasmid:141250"},
-    {1439, "gene:plasmid:141403"},
-    {1440, "gene:plasmid:141421"},
-    {1441, "gene:plasmid:141422"},
-    {1442, "gene:plasmid:141423"},
-    {1443, "gene:plasmid:141424"},
-    {1444, "gene:plasmid:141425"},
-    {1445, "gene:plasmid:141426"},
-    {1446, "gene:plasmid:141427"},
-    {1447, "gene:plasmid:141428"},
-    {1448, "gene:plasmid:141429"},
-    {1449, "gene:plasmid:141431"},
-    {1450, "gene:plasmid:14189"},
-    {1451, "gene:plasmid:141976"},
-    {1452, "gene:plasmid:142013"},
-    {1453, "gene:plasmid:142025"},
-    {1454, "gene:plasmid:142074"},
-    {1455, "gene:plasmid:142078"},
-    {1456, "gene:plasmid:142099"},
-    {1457, "gene:plasmid:142103"},
-    {1458, "gene:plasmid:14227"},
-    {1459, "gene:plasmid:14228"},
-    {1460, "gene:plasmid:14229"},
-    {1461, "gene:plasmid:14231"},
-    {1462, "gene:plasmid:14232"},
-    {1463, "gene:plasmid:14238"},
-    {1464, "gene:plasmid:14240"},
-    {1465, "gene:plasmid:14241"},
-    {1466, "gene:plasmid:14242"},
-    {1467, "gene:plasmid:14243"},
-    {1468, "gene:plasmid:14246"},
-    {1469, "gene:plasmid:14247"},
-    {1470, "gene:plasmid:14250"},
-    {1471, "gene:plasmid:14252"},
-    {1472, "gene:plasmid:14254"},
-    {1473, "gene:plasmid:14257"},
-    {1474, "gene:plasmid:14258"},
-    {1475, "gene:plasmid:14259"},
-    {1476, "gene:plasmid:14302"},
-    {1477, "gene:plasmid:14303"},
-    {1478, "gene:plasmid:14304"},
-    {1479, "gene:plasmid:14307"},
-    {1480, "gene:plasmid:14401"},
-    {1481, "gene:plasmid:14403"},
-    {1482, "gene:plasmid:145495"},
-    {1483, "gene:plasmid:145991"},
-    {1484, "gene:plasmid:146017"},
-    {1485, "gene:plasmid:146021"},
-    {1486, "gene:plasmid:146529"},
-    {1487, "gene:plasmid:146683"},
-    {1488, "gene:plasmid:147172"},
-    {1489, "gene:plasmid:147231"},
-    {1490, "gene:plasmid:147495"},
-    {1491, "gene:plasmid:147496"},
-    {1492, "gene:plasmid:147498"},
-    {1493, "gene:plasmid:147501"},
-    {1494, "gene:plasmid:147544"},
-    {1495, "gene:plasmid:148055"},
-    {1496, "gene:plasmid:148146"},
-    {1497, "gene:plasmid:148147"},
-    {1498, "gene:plasmid:148149"},
-    {1499, "gene:plasmid:148150"},
-    {1500, "gene:plasmid:148201"},
-    {1501, "gene:plasmid:148202"},
-    {1502, "gene:plasmid:148203"},
-    {1503, "gene:plasmid:148218"},
-    {1504, "gene:plasmid:148219"},
-    {1505, "gene:plasmid:148220"},
-    {1506, "gene:plasmid:148233"},
-    {1507, "gene:plasmid:148234"},
-    {1508, "gene:plasmid:149101"},
-    {1509, "gene:plasmid:14929"},
-    {1510, "gene:plasmid:14930"},
-    {1511, "gene:plasmid:149414"},
-    {1512, "gene:plasmid:149415"},
-    {1513, "gene:plasmid:14955"},
-    {1514, "gene:plasmid:150081"},
-    {1515, "gene:plasmid:151001"},
-    {1516, "gene:plasmid:151038"},
-    {1517, "gene:plasmid:151053"},
-    {1518, "gene:plasmid:151054"},
-    {1519, "gene:plasmid:151055"},
-    {1520, "gene:plasmid:151057"},
-    {1521, "gene:plasmid:151060"},
-    {1522, "gene:plasmid:151216"},
-    {1523, "gene:plasmid:151217"},
-    {1524, "gene:plasmid:151223"},
-    {1525, "gene:plasmid:151224"},
-    {1526, "gene:plasmid:151225"},
-    {1527, "gene:plasmid:151237"},
-    {1528, "gene:plasmid:151239"},
-    {1529, "gene:plasmid:151240"},
-    {1530, "gene:plasmid:151241"},
-    {1531, "gene:plasmid:151243"},
-    {1532, "gene:plasmid:151245"},
-    {1533, "gene:plasmid:151254"},
-    {1534, "gene:plasmid:151260"},
-    {1535, "gene:plasmid:151265"},
-    {1536, "gene:plasmid:151266"},
-    {1537, "gene:plasmid:151267"},
-    {1538, "gene:plasmid:151269"},
-    {1539, "gene:plasmid:151273"},
-    {1540, "gene:plasmid:151274"},
-    {1541, "gene:plasmid:151275"},
-    {1542, "gene:plasmid:151280"},
-    {1543, "gene:plasmid:151286"},
-    {1544, "gene:plasmid:151291"},
-    {1545, "gene:plasmid:151295"},
-    {1546, "gene:plasmid:151296"},
-    {1547, "gene:plasmid:151298"},
-    {1548, "gene:plasmid:151300"},
-    {1549, "gene:plasmid:151309"},
-    {1550, "gene:plasmid:151322"},
-    {1551, "gene:plasmid:151323"},
-    {1552, "gene:plasmid:151429"},
-    {1553, "gene:plasmid:151658"},
-    {1554, "gene:plasmid:152440"},
-    {1555, "gene:plasmid:15293"},
-    {1556, "gene:plasmid:15301"},
-    {1557, "gene:plasmid:15302"},
-    {1558, "gene:plasmid:15303"},
-    {1559, "gene:plasmid:15306"},
-    {1560, "gene:plasmid:153832"},
-    {1561, "gene:plasmid:153833"},
-    {1562, "gene:plasmid:153834"},
-    {1563, "gene:plasmid:153835"},
-    {1564, "gene:plasmid:153836"},
-    {1565, "gene:plasmid:153837"},
-    {1566, "gene:plasmid:153838"},
-    {1567, "gene:plasmid:153840"},
-    {1568, "gene:plasmid:153841"},
-    {1569, "gene:plasmid:153842"},
-    {1570, "gene:plasmid:153843"},
-    {1571, "gene:plasmid:153844"},
-    {1572, "gene:plasmid:153845"},
-    {1573, "gene:plasmid:153846"},
-    {1574, "gene:plasmid:153847"},
-    {1575, "gene:plasmid:153848"},
-    {1576, "gene:plasmid:153849"},
-    {1577, "gene:plasmid:153850"},
-    {1578, "gene:plasmid:153851"},
-    {1579, "gene:plasmid:153852"},
-    {1580, "gene:plasmid:153853"},
-    {1581, "gene:plasmid:153854"},
-    {1582, "gene:plasmid:153855"},
-    {1583, "gene:plasmid:153856"},
-    {1584, "gene:plasmid:153857"},
-    {1585, "gene:plasmid:153858"},
-    {1586, "gene:plasmid:153860"},
-    {1587, "gene:plasmid:153861"},
-    {1588, "gene:plasmid:153862"},
-    {1589, "gene:plasmid:153863"},
-    {1590, "gene:plasmid:153864"},
-    {1591, "gene:plasmid:153865"},
-    {1592, "gene:plasmid:153866"},
-    {1593, "gene:plasmid:153867"},
-    {1594, "gene:plasmid:153868"},
-    {1595, "gene:plasmid:153870"},
-    {1596, "gene:plasmid:153871"},
-    {1597, "gene:plasmid:153875"},
-    {1598, "gene:plasmid:153876"},
-    {1599, "gene:plasmid:153877"},
-    {1600, "gene:plasmid:153884"},
-    {1601, "gene:plasmid:153886"},
-    {1602, "gene:plasmid:153887"},
-    {1603, "gene:plasmid:153896"},
-    {1604, "gene:plasmid:153898"},
-    {1605, "gene:plasmid:153899"},
-    {1606, "gene:plasmid:153900"},
-    {1607, "gene:plasmid:153901"},
-    {1608, "gene:plasmid:153902"},
-    {1609, "gene:plasmid:153903"},
-    {1610, "gene:plasmid:153905"},
-    {1611, "gene:plasmid:153906"},
-    {1612, "gene:plasmid:153907"},
-    {1613, "gene:plasmid:153908"},
-    {1614, "gene:plasmid:153909"},
-    {1615, "gene:plasmid:153913"},
-    {1616, "gene:plasmid:153914"},
-    {1617, "gene:plasmid:153926"},
-    {1618, "gene:plasmid:153927"},
-    {1619, "gene:plasmid:153998"},
-    {1620, "gene:plasmid:153999"},
-    {1621, "gene:plasmid:154000"},
-    {1622, "gene:plasmid:154001"},
-    {1623, "gene:plasmid:154003"},
-    {1624, "gene:plasmid:154004"},
-    {1625, "gene:plasmid:154007"},
-    {1626, "gene:plasmid:154008"},
-    {1627, "gene:plasmid:154009"},
-    {1628, "gene:plasmid:154010"},
-    {1629, "gene:plasmid:154011"},
-    {1630, "gene:plasmid:154013"},
-    {1631, "gene:plasmid:154014"},
-    {1632, "gene:plasmid:154026"},
-    {1633, "gene:plasmid:154029"},
-    {1634, "gene:plasmid:154033"},
-    {1635, "gene:plasmid:154036"},
-    {1636, "gene:plasmid:154037"},
-    {1637, "gene:plasmid:154038"},
-    {1638, "gene:plasmid:15404"},
-    {1639, "gene:plasmid:154040"},
-    {1640, "gene:plasmid:154041"},
-    {1641, "gene:plasmid:154042"},
-    {1642, "gene:plasmid:154043"},
-    {1643, "gene:plasmid:154057"},
-    {1644, "gene:plasmid:154059"},
-    {1645, "gene:plasmid:154060"},
-    {1646, "gene:plasmid:154062"},
-    {1647, "gene:plasmid:154063"},
-    {1648, "gene:plasmid:154064"},
-    {1649, "gene:plasmid:154065"},
-    {1650, "gene:plasmid:154074"},
-    {1651, "gene:plasmid:154075"},
-    {1652, "gene:plasmid:154076"},
-    {1653, "gene:plasmid:154077"},
-    {1654, "gene:plasmid:154078"},
-    {1655, "gene:plasmid:154080"},
-    {1656, "gene:plasmid:154081"},
-    {1657, "gene:plasmid:154082"},
-    {1658, "gene:plasmid:154083"},
-    {1659, "gene:plasmid:154098"},
-    {1660, "gene:plasmid:154099"},
-    {1661, "gene:plasmid:154100"},
-    {1662, "gene:plasmid:154101"},
-    {1663, "gene:plasmid:154102"},
-    {1664, "gene:plasmid:154107"},
-    {1665, "gene:plasmid:154108"},
-    {1666, "gene:plasmid:154110"},
-    {1667, "gene:plasmid:154111"},
-    {1668, "gene:plasmid:154115"},
-    {1669, "gene:plasmid:154116"},
-    {1670, "gene:plasmid:154117"},
-    {1671, "gene:plasmid:154118"},
-    {1672, "gene:plasmid:154119"},
-    {1673, "gene:plasmid:154121"},
-    {1674, "gene:plasmid:154122"},
-    {1675, "gene:plasmid:154123"},
-    {1676, "gene:plasmid:154125"},
-    {1677, "gene:plasmid:154398"},
-    {1678, "gene:plasmid:154402"},
-    {1679, "gene:plasmid:154403"},
-    {1680, "gene:plasmid:154407"},
-    {1681, "gene:plasmid:154408"},
-    {1682, "gene:plasmid:154409"},
-    {1683, "gene:plasmid:154410"},
-    {1684, "gene:plasmid:154411"},
-    {1685, "gene:plasmid:154412"},
-    {1686, "gene:plasmid:154413"},
-    {1687, "gene:plasmid:154414"},
-    {1688, "gene:plasmid:154416"},
-    {1689, "gene:plasmid:154417"},
-    {1690, "gene:plasmid:154418"},
-    {1691, "gene:plasmid:154420"},
-    {1692, "gene:plasmid:154421"},
-    {1693, "gene:plasmid:154422"},
-    {1694, "gene:plasmid:154429"},
-    {1695, "gene:plasmid:154434"},
-    {1696, "gene:plasmid:154442"},
-    {1697, "gene:plasmid:154443"},
-    {1698, "gene:plasmid:154444"},
-    {1699, "gene:plasmid:154450"},
-    {1700, "gene:plasmid:154459"},
-    {1701, "gene:plasmid:154460"},
-    {1702, "gene:plasmid:154477"},
-    {1703, "gene:plasmid:154739"},
-    {1704, "gene:plasmid:15538"},
-    {1705, "gene:plasmid:15539"},
-    {1706, "gene:plasmid:15542"},
-    {1707, "gene:plasmid:15547"},
-    {1708, "gene:plasmid:15551"},
-    {1709, "gene:plasmid:15563"},
-    {1710, "gene:plasmid:15569"},
-    {1711, "gene:plasmid:155919"},
-    {1712, "gene:plasmid:155923"},
-    {1713, "gene:plasmid:155925"},
-    {1714, "gene:plasmid:155929"},
-    {1715, "gene:plasmid:15593"},
-    {1716, "gene:plasmid:155943"},
-    {1717, "gene:plasmid:155947"},
-    {1718, "gene:plasmid:155951"},
-    {1719, "gene:plasmid:155952"},
-    {1720, "gene:plasmid:155957"},
-    {1721, "gene:plasmid:155959"},
-    {1722, "gene:plasmid:155964"},
-    {1723, "gene:plasmid:155970"},
-    {1724, "gene:plasmid:155972"},
-    {1725, "gene:plasmid:155982"},
-    {1726, "gene:plasmid:155983"},
-    {1727, "gene:plasmid:155985"},
-    {1728, "gene:plasmid:155986"},
-    {1729, "gene:plasmid:155987"},
-    {1730, "gene:plasmid:155991"},
-    {1731, "gene:plasmid:155994"},
-    {1732, "gene:plasmid:156009"},
-    {1733, "gene:plasmid:156018"},
-    {1734, "gene:plasmid:156020"},
-    {1735, "gene:plasmid:156022"},
-    {1736, "gene:plasmid:156023"},
-    {1737, "gene:plasmid:156025"},
-    {1738, "gene:plasmid:156032"},
-    {1739, "gene:plasmid:156035"},
-    {1740, "gene:plasmid:156038"},
-    {1741, "gene:plasmid:156042"},
-    {1742, "gene:plasmid:156047"},
-    {1743, "gene:plasmid:156050"},
-    {1744, "gene:plasmid:156052"},
-    {1745, "gene:plasmid:156053"},
-    {1746, "gene:plasmid:156066"},
-    {1747, "gene:plasmid:156075"},
-    {1748, "gene:plasmid:156077"},
-    {1749, "gene:plasmid:156082"},
-    {1750, "gene:plasmid:156084"},
-    {1751, "gene:plasmid:156088"},
-    {1752, "gene:plasmid:156104"},
-    {1753, "gene:plasmid:156110"},
-    {1754, "gene:plasmid:156115"},
-    {1755, "gene:plasmid:156119"},
-    {1756, "gene:plasmid:156120"},
-    {1757, "gene:plasmid:156123"},
-    {1758, "gene:plasmid:156124"},
-    {1759, "gene:plasmid:156128"},
-    {1760, "gene:plasmid:156131"},
-    {1761, "gene:plasmid:156134"},
-    {1762, "gene:plasmid:156136"},
-    {1763, "gene:plasmid:156145"},
-    {1764, "gene:plasmid:156155"},
-    {1765, "gene:plasmid:156156"},
-    {1766, "gene:plasmid:156157"},
-    {1767, "gene:plasmid:156161"},
-    {1768, "gene:plasmid:156169"},
-    {1769, "gene:plasmid:156176"},
-    {1770, "gene:plasmid:15632"},
-    {1771, "gene:plasmid:156359"},
-    {1772, "gene:plasmid:156361"},
-    {1773, "gene:plasmid:156386"},
-    {1774, "gene:plasmid:156401"},
-    {1775, "gene:plasmid:15651"},
-    {1776, "gene:plasmid:15652"},
-    {1777, "gene:plasmid:15664"},
-    {1778, "gene:plasmid:15665"},
-    {1779, "gene:plasmid:156782"},
-    {1780, "gene:plasmid:156805"},
-    {1781, "gene:plasmid:156832"},
-    {1782, "gene:plasmid:15709"},
-    {1783, "gene:plasmid:15735"},
-    {1784, "gene:plasmid:157415"},
-    {1785, "gene:plasmid:15744"},
-    {1786, "gene:plasmid:15745"},
-    {1787, "gene:plasmid:15750"},
-    {1788, "gene:plasmid:15751"},
-    {1789, "gene:plasmid:157659"},
-    {1790, "gene:plasmid:157676"},
-    {1791, "gene:plasmid:15768"},
-    {1792, "gene:plasmid:157713"},
-    {1793, "gene:plasmid:157741"},
-    {1794, "gene:plasmid:157743"},
-    {1795, "gene:plasmid:157758"},
-    {1796, "gene:plasmid:157762"},
-    {1797, "gene:plasmid:15780"},
-    {1798, "gene:plasmid:15801"},
-    {1799, "gene:plasmid:15811"},
-    {1800, "gene:plasmid:158140"},
-    {1801, "gene:plasmid:15815"},
-    {1802, "gene:plasmid:15816"},
-    {1803, "gene:plasmid:15825"},
-    {1804, "gene:plasmid:15838"},
-    {1805, "gene:plasmid:15839"},
-    {1806, "gene:plasmid:158565"},
-    {1807, "gene:plasmid:158573"},
-    {1808, "gene:plasmid:158595"},
-    {1809, "gene:plasmid:158721"},
-    {1810, "gene:plasmid:158823"},
-    {1811, "gene:plasmid:158830"},
-    {1812, "gene:plasmid:158835"},
-    {1813, "gene:plasmid:158836"},
-    {1814, "gene:plasmid:158837"},
-    {1815, "gene:plasmid:158838"},
-    {1816, "gene:plasmid:158858"},
-    {1817, "gene:plasmid:158860"},
-    {1818, "gene:plasmid:158872"},
-    {1819, "gene:plasmid:158874"},
-    {1820, "gene:plasmid:158895"},
-    {1821, "gene:plasmid:158896"},
-    {1822, "gene:plasmid:158907"},
-    {1823, "gene:plasmid:158916"},
-    {1824, "gene:plasmid:15970"},
-    {1825, "gene:plasmid:15978"},
-    {1826, "gene:plasmid:15979"},
-    {1827, "gene:plasmid:15980"},
-    {1828, "gene:plasmid:15988"},
-    {1829, "gene:plasmid:15989"},
-    {1830, "gene:plasmid:15990"},
-    {1831, "gene:plasmid:15993"},
-    {1832, "gene:plasmid:15994"},
-    {1833, "gene:plasmid:16003"},
-    {1834, "gene:plasmid:16008"},
-    {1835, "gene:plasmid:16009"},
-    {1836, "gene:plasmid:16011"},
-    {1837, "gene:plasmid:16015"},
-    {1838, "gene:plasmid:16025"},
-    {1839, "gene:plasmid:16026"},
-    {1840, "gene:plasmid:16027"},
-    {1841, "gene:plasmid:16028"},
-    {1842, "gene:plasmid:16029"},
-    {1843, "gene:plasmid:16031"},
-    {1844, "gene:plasmid:16032"},
-    {1845, "gene:plasmid:16033"},
-    {1846, "gene:plasmid:16044"},
-    {1847, "gene:plasmid:16046"},
-    {1848, "gene:plasmid:16047"},
-    {1849, "gene:plasmid:16099"},
-    {1850, "gene:plasmid:16111"},
-    {1851, "gene:plasmid:16162"},
-    {1852, "gene:plasmid:16930"},
-    {1853, "gene:plasmid:16943"},
-    {1854, "gene:plasmid:16952"},
-    {1855, "gene:plasmid:16955"},
-    {1856, "gene:plasmid:16956"},
-    {1857, "gene:plasmid:16991"},
-    {1858, "gene:plasmid:17097"},
-    {1859, "gene:plasmid:17121"},
-    {1860, "gene:plasmid:17163"},
-    {1861, "gene:plasmid:17290"},
-    {1862, "gene:plasmid:17291"},
-    {1863, "gene:plasmid:17292"},
-    {1864, "gene:plasmid:17293"},
-    {1865, "gene:plasmid:17458"},
-    {1866, "gene:plasmid:19088"},
-    {1867, "gene:plasmid:19383"},
-    {1868, "gene:plasmid:19387"},
-    {1869, "gene:plasmid:19399"},
-    {1870, "gene:plasmid:19401"},
-    {1871, "gene:plasmid:19402"},
-    {1872, "gene:plasmid:19403"},
-    {1873, "gene:plasmid:19404"},
-    {1874, "gene:plasmid:19405"},
-    {1875, "gene:plasmid:19406"},
-    {1876, "gene:plasmid:19407"},
-    {1877, "gene:plasmid:19408"},
-    {1878, "gene:plasmid:19409"},
-    {1879, "gene:plasmid:19413"},
-    {1880, "gene:plasmid:19426"},
-    {1881, "gene:plasmid:19447"},
-    {1882, "gene:plasmid:19451"},
-    {1883, "gene:plasmid:19453"},
-    {1884, "gene:plasmid:19454"},
-    {1885, "gene:plasmid:19455"},
-    {1886, "gene:plasmid:19456"},
-    {1887, "gene:plasmid:19464"},
-    {1888, "gene:plasmid:19467"},
-    {1889, "gene:plasmid:19468"},
-    {1890, "gene:plasmid:19489"},
-    {1891, "gene:plasmid:19493"},
-    {1892, "gene:plasmid:19497"},
-    {1893, "gene:plasmid:19506"},
-    {1894, "gene:plasmid:19639"},
-    {1895, "gene:plasmid:19727"},
-    {1896, "gene:plasmid:19728"},
-    {1897, "gene:plasmid:19729"},
-    {1898, "gene:plasmid:19732"},
-    {1899, "gene:plasmid:19743"},
-    {1900, "gene:plasmid:19744"},
-    {1901, "gene:plasmid:19765"},
-    {1902, "gene:plasmid:19782"},
-    {1903, "gene:plasmid:19874"},
-    {1904, "gene:plasmid:20019"},
-    {1905, "gene:plasmid:20020"},
-    {1906, "gene:plasmid:20022"},
-    {1907, "gene:plasmid:20023"},
-    {1908, "gene:plasmid:20177"},
-    {1909, "gene:plasmid:20178"},
-    {1910, "gene:plasmid:20382"},
-    {1911, "gene:plasmid:21240"},
-    {1912, "gene:plasmid:21336"},
-    {1913, "gene:plasmid:21346"},
-    {1914, "gene:plasmid:21493"},
-    {1915, "gene:plasmid:21818"},
-    {1916, "gene:plasmid:21828"},
-    {1917, "gene:plasmid:21842"},
-    {1918, "gene:plasmid:21843"},
-    {1919, "gene:plasmid:21909"},
-    {1920, "gene:plasmid:21942"},
-    {1921, "gene:plasmid:21988"},
-    {1922, "gene:plasmid:21989"},
-    {1923, "gene:plasmid:22236"},
-    {1924, "gene:plasmid:22627"},
-    {1925, "gene:plasmid:23148"},
-    {1926, "gene:plasmid:24081"},
-    {1927, "gene:plasmid:24088"},
-    {1928, "gene:plasmid:24099"},
-    {1929, "gene:plasmid:24100"},
-    {1930, "gene:plasmid:24101"},
-    {1931, "gene:plasmid:24102"},
-    {1932, "gene:plasmid:24194"},
-    {1933, "gene:plasmid:24195"},
-    {1934, "gene:plasmid:24202"},
-    {1935, "gene:plasmid:24221"},
-    {1936, "gene:plasmid:24229"},
-    {1937, "gene:plasmid:24230"},
-    {1938, "gene:plasmid:24231"},
-    {1939, "gene:plasmid:24232"},
-    {1940, "gene:plasmid:24233"},
-    {1941, "gene:plasmid:24236"},
-    {1942, "gene:plasmid:24237"},
-    {1943, "gene:plasmid:24240"},
-    {1944, "gene:plasmid:24243"},
-    {1945, "gene:plasmid:24248"},
-    {1946, "gene:plasmid:24249"},
-    {1947, "gene:plasmid:24253"},
-    {1948, "gene:plasmid:24263"},
-    {1949, "gene:plasmid:24290"},
-    {1950, "gene:plasmid:24295"},
-    {1951, "gene:plasmid:24300"},
-    {1952, "gene:plasmid:24302"},
-    {1953, "gene:plasmid:24309"},
-    {1954, "gene:plasmid:24510"},
-    {1955, "gene:plasmid:24529"},
-    {1956, "gene:plasmid:24530"},
-    {1957, "gene:plasmid:24532"},
-    {1958, "gene:plasmid:24534"},
-    {1959, "gene:plasmid:24555"},
-    {1960, "gene:plasmid:24561"},
-    {1961, "gene:plasmid:24562"},
-    {1962, "gene:plasmid:24564"},
-    {1963, "gene:plasmid:24565"},
-    {1964, "gene:plasmid:24568"},
-    {1965, "gene:plasmid:24579"},
-    {1966, "gene:plasmid:24580"},
-    {1967, "gene:plasmid:24581"},
-    {1968, "gene:plasmid:24583"},
-    {1969, "gene:plasmid:24584"},
-    {1970, "gene:plasmid:24587"},
-    {1971, "gene:plasmid:24591"},
-    {1972, "gene:plasmid:24594"},
-    {1973, "gene:plasmid:24608"},
-    {1974, "gene:plasmid:24609"},
-    {1975, "gene:plasmid:24610"},
-    {1976, "gene:plasmid:24611"},
-    {1977, "gene:plasmid:24612"},
-    {1978, "gene:plasmid:24613"},
-    {1979, "gene:plasmid:24620"},
-    {1980, "gene:plasmid:24634"},
-    {1981, "gene:plasmid:24637"},
-    {1982, "gene:plasmid:24639"},
-    {1983, "gene:plasmid:24642"},
-    {1984, "gene:plasmid:24674"},
-    {1985, "gene:plasmid:24693"},
-    {1986, "gene:plasmid:24694"},
-    {1987, "gene:plasmid:24696"},
-    {1988, "gene:plasmid:24697"},
-    {1989, "gene:plasmid:24698"},
-    {1990, "gene:plasmid:24699"},
-    {1991, "gene:plasmid:24704"},
-    {1992, "gene:plasmid:24705"},
-    {1993, "gene:plasmid:24706"},
-    {1994, "gene:plasmid:24707"},
-    {1995, "gene:plasmid:24709"},
-    {1996, "gene:plasmid:24710"},
-    {1997, "gene:plasmid:24721"},
-    {1998, "gene:plasmid:24743"},
-    {1999, "gene:plasmid:24751"},
-    {2000, "gene:plasmid:24760"},
-    {2001, "gene:plasmid:24763"},
-    {2002, "gene:plasmid:24764"},
-    {2003, "gene:plasmid:24765"},
-    {2004, "gene:plasmid:24766"},
-    {2005, "gene:plasmid:24768"},
-    {2006, "gene:plasmid:24769"},
-    {2007, "gene:plasmid:24770"},
-    {2008, "gene:plasmid:24771"},
-    {2009, "gene:plasmid:24773"},
-    {2010, "gene:plasmid:24775"},
-    {2011, "gene:plasmid:24776"},
-    {2012, "gene:plasmid:24777"},
-    {2013, "gene:plasmid:24778"},
-    {2014, "gene:plasmid:24779"},
-    {2015, "gene:plasmid:24780"},
-    {2016, "gene:plasmid:24781"},
-    {2017, "gene:plasmid:24791"},
-    {2018, "gene:plasmid:24792"},
-    {2019, "gene:plasmid:24793"},
-    {2020, "gene:plasmid:24796"},
-    {2021, "gene:plasmid:24797"},
-    {2022, "gene:plasmid:24799"},
-    {2023, "gene:plasmid:24800"},
-    {2024, "gene:plasmid:24804"},
-    {2025, "gene:plasmid:24805"},
-    {2026, "gene:plasmid:24806"},
-    {2027, "gene:plasmid:24807"},
-    {2028, "gene:plasmid:24852"},
-    {2029, "gene:plasmid:24949"},
-    {2030, "gene:plasmid:24950"},
-    {2031, "gene:plasmid:24972"},
-    {2032, "gene:plasmid:25149"},
-    {2033, "gene:plasmid:25161"},
-    {2034, "gene:plasmid:25253"},
-    {2035, "gene:plasmid:25296"},
-    {2036, "gene:plasmid:25331"},
-    {2037, "gene:plasmid:25332"},
-    {2038, "gene:plasmid:25333"},
-    {2039, "gene:plasmid:25357"},
-    {2040, "gene:plasmid:25369"},
-    {2041, "gene:plasmid:25392"},
-    {2042, "gene:plasmid:25433"},
-    {2043, "gene:plasmid:25437"},
-    {2044, "gene:plasmid:25448"},
-    {2045, "gene:plasmid:25527"},
-    {2046, "gene:plasmid:25643"},
-    {2047, "gene:plasmid:25689"},
-    {2048, "gene:plasmid:27818"},
-    {2049, "gene:plasmid:28516"},
-    {2050, "gene:plasmid:28746"},
-    {2051, "gene:plasmid:28749"},
-    {2052, "gene:plasmid:28884"},
-    {2053, "gene:plasmid:28967"},
-    {2054, "gene:plasmid:28968"},
-    {2055, "gene:plasmid:29620"},
-    {2056, "gene:plasmid:30130"},
-    {2057, "gene:plasmid:30134"},
-    {2058, "gene:plasmid:30743"},
-    {2059, "gene:plasmid:30839"},
-    {2060, "gene:plasmid:30991"},
-    {2061, "gene:plasmid:31083"},
-    {2062, "gene:plasmid:77695"},
-    {2063, "gene:plasmid:77826"},
-    {2064, "gene:plasmid:82630"},
-    {2065, "gene:plasmid:82857"},
-    {2066, "gene:plasmid:83606"},
-    {2067, "gene:plasmid:83613"},
-    {2068, "gene:plasmid:83661"},
-    {2069, "gene:plasmid:83736"},
-    {2070, "gene:plasmid:83749"},
-    {2071, "gene:plasmid:83768"},
-    {2072, "gene:plasmid:83771"},
-    {2073, "gene:plasmid:83772"},
-    {2074, "gene:plasmid:83774"},
-    {2075, "gene:plasmid:83785"},
-    {2076, "gene:plasmid:83787"},
-    {2077, "gene:plasmid:83798"},
-    {2078, "gene:plasmid:83812"},
-    {2079, "gene:plasmid:83868"},
-    {2080, "gene:plasmid:83871"},
-    {2081, "gene:plasmid:83899"},
-    {2082, "gene:plasmid:83906"},
-    {2083, "gene:plasmid:83908"},
-    {2084, "gene:plasmid:83928"},
-    {2085, "gene:plasmid:83929"},
-    {2086, "gene:plasmid:83934"},
-    {2087, "gene:plasmid:84283"},
-    {2088, "gene:plasmid:84454"},
-    {2089, "gene:plasmid:84460"},
-    {2090, "gene:plasmid:84461"},
-    {2091, "gene:plasmid:84548"},
-    {2092, "gene:plasmid:84549"},
-    {2093, "gene:plasmid:84559"},
-    {2094, "gene:plasmid:84560"},
-    {2095, "gene:plasmid:84566"},
-    {2096, "gene:plasmid:84585"},
-    {2097, "gene:plasmid:84591"},
-    {2098, "gene:plasmid:84599"},
-    {2099, "gene:plasmid:84603"},
-    {2100, "gene:plasmid:84614"},
-    {2101, "gene:plasmid:84615"},
-    {2102, "gene:plasmid:84622"},
-    {2103, "gene:plasmid:85089"},
-    {2104, "gene:plasmid:85207"},
-    {2105, "gene:plasmid:85210"},
-    {2106, "gene:plasmid:85216"},
-    {2107, "gene:plasmid:85218"},
-    {2108, "gene:plasmid:85307"},
-    {2109, "gene:plasmid:85992"},
-    {2110, "gene:plasmid:86179"},
-    {2111, "gene:plasmid:86276"},
-    {2112, "gene:plasmid:86304"},
-    {2113, "gene:plasmid:87041"},
-    {2114, "gene:plasmid:87050"},
-    {2115, "gene:plasmid:87051"},
-    {2116, "gene:plasmid:87059"},
-    {2117, "gene:plasmid:87066"},
-    {2118, "gene:plasmid:87096"},
-    {2119, "gene:plasmid:87107"},
-    {2120, "gene:plasmid:87122"},
-    {2121, "gene:plasmid:87123"},
-    {2122, "gene:plasmid:87130"},
-    {2123, "gene:plasmid:87138"},
-    {2124, "gene:plasmid:87417"},
-    {2125, "gene:plasmid:87420"},
-    {2126, "gene:plasmid:87421"},
-    {2127, "gene:plasmid:87422"},
-    {2128, "gene:plasmid:87432"},
-    {2129, "gene:plasmid:87438"},
-    {2130, "gene:plasmid:87439"},
-    {2131, "gene:plasmid:87440"},
-    {2132, "gene:plasmid:87441"},
-    {2133, "gene:plasmid:87442"},
-    {2134, "gene:plasmid:87443"},
-    {2135, "gene:plasmid:87451"},
-    {2136, "gene:plasmid:87452"},
-    {2137, "gene:plasmid:87554"},
-    {2138, "gene:plasmid:88298"},
-    {2139, "gene:plasmid:88299"},
-    {2140, "gene:plasmid:88300"},
-    {2141, "gene:plasmid:88301"},
-    {2142, "gene:plasmid:88302"},
-    {2143, "gene:plasmid:88303"},
-    {2144, "gene:plasmid:88308"},
-    {2145, "gene:plasmid:88312"},
-    {2146, "gene:plasmid:88313"},
-    {2147, "gene:plasmid:88314"},
-    {2148, "gene:plasmid:88316"},
-    {2149, "gene:plasmid:88325"},
-    {2150, "gene:plasmid:88326"},
-    {2151, "gene:plasmid:88327"},
-    {2152, "gene:plasmid:88328"},
-    {2153, "gene:plasmid:88329"},
-    {2154, "gene:plasmid:88330"},
-    {2155, "gene:plasmid:88331"},
-    {2156, "gene:plasmid:88332"},
-    {2157, "gene:plasmid:88333"},
-    {2158, "gene:plasmid:88334"},
-    {2159, "gene:plasmid:88336"},
-    {2160, "gene:plasmid:88337"},
-    {2161, "gene:plasmid:88338"},
-    {2162, "gene:plasmid:88339"},
-    {2163, "gene:plasmid:88340"},
-    {2164, "gene:plasmid:88341"},
-    {2165, "gene:plasmid:88343"},
-    {2166, "gene:plasmid:88353"},
-    {2167, "gene:plasmid:88354"},
-    {2168, "gene:plasmid:88355"},
-    {2169, "gene:plasmid:88356"},
-    {2170, "gene:plasmid:88357"},
-    {2171, "gene:plasmid:88358"},
-    {2172, "gene:plasmid:88359"},
-    {2173, "gene:plasmid:88360"},
-    {2174, "gene:plasmid:88361"},
-    {2175, "gene:plasmid:88362"},
-    {2176, "gene:plasmid:88363"},
-    {2177, "gene:plasmid:88364"},
-    {2178, "gene:plasmid:88365"},
-    {2179, "gene:plasmid:88366"},
-    {2180, "gene:plasmid:88367"},
-    {2181, "gene:plasmid:88370"},
-    {2182, "gene:plasmid:88375"},
-    {2183, "gene:plasmid:88377"},
-    {2184, "gene:plasmid:88379"},
-    {2185, "gene:plasmid:88381"},
-    {2186, "gene:plasmid:88382"},
-    {2187, "gene:plasmid:88383"},
-    {2188, "gene:plasmid:88384"},
-    {2189, "gene:plasmid:88387"},
-    {2190, "gene:plasmid:88388"},
-    {2191, "gene:plasmid:88389"},
-    {2192, "gene:plasmid:88392"},
-    {2193, "gene:plasmid:88393"},
-    {2194, "gene:plasmid:88394"},
-    {2195, "gene:plasmid:88395"},
-    {2196, "gene:plasmid:88396"},
-    {2197, "gene:plasmid:88397"},
-    {2198, "gene:plasmid:88398"},
-    {2199, "gene:plasmid:88399"},
-    {2200, "gene:plasmid:88400"},
-    {2201, "gene:plasmid:88401"},
-    {2202, "gene:plasmid:88402"},
-    {2203, "gene:plasmid:88403"},
-    {2204, "gene:plasmid:88404"},
-    {2205, "gene:plasmid:88405"},
-    {2206, "gene:plasmid:88406"},
-    {2207, "gene:plasmid:88407"},
-    {2208, "gene:plasmid:88408"},
-    {2209, "gene:plasmid:88409"},
-    {2210, "gene:plasmid:88410"},
-    {2211, "gene:plasmid:88413"},
-    {2212, "gene:plasmid:88414"},
-    {2213, "gene:plasmid:88415"},
-    {2214, "gene:plasmid:88416"},
-    {2215, "gene:plasmid:88417"},
-    {2216, "gene:plasmid:88420"},
-    {2217, "gene:plasmid:88428"},
-    {2218, "gene:plasmid:88430"},
-    {2219, "gene:plasmid:88431"},
-    {2220, "gene:plasmid:88432"},
-    {2221, "gene:plasmid:88433"},
-    {2222, "gene:plasmid:88435"},
-    {2223, "gene:plasmid:88436"},
-    {2224, "gene:plasmid:88437"},
-    {2225, "gene:plasmid:88443"},
-    {2226, "gene:plasmid:88444"},
-    {2227, "gene:plasmid:88445"},
-    {2228, "gene:plasmid:88446"},
-    {2229, "gene:plasmid:88447"},
-    {2230, "gene:plasmid:88448"},
-    {2231, "gene:plasmid:88449"},
-    {2232, "gene:plasmid:88450"},
-    {2233, "gene:plasmid:88451"},
-    {2234, "gene:plasmid:88452"},
-    {2235, "gene:plasmid:88453"},
-    {2236, "gene:plasmid:88454"},
-    {2237, "gene:plasmid:88455"},
-    {2238, "gene:plasmid:88456"},
-    {2239, "gene:plasmid:88457"},
-    {2240, "gene:plasmid:88458"},
-    {2241, "gene:plasmid:88459"},
-    {2242, "gene:plasmid:88460"},
-    {2243, "gene:plasmid:88461"},
-    {2244, "gene:plasmid:88462"},
-    {2245, "gene:plasmid:88463"},
-    {2246, "gene:plasmid:88464"},
-    {2247, "gene:plasmid:88465"},
-    {2248, "gene:plasmid:88466"},
-    {2249, "gene:plasmid:88467"},
-    {2250, "gene:plasmid:88468"},
-    {2251, "gene:plasmid:88472"},
-    {2252, "gene:plasmid:88473"},
-    {2253, "gene:plasmid:88474"},
-    {2254, "gene:plasmid:88475"},
-    {2255, "gene:plasmid:88476"},
-    {2256, "gene:plasmid:88624"},
-    {2257, "gene:plasmid:88824"},
-    {2258, "gene:plasmid:89001"},
-    {2259, "gene:plasmid:89528"},
-    {2260, "gene:plasmid:90631"},
-    {2261, "gene:plasmid:90633"},
-    {2262, "gene:plasmid:91057"},
-    {2263, "gene:plasmid:91073"},
-    {2264, "gene:plasmid:91140"},
-    {2265, "gene:plasmid:91147"},
-    {2266, "gene:plasmid:91150"},
-    {2267, "gene:plasmid:91194"},
-    {2268, "gene:plasmid:91534"},
-    {2269, "gene:plasmid:91536"},
-    {2270, "gene:plasmid:91541"},
-    {2271, "gene:plasmid:91550"},
-    {2272, "gene:plasmid:91552"},
-    {2273, "gene:plasmid:91553"},
-    {2274, "gene:plasmid:91555"},
-    {2275, "gene:plasmid:91561"},
-    {2276, "gene:plasmid:91563"},
-    {2277, "gene:plasmid:91567"},
-    {2278, "gene:plasmid:91568"},
-    {2279, "gene:plasmid:91569"},
-    {2280, "gene:plasmid:91571"},
-    {2281, "gene:plasmid:91572"},
-    {2282, "gene:plasmid:91573"},
-    {2283, "gene:plasmid:91574"},
-    {2284, "gene:plasmid:91579"},
-    {2285, "gene:plasmid:91581"},
-    {2286, "gene:plasmid:91594"},
-    {2287, "gene:plasmid:91595"},
-    {2288, "gene:plasmid:91596"},
-    {2289, "gene:plasmid:91599"},
-    {2290, "gene:plasmid:91603"},
-    {2291, "gene:plasmid:91606"},
-    {2292, "gene:plasmid:91609"},
-    {2293, "gene:plasmid:91612"},
-    {2294, "gene:plasmid:91615"},
-    {2295, "gene:plasmid:91619"},
-    {2296, "gene:plasmid:91621"},
-    {2297, "gene:plasmid:91625"},
-    {2298, "gene:plasmid:91626"},
-    {2299, "gene:plasmid:91631"},
-    {2300, "gene:plasmid:91637"},
-    {2301, "gene:plasmid:91640"},
-    {2302, "gene:plasmid:91641"},
-    {2303, "gene:plasmid:91642"},
-    {2304, "gene:plasmid:91643"},
-    {2305, "gene:plasmid:91644"},
-    {2306, "gene:plasmid:91648"},
-    {2307, "gene:plasmid:91649"},
-    {2308, "gene:plasmid:91650"},
-    {2309, "gene:plasmid:91660"},
-    {2310, "gene:plasmid:91662"},
-    {2311, "gene:plasmid:91666"},
-    {2312, "gene:plasmid:91674"},
-    {2313, "gene:plasmid:91675"},
-    {2314, "gene:plasmid:91678"},
-    {2315, "gene:plasmid:91679"},
-    {2316, "gene:plasmid:91682"},
-    {2317, "gene:plasmid:91685"},
-    {2318, "gene:plasmid:91689"},
-    {2319, "gene:plasmid:91693"},
-    {2320, "gene:plasmid:91695"},
-    {2321, "gene:plasmid:91700"},
-    {2322, "gene:plasmid:91702"},
-    {2323, "gene:plasmid:91710"},
-    {2324, "gene:plasmid:91714"},
-    {2325, "gene:plasmid:91716"},
-    {2326, "gene:plasmid:91742"},
-    {2327, "gene:plasmid:91743"},
-    {2328, "gene:plasmid:91745"},
-    {2329, "gene:plasmid:91746"},
-    {2330, "gene:plasmid:91747"},
-    {2331, "gene:plasmid:91748"},
-    {2332, "gene:plasmid:91749"},
-    {2333, "gene:plasmid:91750"},
-    {2334, "gene:plasmid:91760"},
-    {2335, "gene:plasmid:91761"},
-    {2336, "gene:plasmid:91763"},
-    {2337, "gene:plasmid:91771"},
-    {2338, "gene:plasmid:91772"},
-    {2339, "gene:plasmid:91773"},
-    {2340, "gene:plasmid:91774"},
-    {2341, "gene:plasmid:91775"},
-    {2342, "gene:plasmid:91776"},
-    {2343, "gene:plasmid:91778"},
-    {2344, "gene:plasmid:91781"},
-    {2345, "gene:plasmid:91784"},
-    {2346, "gene:plasmid:91786"},
-    {2347, "gene:plasmid:91800"},
-    {2348, "gene:plasmid:91801"},
-    {2349, "gene:plasmid:91802"},
-    {2350, "gene:plasmid:91833"},
-    {2351, "gene:plasmid:91918"},
-    {2352, "gene:plasmid:91925"},
-    {2353, "gene:plasmid:91930"},
-    {2354, "gene:plasmid:91947"},
-    {2355, "gene:plasmid:91950"},
-    {2356, "gene:plasmid:91966"},
-    {2357, "gene:plasmid:91974"},
-    {2358, "gene:plasmid:91980"},
-    {2359, "gene:plasmid:91985"},
-    {2360, "gene:plasmid:91989"},
-    {2361, "gene:plasmid:92005"},
-    {2362, "gene:plasmid:92008"},
-    {2363, "gene:plasmid:92011"},
-    {2364, "gene:plasmid:92044"},
-    {2365, "gene:plasmid:92045"},
-    {2366, "gene:plasmid:92065"},
-    {2367, "gene:plasmid:92066"},
-    {2368, "gene:plasmid:92068"},
-    {2369, "gene:plasmid:92070"},
-    {2370, "gene:plasmid:92071"},
-    {2371, "gene:plasmid:92072"},
-    {2372, "gene:plasmid:92073"},
-    {2373, "gene:plasmid:92074"},
-    {2374, "gene:plasmid:92075"},
-    {2375, "gene:plasmid:92076"},
-    {2376, "gene:plasmid:92088"},
-    {2377, "gene:plasmid:92090"},
-    {2378, "gene:plasmid:92091"},
-    {2379, "gene:plasmid:92092"},
-    {2380, "gene:plasmid:92093"},
-    {2381, "gene:plasmid:92094"},
-    {2382, "gene:plasmid:92098"},
-    {2383, "gene:plasmid:92099"},
-    {2384, "gene:plasmid:92100"},
-    {2385, "gene:plasmid:92101"},
-    {2386, "gene:plasmid:92102"},
-    {2387, "gene:plasmid:92103"},
-    {2388, "gene:plasmid:92104"},
-    {2389, "gene:plasmid:92105"},
-    {2390, "gene:plasmid:92106"},
-    {2391, "gene:plasmid:92107"},
-    {2392, "gene:plasmid:92108"},
-    {2393, "gene:plasmid:92109"},
-    {2394, "gene:plasmid:92110"},
-    {2395, "gene:plasmid:92111"},
-    {2396, "gene:plasmid:92112"},
-    {2397, "gene:plasmid:92113"},
-    {2398, "gene:plasmid:92114"},
-    {2399, "gene:plasmid:92115"},
-    {2400, "gene:plasmid:92116"},
-    {2401, "gene:plasmid:92117"},
-    {2402, "gene:plasmid:92118"},
-    {2403, "gene:plasmid:92119"},
-    {2404, "gene:plasmid:92120"},
-    {2405, "gene:plasmid:92123"},
-    {2406, "gene:plasmid:92124"},
-    {2407, "gene:plasmid:92125"},
-    {2408, "gene:plasmid:92127"},
-    {2409, "gene:plasmid:92128"},
-    {2410, "gene:plasmid:92129"},
-    {2411, "gene:plasmid:92130"},
-    {2412, "gene:plasmid:92131"},
-    {2413, "gene:plasmid:92132"},
-    {2414, "gene:plasmid:92133"},
-    {2415, "gene:plasmid:92137"},
-    {2416, "gene:plasmid:92139"},
-    {2417, "gene:plasmid:92140"},
-    {2418, "gene:plasmid:92141"},
-    {2419, "gene:plasmid:92142"},
-    {2420, "gene:plasmid:92146"},
-    {2421, "gene:plasmid:92147"},
-    {2422, "gene:plasmid:92935"},
-    {2423, "gene:plasmid:93439"},
-    {2424, "gene:plasmid:93448"},
-    {2425, "gene:plasmid:93454"},
-    {2426, "gene:plasmid:93463"},
-    {2427, "gene:plasmid:93468"},
-    {2428, "gene:plasmid:93469"},
-    {2429, "gene:plasmid:93474"},
-    {2430, "gene:plasmid:93475"},
-    {2431, "gene:plasmid:93482"},
-    {2432, "gene:plasmid:93486"},
-    {2433, "gene:plasmid:93494"},
-    {2434, "gene:plasmid:93495"},
-    {2435, "gene:plasmid:93508"},
-    {2436, "gene:plasmid:93509"},
-    {2437, "gene:plasmid:93510"},
-    {2438, "gene:plasmid:97769"},
-    {2439, "gene:plasmid:97786"},
-    {2440, "gene:proph:159024"},
-    {2441, "gene:proph:159025"},
-    {2442, "gene:proph:159026"},
-    {2443, "gene:proph:159027"},
-    {2444, "gene:proph:159028"},
-    {2445, "gene:proph:159032"},
-    {2446, "gene:proph:159036"},
-    {2447, "gene:proph:159040"},
-    {2448, "gene:proph:159043"},
-    {2449, "gene:proph:159046"},
-    {2450, "gene:proph:159047"},
-    {2451, "gene:proph:159051"},
-    {2452, "gene:proph:159053"},
-    {2453, "gene:proph:159058"},
-    {2454, "gene:proph:159060"},
-    {2455, "gene:proph:159061"},
-    {2456, "gene:proph:159062"},
-    {2457, "gene:proph:159063"},
-    {2458, "gene:proph:159064"},
-    {2459, "gene:proph:159065"},
-    {2460, "gene:proph:159066"},
-    {2461, "gene:proph:159067"},
-    {2462, "gene:proph:159068"},
-    {2463, "gene:proph:159069"},
-    {2464, "gene:proph:159070"},
-    {2465, "gene:proph:159071"},
-    {2466, "gene:proph:159072"},
-    {2467, "gene:proph:159074"},
-    {2468, "gene:proph:159076"},
-    {2469, "gene:proph:159078"},
-    {2470, "gene:proph:159079"},
-    {2471, "gene:proph:159080"},
-    {2472, "gene:proph:159081"},
-    {2473, "gene:proph:159082"},
-    {2474, "gene:proph:159083"},
-    {2475, "gene:proph:159084"},
-    {2476, "gene:proph:159085"},
-    {2477, "gene:proph:159089"},
-    {2478, "gene:proph:159090"},
-    {2479, "gene:proph:159091"},
-    {2480, "gene:proph:159092"},
-    {2481, "gene:proph:159093"},
-    {2482, "gene:proph:159361"},
-    {2483, "gene:proph:159363"},
-    {2484, "gene:proph:159396"},
-    {2485, "gene:proph:160594"},
-    {2486, "gene:proph:160595"},
-    {2487, "gene:proph:160596"},
-    {2488, "gene:proph:160597"},
-    {2489, "gene:proph:160598"},
-    {2490, "gene:proph:160599"},
-    {2491, "gene:proph:160600"},
-    {2492, "gene:proph:160601"},
-    {2493, "gene:proph:160602"},
-    {2494, "gene:proph:160603"},
-    {2495, "gene:proph:160736"},
-    {2496, "gene:proph:160870"},
-    {2497, "gene:proph:160872"},
-    {2498, "gene:proph:161536"},
-    {2499, "gene:proph:161537"},
-    {2500, "gene:proph:161578"},
-    {2501, "gene:proph:161580"},
-    {2502, "gene:proph:161581"},
-    {2503, "gene:proph:161601"},
-    {2504, "gene:proph:161602"},
-    {2505, "gene:proph:161608"},
-    {2506, "gene:proph:161622"},
-    {2507, "gene:proph:161623"},
-    {2508, "gene:proph:161624"},
-    {2509, "gene:proph:161626"},
-    {2510, "gene:proph:161685"},
-    {2511, "gene:proph:161694"},
-    {2512, "gene:proph:162247"},
-    {2513, "gene:proph:162588"},
-    {2514, "gene:proph:162590"},
-    {2515, "gene:proph:162591"},
-    {2516, "gene:proph:162592"},
-    {2517, "gene:proph:162593"},
-    {2518, "gene:proph:162598"},
-    {2519, "gene:proph:162599"},
-    {2520, "gene:proph:162600"},
-    {2521, "gene:proph:162601"},
-    {2522, "gene:proph:162602"},
-    {2523, "gene:proph:162603"},
-    {2524, "gene:proph:162605"},
-    {2525, "gene:proph:162607"},
-    {2526, "gene:proph:162608"},
-    {2527, "gene:proph:162609"},
-    {2528, "gene:proph:162610"},
-    {2529, "gene:proph:162613"},
-    {2530, "gene:proph:162617"},
-    {2531, "gene:proph:162923"},
-    {2532, "gene:proph:162953"},
-    {2533, "gene:proph:162968"},
-    {2534, "gene:proph:162970"},
-    {2535, "gene:proph:162996"},
-    {2536, "gene:proph:163041"},
-    {2537, "gene:proph:163662"},
-    {2538, "gene:proph:163673"},
-    {2539, "gene:proph:163675"},
-    {2540, "gene:proph:163685"},
-    {2541, "gene:proph:163686"},
-    {2542, "gene:proph:163687"},
-    {2543, "gene:proph:163800"},
-    {2544, "gene:proph:163801"},
-    {2545, "gene:proph:163802"},
-    {2546, "gene:proph:163803"},
-    {2547, "gene:proph:163806"},
-    {2548, "gene:proph:163807"},
-    {2549, "gene:proph:163810"},
-    {2550, "gene:proph:163814"},
-    {2551, "gene:proph:163815"},
-    {2552, "gene:proph:163817"},
-    {2553, "gene:proph:163818"},
-    {2554, "gene:proph:163829"},
-    {2555, "gene:proph:163832"},
-    {2556, "gene:proph:163833"},
-    {2557, "gene:proph:163834"},
-    {2558, "gene:proph:163835"},
-    {2559, "gene:proph:163837"},
-    {2560, "gene:proph:163838"},
-    {2561, "gene:proph:163841"},
-    {2562, "gene:proph:163842"},
-    {2563, "gene:proph:163843"},
-    {2564, "gene:proph:163845"},
-    {2565, "gene:proph:163847"},
-    {2566, "gene:proph:163850"},
-    {2567, "gene:proph:163852"},
-    {2568, "gene:proph:163853"},
-    {2569, "gene:proph:163854"},
-    {2570, "gene:proph:163857"},
-    {2571, "gene:proph:163858"},
-    {2572, "gene:proph:163860"},
-    {2573, "gene:proph:163861"},
-    {2574, "gene:proph:163863"},
-    {2575, "gene:proph:163864"},
-    {2576, "gene:proph:163865"},
-    {2577, "gene:proph:163866"},
-    {2578, "gene:proph:163867"},
-    {2579, "gene:proph:163869"},
-    {2580, "gene:proph:163870"},
-    {2581, "gene:proph:163871"},
-    {2582, "gene:proph:163872"},
-    {2583, "gene:proph:163873"},
-    {2584, "gene:proph:163874"},
-    {2585, "gene:proph:163876"},
-    {2586, "gene:proph:163877"},
-    {2587, "gene:proph:163878"},
-    {2588, "gene:proph:163881"},
-    {2589, "gene:proph:163883"},
-    {2590, "gene:proph:163885"},
-    {2591, "gene:proph:163886"},
-    {2592, "gene:proph:163888"},
-    {2593, "gene:proph:163889"},
-    {2594, "gene:proph:163890"},
-    {2595, "gene:proph:163891"},
-    {2596, "gene:proph:163893"},
-    {2597, "gene:proph:163895"},
-    {2598, "gene:proph:163896"},
-    {2599, "gene:proph:163897"},
-    {2600, "gene:proph:163899"},
-    {2601, "gene:proph:163900"},
-    {2602, "gene:proph:163901"},
-    {2603, "gene:proph:163902"},
-    {2604, "gene:proph:163903"},
-    {2605, "gene:proph:163904"},
-    {2606, "gene:proph:163905"},
-    {2607, "gene:proph:163906"},
-    {2608, "gene:proph:163908"},
-    {2609, "gene:proph:163909"},
-    {2610, "gene:proph:163910"},
-    {2611, "gene:proph:163911"},
-    {2612, "gene:proph:163912"},
-    {2613, "gene:proph:163914"},
-    {2614, "gene:proph:163916"},
-    {2615, "gene:proph:163917"},
-    {2616, "gene:proph:163918"},
-    {2617, "gene:proph:163920"},
-    {2618, "gene:proph:163921"},
-    {2619, "gene:proph:163922"},
-    {2620, "gene:proph:163923"},
-    {2621, "gene:proph:163926"},
-    {2622, "gene:proph:163927"},
-    {2623, "gene:proph:163928"},
-    {2624, "gene:proph:163929"},
-    {2625, "gene:proph:163930"},
-    {2626, "gene:proph:163931"},
-    {2627, "gene:proph:163934"},
-    {2628, "gene:proph:163935"},
-    {2629, "gene:proph:163937"},
-    {2630, "gene:proph:163938"},
-    {2631, "gene:proph:163939"},
-    {2632, "gene:proph:163940"},
-    {2633, "gene:proph:163941"},
-    {2634, "gene:proph:163942"},
-    {2635, "gene:proph:163944"},
-    {2636, "gene:proph:163946"},
-    {2637, "gene:proph:163947"},
-    {2638, "gene:proph:163948"},
-    {2639, "gene:proph:163976"},
-    {2640, "gene:proph:163979"},
-    {2641, "gene:proph:163981"},
-    {2642, "gene:proph:164853"},
-    {2643, "gene:proph:164854"},
-    {2644, "gene:proph:164855"},
-    {2645, "gene:proph:164861"},
-    {2646, "gene:proph:164862"},
-    {2647, "gene:proph:164863"},
-    {2648, "gene:proph:164865"},
-    {2649, "gene:proph:164866"},
-    {2650, "gene:proph:164869"},
-    {2651, "gene:proph:164870"},
-    {2652, "gene:proph:164871"},
-    {2653, "gene:proph:164873"},
-    {2654, "gene:proph:164874"},
-    {2655, "gene:proph:164875"},
-    {2656, "gene:proph:164876"},
-    {2657, "gene:proph:164877"},
-    {2658, "gene:proph:164878"},
-    {2659, "gene:proph:164879"},
-    {2660, "gene:proph:164880"},
-    {2661, "gene:proph:164881"},
-    {2662, "gene:proph:164882"},
-    {2663, "gene:proph:164883"},
-    {2664, "gene:proph:164884"},
-    {2665, "gene:proph:164885"},
-    {2666, "gene:proph:164886"},
-    {2667, "gene:proph:164887"},
-    {2668, "gene:proph:164889"},
-    {2669, "gene:proph:164890"},
-    {2670, "gene:proph:164891"},
-    {2671, "gene:proph:164892"},
-    {2672, "gene:proph:164893"},
-    {2673, "gene:proph:164894"},
-    {2674, "gene:proph:164895"},
-    {2675, "gene:proph:164896"},
-    {2676, "gene:proph:164902"},
-    {2677, "gene:proph:164903"},
-    {2678, "gene:proph:164904"},
-    {2679, "gene:proph:164906"},
-    {2680, "gene:proph:164908"},
-    {2681, "gene:proph:164909"},
-    {2682, "gene:proph:164910"},
-    {2683, "gene:proph:164911"},
-    {2684, "gene:proph:164912"},
-    {2685, "gene:proph:164913"},
-    {2686, "gene:proph:164916"},
-    {2687, "gene:proph:166425"},
-    {2688, "gene:proph:166433"},
-    {2689, "gene:proph:167228"},
-    {2690, "gene:proph:167231"},
-    {2691, "gene:proph:167847"},
-    {2692, "gene:proph:167870"},
-    {2693, "gene:proph:169074"},
-    {2694, "gene:proph:169075"},
-    {2695, "gene:proph:169076"},
-    {2696, "gene:proph:169077"},
-    {2697, "gene:proph:169078"},
-    {2698, "gene:proph:169079"},
-    {2699, "gene:proph:169080"},
-    {2700, "gene:proph:169086"},
-    {2701, "gene:proph:169100"},
-    {2702, "gene:proph:169101"},
-    {2703, "gene:proph:169102"},
-    {2704, "gene:proph:169103"},
-    {2705, "gene:proph:169106"},
-    {2706, "gene:proph:169107"},
-    {2707, "gene:proph:169108"},
-    {2708, "gene:proph:169109"},
-    {2709, "gene:proph:169111"},
-    {2710, "gene:proph:169112"},
-    {2711, "gene:proph:169113"},
-    {2712, "gene:proph:169115"},
-    {2713, "gene:proph:169120"},
-    {2714, "gene:proph:169135"},
-    {2715, "gene:proph:169136"},
-    {2716, "gene:proph:169137"},
-    {2717, "gene:proph:169138"},
-    {2718, "gene:proph:169140"},
-    {2719, "gene:proph:169141"},
-    {2720, "gene:proph:169142"},
-    {2721, "gene:proph:169143"},
-    {2722, "gene:proph:169148"},
-    {2723, "gene:proph:169149"},
-    {2724, "gene:proph:169150"},
-    {2725, "gene:proph:169460"},
-    {2726, "gene:proph:169463"},
-    {2727, "gene:proph:169464"},
-    {2728, "gene:proph:169476"},
-    {2729, "gene:proph:169477"},
-    {2730, "gene:proph:169478"},
-    {2731, "gene:proph:169480"},
-    {2732, "gene:proph:169499"},
-    {2733, "gene:proph:169500"},
-    {2734, "gene:proph:169505"},
-    {2735, "gene:proph:169507"},
-    {2736, "gene:proph:169508"},
-    {2737, "gene:proph:169510"},
-    {2738, "gene:proph:169511"},
-    {2739, "gene:proph:169512"},
-    {2740, "gene:proph:169514"},
-    {2741, "gene:proph:169516"},
-    {2742, "gene:proph:169517"},
-    {2743, "gene:proph:169518"},
-    {2744, "gene:proph:169519"},
-    {2745, "gene:proph:169520"},
-    {2746, "gene:proph:169521"},
-    {2747, "gene:proph:170528"},
-    {2748, "gene:proph:170529"},
-    {2749, "gene:proph:170535"},
-    {2750, "gene:proph:170536"},
-    {2751, "gene:proph:170537"},
-    {2752, "gene:proph:170538"},
-    {2753, "gene:proph:170540"},
-    {2754, "gene:proph:170541"},
-    {2755, "gene:proph:170551"},
-    {2756, "gene:proph:170553"},
-    {2757, "gene:proph:170558"},
-    {2758, "gene:proph:170560"},
-    {2759, "gene:proph:170569"},
-    {2760, "gene:proph:170577"},
-    {2761, "gene:proph:170590"},
-    {2762, "gene:proph:170892"},
-    {2763, "gene:proph:172400"},
-    {2764, "gene:proph:172401"},
-    {2765, "gene:proph:172402"},
-    {2766, "gene:proph:172413"},
-    {2767, "gene:proph:172415"},
-    {2768, "gene:proph:172429"},
-    {2769, "gene:proph:172431"},
-    {2770, "gene:proph:172438"},
-    {2771, "gene:proph:172440"},
-    {2772, "gene:proph:172441"},
-    {2773, "gene:proph:172443"},
-    {2774, "gene:proph:172447"},
-    {2775, "gene:proph:172449"},
-    {2776, "gene:proph:172450"},
-    {2777, "gene:proph:172451"},
-    {2778, "gene:proph:172452"},
-    {2779, "gene:proph:172454"},
-    {2780, "gene:proph:172455"},
-    {2781, "gene:proph:172459"},
-    {2782, "gene:proph:172465"},
-    {2783, "gene:proph:172466"},
-    {2784, "gene:proph:172467"},
-    {2785, "gene:proph:172470"},
-    {2786, "gene:proph:172473"},
-    {2787, "gene:proph:172477"},
-    {2788, "gene:proph:172478"},
-    {2789, "gene:proph:172479"},
-    {2790, "gene:proph:172480"},
-    {2791, "gene:proph:172516"},
-    {2792, "gene:proph:172517"},
-    {2793, "gene:proph:172518"},
-    {2794, "gene:proph:172519"},
-    {2795, "gene:proph:172520"},
-    {2796, "gene:proph:172521"},
-    {2797, "gene:proph:172522"},
-    {2798, "gene:proph:172523"},
-    {2799, "gene:proph:172524"},
-    {2800, "gene:proph:172525"},
-    {2801, "gene:proph:172526"},
-    {2802, "gene:proph:172529"},
-    {2803, "gene:proph:172532"},
-    {2804, "gene:proph:172537"},
-    {2805, "gene:proph:172549"},
-    {2806, "gene:proph:172550"},
-    {2807, "gene:proph:172551"},
-    {2808, "gene:proph:172557"},
-    {2809, "gene:proph:172559"},
-    {2810, "gene:proph:172561"},
-    {2811, "gene:proph:172575"},
-    {2812, "gene:proph:172576"},
-    {2813, "gene:proph:172581"},
-    {2814, "gene:proph:172582"},
-    {2815, "gene:proph:172583"},
-    {2816, "gene:proph:172596"},
-    {2817, "gene:proph:172598"},
-    {2818, "gene:proph:172602"},
-    {2819, "gene:proph:172610"},
-    {2820, "gene:proph:172623"},
-    {2821, "gene:proph:172635"},
-    {2822, "gene:proph:172651"},
-    {2823, "gene:proph:172665"},
-    {2824, "gene:proph:173116"},
-    {2825, "gene:proph:173413"},
-    {2826, "gene:proph:173445"},
-    {2827, "gene:proph:173446"},
-    {2828, "gene:proph:173451"},
-    {2829, "gene:proph:173473"},
-    {2830, "gene:proph:173485"},
-    {2831, "gene:proph:173491"},
-    {2832, "gene:proph:173494"},
-    {2833, "gene:proph:173495"},
-    {2834, "gene:proph:173496"},
-    {2835, "gene:proph:173505"},
-    {2836, "gene:proph:173506"},
-    {2837, "gene:proph:173508"},
-    {2838, "gene:proph:173545"},
-    {2839, "gene:proph:173723"},
-    {2840, "gene:proph:173726"},
-    {2841, "gene:proph:173747"},
-    {2842, "gene:proph:173748"},
-    {2843, "gene:proph:173749"},
-    {2844, "gene:proph:173750"},
-    {2845, "gene:proph:173754"},
-    {2846, "gene:proph:173755"},
-    {2847, "gene:proph:173756"},
-    {2848, "gene:proph:173757"},
-    {2849, "gene:proph:173760"},
-    {2850, "gene:proph:173763"},
-    {2851, "gene:proph:173764"},
-    {2852, "gene:proph:173765"},
-    {2853, "gene:proph:173766"},
-    {2854, "gene:proph:173767"},
-    {2855, "gene:proph:173768"},
-    {2856, "gene:proph:173769"},
-    {2857, "gene:proph:173770"},
-    {2858, "gene:proph:173771"},
-    {2859, "gene:proph:173772"},
-    {2860, "gene:proph:173773"},
-    {2861, "gene:proph:173774"},
-    {2862, "gene:proph:173775"},
-    {2863, "gene:proph:173776"},
-    {2864, "gene:proph:173777"},
-    {2865, "gene:proph:173778"},
-    {2866, "gene:proph:173779"},
-    {2867, "gene:proph:173782"},
-    {2868, "gene:proph:173783"},
-    {2869, "gene:proph:173784"},
-    {2870, "gene:proph:173785"},
-    {2871, "gene:proph:173786"},
-    {2872, "gene:proph:173787"},
-    {2873, "gene:proph:173788"},
-    {2874, "gene:proph:173848"},
-    {2875, "gene:proph:173874"},
-    {2876, "gene:proph:173881"},
-    {2877, "gene:proph:173882"},
-    {2878, "gene:proph:173883"},
-    {2879, "gene:proph:173884"},
-    {2880, "gene:proph:173886"},
-    {2881, "gene:proph:173887"},
-    {2882, "gene:proph:173888"},
-    {2883, "gene:proph:173889"},
-    {2884, "gene:proph:173890"},
-    {2885, "gene:proph:173891"},
-    {2886, "gene:proph:173892"},
-    {2887, "gene:proph:173893"},
-    {2888, "gene:proph:173894"},
-    {2889, "gene:proph:173895"},
-    {2890, "gene:proph:173899"},
-    {2891, "gene:proph:173900"},
-    {2892, "gene:proph:173901"},
-    {2893, "gene:proph:173925"},
-    {2894, "gene:proph:173928"},
-    {2895, "gene:proph:173932"},
-    {2896, "gene:proph:173934"},
-    {2897, "gene:proph:173936"},
-    {2898, "gene:proph:173945"},
-    {2899, "gene:proph:173946"},
-    {2900, "gene:proph:173947"},
-    {2901, "gene:proph:173949"},
-    {2902, "gene:proph:173951"},
-    {2903, "gene:proph:173955"},
-    {2904, "gene:proph:173957"},
-    {2905, "gene:proph:173959"},
-    {2906, "gene:proph:173960"},
-    {2907, "gene:proph:174191"},
-    {2908, "gene:proph:174233"},
-    {2909, "gene:proph:174534"},
-    {2910, "gene:proph:174535"},
-    {2911, "gene:proph:174546"},
-    {2912, "gene:proph:174549"},
-    {2913, "gene:proph:174550"},
-    {2914, "gene:proph:174551"},
-    {2915, "gene:proph:174552"},
-    {2916, "gene:proph:174553"},
-    {2917, "gene:proph:174554"},
-    {2918, "gene:proph:174555"},
-    {2919, "gene:proph:174565"},
-    {2920, "gene:proph:174572"},
-    {2921, "gene:proph:174576"},
-    {2922, "gene:proph:174577"},
-    {2923, "gene:proph:174578"},
-    {2924, "gene:proph:174581"},
-    {2925, "gene:proph:174582"},
-    {2926, "gene:proph:174585"},
-    {2927, "gene:proph:174588"},
-    {2928, "gene:proph:174589"},
-    {2929, "gene:proph:174593"},
-    {2930, "gene:proph:174594"},
-    {2931, "gene:proph:174595"},
-    {2932, "gene:proph:174597"},
-    {2933, "gene:proph:174598"},
-    {2934, "gene:proph:174599"},
-    {2935, "gene:proph:174600"},
-    {2936, "gene:proph:174980"},
-    {2937, "gene:proph:174981"},
-    {2938, "gene:proph:174982"},
-    {2939, "gene:proph:174983"},
-    {2940, "gene:proph:174984"},
-    {2941, "gene:proph:174986"},
-    {2942, "gene:proph:174987"},
-    {2943, "gene:proph:174989"},
-    {2944, "gene:proph:174990"},
-    {2945, "gene:proph:174991"},
-    {2946, "gene:proph:174992"},
-    {2947, "gene:proph:174993"},
-    {2948, "gene:proph:174994"},
-    {2949, "gene:proph:174995"},
-    {2950, "gene:proph:174996"},
-    {2951, "gene:proph:174997"},
-    {2952, "gene:proph:174998"},
-    {2953, "gene:proph:174999"},
-    {2954, "gene:proph:175000"},
-    {2955, "gene:proph:175001"},
-    {2956, "gene:proph:175002"},
-    {2957, "gene:proph:175003"},
-    {2958, "gene:proph:175004"},
-    {2959, "gene:proph:175006"},
-    {2960, "gene:proph:175008"},
-    {2961, "gene:proph:175010"},
-    {2962, "gene:proph:175012"},
-    {2963, "gene:proph:175013"},
-    {2964, "gene:proph:175014"},
-    {2965, "gene:proph:175016"},
-    {2966, "gene:proph:175023"},
-    {2967, "gene:proph:175025"},
-    {2968, "gene:proph:175031"},
-    {2969, "gene:proph:175032"},
-    {2970, "gene:proph:175033"},
-    {2971, "gene:proph:175054"},
-    {2972, "gene:proph:175083"},
-    {2973, "gene:proph:175087"},
-    {2974, "gene:proph:175123"},
-    {2975, "gene:proph:175139"},
-    {2976, "gene:proph:175149"},
-    {2977, "gene:proph:175194"},
-    {2978, "gene:proph:175229"},
-    {2979, "gene:proph:175234"},
-    {2980, "gene:proph:175261"},
-    {2981, "gene:proph:175276"},
-    {2982, "gene:proph:175278"},
-    {2983, "gene:proph:175283"},
-    {2984, "gene:proph:175285"},
-    {2985, "gene:proph:175295"},
-    {2986, "gene:proph:175311"},
-    {2987, "gene:proph:175648"},
-    {2988, "gene:proph:175649"},
-    {2989, "gene:proph:175652"},
-    {2990, "gene:proph:175655"},
-    {2991, "gene:proph:175656"},
-    {2992, "gene:proph:175658"},
-    {2993, "gene:proph:175690"},
-    {2994, "gene:proph:176039"},
-    {2995, "gene:proph:176040"},
-    {2996, "gene:proph:176046"},
-    {2997, "gene:proph:176047"},
-    {2998, "gene:proph:176048"},
-    {2999, "gene:proph:176049"},
-    {3000, "gene:proph:176050"},
-    {3001, "gene:proph:176051"},
-    {3002, "gene:proph:176052"},
-    {3003, "gene:proph:176053"},
-    {3004, "gene:proph:176054"},
-    {3005, "gene:proph:176055"},
-    {3006, "gene:proph:176056"},
-    {3007, "gene:proph:176057"},
-    {3008, "gene:proph:176058"},
-    {3009, "gene:proph:176059"},
-    {3010, "gene:proph:176060"},
-    {3011, "gene:proph:176061"},
-    {3012, "gene:proph:176065"},
-    {3013, "gene:proph:176068"},
-    {3014, "gene:proph:176071"},
-    {3015, "gene:proph:176073"},
-    {3016, "gene:proph:176074"},
-    {3017, "gene:proph:176075"},
-    {3018, "gene:proph:176076"},
-    {3019, "gene:proph:176080"},
-    {3020, "gene:proph:176085"},
-    {3021, "gene:proph:176086"},
-    {3022, "gene:proph:176088"},
-    {3023, "gene:proph:176089"},
-    {3024, "gene:proph:176709"},
-    {3025, "gene:proph:176710"},
-    {3026, "gene:proph:176711"},
-    {3027, "gene:proph:176712"},
-    {3028, "gene:proph:176713"},
-    {3029, "gene:proph:176715"},
-    {3030, "gene:proph:176716"},
-    {3031, "gene:proph:176718"},
-    {3032, "gene:proph:176719"},
-    {3033, "gene:proph:176720"},
-    {3034, "gene:proph:176721"},
-    {3035, "gene:proph:176722"},
-    {3036, "gene:proph:176723"},
-    {3037, "gene:proph:176724"},
-    {3038, "gene:proph:176725"},
-    {3039, "gene:proph:176727"},
-    {3040, "gene:proph:176728"},
-    {3041, "gene:proph:176729"},
-    {3042, "gene:proph:176730"},
-    {3043, "gene:proph:176731"},
-    {3044, "gene:proph:176732"},
-    {3045, "gene:proph:176733"},
-    {3046, "gene:proph:176736"},
-    {3047, "gene:proph:176737"},
-    {3048, "gene:proph:176738"},
-    {3049, "gene:proph:176739"},
-    {3050, "gene:proph:176741"},
-    {3051, "gene:proph:176745"},
-    {3052, "gene:proph:176747"},
-    {3053, "gene:proph:176748"},
-    {3054, "gene:proph:176753"},
-    {3055, "gene:proph:176754"},
-    {3056, "gene:proph:176755"},
-    {3057, "gene:proph:176757"},
-    {3058, "gene:proph:176758"},
-    {3059, "gene:proph:176759"},
-    {3060, "gene:proph:176763"},
-    {3061, "gene:proph:176764"},
-    {3062, "gene:proph:176765"},
-    {3063, "gene:proph:176766"},
-    {3064, "gene:proph:176767"},
-    {3065, "gene:proph:176768"},
-    {3066, "gene:proph:176772"},
-    {3067, "gene:proph:176773"},
-    {3068, "gene:proph:176774"},
-    {3069, "gene:proph:176775"},
-    {3070, "gene:proph:176778"},
-    {3071, "gene:proph:176779"},
-    {3072, "gene:proph:176780"},
-    {3073, "gene:proph:176782"},
-    {3074, "gene:proph:176783"},
-    {3075, "gene:proph:176785"},
-    {3076, "gene:proph:176786"},
-    {3077, "gene:proph:176787"},
-    {3078, "gene:proph:176788"},
-    {3079, "gene:proph:176789"},
-    {3080, "gene:proph:176790"},
-    {3081, "gene:proph:176791"},
-    {3082, "gene:proph:176792"},
-    {3083, "gene:proph:176793"},
-    {3084, "gene:proph:176794"},
-    {3085, "gene:proph:176795"},
-    {3086, "gene:proph:176796"},
-    {3087, "gene:proph:176797"},
-    {3088, "gene:proph:176798"},
-    {3089, "gene:proph:176799"},
-    {3090, "gene:proph:176800"},
-    {3091, "gene:proph:176802"},
-    {3092, "gene:proph:176803"},
-    {3093, "gene:proph:176804"},
-    {3094, "gene:proph:176805"},
-    {3095, "gene:proph:176806"},
-    {3096, "gene:proph:176807"},
-    {3097, "gene:proph:176808"},
-    {3098, "gene:proph:176809"},
-    {3099, "gene:proph:176810"},
-    {3100, "gene:proph:176811"},
-    {3101, "gene:proph:176812"},
-    {3102, "gene:proph:176813"},
-    {3103, "gene:proph:176814"},
-    {3104, "gene:proph:176816"},
-    {3105, "gene:proph:176817"},
-    {3106, "gene:proph:176818"},
-    {3107, "gene:proph:176819"},
-    {3108, "gene:proph:176820"},
-    {3109, "gene:proph:176821"},
-    {3110, "gene:proph:176822"},
-    {3111, "gene:proph:176823"},
-    {3112, "gene:proph:176824"},
-    {3113, "gene:proph:176825"},
-    {3114, "gene:proph:176826"},
-    {3115, "gene:proph:176827"},
-    {3116, "gene:proph:176828"},
-    {3117, "gene:proph:176829"},
-    {3118, "gene:proph:176830"},
-    {3119, "gene:proph:176831"},
-    {3120, "gene:proph:176832"},
-    {3121, "gene:proph:176833"},
-    {3122, "gene:proph:176835"},
-    {3123, "gene:proph:176836"},
-    {3124, "gene:proph:176839"},
-    {3125, "gene:proph:176840"},
-    {3126, "gene:proph:176844"},
-    {3127, "gene:proph:176845"},
-    {3128, "gene:proph:176848"},
-    {3129, "gene:proph:176849"},
-    {3130, "gene:proph:176850"},
-    {3131, "gene:proph:176852"},
-    {3132, "gene:proph:176855"},
-    {3133, "gene:proph:176860"},
-    {3134, "gene:proph:176861"},
-    {3135, "gene:proph:176862"},
-    {3136, "gene:proph:176863"},
-    {3137, "gene:proph:176864"},
-    {3138, "gene:proph:176866"},
-    {3139, "gene:proph:176867"},
-    {3140, "gene:proph:176869"},
-    {3141, "gene:proph:176870"},
-    {3142, "gene:proph:176871"},
-    {3143, "gene:proph:176873"},
-    {3144, "gene:proph:176874"},
-    {3145, "gene:proph:176876"},
-    {3146, "gene:proph:176877"},
-    {3147, "gene:proph:176880"},
-    {3148, "gene:proph:176881"},
-    {3149, "gene:proph:176884"},
-    {3150, "gene:proph:176887"},
-    {3151, "gene:proph:176888"},
-    {3152, "gene:proph:176890"},
-    {3153, "gene:proph:176891"},
-    {3154, "gene:proph:176892"},
-    {3155, "gene:proph:176893"},
-    {3156, "gene:proph:176895"},
-    {3157, "gene:proph:176897"},
-    {3158, "gene:proph:176902"},
-    {3159, "gene:proph:176905"},
-    {3160, "gene:proph:176906"},
-    {3161, "gene:proph:176909"},
-    {3162, "gene:proph:176910"},
-    {3163, "gene:proph:176914"},
-    {3164, "gene:proph:176915"},
-    {3165, "gene:proph:176916"},
-    {3166, "gene:proph:176917"},
-    {3167, "gene:proph:176920"},
-    {3168, "gene:proph:176921"},
-    {3169, "gene:proph:176922"},
-    {3170, "gene:proph:176924"},
-    {3171, "gene:proph:176925"},
-    {3172, "gene:proph:177426"},
-    {3173, "gene:proph:177428"},
-    {3174, "gene:proph:177429"},
-    {3175, "gene:proph:177439"},
-    {3176, "gene:proph:177440"},
-    {3177, "gene:proph:177441"},
-    {3178, "gene:proph:177442"},
-    {3179, "gene:proph:177446"},
-    {3180, "gene:proph:177447"},
-    {3181, "gene:proph:177459"},
-    {3182, "gene:proph:177474"},
-    {3183, "gene:proph:177482"},
-    {3184, "gene:proph:177484"},
-    {3185, "gene:proph:177498"},
-    {3186, "gene:proph:177500"},
-    {3187, "gene:proph:177501"},
-    {3188, "gene:proph:177510"},
-    {3189, "gene:proph:177511"},
-    {3190, "gene:proph:177540"},
-    {3191, "gene:proph:177541"},
-    {3192, "gene:proph:177543"},
-    {3193, "gene:proph:177548"},
-    {3194, "gene:proph:177552"},
-    {3195, "gene:proph:177557"},
-    {3196, "gene:proph:177560"},
-    {3197, "gene:proph:177562"},
-    {3198, "gene:proph:177575"},
-    {3199, "gene:proph:177577"},
-    {3200, "gene:proph:177582"},
-    {3201, "gene:proph:177584"},
-    {3202, "gene:proph:177585"},
-    {3203, "gene:proph:177586"},
-    {3204, "gene:proph:177595"},
-    {3205, "gene:proph:177598"},
-    {3206, "gene:proph:177611"},
-    {3207, "gene:proph:177615"},
-    {3208, "gene:proph:177619"},
-    {3209, "gene:proph:177620"},
-    {3210, "gene:proph:177621"},
-    {3211, "gene:proph:177622"},
-    {3212, "gene:proph:177628"},
-    {3213, "gene:proph:177629"},
-    {3214, "gene:proph:177630"},
-    {3215, "gene:proph:177631"},
-    {3216, "gene:proph:177632"},
-    {3217, "gene:proph:177640"},
-    {3218, "gene:proph:177660"},
-    {3219, "gene:proph:177683"},
-    {3220, "gene:proph:177685"},
-    {3221, "gene:proph:177695"},
-    {3222, "gene:proph:177696"},
-    {3223, "gene:proph:179201"},
-    {3224, "gene:proph:179204"},
-    {3225, "gene:proph:179208"},
-    {3226, "gene:proph:179217"},
-    {3227, "gene:proph:179228"},
-    {3228, "gene:proph:179244"},
-    {3229, "gene:proph:179246"},
-    {3230, "gene:proph:179247"},
-    {3231, "gene:proph:179258"},
-    {3232, "gene:proph:179286"},
-    {3233, "gene:proph:179287"},
-    {3234, "gene:proph:179289"},
-    {3235, "gene:proph:179290"},
-    {3236, "gene:proph:179305"},
-    {3237, "gene:proph:179307"},
-    {3238, "gene:proph:179308"},
-    {3239, "gene:proph:179321"},
-    {3240, "gene:proph:179335"},
-    {3241, "gene:proph:179343"},
-    {3242, "gene:proph:179346"},
-    {3243, "gene:proph:179364"},
-    {3244, "gene:proph:179383"},
-    {3245, "gene:proph:179389"},
-    {3246, "gene:proph:179390"},
-    {3247, "gene:proph:179392"},
-    {3248, "gene:proph:179393"},
-    {3249, "gene:proph:179395"},
-    {3250, "gene:proph:179396"},
-    {3251, "gene:proph:179402"},
-    {3252, "gene:proph:179418"},
-    {3253, "gene:proph:179420"},
-    {3254, "gene:proph:179425"},
-    {3255, "gene:proph:179426"},
-    {3256, "gene:proph:179429"},
-    {3257, "gene:proph:179430"},
-    {3258, "gene:proph:179432"},
-    {3259, "gene:proph:179433"},
-    {3260, "gene:proph:179434"},
-    {3261, "gene:proph:179435"},
-    {3262, "gene:proph:179436"},
-    {3263, "gene:proph:179438"},
-    {3264, "gene:proph:179439"},
-    {3265, "gene:proph:179440"},
-    {3266, "gene:proph:179442"},
-    {3267, "gene:proph:179443"},
-    {3268, "gene:proph:179445"},
-    {3269, "gene:proph:179446"},
-    {3270, "gene:proph:179447"},
-    {3271, "gene:proph:179448"},
-    {3272, "gene:proph:179451"},
-    {3273, "gene:proph:179452"},
-    {3274, "gene:proph:179453"},
-    {3275, "gene:proph:179454"},
-    {3276, "gene:proph:179456"},
-    {3277, "gene:proph:179457"},
-    {3278, "gene:proph:179459"},
-    {3279, "gene:proph:179460"},
-    {3280, "gene:proph:179463"},
-    {3281, "gene:proph:179464"},
-    {3282, "gene:proph:179465"},
-    {3283, "gene:proph:179467"},
-    {3284, "gene:proph:179468"},
-    {3285, "gene:proph:179469"},
-    {3286, "gene:proph:179470"},
-    {3287, "gene:proph:179471"},
-    {3288, "gene:proph:179473"},
-    {3289, "gene:proph:179474"},
-    {3290, "gene:proph:179475"},
-    {3291, "gene:proph:179476"},
-    {3292, "gene:proph:179478"},
-    {3293, "gene:proph:179481"},
-    {3294, "gene:proph:179482"},
-    {3295, "gene:proph:179483"},
-    {3296, "gene:proph:179485"},
-    {3297, "gene:proph:179486"},
-    {3298, "gene:proph:179489"},
-    {3299, "gene:proph:179490"},
-    {3300, "gene:proph:181032"},
-    {3301, "gene:proph:181033"},
-    {3302, "gene:proph:181034"},
-    {3303, "gene:proph:181036"},
-    {3304, "gene:proph:181037"},
-    {3305, "gene:proph:181038"},
-    {3306, "gene:proph:181039"},
-    {3307, "gene:proph:181040"},
-    {3308, "gene:proph:181041"},
-    {3309, "gene:proph:181047"},
-    {3310, "gene:proph:181048"},
-    {3311, "gene:proph:181050"},
-    {3312, "gene:proph:181052"},
-    {3313, "gene:proph:181054"},
-    {3314, "gene:proph:181055"},
-    {3315, "gene:proph:181056"},
-    {3316, "gene:proph:181057"},
-    {3317, "gene:proph:181058"},
-    {3318, "gene:proph:181059"},
-    {3319, "gene:proph:181060"},
-    {3320, "gene:proph:181061"},
-    {3321, "gene:proph:181062"},
-    {3322, "gene:proph:181065"},
-    {3323, "gene:proph:181067"},
-    {3324, "gene:proph:181068"},
-    {3325, "gene:proph:181069"},
-    {3326, "gene:proph:181070"},
-    {3327, "gene:proph:181071"},
-    {3328, "gene:proph:181073"},
-    {3329, "gene:proph:181074"},
-    {3330, "gene:proph:181075"},
-    {3331, "gene:proph:181076"},
-    {3332, "gene:proph:181077"},
-    {3333, "gene:proph:181078"},
-    {3334, "gene:proph:181080"},
-    {3335, "gene:proph:181081"},
-    {3336, "gene:proph:181082"},
-    {3337, "gene:proph:181083"},
-    {3338, "gene:proph:181084"},
-    {3339, "gene:proph:181085"},
-    {3340, "gene:proph:181086"},
-    {3341, "gene:proph:181087"},
-    {3342, "gene:proph:181089"},
-    {3343, "gene:proph:181090"},
-    {3344, "gene:proph:181091"},
-    {3345, "gene:proph:181092"},
-    {3346, "gene:proph:181093"},
-    {3347, "gene:proph:181094"},
-    {3348, "gene:proph:181095"},
-    {3349, "gene:proph:181096"},
-    {3350, "gene:proph:181097"},
-    {3351, "gene:proph:181098"},
-    {3352, "gene:proph:181099"},
-    {3353, "gene:proph:181100"},
-    {3354, "gene:proph:181101"},
-    {3355, "gene:proph:181102"},
-    {3356, "gene:proph:181103"},
-    {3357, "gene:proph:181104"},
-    {3358, "gene:proph:181109"},
-    {3359, "gene:proph:181110"},
-    {3360, "gene:proph:181111"},
-    {3361, "gene:proph:181113"},
-    {3362, "gene:proph:181119"},
-    {3363, "gene:proph:181121"},
-    {3364, "gene:proph:181125"},
-    {3365, "gene:proph:181127"},
-    {3366, "gene:proph:181128"},
-    {3367, "gene:proph:181129"},
-    {3368, "gene:proph:181132"},
-    {3369, "gene:proph:181133"},
-    {3370, "gene:proph:181134"},
-    {3371, "gene:proph:181136"},
-    {3372, "gene:proph:181137"},
-    {3373, "gene:proph:181138"},
-    {3374, "gene:proph:181139"},
-    {3375, "gene:proph:181140"},
-    {3376, "gene:proph:181141"},
-    {3377, "gene:proph:181145"},
-    {3378, "gene:proph:181147"},
-    {3379, "gene:proph:181148"},
-    {3380, "gene:proph:181149"},
-    {3381, "gene:proph:181151"},
-    {3382, "gene:proph:181153"},
-    {3383, "gene:proph:181154"},
-    {3384, "gene:proph:181155"},
-    {3385, "gene:proph:181157"},
-    {3386, "gene:proph:181158"},
-    {3387, "gene:proph:181159"},
-    {3388, "gene:proph:181161"},
-    {3389, "gene:proph:181162"},
-    {3390, "gene:proph:181163"},
-    {3391, "gene:proph:181165"},
-    {3392, "gene:proph:181166"},
-    {3393, "gene:proph:181167"},
-    {3394, "gene:proph:181168"},
-    {3395, "gene:proph:181169"},
-    {3396, "gene:proph:181170"},
-    {3397, "gene:proph:181171"},
-    {3398, "gene:proph:181172"},
-    {3399, "gene:proph:181173"},
-    {3400, "gene:proph:181174"},
-    {3401, "gene:proph:181175"},
-    {3402, "gene:proph:181177"},
-    {3403, "gene:proph:181179"},
-    {3404, "gene:proph:181180"},
-    {3405, "gene:proph:181182"},
-    {3406, "gene:proph:181184"},
-    {3407, "gene:proph:181191"},
-    {3408, "gene:proph:181192"},
-    {3409, "gene:proph:181193"},
-    {3410, "gene:proph:181194"},
-    {3411, "gene:proph:181195"},
-    {3412, "gene:proph:181197"},
-    {3413, "gene:proph:181201"},
-    {3414, "gene:proph:181203"},
-    {3415, "gene:proph:181206"},
-    {3416, "gene:proph:181208"},
-    {3417, "gene:proph:181209"},
-    {3418, "gene:proph:181210"},
-    {3419, "gene:proph:181211"},
-    {3420, "gene:proph:181212"},
-    {3421, "gene:proph:181213"},
-    {3422, "gene:proph:181215"},
-    {3423, "gene:proph:181217"},
-    {3424, "gene:proph:181218"},
-    {3425, "gene:proph:181220"},
-    {3426, "gene:proph:181222"},
-    {3427, "gene:proph:181223"},
-    {3428, "gene:proph:181224"},
-    {3429, "gene:proph:181225"},
-    {3430, "gene:proph:181233"},
-    {3431, "gene:proph:181234"},
-    {3432, "gene:proph:181237"},
-    {3433, "gene:proph:181239"},
-    {3434, "gene:proph:181241"},
-    {3435, "gene:proph:181242"},
-    {3436, "gene:proph:181243"},
-    {3437, "gene:proph:181244"},
-    {3438, "gene:proph:181245"},
-    {3439, "gene:proph:181247"},
-    {3440, "gene:proph:181257"},
-    {3441, "gene:proph:181258"},
-    {3442, "gene:proph:181259"},
-    {3443, "gene:proph:181266"},
-    {3444, "gene:proph:181267"},
-    {3445, "gene:proph:181272"},
-    {3446, "gene:proph:181284"},
-    {3447, "gene:proph:181285"},
-    {3448, "gene:proph:181287"},
-    {3449, "gene:proph:181290"},
-    {3450, "gene:proph:181291"},
-    {3451, "gene:proph:181292"},
-    {3452, "gene:proph:181293"},
-    {3453, "gene:proph:181296"},
-    {3454, "gene:proph:181298"},
-    {3455, "gene:proph:181300"},
-    {3456, "gene:proph:181302"},
-    {3457, "gene:proph:181304"},
-    {3458, "gene:proph:181305"},
-    {3459, "gene:proph:181306"},
-    {3460, "gene:proph:181307"},
-    {3461, "gene:proph:181308"},
-    {3462, "gene:proph:181310"},
-    {3463, "gene:proph:181311"},
-    {3464, "gene:proph:181312"},
-    {3465, "gene:proph:181314"},
-    {3466, "gene:proph:181315"},
-    {3467, "gene:proph:181316"},
-    {3468, "gene:proph:181317"},
-    {3469, "gene:proph:181318"},
-    {3470, "gene:proph:181321"},
-    {3471, "gene:proph:181322"},
-    {3472, "gene:proph:181323"},
-    {3473, "gene:proph:181324"},
-    {3474, "gene:proph:181667"},
-    {3475, "gene:proph:181669"},
-    {3476, "gene:proph:181670"},
-    {3477, "gene:proph:182641"},
-    {3478, "gene:proph:182647"},
-    {3479, "gene:proph:182649"},
-    {3480, "gene:proph:182915"},
-    {3481, "gene:proph:182916"},
-    {3482, "gene:proph:182917"},
-    {3483, "gene:proph:182918"},
-    {3484, "gene:proph:182923"},
-    {3485, "gene:proph:182924"},
-    {3486, "gene:proph:182925"},
-    {3487, "gene:proph:182926"},
-    {3488, "gene:proph:182930"},
-    {3489, "gene:proph:182931"},
-    {3490, "gene:proph:182932"},
-    {3491, "gene:proph:182947"},
-    {3492, "gene:proph:182948"},
-    {3493, "gene:proph:182949"},
-    {3494, "gene:proph:182951"},
-    {3495, "gene:proph:182952"},
-    {3496, "gene:proph:182953"},
-    {3497, "gene:proph:182958"},
-    {3498, "gene:proph:182959"},
-    {3499, "gene:proph:182965"},
-    {3500, "gene:proph:182966"},
-    {3501, "gene:proph:182970"},
-    {3502, "gene:proph:182973"},
-    {3503, "gene:proph:182974"},
-    {3504, "gene:proph:182975"},
-    {3505, "gene:proph:182978"},
-    {3506, "gene:proph:182979"},
-    {3507, "gene:proph:182980"},
-    {3508, "gene:proph:182981"},
-    {3509, "gene:proph:182982"},
-    {3510, "gene:proph:182983"},
-    {3511, "gene:proph:182984"},
-    {3512, "gene:proph:182991"},
-    {3513, "gene:proph:182994"},
-    {3514, "gene:proph:182995"},
-    {3515, "gene:proph:182997"},
-    {3516, "gene:proph:182999"},
-    {3517, "gene:proph:183000"},
-    {3518, "gene:proph:183003"},
-    {3519, "gene:proph:183006"},
-    {3520, "gene:proph:183007"},
-    {3521, "gene:proph:183009"},
-    {3522, "gene:proph:183010"},
-    {3523, "gene:proph:183012"},
-    {3524, "gene:proph:183015"},
-    {3525, "gene:proph:183019"},
-    {3526, "gene:proph:183022"},
-    {3527, "gene:proph:183023"},
-    {3528, "gene:proph:183024"},
-    {3529, "gene:proph:183025"},
-    {3530, "gene:proph:183028"},
-    {3531, "gene:proph:183029"},
-    {3532, "gene:proph:183030"},
-    {3533, "gene:proph:183032"},
-    {3534, "gene:proph:183034"},
-    {3535, "gene:proph:183035"},
-    {3536, "gene:proph:183041"},
-    {3537, "gene:proph:183043"},
-    {3538, "gene:proph:183059"},
-    {3539, "gene:proph:183085"},
-    {3540, "gene:proph:183542"},
-    {3541, "gene:proph:183544"},
-    {3542, "gene:proph:183545"},
-    {3543, "gene:proph:183546"},
-    {3544, "gene:proph:183548"},
-    {3545, "gene:proph:183549"},
-    {3546, "gene:proph:183551"},
-    {3547, "gene:proph:183552"},
-    {3548, "gene:proph:183553"},
-    {3549, "gene:proph:183562"},
-    {3550, "gene:proph:183569"},
-    {3551, "gene:proph:183570"},
-    {3552, "gene:proph:183571"},
-    {3553, "gene:proph:183572"},
-    {3554, "gene:proph:183581"},
-    {3555, "gene:proph:183583"},
-    {3556, "gene:proph:183597"},
-    {3557, "gene:proph:183598"},
-    {3558, "gene:proph:183612"},
-    {3559, "gene:proph:183615"},
-    {3560, "gene:proph:183616"},
-    {3561, "gene:proph:183617"},
-    {3562, "gene:proph:183618"},
-    {3563, "gene:proph:183625"},
-    {3564, "gene:proph:183626"},
-    {3565, "gene:proph:183629"},
-    {3566, "gene:proph:183635"},
-    {3567, "gene:proph:183636"},
-    {3568, "gene:proph:183637"},
-    {3569, "gene:proph:183644"},
-    {3570, "gene:proph:183651"},
-    {3571, "gene:proph:183652"},
-    {3572, "gene:proph:183653"},
-    {3573, "gene:proph:183654"},
-    {3574, "gene:proph:183655"},
-    {3575, "gene:proph:183656"},
-    {3576, "gene:proph:183657"},
-    {3577, "gene:proph:183658"},
-    {3578, "gene:proph:183659"},
-    {3579, "gene:proph:183660"},
-    {3580, "gene:proph:183661"},
-    {3581, "gene:proph:183662"},
-    {3582, "gene:proph:183663"},
-    {3583, "gene:proph:183664"},
-    {3584, "gene:proph:183665"},
-    {3585, "gene:proph:183666"},
-    {3586, "gene:proph:183667"},
-    {3587, "gene:proph:183668"},
-    {3588, "gene:proph:183775"},
-    {3589, "gene:proph:183779"},
-    {3590, "gene:proph:184396"},
-    {3591, "gene:proph:184397"},
-    {3592, "gene:proph:184398"},
-    {3593, "gene:proph:184574"},
-    {3594, "gene:proph:184629"},
-    {3595, "gene:proph:184639"},
-    {3596, "gene:proph:184642"},
-    {3597, "gene:proph:184643"},
-    {3598, "gene:proph:184644"},
-    {3599, "gene:proph:184664"},
-    {3600, "gene:proph:184723"},
-    {3601, "gene:proph:184757"},
-    {3602, "gene:proph:184777"},
-    {3603, "gene:proph:184793"},
-    {3604, "gene:proph:184879"},
-    {3605, "gene:proph:184884"},
-    {3606, "gene:proph:184889"},
-    {3607, "gene:proph:184890"},
-    {3608, "gene:proph:184891"},
-    {3609, "gene:proph:184893"},
-    {3610, "gene:proph:184896"},
-    {3611, "gene:proph:184898"},
-    {3612, "gene:proph:184899"},
-    {3613, "gene:proph:184901"},
-    {3614, "gene:proph:184902"},
-    {3615, "gene:proph:184903"},
-    {3616, "gene:proph:184904"},
-    {3617, "gene:proph:184905"},
-    {3618, "gene:proph:184906"},
-    {3619, "gene:proph:184908"},
-    {3620, "gene:proph:184910"},
-    {3621, "gene:proph:184911"},
-    {3622, "gene:proph:184912"},
-    {3623, "gene:proph:184913"},
-    {3624, "gene:proph:184917"},
-    {3625, "gene:proph:184921"},
-    {3626, "gene:proph:184960"},
-    {3627, "gene:proph:184970"},
-    {3628, "gene:proph:184990"},
-    {3629, "gene:vir:10066"},
-    {3630, "gene:vir:10085"},
-    {3631, "gene:vir:100922"},
-    {3632, "gene:vir:100923"},
-    {3633, "gene:vir:10093"},
-    {3634, "gene:vir:100972"},
-    {3635, "gene:vir:10117"},
-    {3636, "gene:vir:10129"},
-    {3637, "gene:vir:101322"},
-    {3638, "gene:vir:101323"},
-    {3639, "gene:vir:101325"},
-    {3640, "gene:vir:101326"},
-    {3641, "gene:vir:101327"},
-    {3642, "gene:vir:101333"},
-    {3643, "gene:vir:101336"},
-    {3644, "gene:vir:101337"},
-    {3645, "gene:vir:101338"},
-    {3646, "gene:vir:101339"},
-    {3647, "gene:vir:101355"},
-    {3648, "gene:vir:101356"},
-    {3649, "gene:vir:101358"},
-    {3650, "gene:vir:101359"},
-    {3651, "gene:vir:101366"},
-    {3652, "gene:vir:101367"},
-    {3653, "gene:vir:101368"},
-    {3654, "gene:vir:101369"},
-    {3655, "gene:vir:101370"},
-    {3656, "gene:vir:101372"},
-    {3657, "gene:vir:101382"},
-    {3658, "gene:vir:101385"},
-    {3659, "gene:vir:101387"},
-    {3660, "gene:vir:101388"},
-    {3661, "gene:vir:101391"},
-    {3662, "gene:vir:101393"},
-    {3663, "gene:vir:101394"},
-    {3664, "gene:vir:101397"},
-    {3665, "gene:vir:101398"},
-    {3666, "gene:vir:101399"},
-    {3667, "gene:vir:101404"},
-    {3668, "gene:vir:101410"},
-    {3669, "gene:vir:101413"},
-    {3670, "gene:vir:101417"},
-    {3671, "gene:vir:101419"},
-    {3672, "gene:vir:101420"},
-    {3673, "gene:vir:101424"},
-    {3674, "gene:vir:101425"},
-    {3675, "gene:vir:101427"},
-    {3676, "gene:vir:101428"},
-    {3677, "gene:vir:10148"},
-    {3678, "gene:vir:10152"},
-    {3679, "gene:vir:10162"},
-    {3680, "gene:vir:10190"},
-    {3681, "gene:vir:10232"},
-    {3682, "gene:vir:10237"},
-    {3683, "gene:vir:10248"},
-    {3684, "gene:vir:10250"},
-    {3685, "gene:vir:10270"},
-    {3686, "gene:vir:102971"},
-    {3687, "gene:vir:1042"},
-    {3688, "gene:vir:104367"},
-    {3689, "gene:vir:104372"},
-    {3690, "gene:vir:104379"},
-    {3691, "gene:vir:104384"},
-    {3692, "gene:vir:104390"},
-    {3693, "gene:vir:104392"},
-    {3694, "gene:vir:104393"},
-    {3695, "gene:vir:104394"},
-    {3696, "gene:vir:104395"},
-    {3697, "gene:vir:104397"},
-    {3698, "gene:vir:104398"},
-    {3699, "gene:vir:104409"},
-    {3700, "gene:vir:104414"},
-    {3701, "gene:vir:104416"},
-    {3702, "gene:vir:104422"},
-    {3703, "gene:vir:104426"},
-    {3704, "gene:vir:104435"},
-    {3705, "gene:vir:104438"},
-    {3706, "gene:vir:1050"},
-    {3707, "gene:vir:105028"},
-    {3708, "gene:vir:105031"},
-    {3709, "gene:vir:105035"},
-    {3710, "gene:vir:105038"},
-    {3711, "gene:vir:105039"},
-    {3712, "gene:vir:105041"},
-    {3713, "gene:vir:105043"},
-    {3714, "gene:vir:105044"},
-    {3715, "gene:vir:105050"},
-    {3716, "gene:vir:105055"},
-    {3717, "gene:vir:105059"},
-    {3718, "gene:vir:105063"},
-    {3719, "gene:vir:105064"},
-    {3720, "gene:vir:105067"},
-    {3721, "gene:vir:105083"},
-    {3722, "gene:vir:105087"},
-    {3723, "gene:vir:105088"},
-    {3724, "gene:vir:105089"},
-    {3725, "gene:vir:105366"},
-    {3726, "gene:vir:105367"},
-    {3727, "gene:vir:105370"},
-    {3728, "gene:vir:105371"},
-    {3729, "gene:vir:105373"},
-    {3730, "gene:vir:105375"},
-    {3731, "gene:vir:105377"},
-    {3732, "gene:vir:105378"},
-    {3733, "gene:vir:105389"},
-    {3734, "gene:vir:105390"},
-    {3735, "gene:vir:105392"},
-    {3736, "gene:vir:105395"},
-    {3737, "gene:vir:105399"},
-    {3738, "gene:vir:105401"},
-    {3739, "gene:vir:105404"},
-    {3740, "gene:vir:105410"},
-    {3741, "gene:vir:105414"},
-    {3742, "gene:vir:105416"},
-    {3743, "gene:vir:105418"},
-    {3744, "gene:vir:105420"},
-    {3745, "gene:vir:105421"},
-    {3746, "gene:vir:105428"},
-    {3747, "gene:vir:105430"},
-    {3748, "gene:vir:105459"},
-    {3749, "gene:vir:105460"},
-    {3750, "gene:vir:105461"},
-    {3751, "gene:vir:105462"},
-    {3752, "gene:vir:105463"},
-    {3753, "gene:vir:105464"},
-    {3754, "gene:vir:105465"},
-    {3755, "gene:vir:105466"},
-    {3756, "gene:vir:105467"},
-    {3757, "gene:vir:105468"},
-    {3758, "gene:vir:105469"},
-    {3759, "gene:vir:105470"},
-    {3760, "gene:vir:105471"},
-    {3761, "gene:vir:105472"},
-    {3762, "gene:vir:105476"},
-    {3763, "gene:vir:105488"},
-    {3764, "gene:vir:105490"},
-    {3765, "gene:vir:105492"},
-    {3766, "gene:vir:105496"},
-    {3767, "gene:vir:105497"},
-    {3768, "gene:vir:105498"},
-    {3769, "gene:vir:105503"},
-    {3770, "gene:vir:105504"},
-    {3771, "gene:vir:105507"},
-    {3772, "gene:vir:105508"},
-    {3773, "gene:vir:105509"},
-    {3774, "gene:vir:105510"},
-    {3775, "gene:vir:105511"},
-    {3776, "gene:vir:105512"},
-    {3777, "gene:vir:105513"},
-    {3778, "gene:vir:105705"},
-    {3779, "gene:vir:105714"},
-    {3780, "gene:vir:105726"},
-    {3781, "gene:vir:105727"},
-    {3782, "gene:vir:105728"},
-    {3783, "gene:vir:105780"},
-    {3784, "gene:vir:105781"},
-    {3785, "gene:vir:108417"},
-    {3786, "gene:vir:108421"},
-    {3787, "gene:vir:108429"},
-    {3788, "gene:vir:108435"},
-    {3789, "gene:vir:108541"},
-    {3790, "gene:vir:108544"},
-    {3791, "gene:vir:108549"},
-    {3792, "gene:vir:108625"},
-    {3793, "gene:vir:108626"},
-    {3794, "gene:vir:108646"},
-    {3795, "gene:vir:108716"},
-    {3796, "gene:vir:108717"},
-    {3797, "gene:vir:108718"},
-    {3798, "gene:vir:108724"},
-    {3799, "gene:vir:108725"},
-    {3800, "gene:vir:108727"},
-    {3801, "gene:vir:108728"},
-    {3802, "gene:vir:1127"},
-    {3803, "gene:vir:1146"},
-    {3804, "gene:vir:129"},
-    {3805, "gene:vir:130"},
-    {3806, "gene:vir:131"},
-    {3807, "gene:vir:1321"},
-    {3808, "gene:vir:133"},
-    {3809, "gene:vir:137"},
-    {3810, "gene:vir:147"},
-    {3811, "gene:vir:148"},
-    {3812, "gene:vir:149"},
-    {3813, "gene:vir:150"},
-    {3814, "gene:vir:151"},
-    {3815, "gene:vir:154"},
-    {3816, "gene:vir:160"},
-    {3817, "gene:vir:165"},
-    {3818, "gene:vir:166"},
-    {3819, "gene:vir:167"},
-    {3820, "gene:vir:179"},
-    {3821, "gene:vir:1826"},
-    {3822, "gene:vir:1829"},
-    {3823, "gene:vir:1830"},
-    {3824, "gene:vir:1845"},
-    {3825, "gene:vir:1849"},
-    {3826, "gene:vir:1854"},
-    {3827, "gene:vir:1857"},
-    {3828, "gene:vir:1869"},
-    {3829, "gene:vir:1870"},
-    {3830, "gene:vir:1904"},
-    {3831, "gene:vir:1911"},
-    {3832, "gene:vir:1912"},
-    {3833, "gene:vir:1914"},
-    {3834, "gene:vir:1915"},
-    {3835, "gene:vir:1917"},
-    {3836, "gene:vir:1919"},
-    {3837, "gene:vir:1921"},
-    {3838, "gene:vir:1925"},
-    {3839, "gene:vir:1930"},
-    {3840, "gene:vir:1933"},
-    {3841, "gene:vir:197"},
-    {3842, "gene:vir:2013"},
-    {3843, "gene:vir:2014"},
-    {3844, "gene:vir:2015"},
-    {3845, "gene:vir:2016"},
-    {3846, "gene:vir:2017"},
-    {3847, "gene:vir:2018"},
-    {3848, "gene:vir:2019"},
-    {3849, "gene:vir:2021"},
-    {3850, "gene:vir:2022"},
-    {3851, "gene:vir:2023"},
-    {3852, "gene:vir:2024"},
-    {3853, "gene:vir:2025"},
-    {3854, "gene:vir:2026"},
-    {3855, "gene:vir:2027"},
-    {3856, "gene:vir:2028"},
-    {3857, "gene:vir:2029"},
-    {3858, "gene:vir:2030"},
-    {3859, "gene:vir:2031"},
-    {3860, "gene:vir:2032"},
-    {3861, "gene:vir:2033"},
-    {3862, "gene:vir:2035"},
-    {3863, "gene:vir:2036"},
-    {3864, "gene:vir:2037"},
-    {3865, "gene:vir:2039"},
-    {3866, "gene:vir:2040"},
-    {3867, "gene:vir:2041"},
-    {3868, "gene:vir:2042"},
-    {3869, "gene:vir:2043"},
-    {3870, "gene:vir:2044"},
-    {3871, "gene:vir:2045"},
-    {3872, "gene:vir:2046"},
-    {3873, "gene:vir:2047"},
-    {3874, "gene:vir:2048"},
-    {3875, "gene:vir:2049"},
-    {3876, "gene:vir:2050"},
-    {3877, "gene:vir:2051"},
-    {3878, "gene:vir:2052"},
-    {3879, "gene:vir:209"},
-    {3880, "gene:vir:2101"},
-    {3881, "gene:vir:2121"},
-    {3882, "gene:vir:213"},
-    {3883, "gene:vir:219"},
-    {3884, "gene:vir:221"},
-    {3885, "gene:vir:228"},
-    {3886, "gene:vir:229"},
-    {3887, "gene:vir:235"},
-    {3888, "gene:vir:236"},
-    {3889, "gene:vir:240"},
-    {3890, "gene:vir:243"},
-    {3891, "gene:vir:244"},
-    {3892, "gene:vir:2792"},
-    {3893, "gene:vir:2854"},
-    {3894, "gene:vir:2876"},
-    {3895, "gene:vir:2883"},
-    {3896, "gene:vir:2884"},
-    {3897, "gene:vir:2918"},
-    {3898, "gene:vir:3271"},
-    {3899, "gene:vir:3289"},
-    {3900, "gene:vir:3298"},
-    {3901, "gene:vir:3403"},
-    {3902, "gene:vir:3405"},
-    {3903, "gene:vir:3417"},
-    {3904, "gene:vir:3418"},
-    {3905, "gene:vir:3419"},
-    {3906, "gene:vir:3420"},
-    {3907, "gene:vir:3421"},
-    {3908, "gene:vir:3423"},
-    {3909, "gene:vir:3424"},
-    {3910, "gene:vir:3425"},
-    {3911, "gene:vir:3426"},
-    {3912, "gene:vir:3427"},
-    {3913, "gene:vir:3428"},
-    {3914, "gene:vir:3429"},
-    {3915, "gene:vir:3430"},
-    {3916, "gene:vir:3431"},
-    {3917, "gene:vir:3432"},
-    {3918, "gene:vir:3433"},
-    {3919, "gene:vir:3434"},
-    {3920, "gene:vir:3435"},
-    {3921, "gene:vir:3436"},
-    {3922, "gene:vir:3472"},
-    {3923, "gene:vir:3474"},
-    {3924, "gene:vir:3476"},
-    {3925, "gene:vir:3477"},
-    {3926, "gene:vir:3484"},
-    {3927, "gene:vir:3485"},
-    {3928, "gene:vir:3486"},
-    {3929, "gene:vir:3487"},
-    {3930, "gene:vir:3580"},
-    {3931, "gene:vir:3803"},
-    {3932, "gene:vir:3810"},
-    {3933, "gene:vir:3834"},
-    {3934, "gene:vir:3835"},
-    {3935, "gene:vir:3836"},
-    {3936, "gene:vir:3837"},
-    {3937, "gene:vir:3838"},
-    {3938, "gene:vir:3840"},
-    {3939, "gene:vir:3841"},
-    {3940, "gene:vir:3842"},
-    {3941, "gene:vir:3843"},
-    {3942, "gene:vir:3844"},
-    {3943, "gene:vir:3845"},
-    {3944, "gene:vir:3846"},
-    {3945, "gene:vir:3847"},
-    {3946, "gene:vir:3848"},
-    {3947, "gene:vir:3849"},
-    {3948, "gene:vir:3850"},
-    {3949, "gene:vir:3851"},
-    {3950, "gene:vir:3852"},
-    {3951, "gene:vir:3853"},
-    {3952, "gene:vir:3854"},
-    {3953, "gene:vir:3855"},
-    {3954, "gene:vir:3856"},
-    {3955, "gene:vir:3857"},
-    {3956, "gene:vir:3858"},
-    {3957, "gene:vir:3859"},
-    {3958, "gene:vir:3860"},
-    {3959, "gene:vir:3861"},
-    {3960, "gene:vir:3862"},
-    {3961, "gene:vir:3864"},
-    {3962, "gene:vir:3865"},
-    {3963, "gene:vir:387"},
-    {3964, "gene:vir:388"},
-    {3965, "gene:vir:389"},
-    {3966, "gene:vir:390"},
-    {3967, "gene:vir:392"},
-    {3968, "gene:vir:393"},
-    {3969, "gene:vir:3933"},
-    {3970, "gene:vir:394"},
-    {3971, "gene:vir:395"},
-    {3972, "gene:vir:396"},
-    {3973, "gene:vir:397"},
-    {3974, "gene:vir:398"},
-    {3975, "gene:vir:399"},
-    {3976, "gene:vir:400"},
-    {3977, "gene:vir:401"},
-    {3978, "gene:vir:402"},
-    {3979, "gene:vir:403"},
-    {3980, "gene:vir:4033"},
-    {3981, "gene:vir:4035"},
-    {3982, "gene:vir:404"},
-    {3983, "gene:vir:4047"},
-    {3984, "gene:vir:441"},
-    {3985, "gene:vir:4452"},
-    {3986, "gene:vir:4454"},
-    {3987, "gene:vir:4456"},
-    {3988, "gene:vir:446"},
-    {3989, "gene:vir:4495"},
-    {3990, "gene:vir:450"},
-    {3991, "gene:vir:4507"},
-    {3992, "gene:vir:4508"},
-    {3993, "gene:vir:4509"},
-    {3994, "gene:vir:4510"},
-    {3995, "gene:vir:4511"},
-    {3996, "gene:vir:4512"},
-    {3997, "gene:vir:4514"},
-    {3998, "gene:vir:4515"},
-    {3999, "gene:vir:4516"},
-    {4000, "gene:vir:4518"},
-    {4001, "gene:vir:4519"},
-    {4002, "gene:vir:4520"},
-    {4003, "gene:vir:4521"},
-    {4004, "gene:vir:4522"},
-    {4005, "gene:vir:4523"},
-    {4006, "gene:vir:4525"},
-    {4007, "gene:vir:4533"},
-    {4008, "gene:vir:4534"},
-    {4009, "gene:vir:4535"},
-    {4010, "gene:vir:4536"},
-    {4011, "gene:vir:4537"},
-    {4012, "gene:vir:4539"},
-    {4013, "gene:vir:4542"},
-    {4014, "gene:vir:4543"},
-    {4015, "gene:vir:4544"},
-    {4016, "gene:vir:4545"},
-    {4017, "gene:vir:4546"},
-    {4018, "gene:vir:4547"},
-    {4019, "gene:vir:4549"},
-    {4020, "gene:vir:4551"},
-    {4021, "gene:vir:4552"},
-    {4022, "gene:vir:4554"},
-    {4023, "gene:vir:4555"},
-    {4024, "gene:vir:4556"},
-    {4025, "gene:vir:4557"},
-    {4026, "gene:vir:4558"},
-    {4027, "gene:vir:4559"},
-    {4028, "gene:vir:469"},
-    {4029, "gene:vir:473"},
-    {4030, "gene:vir:474"},
-    {4031, "gene:vir:475"},
-    {4032, "gene:vir:4763"},
-    {4033, "gene:vir:477"},
-    {4034, "gene:vir:478"},
-    {4035, "gene:vir:499"},
-    {4036, "gene:vir:507"},
-    {4037, "gene:vir:508"},
-    {4038, "gene:vir:513"},
-    {4039, "gene:vir:5691"},
-    {4040, "gene:vir:5692"},
-    {4041, "gene:vir:5693"},
-    {4042, "gene:vir:5695"},
-    {4043, "gene:vir:5696"},
-    {4044, "gene:vir:5698"},
-    {4045, "gene:vir:5699"},
-    {4046, "gene:vir:5701"},
-    {4047, "gene:vir:5704"},
-    {4048, "gene:vir:5705"},
-    {4049, "gene:vir:5706"},
-    {4050, "gene:vir:5707"},
-    {4051, "gene:vir:5708"},
-    {4052, "gene:vir:5709"},
-    {4053, "gene:vir:5711"},
-    {4054, "gene:vir:5712"},
-    {4055, "gene:vir:5713"},
-    {4056, "gene:vir:5715"},
-    {4057, "gene:vir:5716"},
-    {4058, "gene:vir:5717"},
-    {4059, "gene:vir:5718"},
-    {4060, "gene:vir:5719"},
-    {4061, "gene:vir:5720"},
-    {4062, "gene:vir:5721"},
-    {4063, "gene:vir:5722"},
-    {4064, "gene:vir:5723"},
-    {4065, "gene:vir:5725"},
-    {4066, "gene:vir:5726"},
-    {4067, "gene:vir:5727"},
-    {4068, "gene:vir:5728"},
-    {4069, "gene:vir:5729"},
-    {4070, "gene:vir:6058"},
-    {4071, "gene:vir:6059"},
-    {4072, "gene:vir:6060"},
-    {4073, "gene:vir:6061"},
-    {4074, "gene:vir:6062"},
-    {4075, "gene:vir:6063"},
-    {4076, "gene:vir:6064"},
-    {4077, "gene:vir:6065"},
-    {4078, "gene:vir:6066"},
-    {4079, "gene:vir:6067"},
-    {4080, "gene:vir:6068"},
-    {4081, "gene:vir:6069"},
-    {4082, "gene:vir:6070"},
-    {4083, "gene:vir:6071"},
-    {4084, "gene:vir:6072"},
-    {4085, "gene:vir:6073"},
-    {4086, "gene:vir:6074"},
-    {4087, "gene:vir:6075"},
-    {4088, "gene:vir:6076"},
-    {4089, "gene:vir:6077"},
-    {4090, "gene:vir:6078"},
-    {4091, "gene:vir:6079"},
-    {4092, "gene:vir:6080"},
-    {4093, "gene:vir:6081"},
-    {4094, "gene:vir:6083"},
-    {4095, "gene:vir:6084"},
-    {4096, "gene:vir:6085"},
-    {4097, "gene:vir:6086"},
-    {4098, "gene:vir:6088"},
-    {4099, "gene:vir:6093"},
-    {4100, "gene:vir:6834"},
-    {4101, "gene:vir:7156"},
-    {4102, "gene:vir:7319"},
-    {4103, "gene:vir:7343"},
-    {4104, "gene:vir:7351"},
-    {4105, "gene:vir:7352"},
-    {4106, "gene:vir:7358"},
-    {4107, "gene:vir:769"},
-    {4108, "gene:vir:772"},
-    {4109, "gene:vir:77584"},
-    {4110, "gene:vir:77589"},
-    {4111, "gene:vir:779"},
-    {4112, "gene:vir:79529"},
-    {4113, "gene:vir:79530"},
-    {4114, "gene:vir:79536"},
-    {4115, "gene:vir:79539"},
-    {4116, "gene:vir:79542"},
-    {4117, "gene:vir:79543"},
-    {4118, "gene:vir:79544"},
-    {4119, "gene:vir:79545"},
-    {4120, "gene:vir:79547"},
-    {4121, "gene:vir:79550"},
-    {4122, "gene:vir:79551"},
-    {4123, "gene:vir:79552"},
-    {4124, "gene:vir:79555"},
-    {4125, "gene:vir:79556"},
-    {4126, "gene:vir:79557"},
-    {4127, "gene:vir:79559"},
-    {4128, "gene:vir:79561"},
-    {4129, "gene:vir:79562"},
-    {4130, "gene:vir:79564"},
-    {4131, "gene:vir:79565"},
-    {4132, "gene:vir:79567"},
-    {4133, "gene:vir:79568"},
-    {4134, "gene:vir:79569"},
-    {4135, "gene:vir:79570"},
-    {4136, "gene:vir:79572"},
-    {4137, "gene:vir:79575"},
-    {4138, "gene:vir:79577"},
-    {4139, "gene:vir:79578"},
-    {4140, "gene:vir:79580"},
-    {4141, "gene:vir:79581"},
-    {4142, "gene:vir:79582"},
-    {4143, "gene:vir:79583"},
-    {4144, "gene:vir:79588"},
-    {4145, "gene:vir:798"},
-    {4146, "gene:vir:809"},
-    {4147, "gene:vir:820"},
-    {4148, "gene:vir:8733"},
-    {4149, "gene:vir:8772"},
-    {4150, "gene:vir:8776"},
-    {4151, "gene:vir:8777"},
-    {4152, "gene:vir:93595"},
-    {4153, "gene:vir:93603"},
-    {4154, "gene:vir:93604"},
-    {4155, "gene:vir:93613"},
-    {4156, "gene:vir:93619"},
-    {4157, "gene:vir:94754"},
-    {4158, "gene:vir:95268"},
-    {4159, "gene:vir:95310"},
-    {4160, "gene:vir:95311"},
-    {4161, "gene:vir:95312"},
-    {4162, "gene:vir:95313"},
-    {4163, "gene:vir:95314"},
-    {4164, "gene:vir:95315"},
-    {4165, "gene:vir:95317"},
-    {4166, "gene:vir:95318"},
-    {4167, "gene:vir:95319"},
-    {4168, "gene:vir:95321"},
-    {4169, "gene:vir:95322"},
-    {4170, "gene:vir:95323"},
-    {4171, "gene:vir:95324"},
-    {4172, "gene:vir:95326"},
-    {4173, "gene:vir:95327"},
-    {4174, "gene:vir:95330"},
-    {4175, "gene:vir:95331"},
-    {4176, "gene:vir:95335"},
-    {4177, "gene:vir:95339"},
-    {4178, "gene:vir:95342"},
-    {4179, "gene:vir:95347"},
-    {4180, "gene:vir:95348"},
-    {4181, "gene:vir:95349"},
-    {4182, "gene:vir:95350"},
-    {4183, "gene:vir:95351"},
-    {4184, "gene:vir:95352"},
-    {4185, "gene:vir:95353"},
-    {4186, "gene:vir:95354"},
-    {4187, "gene:vir:95355"},
-    {4188, "gene:vir:95356"},
-    {4189, "gene:vir:95357"},
-    {4190, "gene:vir:95359"},
-    {4191, "gene:vir:9540"},
-    {4192, "gene:vir:9541"},
-    {4193, "gene:vir:9572"},
-    {4194, "gene:vir:96465"},
-    {4195, "gene:vir:98354"},
-    {4196, "gene:vir:98537"},
-    {4197, "gene:vir:98538"},
-    {4198, "gene:vir:98549"},
-    {4199, "gene:vir:98550"},
-    {4200, "gene:vir:98552"},
-    {4201, "gene:vir:98554"},
-    {4202, "gene:vir:98555"},
-    {4203, "gene:vir:98556"},
-    {4204, "gene:vir:98566"},
-    {4205, "gene:vir:992"},
-    {4206, "gene:vir:9949"},
-    {4207, "p0111_1__AP010962"},
-    {4208, "pENTAS02_1__CP003028"},
-    {4209, "rep7a_8_ORF11(pRE25)_X92945"}
-};
-
-
-const std::unordered_map<int, std::string> mgeGroupMap = {
-{1001, "Colicin_plasmid"},
-{1002, "replicon"},
-{1003, "ICE"},
-{1004, "ICE"},
-{1005, "ICE"},
-{1006, "ICE"},
-{1007, "ICE"},
-{1008, "ICE"},
-{1009, "ICE"},
-{1010, "ICE"},
-{1011, "ICE"},
-{1012, "ICE"},
-{1013, "ICE"},
-{1014, "ICE"},
-{1015, "ICE"},
-{1016, "ICE"},
-{1017, "Inc_plasmid"},
-{1018, "Inc_plasmid"},
-{1019, "Inc_plasmid"},
-{1020, "Inc_plasmid"},
-{1021, "Inc_plasmid"},
-{1022, "Inc_plasmid"},
-{1023, "Inc_plasmid"},
-{1024, "plasmid"},
-{1025, "plasmid"},
-{1026, "plasmid"},
-{1027, "plasmid"},
-{1028, "plasmid"},
-{1029, "likely IS/TE"},
-{1030, "plasmid"},
-{1031, "plasmid"},
-{1032, "plasmid"},
-{1033, "likely IS/TE"},
-{1034, "plasmid"},
-{1035, "plasmid"},
-{1036, "plasmid"},
-{1037, "plasmid"},
-{1038, "plasmid"},
-{1039, "likely IS/TE"},
-{1040, "likely IS/TE"},
-{1041, "plasmid"},
-{1042, "likely IS/TE"},
-{1043, "likely IS/TE"},
-{1044, "likely IS/TE"},
-{1045, "likely IS/TE"},
-{1046, "likely IS/TE"},
-{1047, "plasmid"},
-{1048, "plasmid"},
-{1049, "plasmid"},
-{1050, "plasmid"},
-{1051, "plasmid"},
-{1052, "plasmid"},
-{1053, "plasmid"},
-{1054, "plasmid"},
-{1055, "plasmid"},
-{1056, "likely IS/TE"},
-{1057, "likely IS/TE"},
-{1058, "likely IS/TE"},
-{1059, "likely IS/TE"},
-{1060, "plasmid"},
-{1061, "plasmid"},
-{1062, "plasmid"},
-{1063, "plasmid"},
-{1064, "plasmid"},
-{1065, "plasmid"},
-{1066, "likely IS/TE"},
-{1067, "plasmid"},
-{1068, "plasmid"},
-{1069, "plasmid"},
-{1070, "likely IS/TE"},
-{1071, "plasmid"},
-{1072, "plasmid"},
-{1073, "plasmid"},
-{1074, "plasmid"},
-{1075, "plasmid"},
-{1076, "plasmid"},
-{1077, "plasmid"},
-{1078, "plasmid"},
-{1079, "likely IS/TE"},
-{1080, "plasmid"},
-{1081, "plasmid"},
-{1082, "plasmid"},
-{1083, "plasmid"},
-{1084, "plasmid"},
-{1085, "plasmid"},
-{1086, "plasmid"},
-{1087, "plasmid"},
-{1088, "plasmid"},
-{1089, "likely IS/TE"},
-{1090, "likely IS/TE"},
-{1091, "likely IS/TE"},
-{1092, "plasmid"},
-{1093, "plasmid"},
-{1094, "plasmid"},
-{1095, "plasmid"},
-{1096, "plasmid"},
-{1097, "plasmid"},
-{1098, "plasmid"},
-{1099, "plasmid"},
-{1100, "likely IS/TE"},
-{1101, "plasmid"},
-{1102, "plasmid"},
-{1103, "plasmid"},
-{1104, "plasmid"},
-{1105, "plasmid"},
-{1106, "plasmid"},
-{1107, "plasmid"},
-{1108, "plasmid"},
-{1109, "plasmid"},
-{1110, "plasmid"},
-{1111, "likely IS/TE"},
-{1112, "likely IS/TE"},
-{1113, "likely IS/TE"},
-{1114, "plasmid"},
-{1115, "plasmid"},
-{1116, "plasmid"},
-{1117, "plasmid"},
-{1118, "plasmid"},
-{1119, "likely IS/TE"},
-{1120, "plasmid"},
-{1121, "plasmid"},
-{1122, "plasmid"},
-{1123, "plasmid"},
-{1124, "plasmid"},
-{1125, "plasmid"},
-{1126, "plasmid"},
-{1127, "plasmid"},
-{1128, "plasmid"},
-{1129, "plasmid"},
-{1130, "plasmid"},
-{1131, "plasmid"},
-{1132, "likely IS/TE"},
-{1133, "plasmid"},
-{1134, "likely IS/TE"},
-{1135, "likely IS/TE"},
-{1136, "likely IS/TE"},
-{1137, "likely IS/TE"},
-{1138, "plasmid"},
-{1139, "plasmid"},
-{1140, "plasmid"},
-{1141, "plasmid"},
-{1142, "plasmid"},
-{1143, "plasmid"},
-{1144, "plasmid"},
-{1145, "plasmid"},
-{1146, "plasmid"},
-{1147, "plasmid"},
-{1148, "plasmid"},
-{1149, "plasmid"},
-{1150, "plasmid"},
-{1151, "plasmid"},
-{1152, "plasmid"},
-{1153, "plasmid"},
-{1154, "plasmid"},
-{1155, "plasmid"},
-{1156, "likely IS/TE"},
-{1157, "plasmid"},
-{1158, "plasmid"},
-{1159, "plasmid"},
-{1160, "likely IS/TE"},
-{1161, "likely IS/TE"},
-{1162, "plasmid"},
-{1163, "likely IS/TE"},
-{1164, "likely IS/TE"},
-{1165, "plasmid"},
-{1166, "plasmid"},
-{1167, "plasmid"},
-{1168, "plasmid"},
-{1169, "plasmid"},
-{1170, "plasmid"},
-{1171, "plasmid"},
-{1172, "plasmid"},
-{1173, "likely IS/TE"},
-{1174, "plasmid"},
-{1175, "plasmid"},
-{1176, "plasmid"},
-{1177, "plasmid"},
-{1178, "plasmid"},
-{1179, "plasmid"},
-{1180, "plasmid"},
-{1181, "plasmid"},
-{1182, "plasmid"},
-{1183, "plasmid"},
-{1184, "plasmid"},
-{1185, "plasmid"},
-{1186, "plasmid"},
-{1187, "plasmid"},
-{1188, "plasmid"},
-{1189, "plasmid"},
-{1190, "plasmid"},
-{1191, "plasmid"},
-{1192, "plasmid"},
-{1193, "plasmid"},
-{1194, "plasmid"},
-{1195, "plasmid"},
-{1196, "plasmid"},
-{1197, "likely IS/TE"},
-{1198, "likely IS/TE"},
-{1199, "likely IS/TE"},
-{1200, "likely IS/TE"},
-{1201, "likely IS/TE"},
-{1202, "plasmid"},
-{1203, "likely IS/TE"},
-{1204, "likely IS/TE"},
-{1205, "likely IS/TE"},
-{1206, "plasmid"},
-{1207, "plasmid"},
-{1208, "plasmid"},
-{1209, "plasmid"},
-{1210, "plasmid"},
-{1211, "plasmid"},
-{1212, "plasmid"},
-{1213, "plasmid"},
-{1214, "plasmid"},
-{1215, "plasmid"},
-{1216, "plasmid"},
-{1217, "plasmid"},
-{1218, "likely IS/TE"},
-{1219, "plasmid"},
-{1220, "plasmid"},
-{1221, "plasmid"},
-{1222, "plasmid"},
-{1223, "plasmid"},
-{1224, "plasmid"},
-{1225, "plasmid"},
-{1226, "plasmid"},
-{1227, "plasmid"},
-{1228, "plasmid"},
-{1229, "plasmid"},
-{1230, "plasmid"},
-{1231, "plasmid"},
-{1232, "plasmid"},
-{1233, "plasmid"},
-{1234, "plasmid"},
-{1235, "plasmid"},
-{1236, "plasmid"},
-{1237, "likely IS/TE"},
-{1238, "plasmid"},
-{1239, "plasmid"},
-{1240, "likely IS/TE"},
-{1241, "plasmid"},
-{1242, "likely IS/TE"},
-{1243, "likely IS/TE"},
-{1244, "plasmid"},
-{1245, "plasmid"},
-{1246, "plasmid"},
-{1247, "plasmid"},
-{1248, "plasmid"},
-{1249, "plasmid"},
-{1250, "plasmid"},
-{1251, "plasmid"},
-{1252, "plasmid"},
-{1253, "likely IS/TE"},
-{1254, "plasmid"},
-{1255, "plasmid"},
-{1256, "plasmid"},
-{1257, "plasmid"},
-{1258, "plasmid"},
-{1259, "plasmid"},
-{1260, "plasmid"},
-{1261, "plasmid"},
-{1262, "plasmid"},
-{1263, "plasmid"},
-{1264, "plasmid"},
-{1265, "plasmid"},
-{1266, "plasmid"},
-{1267, "plasmid"},
-{1268, "plasmid"},
-{1269, "plasmid"},
-{1270, "plasmid"},
-{1271, "plasmid"},
-{1272, "plasmid"},
-{1273, "plasmid"},
-{1274, "plasmid"},
-{1275, "plasmid"},
-{1276, "plasmid"},
-{1277, "plasmid"},
-{1278, "likely IS/TE"},
-{1279, "likely IS/TE"},
-{1280, "likely IS/TE"},
-{1281, "likely IS/TE"},
-{1282, "likely IS/TE"},
-{1283, "likely IS/TE"},
-{1284, "likely IS/TE"},
-{1285, "likely IS/TE"},
-{1286, "likely IS/TE"},
-{1287, "plasmid"},
-{1288, "plasmid"},
-{1289, "plasmid"},
-{1290, "plasmid"},
-{1291, "plasmid"},
-{1292, "likely IS/TE"},
-{1293, "likely IS/TE"},
-{1294, "likely IS/TE"},
-{1295, "likely IS/TE"},
-{1296, "plasmid"},
-{1297, "plasmid"},
-{1298, "plasmid"},
-{1299, "plasmid"},
-{1300, "plasmid"},
-{1301, "plasmid"},
-{1302, "plasmid"},
-{1303, "plasmid"},
-{1304, "plasmid"},
-{1305, "likely IS/TE"},
-{1306, "plasmid"},
-{1307, "plasmid"},
-{1308, "plasmid"},
-{1309, "plasmid"},
-{1310, "likely IS/TE"},
-{1311, "likely IS/TE"},
-{1312, "likely IS/TE"},
-{1313, "plasmid"},
-{1314, "plasmid"},
-{1315, "plasmid"},
-{1316, "plasmid"},
-{1317, "plasmid"},
-{1318, "plasmid"},
-{1319, "plasmid"},
-{1320, "plasmid"},
-{1321, "likely IS/TE"},
-{1322, "plasmid"},
-{1323, "plasmid"},
-{1324, "likely IS/TE"},
-{1325, "plasmid"},
-{1326, "plasmid"},
-{1327, "plasmid"},
-{1328, "plasmid"},
-{1329, "plasmid"},
-{1330, "plasmid"},
-{1331, "plasmid"},
-{1332, "plasmid"},
-{1333, "plasmid"},
-{1334, "plasmid"},
-{1335, "plasmid"},
-{1336, "plasmid"},
-{1337, "plasmid"},
-{1338, "plasmid"},
-{1339, "plasmid"},
-{1340, "UNCLASSIFIED"},
-{1341, "plasmid"},
-{1342, "plasmid"},
-{1343, "plasmid"},
-{1344, "plasmid"},
-{1345, "plasmid"},
-{1346, "plasmid"},
-{1347, "plasmid"},
-{1348, "plasmid"},
-{1349, "plasmid"},
-{1350, "plasmid"},
-{1351, "plasmid"},
-{1352, "plasmid"},
-{1353, "plasmid"},
-{1354, "plasmid"},
-{1355, "plasmid"},
-{1356, "plasmid"},
-{1357, "plasmid"},
-{1358, "plasmid"},
-{1359, "plasmid"},
-{1360, "plasmid"},
-{1361, "plasmid"},
-{1362, "plasmid"},
-{1363, "plasmid"},
-{1364, "plasmid"},
-{1365, "plasmid"},
-{1366, "plasmid"},
-{1367, "plasmid"},
-{1368, "plasmid"},
-{1369, "plasmid"},
-{1370, "plasmid"},
-{1371, "plasmid"},
-{1372, "plasmid"},
-{1373, "plasmid"},
-{1374, "plasmid"},
-{1375, "plasmid"},
-{1376, "plasmid"},
-{1377, "plasmid"},
-{1378, "plasmid"},
-{1379, "plasmid"},
-{1380, "likely IS/TE"},
-{1381, "plasmid"},
-{1382, "likely IS/TE"},
-{1383, "plasmid"},
-{1384, "plasmid"},
-{1385, "plasmid"},
-{1386, "plasmid"},
-{1387, "plasmid"},
-{1388, "plasmid"},
-{1389, "plasmid"},
-{1390, "plasmid"},
-{1391, "plasmid"},
-{1392, "plasmid"},
-{1393, "plasmid"},
-{1394, "plasmid"},
-{1395, "plasmid"},
-{1396, "plasmid"},
-{1397, "plasmid"},
-{1398, "plasmid"},
-{1399, "plasmid"},
-{1400, "plasmid"},
-{1401, "plasmid"},
-{1402, "plasmid"},
-{1403, "plasmid"},
-{1404, "plasmid"},
-{1405, "plasmid"},
-{1406, "plasmid"},
-{1407, "likely IS/TE"},
-{1408, "plasmid"},
-{1409, "plasmid"},
-{1410, "plasmid"},
-{1411, "plasmid"},
-{1412, "plasmid"},
-{1413, "likely IS/TE"},
-{1414, "plasmid"},
-{1415, "plasmid"},
-{1416, "plasmid"},
-{1417, "plasmid"},
-{1418, "plasmid"},
-{1419, "plasmid"},
-{1420, "plasmid"},
-{1421, "plasmid"},
-{1422, "plasmid"},
-{1423, "plasmid"},
-{1424, "plasmid"},
-{1425, "plasmid"},
-{1426, "plasmid"},
-{1427, "plasmid"},
-{1428, "plasmid"},
-{1429, "likely IS/TE"},
-{1430, "likely IS/TE"},
-{1431, "plasmid"},
-{1432, "plasmid"},
-{1433, "plasmid"},
-{1434, "plasmid"},
-{1435, "plasmid"},
-{1436, "plasmid"},
-{1437, "plasmid"},
-{1438, "plasmid"},
-{1439, "plasmid"},
-{1440, "plasmid"},
-{1441, "plasmid"},
-{1442, "plasmid"},
-{1443, "plasmid"},
-{1444, "plasmid"},
-{1445, "plasmid"},
-{1446, "plasmid"},
-{1447, "plasmid"},
-{1448, "plasmid"},
-{1449, "plasmid"},
-{1450, "plasmid"},
-{1451, "likely IS/TE"},
-{1452, "likely IS/TE"},
-{1453, "likely IS/TE"},
-{1454, "likely IS/TE"},
-{1455, "likely IS/TE"},
-{1456, "plasmid"},
-{1457, "likely IS/TE"},
-{1458, "plasmid"},
-{1459, "plasmid"},
-{1460, "likely IS/TE"},
-{1461, "plasmid"},
-{1462, "plasmid"},
-{1463, "plasmid"},
-{1464, "plasmid"},
-{1465, "plasmid"},
-{1466, "plasmid"},
-{1467, "plasmid"},
-{1468, "plasmid"},
-{1469, "plasmid"},
-{1470, "plasmid"},
-{1471, "plasmid"},
-{1472, "plasmid"},
-{1473, "plasmid"},
-{1474, "plasmid"},
-{1475, "plasmid"},
-{1476, "likely IS/TE"},
-{1477, "plasmid"},
-{1478, "plasmid"},
-{1479, "likely IS/TE"},
-{1480, "plasmid"},
-{1481, "plasmid"},
-{1482, "plasmid"},
-{1483, "plasmid"},
-{1484, "plasmid"},
-{1485, "plasmid"},
-{1486, "plasmid"},
-{1487, "likely IS/TE"},
-{1488, "plasmid"},
-{1489, "likely IS/TE"},
-{1490, "plasmid"},
-{1491, "plasmid"},
-{1492, "plasmid"},
-{1493, "plasmid"},
-{1494, "plasmid"},
-{1495, "plasmid"},
-{1496, "plasmid"},
-{1497, "plasmid"},
-{1498, "plasmid"},
-{1499, "likely IS/TE"},
-{1500, "likely IS/TE"},
-{1501, "likely IS/TE"},
-{1502, "likely IS/TE"},
-{1503, "plasmid"},
-{1504, "plasmid"},
-{1505, "plasmid"},
-{1506, "plasmid"},
-{1507, "likely IS/TE"},
-{1508, "likely IS/TE"},
-{1509, "likely IS/TE"},
-{1510, "likely IS/TE"},
-{1511, "plasmid"},
-{1512, "plasmid"},
-{1513, "likely IS/TE"},
-{1514, "likely IS/TE"},
-{1515, "plasmid"},
-{1516, "plasmid"},
-{1517, "plasmid"},
-{1518, "plasmid"},
-{1519, "plasmid"},
-{1520, "plasmid"},
-{1521, "plasmid"},
-{1522, "plasmid"},
-{1523, "plasmid"},
-{1524, "likely IS/TE"},
-{1525, "likely IS/TE"},
-{1526, "likely IS/TE"},
-{1527, "plasmid"},
-{1528, "plasmid"},
-{1529, "plasmid"},
-{1530, "plasmid"},
-{1531, "plasmid"},
-{1532, "plasmid"},
-{1533, "plasmid"},
-{1534, "plasmid"},
-{1535, "likely IS/TE"},
-{1536, "likely IS/TE"},
-{1537, "likely IS/TE"},
-{1538, "plasmid"},
-{1539, "plasmid"},
-{1540, "plasmid"},
-{1541, "plasmid"},
-{1542, "likely IS/TE"},
-{1543, "plasmid"},
-{1544, "plasmid"},
-{1545, "plasmid"},
-{1546, "plasmid"},
-{1547, "likely IS/TE"},
-{1548, "likely IS/TE"},
-{1549, "likely IS/TE"},
-{1550, "plasmid"},
-{1551, "plasmid"},
-{1552, "gene:plasmid:151429"},
-{1553, "plasmid"},
-{1554, "likely IS/TE"},
-{1555, "plasmid"},
-{1556, "likely IS/TE"},
-{1557, "likely IS/TE"},
-{1558, "likely IS/TE"},
-{1559, "likely IS/TE"},
-{1560, "plasmid"},
-{1561, "plasmid"},
-{1562, "plasmid"},
-{1563, "plasmid"},
-{1564, "plasmid"},
-{1565, "plasmid"},
-{1566, "plasmid"},
-{1567, "plasmid"},
-{1568, "plasmid"},
-{1569, "plasmid"},
-{1570, "plasmid"},
-{1571, "plasmid"},
-{1572, "plasmid"},
-{1573, "plasmid"},
-{1574, "plasmid"},
-{1575, "plasmid"},
-{1576, "plasmid"},
-{1577, "plasmid"},
-{1578, "plasmid"},
-{1579, "plasmid"},
-{1580, "plasmid"},
-{1581, "plasmid"},
-{1582, "plasmid"},
-{1583, "plasmid"},
-{1584, "plasmid"},
-{1585, "plasmid"},
-{1586, "plasmid"},
-{1587, "plasmid"},
-{1588, "plasmid"},
-{1589, "plasmid"},
-{1590, "plasmid"},
-{1591, "plasmid"},
-{1592, "plasmid"},
-{1593, "plasmid"},
-{1594, "plasmid"},
-{1595, "plasmid"},
-{1596, "plasmid"},
-{1597, "plasmid"},
-{1598, "plasmid"},
-{1599, "plasmid"},
-{1600, "plasmid"},
-{1601, "plasmid"},
-{1602, "plasmid"},
-{1603, "plasmid"},
-{1604, "plasmid"},
-{1605, "plasmid"},
-{1606, "plasmid"},
-{1607, "plasmid"},
-{1608, "plasmid"},
-{1609, "plasmid"},
-{1610, "plasmid"},
-{1611, "plasmid"},
-{1612, "plasmid"},
-{1613, "plasmid"},
-{1614, "plasmid"},
-{1615, "plasmid"},
-{1616, "plasmid"},
-{1617, "plasmid"},
-{1618, "plasmid"},
-{1619, "plasmid"},
-{1620, "plasmid"},
-{1621, "plasmid"},
-{1622, "plasmid"},
-{1623, "plasmid"},
-{1624, "plasmid"},
-{1625, "plasmid"},
-{1626, "plasmid"},
-{1627, "plasmid"},
-{1628, "plasmid"},
-{1629, "plasmid"},
-{1630, "plasmid"},
-{1631, "plasmid"},
-{1632, "plasmid"},
-{1633, "plasmid"},
-{1634, "plasmid"},
-{1635, "plasmid"},
-{1636, "plasmid"},
-{1637, "plasmid"},
-{1638, "plasmid"},
-{1639, "plasmid"},
-{1640, "plasmid"},
-{1641, "likely IS/TE"},
-{1642, "likely IS/TE"},
-{1643, "plasmid"},
-{1644, "plasmid"},
-{1645, "plasmid"},
-{1646, "plasmid"},
-{1647, "plasmid"},
-{1648, "plasmid"},
-{1649, "plasmid"},
-{1650, "plasmid"},
-{1651, "plasmid"},
-{1652, "plasmid"},
-{1653, "plasmid"},
-{1654, "plasmid"},
-{1655, "plasmid"},
-{1656, "plasmid"},
-{1657, "plasmid"},
-{1658, "plasmid"},
-{1659, "likely IS/TE"},
-{1660, "plasmid"},
-{1661, "plasmid"},
-{1662, "plasmid"},
-{1663, "plasmid"},
-{1664, "plasmid"},
-{1665, "plasmid"},
-{1666, "plasmid"},
-{1667, "plasmid"},
-{1668, "plasmid"},
-{1669, "plasmid"},
-{1670, "plasmid"},
-{1671, "plasmid"},
-{1672, "plasmid"},
-{1673, "plasmid"},
-{1674, "plasmid"},
-{1675, "plasmid"},
-{1676, "plasmid"},
-{1677, "plasmid"},
-{1678, "plasmid"},
-{1679, "plasmid"},
-{1680, "plasmid"},
-{1681, "plasmid"},
-{1682, "plasmid"},
-{1683, "plasmid"},
-{1684, "plasmid"},
-{1685, "plasmid"},
-{1686, "plasmid"},
-{1687, "plasmid"},
-{1688, "plasmid"},
-{1689, "likely IS/TE"},
-{1690, "plasmid"},
-{1691, "plasmid"},
-{1692, "plasmid"},
-{1693, "plasmid"},
-{1694, "likely IS/TE"},
-{1695, "plasmid"},
-{1696, "plasmid"},
-{1697, "plasmid"},
-{1698, "plasmid"},
-{1699, "UNCLASSIFIED"},
-{1700, "plasmid"},
-{1701, "plasmid"},
-{1702, "plasmid"},
-{1703, "plasmid"},
-{1704, "plasmid"},
-{1705, "plasmid"},
-{1706, "plasmid"},
-{1707, "likely IS/TE"},
-{1708, "plasmid"},
-{1709, "plasmid"},
-{1710, "plasmid"},
-{1711, "plasmid"},
-{1712, "likely IS/TE"},
-{1713, "plasmid"},
-{1714, "plasmid"},
-{1715, "plasmid"},
-{1716, "plasmid"},
-{1717, "plasmid"},
-{1718, "plasmid"},
-{1719, "plasmid"},
-{1720, "plasmid"},
-{1721, "plasmid"},
-{1722, "plasmid"},
-{1723, "plasmid"},
-{1724, "plasmid"},
-{1725, "plasmid"},
-{1726, "plasmid"},
-{1727, "plasmid"},
-{1728, "likely IS/TE"},
-{1729, "plasmid"},
-{1730, "plasmid"},
-{1731, "likely IS/TE"},
-{1732, "plasmid"},
-{1733, "plasmid"},
-{1734, "plasmid"},
-{1735, "plasmid"},
-{1736, "plasmid"},
-{1737, "plasmid"},
-{1738, "plasmid"},
-{1739, "plasmid"},
-{1740, "plasmid"},
-{1741, "likely IS/TE"},
-{1742, "plasmid"},
-{1743, "plasmid"},
-{1744, "plasmid"},
-{1745, "plasmid"},
-{1746, "likely IS/TE"},
-{1747, "plasmid"},
-{1748, "plasmid"},
-{1749, "likely IS/TE"},
-{1750, "plasmid"},
-{1751, "plasmid"},
-{1752, "likely IS/TE"},
-{1753, "plasmid"},
-{1754, "plasmid"},
-{1755, "plasmid"},
-{1756, "plasmid"},
-{1757, "plasmid"},
-{1758, "plasmid"},
-{1759, "plasmid"},
-{1760, "likely IS/TE"},
-{1761, "plasmid"},
-{1762, "plasmid"},
-{1763, "plasmid"},
-{1764, "plasmid"},
-{1765, "plasmid"},
-{1766, "plasmid"},
-{1767, "plasmid"},
-{1768, "plasmid"},
-{1769, "plasmid"},
-{1770, "likely IS/TE"},
-{1771, "plasmid"},
-{1772, "plasmid"},
-{1773, "plasmid"},
-{1774, "plasmid"},
-{1775, "plasmid"},
-{1776, "plasmid"},
-{1777, "plasmid"},
-{1778, "likely IS/TE"},
-{1779, "likely IS/TE"},
-{1780, "plasmid"},
-{1781, "likely IS/TE"},
-{1782, "likely IS/TE"},
-{1783, "plasmid"},
-{1784, "plasmid"},
-{1785, "plasmid"},
-{1786, "plasmid"},
-{1787, "plasmid"},
-{1788, "plasmid"},
-{1789, "plasmid"},
-{1790, "plasmid"},
-{1791, "likely IS/TE"},
-{1792, "plasmid"},
-{1793, "plasmid"},
-{1794, "likely IS/TE"},
-{1795, "likely IS/TE"},
-{1796, "plasmid"},
-{1797, "likely IS/TE"},
-{1798, "likely IS/TE"},
-{1799, "likely IS/TE"},
-{1800, "plasmid"},
-{1801, "likely IS/TE"},
-{1802, "likely IS/TE"},
-{1803, "plasmid"},
-{1804, "likely IS/TE"},
-{1805, "likely IS/TE"},
-{1806, "plasmid"},
-{1807, "plasmid"},
-{1808, "plasmid"},
-{1809, "plasmid"},
-{1810, "plasmid"},
-{1811, "plasmid"},
-{1812, "plasmid"},
-{1813, "plasmid"},
-{1814, "plasmid"},
-{1815, "plasmid"},
-{1816, "plasmid"},
-{1817, "plasmid"},
-{1818, "plasmid"},
-{1819, "plasmid"},
-{1820, "plasmid"},
-{1821, "plasmid"},
-{1822, "plasmid"},
-{1823, "plasmid"},
-{1824, "plasmid"},
-{1825, "plasmid"},
-{1826, "plasmid"},
-{1827, "plasmid"},
-{1828, "plasmid"},
-{1829, "plasmid"},
-{1830, "plasmid"},
-{1831, "likely IS/TE"},
-{1832, "likely IS/TE"},
-{1833, "likely IS/TE"},
-{1834, "plasmid"},
-{1835, "plasmid"},
-{1836, "plasmid"},
-{1837, "likely IS/TE"},
-{1838, "likely IS/TE"},
-{1839, "plasmid"},
-{1840, "plasmid"},
-{1841, "plasmid"},
-{1842, "plasmid"},
-{1843, "plasmid"},
-{1844, "plasmid"},
-{1845, "likely IS/TE"},
-{1846, "plasmid"},
-{1847, "plasmid"},
-{1848, "plasmid"},
-{1849, "plasmid"},
-{1850, "likely IS/TE"},
-{1851, "plasmid"},
-{1852, "plasmid"},
-{1853, "plasmid"},
-{1854, "plasmid"},
-{1855, "plasmid"},
-{1856, "plasmid"},
-{1857, "likely IS/TE"},
-{1858, "plasmid"},
-{1859, "plasmid"},
-{1860, "likely IS/TE"},
-{1861, "plasmid"},
-{1862, "plasmid"},
-{1863, "plasmid"},
-{1864, "plasmid"},
-{1865, "likely IS/TE"},
-{1866, "plasmid"},
-{1867, "plasmid"},
-{1868, "plasmid"},
-{1869, "plasmid"},
-{1870, "plasmid"},
-{1871, "plasmid"},
-{1872, "plasmid"},
-{1873, "plasmid"},
-{1874, "plasmid"},
-{1875, "plasmid"},
-{1876, "plasmid"},
-{1877, "plasmid"},
-{1878, "plasmid"},
-{1879, "plasmid"},
-{1880, "plasmid"},
-{1881, "plasmid"},
-{1882, "plasmid"},
-{1883, "plasmid"},
-{1884, "plasmid"},
-{1885, "plasmid"},
-{1886, "plasmid"},
-{1887, "plasmid"},
-{1888, "plasmid"},
-{1889, "plasmid"},
-{1890, "plasmid"},
-{1891, "plasmid"},
-{1892, "plasmid"},
-{1893, "plasmid"},
-{1894, "plasmid"},
-{1895, "plasmid"},
-{1896, "plasmid"},
-{1897, "plasmid"},
-{1898, "plasmid"},
-{1899, "plasmid"},
-{1900, "plasmid"},
-{1901, "plasmid"},
-{1902, "plasmid"},
-{1903, "UNCLASSIFIED"},
-{1904, "plasmid"},
-{1905, "plasmid"},
-{1906, "plasmid"},
-{1907, "likely IS/TE"},
-{1908, "plasmid"},
-{1909, "plasmid"},
-{1910, "plasmid"},
-{1911, "plasmid"},
-{1912, "plasmid"},
-{1913, "plasmid"},
-{1914, "plasmid"},
-{1915, "plasmid"},
-{1916, "plasmid"},
-{1917, "plasmid"},
-{1918, "plasmid"},
-{1919, "plasmid"},
-{1920, "likely IS/TE"},
-{1921, "plasmid"},
-{1922, "plasmid"},
-{1923, "plasmid"},
-{1924, "plasmid"},
-{1925, "plasmid"},
-{1926, "plasmid"},
-{1927, "plasmid"},
-{1928, "plasmid"},
-{1929, "plasmid"},
-{1930, "plasmid"},
-{1931, "plasmid"},
-{1932, "plasmid"},
-{1933, "plasmid"},
-{1934, "plasmid"},
-{1935, "likely IS/TE"},
-{1936, "plasmid"},
-{1937, "plasmid"},
-{1938, "plasmid"},
-{1939, "plasmid"},
-{1940, "plasmid"},
-{1941, "plasmid"},
-{1942, "plasmid"},
-{1943, "plasmid"},
-{1944, "plasmid"},
-{1945, "likely IS/TE"},
-{1946, "plasmid"},
-{1947, "plasmid"},
-{1948, "plasmid"},
-{1949, "plasmid"},
-{1950, "plasmid"},
-{1951, "plasmid"},
-{1952, "plasmid"},
-{1953, "plasmid"},
-{1954, "likely IS/TE"},
-{1955, "plasmid"},
-{1956, "plasmid"},
-{1957, "plasmid"},
-{1958, "plasmid"},
-{1959, "plasmid"},
-{1960, "plasmid"},
-{1961, "plasmid"},
-{1962, "plasmid"},
-{1963, "plasmid"},
-{1964, "plasmid"},
-{1965, "plasmid"},
-{1966, "plasmid"},
-{1967, "plasmid"},
-{1968, "plasmid"},
-{1969, "plasmid"},
-{1970, "plasmid"},
-{1971, "plasmid"},
-{1972, "plasmid"},
-{1973, "plasmid"},
-{1974, "plasmid"},
-{1975, "plasmid"},
-{1976, "plasmid"},
-{1977, "likely IS/TE"},
-{1978, "plasmid"},
-{1979, "plasmid"},
-{1980, "plasmid"},
-{1981, "plasmid"},
-{1982, "plasmid"},
-{1983, "plasmid"},
-{1984, "plasmid"},
-{1985, "plasmid"},
-{1986, "plasmid"},
-{1987, "plasmid"},
-{1988, "plasmid"},
-{1989, "plasmid"},
-{1990, "plasmid"},
-{1991, "plasmid"},
-{1992, "plasmid"},
-{1993, "plasmid"},
-{1994, "plasmid"},
-{1995, "plasmid"},
-{1996, "plasmid"},
-{1997, "plasmid"},
-{1998, "plasmid"},
-{1999, "plasmid"},
-{2000, "plasmid"},
-{2001, "plasmid"},
-{2002, "plasmid"},
-{2003, "plasmid"},
-{2004, "plasmid"},
-{2005, "plasmid"},
-{2006, "plasmid"},
-{2007, "plasmid"},
-{2008, "plasmid"},
-{2009, "plasmid"},
-{2010, "plasmid"},
-{2011, "plasmid"},
-{2012, "plasmid"},
-{2013, "plasmid"},
-{2014, "plasmid"},
-{2015, "plasmid"},
-{2016, "plasmid"},
-{2017, "plasmid"},
-{2018, "plasmid"},
-{2019, "plasmid"},
-{2020, "plasmid"},
-{2021, "plasmid"},
-{2022, "plasmid"},
-{2023, "plasmid"},
-{2024, "plasmid"},
-{2025, "plasmid"},
-{2026, "plasmid"},
-{2027, "plasmid"},
-{2028, "plasmid"},
-{2029, "likely IS/TE"},
-{2030, "likely IS/TE"},
-{2031, "plasmid"},
-{2032, "likely IS/TE"},
-{2033, "likely IS/TE"},
-{2034, "likely IS/TE"},
-{2035, "likely IS/TE"},
-{2036, "plasmid"},
-{2037, "plasmid"},
-{2038, "plasmid"},
-{2039, "likely IS/TE"},
-{2040, "likely IS/TE"},
-{2041, "likely IS/TE"},
-{2042, "likely IS/TE"},
-{2043, "likely IS/TE"},
-{2044, "likely IS/TE"},
-{2045, "likely IS/TE"},
-{2046, "likely IS/TE"},
-{2047, "likely IS/TE"},
-{2048, "plasmid"},
-{2049, "plasmid"},
-{2050, "plasmid"},
-{2051, "plasmid"},
-{2052, "plasmid"},
-{2053, "UNCLASSIFIED"},
-{2054, "plasmid"},
-{2055, "plasmid"},
-{2056, "plasmid"},
-{2057, "plasmid"},
-{2058, "likely IS/TE"},
-{2059, "plasmid"},
-{2060, "gene:plasmid:30991"},
-{2061, "plasmid"},
-{2062, "gene:plasmid:77695"},
-{2063, "likely IS/TE"},
-{2064, "plasmid"},
-{2065, "likely IS/TE"},
-{2066, "plasmid"},
-{2067, "plasmid"},
-{2068, "likely IS/TE"},
-{2069, "likely IS/TE"},
-{2070, "plasmid"},
-{2071, "plasmid"},
-{2072, "plasmid"},
-{2073, "plasmid"},
-{2074, "plasmid"},
-{2075, "plasmid"},
-{2076, "plasmid"},
-{2077, "likely IS/TE"},
-{2078, "plasmid"},
-{2079, "plasmid"},
-{2080, "likely IS/TE"},
-{2081, "plasmid"},
-{2082, "plasmid"},
-{2083, "plasmid"},
-{2084, "plasmid"},
-{2085, "plasmid"},
-{2086, "plasmid"},
-{2087, "likely IS/TE"},
-{2088, "plasmid"},
-{2089, "plasmid"},
-{2090, "plasmid"},
-{2091, "plasmid"},
-{2092, "plasmid"},
-{2093, "plasmid"},
-{2094, "plasmid"},
-{2095, "plasmid"},
-{2096, "plasmid"},
-{2097, "plasmid"},
-{2098, "plasmid"},
-{2099, "plasmid"},
-{2100, "likely IS/TE"},
-{2101, "likely IS/TE"},
-{2102, "likely IS/TE"},
-{2103, "plasmid"},
-{2104, "plasmid"},
-{2105, "plasmid"},
-{2106, "plasmid"},
-{2107, "plasmid"},
-{2108, "plasmid"},
-{2109, "plasmid"},
-{2110, "plasmid"},
-{2111, "plasmid"},
-{2112, "plasmid"},
-{2113, "plasmid"},
-{2114, "plasmid"},
-{2115, "plasmid"},
-{2116, "likely IS/TE"},
-{2117, "likely IS/TE"},
-{2118, "plasmid"},
-{2119, "plasmid"},
-{2120, "likely IS/TE"},
-{2121, "plasmid"},
-{2122, "plasmid"},
-{2123, "plasmid"},
-{2124, "plasmid"},
-{2125, "plasmid"},
-{2126, "plasmid"},
-{2127, "likely IS/TE"},
-{2128, "plasmid"},
-{2129, "plasmid"},
-{2130, "plasmid"},
-{2131, "plasmid"},
-{2132, "plasmid"},
-{2133, "plasmid"},
-{2134, "plasmid"},
-{2135, "likely IS/TE"},
-{2136, "plasmid"},
-{2137, "plasmid"},
-{2138, "plasmid"},
-{2139, "plasmid"},
-{2140, "likely IS/TE"},
-{2141, "likely IS/TE"},
-{2142, "plasmid"},
-{2143, "plasmid"},
-{2144, "plasmid"},
-{2145, "plasmid"},
-{2146, "plasmid"},
-{2147, "plasmid"},
-{2148, "plasmid"},
-{2149, "likely IS/TE"},
-{2150, "likely IS/TE"},
-{2151, "likely IS/TE"},
-{2152, "plasmid"},
-{2153, "plasmid"},
-{2154, "plasmid"},
-{2155, "plasmid"},
-{2156, "likely IS/TE"},
-{2157, "likely IS/TE"},
-{2158, "plasmid"},
-{2159, "plasmid"},
-{2160, "plasmid"},
-{2161, "plasmid"},
-{2162, "plasmid"},
-{2163, "plasmid"},
-{2164, "plasmid"},
-{2165, "plasmid"},
-{2166, "plasmid"},
-{2167, "plasmid"},
-{2168, "plasmid"},
-{2169, "plasmid"},
-{2170, "plasmid"},
-{2171, "plasmid"},
-{2172, "plasmid"},
-{2173, "likely IS/TE"},
-{2174, "plasmid"},
-{2175, "plasmid"},
-{2176, "plasmid"},
-{2177, "plasmid"},
-{2178, "plasmid"},
-{2179, "plasmid"},
-{2180, "plasmid"},
-{2181, "plasmid"},
-{2182, "plasmid"},
-{2183, "plasmid"},
-{2184, "plasmid"},
-{2185, "plasmid"},
-{2186, "plasmid"},
-{2187, "plasmid"},
-{2188, "plasmid"},
-{2189, "plasmid"},
-{2190, "plasmid"},
-{2191, "plasmid"},
-{2192, "plasmid"},
-{2193, "plasmid"},
-{2194, "plasmid"},
-{2195, "plasmid"},
-{2196, "plasmid"},
-{2197, "plasmid"},
-{2198, "plasmid"},
-{2199, "plasmid"},
-{2200, "plasmid"},
-{2201, "plasmid"},
-{2202, "plasmid"},
-{2203, "plasmid"},
-{2204, "plasmid"},
-{2205, "plasmid"},
-{2206, "plasmid"},
-{2207, "plasmid"},
-{2208, "plasmid"},
-{2209, "plasmid"},
-{2210, "likely IS/TE"},
-{2211, "plasmid"},
-{2212, "plasmid"},
-{2213, "plasmid"},
-{2214, "plasmid"},
-{2215, "plasmid"},
-{2216, "likely IS/TE"},
-{2217, "plasmid"},
-{2218, "plasmid"},
-{2219, "plasmid"},
-{2220, "plasmid"},
-{2221, "plasmid"},
-{2222, "plasmid"},
-{2223, "plasmid"},
-{2224, "plasmid"},
-{2225, "likely IS/TE"},
-{2226, "likely IS/TE"},
-{2227, "likely IS/TE"},
-{2228, "plasmid"},
-{2229, "plasmid"},
-{2230, "plasmid"},
-{2231, "plasmid"},
-{2232, "plasmid"},
-{2233, "plasmid"},
-{2234, "plasmid"},
-{2235, "likely IS/TE"},
-{2236, "likely IS/TE"},
-{2237, "likely IS/TE"},
-{2238, "likely IS/TE"},
-{2239, "likely IS/TE"},
-{2240, "plasmid"},
-{2241, "plasmid"},
-{2242, "plasmid"},
-{2243, "plasmid"},
-{2244, "plasmid"},
-{2245, "plasmid"},
-{2246, "plasmid"},
-{2247, "plasmid"},
-{2248, "plasmid"},
-{2249, "plasmid"},
-{2250, "plasmid"},
-{2251, "plasmid"},
-{2252, "plasmid"},
-{2253, "plasmid"},
-{2254, "plasmid"},
-{2255, "plasmid"},
-{2256, "likely IS/TE"},
-{2257, "plasmid"},
-{2258, "plasmid"},
-{2259, "plasmid"},
-{2260, "likely IS/TE"},
-{2261, "likely IS/TE"},
-{2262, "plasmid"},
-{2263, "plasmid"},
-{2264, "plasmid"},
-{2265, "plasmid"},
-{2266, "plasmid"},
-{2267, "plasmid"},
-{2268, "plasmid"},
-{2269, "plasmid"},
-{2270, "plasmid"},
-{2271, "plasmid"},
-{2272, "plasmid"},
-{2273, "likely IS/TE"},
-{2274, "plasmid"},
-{2275, "plasmid"},
-{2276, "plasmid"},
-{2277, "plasmid"},
-{2278, "plasmid"},
-{2279, "plasmid"},
-{2280, "plasmid"},
-{2281, "plasmid"},
-{2282, "plasmid"},
-{2283, "plasmid"},
-{2284, "plasmid"},
-{2285, "plasmid"},
-{2286, "plasmid"},
-{2287, "plasmid"},
-{2288, "plasmid"},
-{2289, "plasmid"},
-{2290, "plasmid"},
-{2291, "plasmid"},
-{2292, "plasmid"},
-{2293, "plasmid"},
-{2294, "plasmid"},
-{2295, "plasmid"},
-{2296, "plasmid"},
-{2297, "plasmid"},
-{2298, "plasmid"},
-{2299, "plasmid"},
-{2300, "plasmid"},
-{2301, "plasmid"},
-{2302, "plasmid"},
-{2303, "plasmid"},
-{2304, "plasmid"},
-{2305, "plasmid"},
-{2306, "plasmid"},
-{2307, "plasmid"},
-{2308, "plasmid"},
-{2309, "plasmid"},
-{2310, "plasmid"},
-{2311, "plasmid"},
-{2312, "plasmid"},
-{2313, "plasmid"},
-{2314, "plasmid"},
-{2315, "plasmid"},
-{2316, "plasmid"},
-{2317, "plasmid"},
-{2318, "plasmid"},
-{2319, "plasmid"},
-{2320, "plasmid"},
-{2321, "plasmid"},
-{2322, "likely IS/TE"},
-{2323, "plasmid"},
-{2324, "plasmid"},
-{2325, "plasmid"},
-{2326, "plasmid"},
-{2327, "plasmid"},
-{2328, "plasmid"},
-{2329, "plasmid"},
-{2330, "plasmid"},
-{2331, "plasmid"},
-{2332, "plasmid"},
-{2333, "plasmid"},
-{2334, "plasmid"},
-{2335, "likely IS/TE"},
-{2336, "plasmid"},
-{2337, "plasmid"},
-{2338, "plasmid"},
-{2339, "plasmid"},
-{2340, "plasmid"},
-{2341, "plasmid"},
-{2342, "plasmid"},
-{2343, "likely IS/TE"},
-{2344, "likely IS/TE"},
-{2345, "plasmid"},
-{2346, "plasmid"},
-{2347, "plasmid"},
-{2348, "plasmid"},
-{2349, "plasmid"},
-{2350, "plasmid"},
-{2351, "plasmid"},
-{2352, "plasmid"},
-{2353, "likely IS/TE"},
-{2354, "plasmid"},
-{2355, "plasmid"},
-{2356, "likely IS/TE"},
-{2357, "plasmid"},
-{2358, "plasmid"},
-{2359, "plasmid"},
-{2360, "plasmid"},
-{2361, "plasmid"},
-{2362, "plasmid"},
-{2363, "plasmid"},
-{2364, "plasmid"},
-{2365, "plasmid"},
-{2366, "plasmid"},
-{2367, "plasmid"},
-{2368, "plasmid"},
-{2369, "plasmid"},
-{2370, "plasmid"},
-{2371, "plasmid"},
-{2372, "plasmid"},
-{2373, "plasmid"},
-{2374, "plasmid"},
-{2375, "plasmid"},
-{2376, "plasmid"},
-{2377, "plasmid"},
-{2378, "plasmid"},
-{2379, "plasmid"},
-{2380, "plasmid"},
-{2381, "plasmid"},
-{2382, "plasmid"},
-{2383, "plasmid"},
-{2384, "plasmid"},
-{2385, "plasmid"},
-{2386, "plasmid"},
-{2387, "plasmid"},
-{2388, "plasmid"},
-{2389, "plasmid"},
-{2390, "plasmid"},
-{2391, "plasmid"},
-{2392, "plasmid"},
-{2393, "plasmid"},
-{2394, "plasmid"},
-{2395, "plasmid"},
-{2396, "plasmid"},
-{2397, "plasmid"},
-{2398, "plasmid"},
-{2399, "plasmid"},
-{2400, "plasmid"},
-{2401, "plasmid"},
-{2402, "plasmid"},
-{2403, "plasmid"},
-{2404, "plasmid"},
-{2405, "plasmid"},
-{2406, "plasmid"},
-{2407, "plasmid"},
-{2408, "plasmid"},
-{2409, "plasmid"},
-{2410, "plasmid"},
-{2411, "plasmid"},
-{2412, "plasmid"},
-{2413, "plasmid"},
-{2414, "plasmid"},
-{2415, "plasmid"},
-{2416, "plasmid"},
-{2417, "plasmid"},
-{2418, "plasmid"},
-{2419, "likely IS/TE"},
-{2420, "plasmid"},
-{2421, "plasmid"},
-{2422, "plasmid"},
-{2423, "plasmid"},
-{2424, "plasmid"},
-{2425, "plasmid"},
-{2426, "plasmid"},
-{2427, "plasmid"},
-{2428, "plasmid"},
-{2429, "plasmid"},
-{2430, "plasmid"},
-{2431, "plasmid"},
-{2432, "plasmid"},
-{2433, "plasmid"},
-{2434, "plasmid"},
-{2435, "plasmid"},
-{2436, "plasmid"},
-{2437, "plasmid"},
-{2438, "plasmid"},
-{2439, "plasmid"},
-{2440, "prophage"},
-{2441, "prophage"},
-{2442, "prophage"},
-{2443, "prophage"},
-{2444, "prophage"},
-{2445, "likely IS/TE"},
-{2446, "prophage"},
-{2447, "prophage"},
-{2448, "prophage"},
-{2449, "prophage"},
-{2450, "prophage"},
-{2451, "prophage"},
-{2452, "prophage"},
-{2453, "prophage"},
-{2454, "prophage"},
-{2455, "prophage"},
-{2456, "likely IS/TE"},
-{2457, "prophage"},
-{2458, "prophage"},
-{2459, "prophage"},
-{2460, "prophage"},
-{2461, "prophage"},
-{2462, "prophage"},
-{2463, "prophage"},
-{2464, "prophage"},
-{2465, "prophage"},
-{2466, "prophage"},
-{2467, "prophage"},
-{2468, "prophage"},
-{2469, "prophage"},
-{2470, "prophage"},
-{2471, "prophage"},
-{2472, "prophage"},
-{2473, "prophage"},
-{2474, "prophage"},
-{2475, "prophage"},
-{2476, "prophage"},
-{2477, "prophage"},
-{2478, "prophage"},
-{2479, "prophage"},
-{2480, "prophage"},
-{2481, "prophage"},
-{2482, "prophage"},
-{2483, "prophage"},
-{2484, "prophage"},
-{2485, "prophage"},
-{2486, "prophage"},
-{2487, "prophage"},
-{2488, "prophage"},
-{2489, "prophage"},
-{2490, "prophage"},
-{2491, "prophage"},
-{2492, "prophage"},
-{2493, "prophage"},
-{2494, "prophage"},
-{2495, "prophage"},
-{2496, "prophage"},
-{2497, "prophage"},
-{2498, "prophage"},
-{2499, "prophage"},
-{2500, "prophage"},
-{2501, "prophage"},
-{2502, "prophage"},
-{2503, "prophage"},
-{2504, "prophage"},
-{2505, "prophage"},
-{2506, "prophage"},
-{2507, "prophage"},
-{2508, "prophage"},
-{2509, "prophage"},
-{2510, "prophage"},
-{2511, "prophage"},
-{2512, "prophage"},
-{2513, "prophage"},
-{2514, "prophage"},
-{2515, "prophage"},
-{2516, "prophage"},
-{2517, "prophage"},
-{2518, "prophage"},
-{2519, "prophage"},
-{2520, "prophage"},
-{2521, "prophage"},
-{2522, "prophage"},
-{2523, "prophage"},
-{2524, "prophage"},
-{2525, "prophage"},
-{2526, "prophage"},
-{2527, "prophage"},
-{2528, "prophage"},
-{2529, "prophage"},
-{2530, "prophage"},
-{2531, "prophage"},
-{2532, "prophage"},
-{2533, "prophage"},
-{2534, "prophage"},
-{2535, "prophage"},
-{2536, "prophage"},
-{2537, "prophage"},
-{2538, "prophage"},
-{2539, "prophage"},
-{2540, "prophage"},
-{2541, "prophage"},
-{2542, "prophage"},
-{2543, "prophage"},
-{2544, "prophage"},
-{2545, "prophage"},
-{2546, "prophage"},
-{2547, "prophage"},
-{2548, "prophage"},
-{2549, "prophage"},
-{2550, "prophage"},
-{2551, "prophage"},
-{2552, "prophage"},
-{2553, "prophage"},
-{2554, "prophage"},
-{2555, "prophage"},
-{2556, "prophage"},
-{2557, "likely IS/TE"},
-{2558, "prophage"},
-{2559, "prophage"},
-{2560, "prophage"},
-{2561, "prophage"},
-{2562, "prophage"},
-{2563, "prophage"},
-{2564, "prophage"},
-{2565, "prophage"},
-{2566, "prophage"},
-{2567, "prophage"},
-{2568, "prophage"},
-{2569, "likely IS/TE"},
-{2570, "prophage"},
-{2571, "prophage"},
-{2572, "prophage"},
-{2573, "prophage"},
-{2574, "prophage"},
-{2575, "prophage"},
-{2576, "prophage"},
-{2577, "prophage"},
-{2578, "prophage"},
-{2579, "prophage"},
-{2580, "prophage"},
-{2581, "prophage"},
-{2582, "prophage"},
-{2583, "prophage"},
-{2584, "prophage"},
-{2585, "prophage"},
-{2586, "prophage"},
-{2587, "prophage"},
-{2588, "prophage"},
-{2589, "prophage"},
-{2590, "prophage"},
-{2591, "prophage"},
-{2592, "prophage"},
-{2593, "prophage"},
-{2594, "prophage"},
-{2595, "prophage"},
-{2596, "prophage"},
-{2597, "prophage"},
-{2598, "prophage"},
-{2599, "prophage"},
-{2600, "prophage"},
-{2601, "prophage"},
-{2602, "prophage"},
-{2603, "prophage"},
-{2604, "prophage"},
-{2605, "prophage"},
-{2606, "prophage"},
-{2607, "prophage"},
-{2608, "prophage"},
-{2609, "likely IS/TE"},
-{2610, "prophage"},
-{2611, "prophage"},
-{2612, "prophage"},
-{2613, "prophage"},
-{2614, "prophage"},
-{2615, "likely IS/TE"},
-{2616, "prophage"},
-{2617, "likely IS/TE"},
-{2618, "prophage"},
-{2619, "likely IS/TE"},
-{2620, "likely IS/TE"},
-{2621, "prophage"},
-{2622, "prophage"},
-{2623, "prophage"},
-{2624, "prophage"},
-{2625, "prophage"},
-{2626, "prophage"},
-{2627, "prophage"},
-{2628, "prophage"},
-{2629, "prophage"},
-{2630, "prophage"},
-{2631, "prophage"},
-{2632, "prophage"},
-{2633, "prophage"},
-{2634, "prophage"},
-{2635, "prophage"},
-{2636, "prophage"},
-{2637, "prophage"},
-{2638, "prophage"},
-{2639, "likely IS/TE"},
-{2640, "prophage"},
-{2641, "prophage"},
-{2642, "prophage"},
-{2643, "prophage"},
-{2644, "prophage"},
-{2645, "prophage"},
-{2646, "prophage"},
-{2647, "prophage"},
-{2648, "prophage"},
-{2649, "prophage"},
-{2650, "prophage"},
-{2651, "prophage"},
-{2652, "prophage"},
-{2653, "prophage"},
-{2654, "prophage"},
-{2655, "prophage"},
-{2656, "prophage"},
-{2657, "prophage"},
-{2658, "prophage"},
-{2659, "prophage"},
-{2660, "prophage"},
-{2661, "prophage"},
-{2662, "prophage"},
-{2663, "prophage"},
-{2664, "prophage"},
-{2665, "prophage"},
-{2666, "prophage"},
-{2667, "prophage"},
-{2668, "prophage"},
-{2669, "prophage"},
-{2670, "prophage"},
-{2671, "prophage"},
-{2672, "prophage"},
-{2673, "prophage"},
-{2674, "prophage"},
-{2675, "prophage"},
-{2676, "prophage"},
-{2677, "prophage"},
-{2678, "prophage"},
-{2679, "prophage"},
-{2680, "prophage"},
-{2681, "prophage"},
-{2682, "prophage"},
-{2683, "prophage"},
-{2684, "prophage"},
-{2685, "prophage"},
-{2686, "prophage"},
-{2687, "prophage"},
-{2688, "prophage"},
-{2689, "likely IS/TE"},
-{2690, "likely IS/TE"},
-{2691, "prophage"},
-{2692, "prophage"},
-{2693, "prophage"},
-{2694, "prophage"},
-{2695, "prophage"},
-{2696, "prophage"},
-{2697, "likely IS/TE"},
-{2698, "prophage"},
-{2699, "prophage"},
-{2700, "prophage"},
-{2701, "prophage"},
-{2702, "prophage"},
-{2703, "likely IS/TE"},
-{2704, "likely IS/TE"},
-{2705, "prophage"},
-{2706, "prophage"},
-{2707, "prophage"},
-{2708, "prophage"},
-{2709, "likely IS/TE"},
-{2710, "prophage"},
-{2711, "prophage"},
-{2712, "prophage"},
-{2713, "prophage"},
-{2714, "prophage"},
-{2715, "prophage"},
-{2716, "prophage"},
-{2717, "prophage"},
-{2718, "prophage"},
-{2719, "prophage"},
-{2720, "prophage"},
-{2721, "prophage"},
-{2722, "prophage"},
-{2723, "prophage"},
-{2724, "prophage"},
-{2725, "prophage"},
-{2726, "prophage"},
-{2727, "prophage"},
-{2728, "prophage"},
-{2729, "prophage"},
-{2730, "prophage"},
-{2731, "prophage"},
-{2732, "prophage"},
-{2733, "prophage"},
-{2734, "prophage"},
-{2735, "prophage"},
-{2736, "prophage"},
-{2737, "prophage"},
-{2738, "prophage"},
-{2739, "prophage"},
-{2740, "prophage"},
-{2741, "prophage"},
-{2742, "prophage"},
-{2743, "prophage"},
-{2744, "prophage"},
-{2745, "prophage"},
-{2746, "prophage"},
-{2747, "prophage"},
-{2748, "prophage"},
-{2749, "prophage"},
-{2750, "prophage"},
-{2751, "prophage"},
-{2752, "prophage"},
-{2753, "prophage"},
-{2754, "prophage"},
-{2755, "prophage"},
-{2756, "prophage"},
-{2757, "prophage"},
-{2758, "prophage"},
-{2759, "prophage"},
-{2760, "prophage"},
-{2761, "prophage"},
-{2762, "prophage"},
-{2763, "prophage"},
-{2764, "prophage"},
-{2765, "prophage"},
-{2766, "prophage"},
-{2767, "prophage"},
-{2768, "prophage"},
-{2769, "prophage"},
-{2770, "prophage"},
-{2771, "prophage"},
-{2772, "prophage"},
-{2773, "prophage"},
-{2774, "prophage"},
-{2775, "prophage"},
-{2776, "prophage"},
-{2777, "prophage"},
-{2778, "prophage"},
-{2779, "prophage"},
-{2780, "prophage"},
-{2781, "prophage"},
-{2782, "prophage"},
-{2783, "prophage"},
-{2784, "prophage"},
-{2785, "prophage"},
-{2786, "prophage"},
-{2787, "prophage"},
-{2788, "prophage"},
-{2789, "prophage"},
-{2790, "prophage"},
-{2791, "prophage"},
-{2792, "prophage"},
-{2793, "prophage"},
-{2794, "prophage"},
-{2795, "prophage"},
-{2796, "prophage"},
-{2797, "prophage"},
-{2798, "prophage"},
-{2799, "prophage"},
-{2800, "prophage"},
-{2801, "prophage"},
-{2802, "prophage"},
-{2803, "prophage"},
-{2804, "prophage"},
-{2805, "prophage"},
-{2806, "prophage"},
-{2807, "prophage"},
-{2808, "prophage"},
-{2809, "prophage"},
-{2810, "prophage"},
-{2811, "prophage"},
-{2812, "prophage"},
-{2813, "prophage"},
-{2814, "prophage"},
-{2815, "prophage"},
-{2816, "prophage"},
-{2817, "prophage"},
-{2818, "prophage"},
-{2819, "prophage"},
-{2820, "prophage"},
-{2821, "prophage"},
-{2822, "prophage"},
-{2823, "prophage"},
-{2824, "prophage"},
-{2825, "prophage"},
-{2826, "prophage"},
-{2827, "prophage"},
-{2828, "prophage"},
-{2829, "prophage"},
-{2830, "prophage"},
-{2831, "prophage"},
-{2832, "prophage"},
-{2833, "prophage"},
-{2834, "prophage"},
-{2835, "prophage"},
-{2836, "prophage"},
-{2837, "prophage"},
-{2838, "prophage"},
-{2839, "prophage"},
-{2840, "prophage"},
-{2841, "prophage"},
-{2842, "prophage"},
-{2843, "prophage"},
-{2844, "prophage"},
-{2845, "prophage"},
-{2846, "prophage"},
-{2847, "prophage"},
-{2848, "prophage"},
-{2849, "prophage"},
-{2850, "prophage"},
-{2851, "prophage"},
-{2852, "prophage"},
-{2853, "prophage"},
-{2854, "prophage"},
-{2855, "prophage"},
-{2856, "prophage"},
-{2857, "prophage"},
-{2858, "prophage"},
-{2859, "prophage"},
-{2860, "prophage"},
-{2861, "prophage"},
-{2862, "prophage"},
-{2863, "prophage"},
-{2864, "prophage"},
-{2865, "prophage"},
-{2866, "prophage"},
-{2867, "prophage"},
-{2868, "prophage"},
-{2869, "prophage"},
-{2870, "prophage"},
-{2871, "prophage"},
-{2872, "prophage"},
-{2873, "prophage"},
-{2874, "prophage"},
-{2875, "prophage"},
-{2876, "prophage"},
-{2877, "prophage"},
-{2878, "prophage"},
-{2879, "prophage"},
-{2880, "prophage"},
-{2881, "prophage"},
-{2882, "prophage"},
-{2883, "prophage"},
-{2884, "prophage"},
-{2885, "prophage"},
-{2886, "prophage"},
-{2887, "prophage"},
-{2888, "prophage"},
-{2889, "prophage"},
-{2890, "prophage"},
-{2891, "prophage"},
-{2892, "prophage"},
-{2893, "prophage"},
-{2894, "prophage"},
-{2895, "prophage"},
-{2896, "prophage"},
-{2897, "prophage"},
-{2898, "prophage"},
-{2899, "prophage"},
-{2900, "prophage"},
-{2901, "prophage"},
-{2902, "prophage"},
-{2903, "prophage"},
-{2904, "prophage"},
-{2905, "prophage"},
-{2906, "prophage"},
-{2907, "prophage"},
-{2908, "prophage"},
-{2909, "prophage"},
-{2910, "prophage"},
-{2911, "prophage"},
-{2912, "prophage"},
-{2913, "prophage"},
-{2914, "prophage"},
-{2915, "prophage"},
-{2916, "prophage"},
-{2917, "prophage"},
-{2918, "prophage"},
-{2919, "prophage"},
-{2920, "prophage"},
-{2921, "prophage"},
-{2922, "prophage"},
-{2923, "prophage"},
-{2924, "prophage"},
-{2925, "prophage"},
-{2926, "prophage"},
-{2927, "prophage"},
-{2928, "prophage"},
-{2929, "prophage"},
-{2930, "prophage"},
-{2931, "prophage"},
-{2932, "prophage"},
-{2933, "prophage"},
-{2934, "prophage"},
-{2935, "prophage"},
-{2936, "prophage"},
-{2937, "prophage"},
-{2938, "prophage"},
-{2939, "prophage"},
-{2940, "prophage"},
-{2941, "prophage"},
-{2942, "prophage"},
-{2943, "prophage"},
-{2944, "prophage"},
-{2945, "prophage"},
-{2946, "prophage"},
-{2947, "prophage"},
-{2948, "prophage"},
-{2949, "prophage"},
-{2950, "prophage"},
-{2951, "prophage"},
-{2952, "prophage"},
-{2953, "prophage"},
-{2954, "prophage"},
-{2955, "prophage"},
-{2956, "prophage"},
-{2957, "prophage"},
-{2958, "prophage"},
-{2959, "prophage"},
-{2960, "prophage"},
-{2961, "prophage"},
-{2962, "prophage"},
-{2963, "prophage"},
-{2964, "prophage"},
-{2965, "prophage"},
-{2966, "prophage"},
-{2967, "prophage"},
-{2968, "prophage"},
-{2969, "prophage"},
-{2970, "prophage"},
-{2971, "prophage"},
-{2972, "prophage"},
-{2973, "prophage"},
-{2974, "prophage"},
-{2975, "prophage"},
-{2976, "prophage"},
-{2977, "prophage"},
-{2978, "prophage"},
-{2979, "likely IS/TE"},
-{2980, "prophage"},
-{2981, "prophage"},
-{2982, "prophage"},
-{2983, "prophage"},
-{2984, "prophage"},
-{2985, "prophage"},
-{2986, "prophage"},
-{2987, "prophage"},
-{2988, "prophage"},
-{2989, "prophage"},
-{2990, "prophage"},
-{2991, "prophage"},
-{2992, "prophage"},
-{2993, "prophage"},
-{2994, "prophage"},
-{2995, "prophage"},
-{2996, "prophage"},
-{2997, "prophage"},
-{2998, "prophage"},
-{2999, "prophage"},
-{3000, "prophage"},
-{3001, "prophage"},
-{3002, "prophage"},
-{3003, "prophage"},
-{3004, "prophage"},
-{3005, "prophage"},
-{3006, "prophage"},
-{3007, "prophage"},
-{3008, "prophage"},
-{3009, "prophage"},
-{3010, "prophage"},
-{3011, "prophage"},
-{3012, "prophage"},
-{3013, "prophage"},
-{3014, "prophage"},
-{3015, "prophage"},
-{3016, "prophage"},
-{3017, "prophage"},
-{3018, "prophage"},
-{3019, "prophage"},
-{3020, "prophage"},
-{3021, "prophage"},
-{3022, "prophage"},
-{3023, "prophage"},
-{3024, "prophage"},
-{3025, "prophage"},
-{3026, "prophage"},
-{3027, "prophage"},
-{3028, "prophage"},
-{3029, "prophage"},
-{3030, "prophage"},
-{3031, "prophage"},
-{3032, "prophage"},
-{3033, "prophage"},
-{3034, "prophage"},
-{3035, "prophage"},
-{3036, "prophage"},
-{3037, "prophage"},
-{3038, "prophage"},
-{3039, "prophage"},
-{3040, "prophage"},
-{3041, "prophage"},
-{3042, "prophage"},
-{3043, "prophage"},
-{3044, "prophage"},
-{3045, "prophage"},
-{3046, "prophage"},
-{3047, "prophage"},
-{3048, "prophage"},
-{3049, "prophage"},
-{3050, "prophage"},
-{3051, "prophage"},
-{3052, "prophage"},
-{3053, "prophage"},
-{3054, "prophage"},
-{3055, "prophage"},
-{3056, "prophage"},
-{3057, "prophage"},
-{3058, "prophage"},
-{3059, "prophage"},
-{3060, "prophage"},
-{3061, "prophage"},
-{3062, "prophage"},
-{3063, "prophage"},
-{3064, "prophage"},
-{3065, "prophage"},
-{3066, "prophage"},
-{3067, "prophage"},
-{3068, "prophage"},
-{3069, "prophage"},
-{3070, "prophage"},
-{3071, "prophage"},
-{3072, "prophage"},
-{3073, "prophage"},
-{3074, "prophage"},
-{3075, "prophage"},
-{3076, "prophage"},
-{3077, "prophage"},
-{3078, "prophage"},
-{3079, "prophage"},
-{3080, "prophage"},
-{3081, "prophage"},
-{3082, "prophage"},
-{3083, "prophage"},
-{3084, "prophage"},
-{3085, "prophage"},
-{3086, "prophage"},
-{3087, "prophage"},
-{3088, "prophage"},
-{3089, "prophage"},
-{3090, "prophage"},
-{3091, "prophage"},
-{3092, "prophage"},
-{3093, "prophage"},
-{3094, "prophage"},
-{3095, "prophage"},
-{3096, "prophage"},
-{3097, "prophage"},
-{3098, "prophage"},
-{3099, "prophage"},
-{3100, "prophage"},
-{3101, "prophage"},
-{3102, "prophage"},
-{3103, "prophage"},
-{3104, "prophage"},
-{3105, "prophage"},
-{3106, "prophage"},
-{3107, "prophage"},
-{3108, "prophage"},
-{3109, "prophage"},
-{3110, "prophage"},
-{3111, "prophage"},
-{3112, "prophage"},
-{3113, "prophage"},
-{3114, "prophage"},
-{3115, "prophage"},
-{3116, "prophage"},
-{3117, "prophage"},
-{3118, "prophage"},
-{3119, "prophage"},
-{3120, "prophage"},
-{3121, "prophage"},
-{3122, "prophage"},
-{3123, "prophage"},
-{3124, "prophage"},
-{3125, "prophage"},
-{3126, "prophage"},
-{3127, "prophage"},
-{3128, "prophage"},
-{3129, "prophage"},
-{3130, "prophage"},
-{3131, "prophage"},
-{3132, "prophage"},
-{3133, "prophage"},
-{3134, "prophage"},
-{3135, "prophage"},
-{3136, "prophage"},
-{3137, "prophage"},
-{3138, "prophage"},
-{3139, "prophage"},
-{3140, "prophage"},
-{3141, "prophage"},
-{3142, "prophage"},
-{3143, "prophage"},
-{3144, "prophage"},
-{3145, "prophage"},
-{3146, "prophage"},
-{3147, "prophage"},
-{3148, "prophage"},
-{3149, "prophage"},
-{3150, "prophage"},
-{3151, "prophage"},
-{3152, "prophage"},
-{3153, "prophage"},
-{3154, "prophage"},
-{3155, "prophage"},
-{3156, "prophage"},
-{3157, "prophage"},
-{3158, "prophage"},
-{3159, "prophage"},
-{3160, "prophage"},
-{3161, "prophage"},
-{3162, "prophage"},
-{3163, "prophage"},
-{3164, "prophage"},
-{3165, "prophage"},
-{3166, "prophage"},
-{3167, "prophage"},
-{3168, "prophage"},
-{3169, "prophage"},
-{3170, "prophage"},
-{3171, "prophage"},
-{3172, "prophage"},
-{3173, "prophage"},
-{3174, "prophage"},
-{3175, "prophage"},
-{3176, "prophage"},
-{3177, "prophage"},
-{3178, "prophage"},
-{3179, "prophage"},
-{3180, "prophage"},
-{3181, "prophage"},
-{3182, "prophage"},
-{3183, "prophage"},
-{3184, "prophage"},
-{3185, "prophage"},
-{3186, "prophage"},
-{3187, "prophage"},
-{3188, "prophage"},
-{3189, "prophage"},
-{3190, "prophage"},
-{3191, "prophage"},
-{3192, "prophage"},
-{3193, "prophage"},
-{3194, "prophage"},
-{3195, "prophage"},
-{3196, "prophage"},
-{3197, "prophage"},
-{3198, "prophage"},
-{3199, "prophage"},
-{3200, "prophage"},
-{3201, "prophage"},
-{3202, "prophage"},
-{3203, "prophage"},
-{3204, "prophage"},
-{3205, "prophage"},
-{3206, "prophage"},
-{3207, "prophage"},
-{3208, "prophage"},
-{3209, "prophage"},
-{3210, "prophage"},
-{3211, "prophage"},
-{3212, "prophage"},
-{3213, "prophage"},
-{3214, "prophage"},
-{3215, "prophage"},
-{3216, "prophage"},
-{3217, "prophage"},
-{3218, "prophage"},
-{3219, "prophage"},
-{3220, "prophage"},
-{3221, "prophage"},
-{3222, "prophage"},
-{3223, "prophage"},
-{3224, "prophage"},
-{3225, "prophage"},
-{3226, "prophage"},
-{3227, "prophage"},
-{3228, "prophage"},
-{3229, "prophage"},
-{3230, "prophage"},
-{3231, "prophage"},
-{3232, "prophage"},
-{3233, "prophage"},
-{3234, "prophage"},
-{3235, "prophage"},
-{3236, "prophage"},
-{3237, "prophage"},
-{3238, "prophage"},
-{3239, "prophage"},
-{3240, "prophage"},
-{3241, "prophage"},
-{3242, "prophage"},
-{3243, "prophage"},
-{3244, "prophage"},
-{3245, "prophage"},
-{3246, "prophage"},
-{3247, "prophage"},
-{3248, "prophage"},
-{3249, "prophage"},
-{3250, "prophage"},
-{3251, "prophage"},
-{3252, "prophage"},
-{3253, "prophage"},
-{3254, "prophage"},
-{3255, "prophage"},
-{3256, "prophage"},
-{3257, "prophage"},
-{3258, "prophage"},
-{3259, "prophage"},
-{3260, "prophage"},
-{3261, "prophage"},
-{3262, "prophage"},
-{3263, "prophage"},
-{3264, "prophage"},
-{3265, "prophage"},
-{3266, "prophage"},
-{3267, "prophage"},
-{3268, "prophage"},
-{3269, "prophage"},
-{3270, "prophage"},
-{3271, "prophage"},
-{3272, "prophage"},
-{3273, "prophage"},
-{3274, "prophage"},
-{3275, "prophage"},
-{3276, "prophage"},
-{3277, "prophage"},
-{3278, "prophage"},
-{3279, "prophage"},
-{3280, "prophage"},
-{3281, "prophage"},
-{3282, "prophage"},
-{3283, "prophage"},
-{3284, "prophage"},
-{3285, "prophage"},
-{3286, "prophage"},
-{3287, "prophage"},
-{3288, "prophage"},
-{3289, "prophage"},
-{3290, "prophage"},
-{3291, "prophage"},
-{3292, "prophage"},
-{3293, "prophage"},
-{3294, "prophage"},
-{3295, "prophage"},
-{3296, "prophage"},
-{3297, "prophage"},
-{3298, "prophage"},
-{3299, "prophage"},
-{3300, "prophage"},
-{3301, "prophage"},
-{3302, "prophage"},
-{3303, "prophage"},
-{3304, "prophage"},
-{3305, "prophage"},
-{3306, "prophage"},
-{3307, "prophage"},
-{3308, "prophage"},
-{3309, "prophage"},
-{3310, "prophage"},
-{3311, "prophage"},
-{3312, "prophage"},
-{3313, "prophage"},
-{3314, "prophage"},
-{3315, "prophage"},
-{3316, "prophage"},
-{3317, "prophage"},
-{3318, "prophage"},
-{3319, "prophage"},
-{3320, "prophage"},
-{3321, "prophage"},
-{3322, "prophage"},
-{3323, "prophage"},
-{3324, "prophage"},
-{3325, "prophage"},
-{3326, "prophage"},
-{3327, "prophage"},
-{3328, "prophage"},
-{3329, "prophage"},
-{3330, "prophage"},
-{3331, "prophage"},
-{3332, "prophage"},
-{3333, "prophage"},
-{3334, "prophage"},
-{3335, "prophage"},
-{3336, "prophage"},
-{3337, "prophage"},
-{3338, "prophage"},
-{3339, "prophage"},
-{3340, "prophage"},
-{3341, "prophage"},
-{3342, "prophage"},
-{3343, "prophage"},
-{3344, "prophage"},
-{3345, "prophage"},
-{3346, "prophage"},
-{3347, "prophage"},
-{3348, "prophage"},
-{3349, "prophage"},
-{3350, "prophage"},
-{3351, "prophage"},
-{3352, "prophage"},
-{3353, "prophage"},
-{3354, "prophage"},
-{3355, "prophage"},
-{3356, "prophage"},
-{3357, "prophage"},
-{3358, "prophage"},
-{3359, "prophage"},
-{3360, "prophage"},
-{3361, "prophage"},
-{3362, "prophage"},
-{3363, "prophage"},
-{3364, "prophage"},
-{3365, "prophage"},
-{3366, "prophage"},
-{3367, "prophage"},
-{3368, "prophage"},
-{3369, "prophage"},
-{3370, "prophage"},
-{3371, "prophage"},
-{3372, "prophage"},
-{3373, "prophage"},
-{3374, "prophage"},
-{3375, "prophage"},
-{3376, "prophage"},
-{3377, "prophage"},
-{3378, "prophage"},
-{3379, "prophage"},
-{3380, "prophage"},
-{3381, "prophage"},
-{3382, "prophage"},
-{3383, "prophage"},
-{3384, "prophage"},
-{3385, "prophage"},
-{3386, "prophage"},
-{3387, "prophage"},
-{3388, "prophage"},
-{3389, "prophage"},
-{3390, "prophage"},
-{3391, "prophage"},
-{3392, "prophage"},
-{3393, "prophage"},
-{3394, "prophage"},
-{3395, "prophage"},
-{3396, "prophage"},
-{3397, "prophage"},
-{3398, "prophage"},
-{3399, "prophage"},
-{3400, "prophage"},
-{3401, "prophage"},
-{3402, "prophage"},
-{3403, "prophage"},
-{3404, "prophage"},
-{3405, "prophage"},
-{3406, "prophage"},
-{3407, "prophage"},
-{3408, "prophage"},
-{3409, "prophage"},
-{3410, "prophage"},
-{3411, "prophage"},
-{3412, "prophage"},
-{3413, "prophage"},
-{3414, "prophage"},
-{3415, "prophage"},
-{3416, "prophage"},
-{3417, "prophage"},
-{3418, "prophage"},
-{3419, "prophage"},
-{3420, "prophage"},
-{3421, "prophage"},
-{3422, "prophage"},
-{3423, "prophage"},
-{3424, "prophage"},
-{3425, "prophage"},
-{3426, "prophage"},
-{3427, "prophage"},
-{3428, "prophage"},
-{3429, "prophage"},
-{3430, "prophage"},
-{3431, "prophage"},
-{3432, "prophage"},
-{3433, "prophage"},
-{3434, "prophage"},
-{3435, "prophage"},
-{3436, "prophage"},
-{3437, "prophage"},
-{3438, "prophage"},
-{3439, "prophage"},
-{3440, "prophage"},
-{3441, "prophage"},
-{3442, "prophage"},
-{3443, "prophage"},
-{3444, "prophage"},
-{3445, "prophage"},
-{3446, "prophage"},
-{3447, "prophage"},
-{3448, "prophage"},
-{3449, "prophage"},
-{3450, "prophage"},
-{3451, "prophage"},
-{3452, "prophage"},
-{3453, "prophage"},
-{3454, "prophage"},
-{3455, "prophage"},
-{3456, "prophage"},
-{3457, "prophage"},
-{3458, "prophage"},
-{3459, "prophage"},
-{3460, "prophage"},
-{3461, "prophage"},
-{3462, "prophage"},
-{3463, "prophage"},
-{3464, "prophage"},
-{3465, "prophage"},
-{3466, "prophage"},
-{3467, "prophage"},
-{3468, "prophage"},
-{3469, "prophage"},
-{3470, "prophage"},
-{3471, "prophage"},
-{3472, "prophage"},
-{3473, "prophage"},
-{3474, "prophage"},
-{3475, "prophage"},
-{3476, "prophage"},
-{3477, "prophage"},
-{3478, "prophage"},
-{3479, "prophage"},
-{3480, "prophage"},
-{3481, "prophage"},
-{3482, "prophage"},
-{3483, "prophage"},
-{3484, "prophage"},
-{3485, "prophage"},
-{3486, "prophage"},
-{3487, "prophage"},
-{3488, "prophage"},
-{3489, "prophage"},
-{3490, "prophage"},
-{3491, "prophage"},
-{3492, "prophage"},
-{3493, "prophage"},
-{3494, "prophage"},
-{3495, "prophage"},
-{3496, "prophage"},
-{3497, "prophage"},
-{3498, "prophage"},
-{3499, "prophage"},
-{3500, "prophage"},
-{3501, "prophage"},
-{3502, "prophage"},
-{3503, "prophage"},
-{3504, "prophage"},
-{3505, "prophage"},
-{3506, "prophage"},
-{3507, "prophage"},
-{3508, "prophage"},
-{3509, "prophage"},
-{3510, "prophage"},
-{3511, "prophage"},
-{3512, "prophage"},
-{3513, "prophage"},
-{3514, "prophage"},
-{3515, "prophage"},
-{3516, "prophage"},
-{3517, "prophage"},
-{3518, "prophage"},
-{3519, "prophage"},
-{3520, "prophage"},
-{3521, "prophage"},
-{3522, "prophage"},
-{3523, "prophage"},
-{3524, "prophage"},
-{3525, "prophage"},
-{3526, "prophage"},
-{3527, "prophage"},
-{3528, "prophage"},
-{3529, "prophage"},
-{3530, "prophage"},
-{3531, "prophage"},
-{3532, "prophage"},
-{3533, "prophage"},
-{3534, "prophage"},
-{3535, "prophage"},
-{3536, "prophage"},
-{3537, "prophage"},
-{3538, "prophage"},
-{3539, "prophage"},
-{3540, "prophage"},
-{3541, "prophage"},
-{3542, "prophage"},
-{3543, "prophage"},
-{3544, "prophage"},
-{3545, "prophage"},
-{3546, "prophage"},
-{3547, "prophage"},
-{3548, "prophage"},
-{3549, "prophage"},
-{3550, "prophage"},
-{3551, "prophage"},
-{3552, "prophage"},
-{3553, "prophage"},
-{3554, "prophage"},
-{3555, "prophage"},
-{3556, "prophage"},
-{3557, "prophage"},
-{3558, "prophage"},
-{3559, "prophage"},
-{3560, "prophage"},
-{3561, "prophage"},
-{3562, "prophage"},
-{3563, "prophage"},
-{3564, "prophage"},
-{3565, "prophage"},
-{3566, "prophage"},
-{3567, "prophage"},
-{3568, "prophage"},
-{3569, "prophage"},
-{3570, "prophage"},
-{3571, "prophage"},
-{3572, "prophage"},
-{3573, "prophage"},
-{3574, "prophage"},
-{3575, "prophage"},
-{3576, "prophage"},
-{3577, "prophage"},
-{3578, "prophage"},
-{3579, "prophage"},
-{3580, "prophage"},
-{3581, "prophage"},
-{3582, "prophage"},
-{3583, "prophage"},
-{3584, "prophage"},
-{3585, "prophage"},
-{3586, "prophage"},
-{3587, "prophage"},
-{3588, "prophage"},
-{3589, "prophage"},
-{3590, "prophage"},
-{3591, "prophage"},
-{3592, "prophage"},
-{3593, "prophage"},
-{3594, "prophage"},
-{3595, "prophage"},
-{3596, "prophage"},
-{3597, "prophage"},
-{3598, "prophage"},
-{3599, "prophage"},
-{3600, "prophage"},
-{3601, "prophage"},
-{3602, "prophage"},
-{3603, "prophage"},
-{3604, "prophage"},
-{3605, "prophage"},
-{3606, "prophage"},
-{3607, "prophage"},
-{3608, "prophage"},
-{3609, "prophage"},
-{3610, "prophage"},
-{3611, "prophage"},
-{3612, "prophage"},
-{3613, "prophage"},
-{3614, "prophage"},
-{3615, "prophage"},
-{3616, "prophage"},
-{3617, "prophage"},
-{3618, "prophage"},
-{3619, "prophage"},
-{3620, "prophage"},
-{3621, "prophage"},
-{3622, "prophage"},
-{3623, "prophage"},
-{3624, "prophage"},
-{3625, "prophage"},
-{3626, "prophage"},
-{3627, "prophage"},
-{3628, "prophage"},
-{3629, "virus"},
-{3630, "virus"},
-{3631, "virus"},
-{3632, "virus"},
-{3633, "virus"},
-{3634, "virus"},
-{3635, "virus"},
-{3636, "virus"},
-{3637, "virus"},
-{3638, "virus"},
-{3639, "virus"},
-{3640, "virus"},
-{3641, "virus"},
-{3642, "virus"},
-{3643, "virus"},
-{3644, "virus"},
-{3645, "virus"},
-{3646, "virus"},
-{3647, "virus"},
-{3648, "virus"},
-{3649, "virus"},
-{3650, "virus"},
-{3651, "virus"},
-{3652, "virus"},
-{3653, "virus"},
-{3654, "virus"},
-{3655, "virus"},
-{3656, "virus"},
-{3657, "virus"},
-{3658, "virus"},
-{3659, "virus"},
-{3660, "virus"},
-{3661, "virus"},
-{3662, "virus"},
-{3663, "virus"},
-{3664, "virus"},
-{3665, "virus"},
-{3666, "virus"},
-{3667, "virus"},
-{3668, "virus"},
-{3669, "virus"},
-{3670, "virus"},
-{3671, "virus"},
-{3672, "virus"},
-{3673, "virus"},
-{3674, "virus"},
-{3675, "virus"},
-{3676, "virus"},
-{3677, "virus"},
-{3678, "virus"},
-{3679, "virus"},
-{3680, "virus"},
-{3681, "virus"},
-{3682, "virus"},
-{3683, "virus"},
-{3684, "virus"},
-{3685, "virus"},
-{3686, "virus"},
-{3687, "virus"},
-{3688, "virus"},
-{3689, "virus"},
-{3690, "virus"},
-{3691, "virus"},
-{3692, "virus"},
-{3693, "virus"},
-{3694, "virus"},
-{3695, "virus"},
-{3696, "virus"},
-{3697, "virus"},
-{3698, "virus"},
-{3699, "virus"},
-{3700, "virus"},
-{3701, "virus"},
-{3702, "virus"},
-{3703, "virus"},
-{3704, "virus"},
-{3705, "virus"},
-{3706, "virus"},
-{3707, "virus"},
-{3708, "virus"},
-{3709, "virus"},
-{3710, "virus"},
-{3711, "virus"},
-{3712, "virus"},
-{3713, "virus"},
-{3714, "virus"},
-{3715, "virus"},
-{3716, "virus"},
-{3717, "virus"},
-{3718, "virus"},
-{3719, "virus"},
-{3720, "virus"},
-{3721, "virus"},
-{3722, "virus"},
-{3723, "virus"},
-{3724, "virus"},
-{3725, "virus"},
-{3726, "virus"},
-{3727, "virus"},
-{3728, "virus"},
-{3729, "virus"},
-{3730, "virus"},
-{3731, "virus"},
-{3732, "virus"},
-{3733, "virus"},
-{3734, "virus"},
-{3735, "virus"},
-{3736, "virus"},
-{3737, "virus"},
-{3738, "virus"},
-{3739, "virus"},
-{3740, "virus"},
-{3741, "virus"},
-{3742, "virus"},
-{3743, "virus"},
-{3744, "virus"},
-{3745, "virus"},
-{3746, "virus"},
-{3747, "virus"},
-{3748, "virus"},
-{3749, "virus"},
-{3750, "virus"},
-{3751, "virus"},
-{3752, "virus"},
-{3753, "virus"},
-{3754, "virus"},
-{3755, "virus"},
-{3756, "virus"},
-{3757, "virus"},
-{3758, "virus"},
-{3759, "virus"},
-{3760, "virus"},
-{3761, "virus"},
-{3762, "virus"},
-{3763, "virus"},
-{3764, "virus"},
-{3765, "virus"},
-{3766, "virus"},
-{3767, "virus"},
-{3768, "virus"},
-{3769, "virus"},
-{3770, "virus"},
-{3771, "virus"},
-{3772, "virus"},
-{3773, "virus"},
-{3774, "virus"},
-{3775, "virus"},
-{3776, "virus"},
-{3777, "virus"},
-{3778, "virus"},
-{3779, "virus"},
-{3780, "virus"},
-{3781, "virus"},
-{3782, "virus"},
-{3783, "virus"},
-{3784, "virus"},
-{3785, "virus"},
-{3786, "virus"},
-{3787, "virus"},
-{3788, "virus"},
-{3789, "virus"},
-{3790, "virus"},
-{3791, "virus"},
-{3792, "virus"},
-{3793, "virus"},
-{3794, "virus"},
-{3795, "virus"},
-{3796, "virus"},
-{3797, "virus"},
-{3798, "virus"},
-{3799, "virus"},
-{3800, "virus"},
-{3801, "virus"},
-{3802, "virus"},
-{3803, "virus"},
-{3804, "virus"},
-{3805, "virus"},
-{3806, "virus"},
-{3807, "virus"},
-{3808, "virus"},
-{3809, "virus"},
-{3810, "virus"},
-{3811, "virus"},
-{3812, "virus"},
-{3813, "virus"},
-{3814, "virus"},
-{3815, "virus"},
-{3816, "virus"},
-{3817, "virus"},
-{3818, "virus"},
-{3819, "virus"},
-{3820, "virus"},
-{3821, "virus"},
-{3822, "virus"},
-{3823, "virus"},
-{3824, "virus"},
-{3825, "virus"},
-{3826, "virus"},
-{3827, "virus"},
-{3828, "virus"},
-{3829, "virus"},
-{3830, "virus"},
-{3831, "virus"},
-{3832, "virus"},
-{3833, "virus"},
-{3834, "virus"},
-{3835, "virus"},
-{3836, "virus"},
-{3837, "virus"},
-{3838, "virus"},
-{3839, "virus"},
-{3840, "virus"},
-{3841, "virus"},
-{3842, "virus"},
-{3843, "virus"},
-{3844, "virus"},
-{3845, "virus"},
-{3846, "virus"},
-{3847, "virus"},
-{3848, "virus"},
-{3849, "virus"},
-{3850, "virus"},
-{3851, "virus"},
-{3852, "virus"},
-{3853, "virus"},
-{3854, "virus"},
-{3855, "virus"},
-{3856, "virus"},
-{3857, "virus"},
-{3858, "virus"},
-{3859, "virus"},
-{3860, "virus"},
-{3861, "virus"},
-{3862, "virus"},
-{3863, "virus"},
-{3864, "virus"},
-{3865, "virus"},
-{3866, "virus"},
-{3867, "virus"},
-{3868, "virus"},
-{3869, "virus"},
-{3870, "virus"},
-{3871, "virus"},
-{3872, "virus"},
-{3873, "virus"},
-{3874, "virus"},
-{3875, "virus"},
-{3876, "virus"},
-{3877, "virus"},
-{3878, "virus"},
-{3879, "virus"},
-{3880, "virus"},
-{3881, "virus"},
-{3882, "virus"},
-{3883, "virus"},
-{3884, "virus"},
-{3885, "virus"},
-{3886, "virus"},
-{3887, "virus"},
-{3888, "virus"},
-{3889, "virus"},
-{3890, "virus"},
-{3891, "virus"},
-{3892, "virus"},
-{3893, "virus"},
-{3894, "virus"},
-{3895, "virus"},
-{3896, "virus"},
-{3897, "virus"},
-{3898, "virus"},
-{3899, "virus"},
-{3900, "virus"},
-{3901, "virus"},
-{3902, "virus"},
-{3903, "virus"},
-{3904, "virus"},
-{3905, "virus"},
-{3906, "virus"},
-{3907, "virus"},
-{3908, "virus"},
-{3909, "virus"},
-{3910, "virus"},
-{3911, "virus"},
-{3912, "virus"},
-{3913, "virus"},
-{3914, "virus"},
-{3915, "virus"},
-{3916, "virus"},
-{3917, "virus"},
-{3918, "virus"},
-{3919, "virus"},
-{3920, "virus"},
-{3921, "virus"},
-{3922, "virus"},
-{3923, "virus"},
-{3924, "virus"},
-{3925, "virus"},
-{3926, "virus"},
-{3927, "virus"},
-{3928, "virus"},
-{3929, "virus"},
-{3930, "virus"},
-{3931, "virus"},
-{3932, "virus"},
-{3933, "virus"},
-{3934, "virus"},
-{3935, "virus"},
-{3936, "virus"},
-{3937, "virus"},
-{3938, "virus"},
-{3939, "virus"},
-{3940, "virus"},
-{3941, "virus"},
-{3942, "virus"},
-{3943, "virus"},
-{3944, "virus"},
-{3945, "virus"},
-{3946, "virus"},
-{3947, "virus"},
-{3948, "virus"},
-{3949, "virus"},
-{3950, "virus"},
-{3951, "virus"},
-{3952, "virus"},
-{3953, "virus"},
-{3954, "virus"},
-{3955, "virus"},
-{3956, "virus"},
-{3957, "virus"},
-{3958, "virus"},
-{3959, "virus"},
-{3960, "virus"},
-{3961, "virus"},
-{3962, "virus"},
-{3963, "virus"},
-{3964, "virus"},
-{3965, "virus"},
-{3966, "virus"},
-{3967, "virus"},
-{3968, "virus"},
-{3969, "virus"},
-{3970, "virus"},
-{3971, "virus"},
-{3972, "virus"},
-{3973, "virus"},
-{3974, "virus"},
-{3975, "virus"},
-{3976, "virus"},
-{3977, "virus"},
-{3978, "virus"},
-{3979, "virus"},
-{3980, "virus"},
-{3981, "virus"},
-{3982, "virus"},
-{3983, "virus"},
-{3984, "virus"},
-{3985, "virus"},
-{3986, "virus"},
-{3987, "virus"},
-{3988, "virus"},
-{3989, "virus"},
-{3990, "virus"},
-{3991, "virus"},
-{3992, "virus"},
-{3993, "virus"},
-{3994, "virus"},
-{3995, "virus"},
-{3996, "virus"},
-{3997, "virus"},
-{3998, "virus"},
-{3999, "virus"},
-{4000, "virus"},
-{4001, "virus"},
-{4002, "virus"},
-{4003, "virus"},
-{4004, "virus"},
-{4005, "virus"},
-{4006, "virus"},
-{4007, "virus"},
-{4008, "virus"},
-{4009, "virus"},
-{4010, "virus"},
-{4011, "virus"},
-{4012, "virus"},
-{4013, "virus"},
-{4014, "virus"},
-{4015, "virus"},
-{4016, "virus"},
-{4017, "virus"},
-{4018, "virus"},
-{4019, "virus"},
-{4020, "virus"},
-{4021, "virus"},
-{4022, "virus"},
-{4023, "virus"},
-{4024, "virus"},
-{4025, "virus"},
-{4026, "virus"},
-{4027, "virus"},
-{4028, "virus"},
-{4029, "virus"},
-{4030, "virus"},
-{4031, "virus"},
-{4032, "virus"},
-{4033, "virus"},
-{4034, "virus"},
-{4035, "virus"},
-{4036, "virus"},
-{4037, "virus"},
-{4038, "virus"},
-{4039, "virus"},
-{4040, "virus"},
-{4041, "virus"},
-{4042, "virus"},
-{4043, "virus"},
-{4044, "virus"},
-{4045, "virus"},
-{4046, "virus"},
-{4047, "virus"},
-{4048, "virus"},
-{4049, "virus"},
-{4050, "virus"},
-{4051, "virus"},
-{4052, "virus"},
-{4053, "virus"},
-{4054, "virus"},
-{4055, "virus"},
-{4056, "virus"},
-{4057, "virus"},
-{4058, "virus"},
-{4059, "virus"},
-{4060, "virus"},
-{4061, "virus"},
-{4062, "virus"},
-{4063, "virus"},
-{4064, "virus"},
-{4065, "virus"},
-{4066, "virus"},
-{4067, "virus"},
-{4068, "virus"},
-{4069, "virus"},
-{4070, "virus"},
-{4071, "virus"},
-{4072, "virus"},
-{4073, "virus"},
-{4074, "virus"},
-{4075, "virus"},
-{4076, "virus"},
-{4077, "virus"},
-{4078, "virus"},
-{4079, "virus"},
-{4080, "virus"},
-{4081, "virus"},
-{4082, "virus"},
-{4083, "virus"},
-{4084, "virus"},
-{4085, "virus"},
-{4086, "virus"},
-{4087, "virus"},
-{4088, "virus"},
-{4089, "virus"},
-{4090, "virus"},
-{4091, "virus"},
-{4092, "virus"},
-{4093, "virus"},
-{4094, "virus"},
-{4095, "virus"},
-{4096, "virus"},
-{4097, "virus"},
-{4098, "virus"},
-{4099, "virus"},
-{4100, "virus"},
-{4101, "virus"},
-{4102, "virus"},
-{4103, "virus"},
-{4104, "virus"},
-{4105, "virus"},
-{4106, "virus"},
-{4107, "virus"},
-{4108, "virus"},
-{4109, "virus"},
-{4110, "virus"},
-{4111, "virus"},
-{4112, "virus"},
-{4113, "virus"},
-{4114, "virus"},
-{4115, "virus"},
-{4116, "virus"},
-{4117, "virus"},
-{4118, "virus"},
-{4119, "virus"},
-{4120, "virus"},
-{4121, "virus"},
-{4122, "virus"},
-{4123, "virus"},
-{4124, "virus"},
-{4125, "virus"},
-{4126, "virus"},
-{4127, "virus"},
-{4128, "virus"},
-{4129, "virus"},
-{4130, "virus"},
-{4131, "virus"},
-{4132, "virus"},
-{4133, "virus"},
-{4134, "virus"},
-{4135, "virus"},
-{4136, "virus"},
-{4137, "virus"},
-{4138, "virus"},
-{4139, "virus"},
-{4140, "virus"},
-{4141, "virus"},
-{4142, "virus"},
-{4143, "virus"},
-{4144, "virus"},
-{4145, "virus"},
-{4146, "virus"},
-{4147, "virus"},
-{4148, "virus"},
-{4149, "virus"},
-{4150, "virus"},
-{4151, "virus"},
-{4152, "virus"},
-{4153, "virus"},
-{4154, "virus"},
-{4155, "virus"},
-{4156, "virus"},
-{4157, "virus"},
-{4158, "virus"},
-{4159, "virus"},
-{4160, "virus"},
-{4161, "virus"},
-{4162, "virus"},
-{4163, "virus"},
-{4164, "virus"},
-{4165, "virus"},
-{4166, "virus"},
-{4167, "virus"},
-{4168, "virus"},
-{4169, "virus"},
-{4170, "virus"},
-{4171, "virus"},
-{4172, "virus"},
-{4173, "virus"},
-{4174, "virus"},
-{4175, "virus"},
-{4176, "virus"},
-{4177, "virus"},
-{4178, "virus"},
-{4179, "virus"},
-{4180, "virus"},
-{4181, "virus"},
-{4182, "virus"},
-{4183, "virus"},
-{4184, "virus"},
-{4185, "virus"},
-{4186, "virus"},
-{4187, "virus"},
-{4188, "virus"},
-{4189, "virus"},
-{4190, "virus"},
-{4191, "virus"},
-{4192, "virus"},
-{4193, "virus"},
-{4194, "virus"},
-{4195, "virus"},
-{4196, "virus"},
-{4197, "virus"},
-{4198, "virus"},
-{4199, "virus"},
-{4200, "virus"},
-{4201, "virus"},
-{4202, "virus"},
-{4203, "virus"},
-{4204, "virus"},
-{4205, "virus"},
-{4206, "virus"},
-{4207, "replicon"},
-{4208, "replicon"},
-{4209, "replicon"}
-};
-
-const std::unordered_map<int, std::string> argGroupMap = {
-{1, "Aminoglycosides"},
-{2, "Aminoglycosides"},
-{3, "Aminoglycosides"},
-{4, "Iron_resistance"},
-{5, "Drug_and_biocide_resistance"},
-{6, "Drug_and_biocide_resistance"},
-{7, "Drug_and_biocide_and_metal_resistance"},
-{8, "Drug_and_biocide_resistance"},
-{9, "Drug_and_biocide_resistance"},
-{10, "betalactams"},
-{11, "betalactams"},
-{12, "Aminoglycosides"},
-{13, "Aminoglycosides"},
-{14, "Aminoglycosides"},
-{15, "Aminoglycosides"},
-{16, "Aminoglycosides"},
-{17, "Multi-biocide_resistance"},
-{18, "Lipopeptides"},
-{19, "Rifampin"},
-{20, "Multi-metal_resistance"},
-{21, "Arsenic_resistance"},
-{22, "Multi-metal_resistance"},
-{23, "Multi-metal_resistance"},
-{24, "Multi-metal_resistance"},
-{25, "Arsenic_resistance"},
-{26, "Multi-metal_resistance"},
-{27, "Multi-drug_resistance"},
-{28, "Acid_resistance"},
-{29, "Bacitracin"},
-{30, "Drug_and_biocide_and_metal_resistance"},
-{31, "Drug_and_biocide_resistance"},
-{32, "Copper_resistance"},
-{33, "betalactams"},
-{34, "betalactams"},
-{35, "betalactams"},
-{36, "Multi-metal_resistance"},
-{37, "Cationic_antimicrobial_peptides"},
-{38, "Phenicol"},
-{39, "Drug_and_biocide_resistance"},
-{40, "betalactams"},
-{41, "Biguanide_resistance"},
-{42, "betalactams"},
-{43, "Sodium_resistance"},
-{44, "Lipopeptides"},
-{45, "betalactams"},
-{46, "Copper_resistance"},
-{47, "Copper_resistance"},
-{48, "Multi-metal_resistance"},
-{49, "Multi-metal_resistance"},
-{50, "Multi-metal_resistance"},
-{51, "Drug_and_biocide_resistance"},
-{52, "Drug_and_biocide_resistance"},
-{53, "betalactams"},
-{54, "Copper_resistance"},
-{55, "Copper_resistance"},
-{56, "Biocide_and_metal_resistance"},
-{57, "Multi-metal_resistance"},
-{58, "Multi-metal_resistance"},
-{59, "Multi-metal_resistance"},
-{60, "Multi-metal_resistance"},
-{61, "Multi-metal_resistance"},
-{62, "Copper_resistance"},
-{63, "Copper_resistance"},
-{64, "Trimethoprim"},
-{65, "Trimethoprim"},
-{66, "Trimethoprim"},
-{67, "Trimethoprim"},
-{68, "betalactams"},
-{69, "Copper_resistance"},
-{70, "Multi-metal_resistance"},
-{71, "Multi-metal_resistance"},
-{72, "Multi-drug_resistance"},
-{73, "Drug_and_biocide_resistance"},
-{74, "Quaternary_Ammonium_Compounds_(QACs)_resistance"},
-{75, "Multi-biocide_resistance"},
-{76, "Drug_and_biocide_resistance"},
-{77, "Drug_and_biocide_resistance"},
-{78, "Drug_and_biocide_resistance"},
-{79, "Drug_and_biocide_resistance"},
-{80, "Drug_and_biocide_resistance"},
-{81, "Cationic_antimicrobial_peptides"},
-{82, "Lipopeptides"},
-{83, "MLS"},
-{84, "MLS"},
-{85, "MLS"},
-{86, "MLS"},
-{87, "Acid_resistance"},
-{88, "Phenolic_compound_resistance"},
-{89, "Phenolic_compound_resistance"},
-{90, "Multi-metal_resistance"},
-{91, "Biocide_and_metal_resistance"},
-{92, "Biocide_and_metal_resistance"},
-{93, "Multi-metal_resistance"},
-{94, "Phenicol"},
-{95, "Sulfonamides"},
-{96, "Fosfomycin"},
-{97, "Fusidic_acid"},
-{98, "Acid_resistance"},
-{99, "Acid_resistance"},
-{100, "Drug_and_biocide_resistance"},
-{101, "Biocide_and_metal_resistance"},
-{102, "Fosfomycin"},
-{103, "Fluoroquinolones"},
-{104, "Fluoroquinolones"},
-{105, "Aminocoumarins"},
-{106, "Acid_resistance"},
-{107, "Multi-drug_resistance"},
-{108, "Acetate_resistance"},
-{109, "Mupirocin"},
-{110, "Drug_and_biocide_resistance"},
-{111, "Aminoglycosides"},
-{112, "Multi-biocide_resistance"},
-{113, "Drug_and_biocide_resistance"},
-{114, "betalactams"},
-{115, "Drug_and_biocide_resistance"},
-{116, "Drug_and_biocide_resistance"},
-{117, "Drug_and_biocide_resistance"},
-{118, "Drug_and_biocide_resistance"},
-{119, "betalactams"},
-{120, "Multi-drug_resistance"},
-{121, "MLS"},
-{122, "MLS"},
-{123, "MLS"},
-{124, "Acetate_resistance"},
-{125, "Multi-drug_resistance"},
-{126, "MLS"},
-{127, "Drug_and_biocide_resistance"},
-{128, "Drug_and_biocide_resistance"},
-{129, "Lipopeptides"},
-{130, "Drug_and_biocide_resistance"},
-{131, "Drug_and_biocide_resistance"},
-{132, "Drug_and_biocide_and_metal_resistance"},
-{133, "Drug_and_biocide_and_metal_resistance"},
-{134, "Drug_and_biocide_resistance"},
-{135, "Drug_and_biocide_resistance"},
-{136, "Drug_and_biocide_resistance"},
-{137, "betalactams"},
-{138, "MLS"},
-{139, "MLS"},
-{140, "Mercury_resistance"},
-{141, "Mercury_resistance"},
-{142, "Mercury_resistance"},
-{143, "Mercury_resistance"},
-{144, "Mercury_resistance"},
-{145, "Mercury_resistance"},
-{146, "Multi-metal_resistance"},
-{147, "MLS"},
-{148, "Multi-metal_resistance"},
-{149, "Multi-metal_resistance"},
-{150, "Multi-metal_resistance"},
-{151, "Multi-metal_resistance"},
-{152, "Multi-metal_resistance"},
-{153, "MLS"},
-{154, "Cationic_antimicrobial_peptides"},
-{155, "Multi-drug_resistance"},
-{156, "MLS"},
-{157, "Fosfomycin"},
-{158, "Drug_and_biocide_resistance"},
-{159, "Multi-metal_resistance"},
-{160, "Nickel_resistance"},
-{161, "Chromium_resistance"},
-{162, "Sodium_resistance"},
-{163, "Sodium_resistance"},
-{164, "Nickel_resistance"},
-{165, "Nickel_resistance"},
-{166, "Paraquat_resistance"},
-{167, "Drug_and_biocide_resistance"},
-{168, "Oxazolidinone"},
-{169, "betalactams"},
-{170, "betalactams"},
-{171, "betalactams"},
-{172, "betalactams"},
-{173, "Multi-drug_resistance"},
-{174, "betalactams"},
-{175, "betalactams"},
-{176, "Drug_and_biocide_resistance"},
-{177, "Drug_and_biocide_resistance"},
-{178, "betalactams"},
-{179, "betalactams"},
-{180, "betalactams"},
-{181, "Multi-biocide_resistance"},
-{182, "Fluoroquinolones"},
-{183, "Aminocoumarins"},
-{184, "Fluoroquinolones"},
-{185, "Fluoroquinolones"},
-{186, "betalactams"},
-{187, "Copper_resistance"},
-{188, "Multi-metal_resistance"},
-{189, "Drug_and_biocide_resistance"},
-{190, "Drug_and_biocide_resistance"},
-{191, "Multi-metal_resistance"},
-{192, "Cationic_antimicrobial_peptides"},
-{193, "Arsenic_resistance"},
-{194, "Arsenic_resistance"},
-{195, "Fosfomycin"},
-{196, "Drug_and_biocide_resistance"},
-{197, "Drug_and_biocide_resistance"},
-{198, "Fluoroquinolones"},
-{199, "Fluoroquinolones"},
-{200, "Fluoroquinolones"},
-{201, "Multi-drug_resistance"},
-{202, "Multi-metal_resistance"},
-{203, "Aminoglycosides"},
-{204, "Drug_and_biocide_and_metal_resistance"},
-{205, "Rifampin"},
-{206, "Multi-biocide_resistance"},
-{207, "Mycobacterium_tuberculosis-specific_Drug"},
-{208, "Aminoglycosides"},
-{209, "Aminoglycosides"},
-{210, "Aminoglycosides"},
-{211, "Aminoglycosides"},
-{212, "Aminoglycosides"},
-{213, "Nucleosides"},
-{214, "Drug_and_biocide_resistance"},
-{215, "betalactams"},
-{216, "Multi-metal_resistance"},
-{217, "Multi-metal_resistance"},
-{218, "Multi-metal_resistance"},
-{219, "Multi-metal_resistance"},
-{220, "Multi-metal_resistance"},
-{221, "Multi-metal_resistance"},
-{222, "Multi-metal_resistance"},
-{223, "Biocide_and_metal_resistance"},
-{224, "Multi-biocide_resistance"},
-{225, "Multi-biocide_resistance"},
-{226, "Peroxide_resistance"},
-{227, "Peroxide_resistance"},
-{228, "Multi-biocide_resistance"},
-{229, "Multi-biocide_resistance"},
-{230, "Sulfonamides"},
-{231, "Sulfonamides"},
-{232, "Sulfonamides"},
-{233, "Biocide_and_metal_resistance"},
-{234, "betalactams"},
-{235, "Tellurium_resistance"},
-{236, "Tellurium_resistance"},
-{237, "Tellurium_resistance"},
-{238, "Tellurium_resistance"},
-{239, "Tetracyclines"},
-{240, "Tetracyclines"},
-{241, "Tetracyclines"},
-{242, "Tetracyclines"},
-{243, "Tetracyclines"},
-{244, "Tetracyclines"},
-{245, "Tetracyclines"},
-{246, "Tetracyclines"},
-{247, "Tetracyclines"},
-{248, "Tetracyclines"},
-{249, "Tetracyclines"},
-{250, "Tetracyclines"},
-{251, "Multi-biocide_resistance"},
-{252, "Elfamycins"},
-{253, "Cationic_antimicrobial_peptides"},
-{254, "Fosfomycin"},
-{255, "Glycopeptides"},
-{256, "Glycopeptides"},
-{257, "Glycopeptides"},
-{258, "Iron_resistance"},
-{259, "Biocide_and_metal_resistance"},
-{260, "Peroxide_resistance"},
-{261, "Multi-biocide_resistance"},
-{262, "Acid_resistance"},
-{263, "Multi-metal_resistance"},
-{264, "Biocide_and_metal_resistance"},
-{265, "Multi-biocide_resistance"},
-{266, "Biocide_and_metal_resistance"},
-{267, "Drug_and_biocide_resistance"},
-{268, "Multi-metal_resistance"},
-{269, "Multi-metal_resistance"},
-{270, "Zinc_resistance"},
-{271, "Zinc_resistance"},
-{272, "Zinc_resistance"},
-{273, "Multi-metal_resistance"},
-{274, "Biocide_and_metal_resistance"},
-{275, "Zinc_resistance"},
-};
-
-
-const std::unordered_map<int, std::string> argResistanceMap = {
-{1, "Drugs"},
-{2, "Drugs"},
-{3, "Drugs"},
-{4, "Metals"},
-{5, "Multi-compound"},
-{6, "Multi-compound"},
-{7, "Multi-compound"},
-{8, "Multi-compound"},
-{9, "Multi-compound"},
-{10, "Drugs"},
-{11, "Drugs"},
-{12, "Drugs"},
-{13, "Drugs"},
-{14, "Drugs"},
-{15, "Drugs"},
-{16, "Drugs"},
-{17, "Biocides"},
-{18, "Drugs"},
-{19, "Drugs"},
-{20, "Metals"},
-{21, "Metals"},
-{22, "Metals"},
-{23, "Metals"},
-{24, "Metals"},
-{25, "Metals"},
-{26, "Metals"},
-{27, "Drugs"},
-{28, "Biocides"},
-{29, "Drugs"},
-{30, "Multi-compound"},
-{31, "Multi-compound"},
-{32, "Metals"},
-{33, "Drugs"},
-{34, "Drugs"},
-{35, "Drugs"},
-{36, "Metals"},
-{37, "Drugs"},
-{38, "Drugs"},
-{39, "Multi-compound"},
-{40, "Drugs"},
-{41, "Biocides"},
-{42, "Drugs"},
-{43, "Metals"},
-{44, "Drugs"},
-{45, "Drugs"},
-{46, "Metals"},
-{47, "Metals"},
-{48, "Metals"},
-{49, "Metals"},
-{50, "Metals"},
-{51, "Multi-compound"},
-{52, "Multi-compound"},
-{53, "Drugs"},
-{54, "Metals"},
-{55, "Metals"},
-{56, "Multi-compound"},
-{57, "Metals"},
-{58, "Metals"},
-{59, "Metals"},
-{60, "Metals"},
-{61, "Metals"},
-{62, "Metals"},
-{63, "Metals"},
-{64, "Drugs"},
-{65, "Drugs"},
-{66, "Drugs"},
-{67, "Drugs"},
-{68, "Drugs"},
-{69, "Metals"},
-{70, "Metals"},
-{71, "Metals"},
-{72, "Drugs"},
-{73, "Multi-compound"},
-{74, "Biocides"},
-{75, "Biocides"},
-{76, "Multi-compound"},
-{77, "Multi-compound"},
-{78, "Multi-compound"},
-{79, "Multi-compound"},
-{80, "Multi-compound"},
-{81, "Drugs"},
-{82, "Drugs"},
-{83, "Drugs"},
-{84, "Drugs"},
-{85, "Drugs"},
-{86, "Drugs"},
-{87, "Biocides"},
-{88, "Biocides"},
-{89, "Biocides"},
-{90, "Metals"},
-{91, "Multi-compound"},
-{92, "Multi-compound"},
-{93, "Metals"},
-{94, "Drugs"},
-{95, "Drugs"},
-{96, "Drugs"},
-{97, "Drugs"},
-{98, "Biocides"},
-{99, "Biocides"},
-{100, "Multi-compound"},
-{101, "Multi-compound"},
-{102, "Drugs"},
-{103, "Drugs"},
-{104, "Drugs"},
-{105, "Drugs"},
-{106, "Biocides"},
-{107, "Drugs"},
-{108, "Biocides"},
-{109, "Drugs"},
-{110, "Multi-compound"},
-{111, "Drugs"},
-{112, "Biocides"},
-{113, "Multi-compound"},
-{114, "Drugs"},
-{115, "Multi-compound"},
-{116, "Multi-compound"},
-{117, "Multi-compound"},
-{118, "Multi-compound"},
-{119, "Drugs"},
-{120, "Drugs"},
-{121, "Drugs"},
-{122, "Drugs"},
-{123, "Drugs"},
-{124, "Biocides"},
-{125, "Drugs"},
-{126, "Drugs"},
-{127, "Multi-compound"},
-{128, "Multi-compound"},
-{129, "Drugs"},
-{130, "Multi-compound"},
-{131, "Multi-compound"},
-{132, "Multi-compound"},
-{133, "Multi-compound"},
-{134, "Multi-compound"},
-{135, "Multi-compound"},
-{136, "Multi-compound"},
-{137, "Drugs"},
-{138, "Drugs"},
-{139, "Drugs"},
-{140, "Metals"},
-{141, "Metals"},
-{142, "Metals"},
-{143, "Metals"},
-{144, "Metals"},
-{145, "Metals"},
-{146, "Metals"},
-{147, "Drugs"},
-{148, "Metals"},
-{149, "Metals"},
-{150, "Metals"},
-{151, "Metals"},
-{152, "Metals"},
-{153, "Drugs"},
-{154, "Drugs"},
-{155, "Drugs"},
-{156, "Drugs"},
-{157, "Drugs"},
-{158, "Multi-compound"},
-{159, "Metals"},
-{160, "Metals"},
-{161, "Metals"},
-{162, "Metals"},
-{163, "Metals"},
-{164, "Metals"},
-{165, "Metals"},
-{166, "Biocides"},
-{167, "Multi-compound"},
-{168, "Drugs"},
-{169, "Drugs"},
-{170, "Drugs"},
-{171, "Drugs"},
-{172, "Drugs"},
-{173, "Drugs"},
-{174, "Drugs"},
-{175, "Drugs"},
-{176, "Multi-compound"},
-{177, "Multi-compound"},
-{178, "Drugs"},
-{179, "Drugs"},
-{180, "Drugs"},
-{181, "Biocides"},
-{182, "Drugs"},
-{183, "Drugs"},
-{184, "Drugs"},
-{185, "Drugs"},
-{186, "Drugs"},
-{187, "Metals"},
-{188, "Metals"},
-{189, "Multi-compound"},
-{190, "Multi-compound"},
-{191, "Metals"},
-{192, "Drugs"},
-{193, "Metals"},
-{194, "Metals"},
-{195, "Drugs"},
-{196, "Multi-compound"},
-{197, "Multi-compound"},
-{198, "Drugs"},
-{199, "Drugs"},
-{200, "Drugs"},
-{201, "Drugs"},
-{202, "Metals"},
-{203, "Drugs"},
-{204, "Multi-compound"},
-{205, "Drugs"},
-{206, "Biocides"},
-{207, "Drugs"},
-{208, "Drugs"},
-{209, "Drugs"},
-{210, "Drugs"},
-{211, "Drugs"},
-{212, "Drugs"},
-{213, "Drugs"},
-{214, "Multi-compound"},
-{215, "Drugs"},
-{216, "Metals"},
-{217, "Metals"},
-{218, "Metals"},
-{219, "Metals"},
-{220, "Metals"},
-{221, "Metals"},
-{222, "Metals"},
-{223, "Multi-compound"},
-{224, "Biocides"},
-{225, "Biocides"},
-{226, "Biocides"},
-{227, "Biocides"},
-{228, "Biocides"},
-{229, "Biocides"},
-{230, "Drugs"},
-{231, "Drugs"},
-{232, "Drugs"},
-{233, "Multi-compound"},
-{234, "Drugs"},
-{235, "Metals"},
-{236, "Metals"},
-{237, "Metals"},
-{238, "Metals"},
-{239, "Drugs"},
-{240, "Drugs"},
-{241, "Drugs"},
-{242, "Drugs"},
-{243, "Drugs"},
-{244, "Drugs"},
-{245, "Drugs"},
-{246, "Drugs"},
-{247, "Drugs"},
-{248, "Drugs"},
-{249, "Drugs"},
-{250, "Drugs"},
-{251, "Biocides"},
-{252, "Drugs"},
-{253, "Drugs"},
-{254, "Drugs"},
-{255, "Drugs"},
-{256, "Drugs"},
-{257, "Drugs"},
-{258, "Metals"},
-{259, "Multi-compound"},
-{260, "Biocides"},
-{261, "Biocides"},
-{262, "Biocides"},
-{263, "Metals"},
-{264, "Multi-compound"},
-{265, "Biocides"},
-{266, "Multi-compound"},
-{267, "Multi-compound"},
-{268, "Metals"},
-{269, "Metals"},
-{270, "Metals"},
-{271, "Metals"},
-{272, "Metals"},
-{273, "Metals"},
-{274, "Multi-compound"},
-{275, "Metals"}
-};
\ No newline at end of file
@@ -0,0 +1,45 @@
+// Released under the GNU GPLv3; see LICENSE for details.
+// Developed by Boucher Lab and Slizovskiy Lab.
+
+#include "../include/incremental.h"
+#include "../include/parser.h"
+#include "../include/traversal.h"
+#include <iostream>
+
+/* Append a delta CSV to a built cohort, tracking which per-disease / per-group outputs change */
+
+bool appendCohortDelta(const std::filesystem::path& deltaFile, Graph& graph, std::map<int, std::string>& patientToDiseaseMap,
+                       IndividualTimelines& colocalizationByIndividual,
+                       bool includeSNPConfirmationARGs, bool excludeMetals, CohortDelta& delta) {
+    if (!std::filesystem::exists(deltaFile)) {
+        std::cerr << "Warning: Could not open delta file: " << deltaFile << std::endl;
+        return false;
+    }
+
+    Graph added;
+    std::map<int, std::string> addedDiseases;
+    parseData(deltaFile, added, addedDiseases, includeSNPConfirmationARGs, excludeMetals);
+
+    // A patient whose label changes affects both the old and the new disease output.
+    for (const auto& [patientID, disease] : addedDiseases) {
+        delta.patients.insert(patientID);
+        auto previous = patientToDiseaseMap.find(patientID);
+        if (previous != patientToDiseaseMap.end()) delta.diseases.insert(previous->second);
+        delta.diseases.insert(disease);
+    }
+    for (const auto& edge : added.edges) {
+        int mgeID = edge.source.isARG ? edge.target.id : edge.source.id;
+        delta.mgeGroups.insert(entityCatalog().mgeGroup(mgeID));
+    }
+
+    removeTemporalEdges(graph, delta.patients);
+    mergeGraph(graph, added);
+    addTemporalEdges(graph, delta.patients);
+
+    for (auto& [patientID, disease] : addedDiseases) {
+        patientToDiseaseMap[patientID] = std::move(disease);
+    }
+    // Timelines are unions over colocalization edges, so the delta's edges extend them.
+    traverseGraph(added, colocalizationByIndividual);
+    return true;
+}
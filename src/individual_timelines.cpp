@@ -0,0 +1,96 @@
+// Released under the GNU GPLv3; see LICENSE for details.
+// Developed by Boucher Lab and Slizovskiy Lab.
+
+#include "../include/individual_timelines.h"
+#include <algorithm>
+#include <iterator>
+#include <numeric>
+
+static bool keyLess(const IndividualTimelines::value_type& a, const IndividualTimelines::value_type& b) {
+    return a.first < b.first;
+}
+
+// Sorts rows by key and ORs the masks of equal keys into one row.
+static void sortAndFold(std::vector<IndividualTimelines::value_type>& rows) {
+    std::sort(rows.begin(), rows.end(), keyLess);
+    size_t out = 0;
+    for (size_t i = 0; i < rows.size(); ++i) {
+        if (out > 0 && rows[out - 1].first == rows[i].first) rows[out - 1].second |= rows[i].second;
+        else rows[out++] = rows[i];
+    }
+    rows.resize(out);
+}
+
+// Orders row indices of rows by (ARG, MGE, patient).
+static auto argOrderLess(const std::vector<IndividualTimelines::value_type>& rows) {
+    return [&rows](std::uint32_t x, std::uint32_t y) {
+        auto [px, ax, mx] = rows[x].first;
+        auto [py, ay, my] = rows[y].first;
+        return std::tie(ax, mx, px) < std::tie(ay, my, py);
+    };
+}
+
+void IndividualTimelines::add(std::vector<value_type> rows) {
+    if (rows.empty()) return;
+    sortAndFold(rows);
+
+    if (rows_.empty()) {
+        rows_ = std::move(rows);
+        rows_.shrink_to_fit();   // the batch had one row per edge and patient before folding
+        argOrder_.resize(rows_.size());
+        std::iota(argOrder_.begin(), argOrder_.end(), 0u);
+        std::sort(argOrder_.begin(), argOrder_.end(), argOrderLess(rows_));
+        return;
+    }
+
+    // Merge the batch into the table, noting where the existing rows move and which rows are
+    // new keys; the ARG index is then merged the same way, so a batch of k rows costs
+    // O(N + k log k) rather than re-sorting the whole index.
+    std::vector<value_type> merged;
+    merged.reserve(rows_.size() + rows.size());
+    std::vector<std::uint32_t> movedTo(rows_.size());
+    std::vector<std::uint32_t> added;
+    size_t a = 0, b = 0;
+    while (a < rows_.size() || b < rows.size()) {
+        auto at = static_cast<std::uint32_t>(merged.size());
+        if (b == rows.size() || (a < rows_.size() && rows_[a].first < rows[b].first)) {
+            movedTo[a] = at;
+            merged.push_back(rows_[a++]);
+        } else if (a == rows_.size() || rows[b].first < rows_[a].first) {
+            added.push_back(at);
+            merged.push_back(rows[b++]);
+        } else {
+            movedTo[a] = at;
+            merged.push_back({rows_[a].first, rows_[a].second | rows[b].second});
+            ++a;
+            ++b;
+        }
+    }
+    rows_ = std::move(merged);
+
+    std::sort(added.begin(), added.end(), argOrderLess(rows_));
+    for (std::uint32_t& row : argOrder_) row = movedTo[row];
+    std::vector<std::uint32_t> order;
+    order.reserve(rows_.size());
+    std::merge(argOrder_.begin(), argOrder_.end(), added.begin(), added.end(), std::back_inserter(order), argOrderLess(rows_));
+    argOrder_ = std::move(order);
+}
+
+IndividualTimelines::const_iterator IndividualTimelines::find(const key_type& key) const {
+    auto it = std::lower_bound(rows_.begin(), rows_.end(), key, [](const value_type& row, const key_type& k) { return row.first < k; });
+    return it != rows_.end() && it->first == key ? it : rows_.end();
+}
+
+IndividualTimelines::Range IndividualTimelines::patientTimelines(int patientID) const {
+    auto first = std::lower_bound(rows_.begin(), rows_.end(), patientID,
+                                  [](const value_type& row, int id) { return std::get<0>(row.first) < id; });
+    auto last = std::upper_bound(first, rows_.end(), patientID,
+                                 [](int id, const value_type& row) { return id < std::get<0>(row.first); });
+    return {first, last};
+}
+
+size_t IndividualTimelines::argLowerBound(int argID) const {
+    auto it = std::lower_bound(argOrder_.begin(), argOrder_.end(), argID,
+                               [this](std::uint32_t row, int id) { return std::get<1>(rows_[row].first) < id; });
+    return static_cast<size_t>(it - argOrder_.begin());
+}
@@ -0,0 +1,127 @@
+// Released under the GNU GPLv3; see LICENSE for details.
+// Developed by Boucher Lab and Slizovskiy Lab.
+
+#include "../include/json_writer.h"
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+
+/* Streaming JSON output in the layout of nlohmann::json::dump */
+
+static constexpr size_t kFlushThreshold = 1 << 16;
+
+JsonWriter::JsonWriter(std::ostream& out, int indent) : out_(out), indent_(indent) {
+    buffer_.reserve(kFlushThreshold + 4096);
+}
+
+JsonWriter::~JsonWriter() {
+    flush();
+}
+
+void JsonWriter::flush() {
+    out_.write(buffer_.data(), static_cast<std::streamsize>(buffer_.size()));
+    buffer_.clear();
+}
+
+void JsonWriter::raw(std::string_view text) {
+    buffer_.append(text.data(), text.size());
+    if (buffer_.size() >= kFlushThreshold) flush();
+}
+
+void JsonWriter::newline(size_t depth) {
+    if (indent_ < 0) return;
+    buffer_.push_back('\n');
+    buffer_.append(depth * static_cast<size_t>(indent_), ' ');
+}
+
+// Separator and indentation in front of an array element or object key; a value that
+// follows its key is written in place.
+void JsonWriter::beforeValue() {
+    if (afterKey_) {
+        afterKey_ = false;
+        return;
+    }
+    if (hasElements_.empty()) return;
+    if (hasElements_.back()) buffer_.push_back(',');
+    hasElements_.back() = true;
+    newline(hasElements_.size());
+}
+
+void JsonWriter::open(char bracket) {
+    beforeValue();
+    buffer_.push_back(bracket);
+    hasElements_.push_back(false);
+}
+
+void JsonWriter::close(char bracket) {
+    bool nonEmpty = hasElements_.back();
+    hasElements_.pop_back();
+    if (nonEmpty) newline(hasElements_.size());
+    buffer_.push_back(bracket);
+    if (buffer_.size() >= kFlushThreshold) flush();
+}
+
+void JsonWriter::beginObject() { open('{'); }
+void JsonWriter::endObject() { close('}'); }
+void JsonWriter::beginArray() { open('['); }
+void JsonWriter::endArray() { close(']'); }
+
+void JsonWriter::key(std::string_view name) {
+    value(name);
+    raw(indent_ < 0 ? ":" : ": ");
+    afterKey_ = true;
+}
+
+void JsonWriter::value(std::string_view text) {
+    beforeValue();
+    buffer_.push_back('"');
+    for (char c : text) {
+        switch (c) {
+            case '"':  buffer_ += "\\\""; break;
+            case '\\': buffer_ += "\\\\"; break;
+            case '\b': buffer_ += "\\b"; break;
+            case '\f': buffer_ += "\\f"; break;
+            case '\n': buffer_ += "\\n"; break;
+            case '\r': buffer_ += "\\r"; break;
+            case '\t': buffer_ += "\\t"; break;
+            default:
+                if (static_cast<unsigned char>(c) < 0x20) {
+                    char escaped[7];
+                    std::snprintf(escaped, sizeof(escaped), "\\u%04x", static_cast<unsigned char>(c));
+                    buffer_ += escaped;
+                } else {
+                    buffer_.push_back(c);  // UTF-8 is written as is, like dump()'s default
+                }
+        }
+    }
+    buffer_.push_back('"');
+    if (buffer_.size() >= kFlushThreshold) flush();
+}
+
+void JsonWriter::value(int number) {
+    beforeValue();
+    raw(std::to_string(number));
+}
+
+void JsonWriter::value(bool flag) {
+    beforeValue();
+    raw(flag ? "true" : "false");
+}
+
+// Shortest representation that reads back exactly, with ".0" on integral values and
+// null for non-finite numbers, as nlohmann prints doubles.
+void JsonWriter::value(double number) {
+    beforeValue();
+    if (!std::isfinite(number)) {
+        raw("null");
+        return;
+    }
+    char text[32];
+    for (int precision = 15; precision <= 17; ++precision) {
+        std::snprintf(text, sizeof(text), "%.*g", precision, number);
+        if (std::strtod(text, nullptr) == number) break;
+    }
+    std::string_view digits(text);
+    raw(digits);
+    if (digits.find_first_of(".eEn") == std::string_view::npos) raw(".0");
+}
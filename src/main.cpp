@@ -1,10 +1,13 @@
 // Released under the GNU GPLv3; see LICENSE for details.
 // Developed by Boucher Lab and Slizovskiy Lab.
 
+#include <algorithm>
 #include <iostream>
 #include <filesystem>
+#include <thread>
 #include "../include/Timepoint.h"
 #include "../include/graph.h"
+#include "../include/csr_graph.h"
 #include "../include/parser.h"
 #include "../include/id_maps.h"
 #include "../include/traversal.h"
@@ -12,16 +15,22 @@
 #include "../include/export.h"
 #include "../include/graph_utils.h"
 #include "../include/export_graph_json.h" 
-#include "../include/config_loader.h"  
+#include "../include/config_loader.h"
+#include "../include/graph_snapshot.h"
+#include "../include/incremental.h"  
+#include "../include/catalog_loader.h"
 
 /* Main entry point: parse arguments, load data, call functions */
 
 namespace fs = std::filesystem;
 
 fs::path data_file;
+fs::path graph_snapshot_file;
+CatalogSource catalog_source;
 fs::path interaction_json_path;
 fs::path parent_json_path;
 fs::path temporal_dynamics_json_path;
+fs::path entity_timelines_json_path;
 fs::path top_entities_output_dir;
 fs::path top_colocalizations_output;
 fs::path disease_type_output;
@@ -29,13 +38,28 @@ fs::path mge_group_output;
 
 
 
-int main() {
+int main(int argc, char* argv[]) {
+    // CoNet [--append delta.csv]: add a batch of rows to the cohort held in the graph snapshot
+    fs::path append_file;
+    for (int i = 1; i < argc; ++i) {
+        std::string arg = argv[i];
+        if (arg == "--append" && i + 1 < argc) {
+            append_file = fs::path(argv[++i]);
+        } else {
+            std::cerr << "Usage: " << argv[0] << " [--append delta.csv]\n";
+            return 1;
+        }
+    }
+
     try {
         Config cfg = loadConfig("config/paths.json");
         data_file = fs::path(cfg.input_data_path);
+        graph_snapshot_file = fs::path(cfg.graph_snapshot_path);
+        catalog_source = {cfg.catalog_args_path, cfg.catalog_mges_path, cfg.catalog_cache_path};
         interaction_json_path = fs::path(cfg.viz_interaction);
         parent_json_path = fs::path(cfg.viz_parent);
         temporal_dynamics_json_path = fs::path(cfg.viz_temporal_dynamics);
+        entity_timelines_json_path = fs::path(cfg.viz_entity_timelines);
         top_entities_output_dir = fs::path(cfg.output_base);
         top_colocalizations_output = fs::path(cfg.output_top_colocalizations);
 
@@ -44,44 +68,107 @@ int main() {
         std::cerr << "Config error: " << e.what() << "\n";
         return 1;
     }
+    // annotation tables named in the config replace the compiled-in catalog; this has to
+    // happen before the graph is parsed or loaded, since nodes hold catalog ids
+    if (!catalog_source.argsFile.empty() && !catalog_source.mgesFile.empty() && !loadEntityCatalog(catalog_source)) {
+        std::cerr << "Warning: Using the built-in entity catalog\n";
+    }
+
     Graph g;
     std::map<int, std::string> patientToDiseaseMap;
-    std::unordered_map<Node, std::unordered_set<Node>> adjacency;
-
-    // parse the data file and construct the graph (true to exclude ARGs requiring SNP confirmation, true to exclude metals)
-    parseData(data_file, g, patientToDiseaseMap, true, false);
+    IndividualTimelines colocalizationByIndividual;
+    CSRGraph csr;
+
+    // reuse the graph snapshot when it was built from the current data file and delta files
+    // with the same options
+    SnapshotSource snapshotSource = {data_file, true, false, {}};
+    if (!graph_snapshot_file.empty()) snapshotSource.appliedDeltas = snapshotAppliedDeltas(graph_snapshot_file);
+    bool fromSnapshot = !graph_snapshot_file.empty() &&
+        loadGraphSnapshot(graph_snapshot_file, snapshotSource, g, patientToDiseaseMap, colocalizationByIndividual);
+
+    if (!fromSnapshot) {
+        // parse the data file and construct the graph (true to exclude ARGs requiring SNP confirmation, true to exclude metals)
+        PatientNodes patientNodes;
+        parseData(data_file, g, patientToDiseaseMap, true, false, std::thread::hardware_concurrency(), &patientNodes);
+
+        addTemporalEdges(g, std::move(patientNodes), std::thread::hardware_concurrency());
+        traverseGraph(g, colocalizationByIndividual);
+
+        // the previous snapshot's appended batches are re-applied, so a rebuild keeps them
+        std::vector<fs::path> replayed;
+        for (const fs::path& deltaFile : snapshotSource.appliedDeltas) {
+            CohortDelta replay;
+            if (!fs::exists(deltaFile) ||
+                !appendCohortDelta(deltaFile, g, patientToDiseaseMap, colocalizationByIndividual, true, false, replay)) {
+                std::cerr << "Warning: Dropping appended batch " << deltaFile << " from the graph snapshot" << std::endl;
+                continue;
+            }
+            replayed.push_back(deltaFile);
+            std::cout << "Re-applied " << replay.patients.size() << " patients from " << deltaFile.string() << "\n";
+        }
+        snapshotSource.appliedDeltas = std::move(replayed);
+    } else {
+        for (const fs::path& deltaFile : snapshotSource.appliedDeltas) {
+            std::cout << "Graph snapshot includes rows appended from " << deltaFile.string() << "\n";
+        }
+    }
 
-    addTemporalEdges(g);  
-    buildAdjacency(g, adjacency);
+    // incremental mode: fold the delta rows into the cohort and keep them in the snapshot
+    CohortDelta delta;
+    bool appended = false;
+    if (!append_file.empty()) {
+        std::error_code ec;
+        fs::path deltaFile = fs::weakly_canonical(append_file, ec);
+        if (ec) deltaFile = fs::absolute(append_file);
+        if (std::find(snapshotSource.appliedDeltas.begin(), snapshotSource.appliedDeltas.end(), deltaFile) !=
+            snapshotSource.appliedDeltas.end()) {
+            std::cerr << "Error: " << append_file.string() << " has already been appended to the graph snapshot\n";
+            return 1;
+        }
+        if (!appendCohortDelta(append_file, g, patientToDiseaseMap, colocalizationByIndividual, true, false, delta)) return 1;
+        appended = true;
+        snapshotSource.appliedDeltas.push_back(deltaFile);
+        std::cout << "Appended " << delta.patients.size() << " patients from " << append_file.string() << "\n";
+    }
+    if ((!fromSnapshot || appended) && !graph_snapshot_file.empty()) {
+        saveGraphSnapshot(graph_snapshot_file, snapshotSource, g, patientToDiseaseMap, colocalizationByIndividual);
+    }
+    buildCSR(g, csr);
 
     /******************************** Graph Statistics  ************************************/
-    writeGraphStatisticsCSV(g, adjacency, "viz/output/graph_statistics.csv");
+    writeGraphStatisticsCSV(g, csr, "viz/output/graph_statistics.csv");
 
     /******************************** Traversal of Graph  ************************************/
     std::map<std::pair<int, int>, std::multiset<Timepoint>> colocalizationTimeline;
-    traverseAdjacency(g, adjacency, colocalizationTimeline);
+    traverseAdjacency(csr, colocalizationTimeline);
 
-    /******************************** Traversal of Graph  ************************************/
-    std::map<std::tuple<int, int, int>, std::set<Timepoint>> colocalizationByIndividual;
-    traverseGraph(g, colocalizationByIndividual);
     std::map<std::pair<int, int>, std::set<int>> globalPairToPatients;
     
 
     /********************************* Colocalizations by Timepoints ************************************/
-    writeAllDiseasesTemporalDynamicsCounts(colocalizationByIndividual, patientToDiseaseMap);
-    writeTemporalDynamicsCountsForMGEGroup(colocalizationByIndividual);
     mostProminentEntities(g);
     getTopARGMGEPairsByFrequencyWODonor(colocalizationByIndividual, 10, patientToDiseaseMap, top_colocalizations_output.string());
     
 
-    exportColocalizations(g, colocalizationByIndividual);
+    // emerge/disappear/transfer/persist, per-disease and per-MGE-group CSVs in one pass;
+    // after an append to a loaded snapshot only the diseases and MGE groups touched by the
+    // delta are rewritten
+    if (appended && fromSnapshot) {
+        exportTemporalDynamics(colocalizationByIndividual, patientToDiseaseMap, &delta.diseases, &delta.mgeGroups);
+    } else {
+        exportTemporalDynamics(colocalizationByIndividual, patientToDiseaseMap);
+    }
 
     // /************************************* Graph Visualization ***********************************/
 
-    Graph amrGraphNet = g;
-    exportGraphToJsonSimple(amrGraphNet, interaction_json_path.string(), patientToDiseaseMap);
-    exportParentGraphToJson(amrGraphNet, parent_json_path.string(), patientToDiseaseMap, true);
+    exportGraphToJsonSimple(g, interaction_json_path.string(), patientToDiseaseMap);
+    exportParentGraphToJson(g, parent_json_path.string(), patientToDiseaseMap, true);
     exportColocalizationsToJSONByDisease(colocalizationByIndividual, patientToDiseaseMap, temporal_dynamics_json_path.string());
+    if (!entity_timelines_json_path.empty()) {
+        EntityTimelineIndex entityTimelines;
+        buildEntityTimelineIndex(g, entityTimelines);
+        exportEntityTimelinesToJson(entityTimelines, entity_timelines_json_path.string());
+    }
 
 
     return 0;
@@ -2,146 +2,282 @@
 // Developed by Boucher Lab and Slizovskiy Lab.
 
 #include "../include/parser.h"
-#include "../include/id_maps.h"
+#include "../include/entity_catalog.h"
+#include "../include/csv_reader.h"
+#include "../include/patient_set.h"
+#include <charconv>
+#include <iostream>
+#include <string_view>
 #include <fstream>
-#include <sstream>
 #include <filesystem>
 #include <unordered_map>
 #include <unordered_set>
 #include <vector>
 #include <set>
 #include <algorithm>
+#include <iterator>
 #include <map>
 #include <cctype>
+#include <thread>
 
 /* Read input files (CSV), extract (individual, ARG, MGE, timepoint) data */
 
 void addEdge(Graph& graph, const Node& src, const Node& tgt, bool isColo, int patientID) {
+    // insert() returns the existing edge when the key is already present; its payload
+    // is mutable, so patients accumulate in place. A temporal edge has weight 1 however
+    // many patients take the step.
     if (isColo) {
         Node s = std::min(src, tgt);
         Node t = std::max(src, tgt);
-        Edge search_edge = {s, t, true, {}, 0};
-
-        auto it = graph.edges.find(search_edge);
-        if (it != graph.edges.end()) {
-            Edge modified_edge = *it;
-            graph.edges.erase(it);
-            if (patientID != -1) modified_edge.individuals.insert(patientID);
-            graph.edges.insert(modified_edge);
-        } else {
-            if (patientID != -1) search_edge.individuals.insert(patientID);
-            graph.edges.insert(search_edge);
-        }
+        auto [it, inserted] = graph.edges.insert(Edge{s, t, true, {}, 0});
+        if (patientID != -1) it->individuals.insert(patientID);
     } else {
-        Edge search_edge = {src, tgt, false, {}, 0};
-        auto it = graph.edges.find(search_edge);
-        if (it != graph.edges.end()) {
-            Edge modified_edge = *it;
-            graph.edges.erase(it);
-            modified_edge.weight++;
-            graph.edges.insert(modified_edge);
-        } else {
-            search_edge.weight = 1;
-            graph.edges.insert(search_edge);
-        }
+        graph.edges.insert(Edge{src, tgt, false, {}, 1});
     }
 }
 
-// This function reads a CSV file containing patient data and constructs a graph.
-// It extracts ARG and MGE labels, maps them to IDs, and creates nodes and edges
-void parseData(const std::filesystem::path& filename, Graph& graph, std::map<int, std::string>& patientToDiseaseMap, bool includeSNPConfirmationARGs, bool excludeMetals) {
-    std::ifstream infile(filename);
-    std::string line;
-    std::vector<std::string> headers;
-    bool isHeader = true;
-
-    std::unordered_map<std::string, Timepoint> columnToTimepoint;
-
-    while (std::getline(infile, line)) {
-        if (!line.empty() && line.back() == '\r') {
-            line.pop_back();
+// Maps every header column to a timepoint ordinal, or -1 for non-timepoint columns.
+static std::vector<int> mapHeaderColumns(const std::vector<std::string_view>& headers) {
+    std::vector<int> columnOrdinals(headers.size(), -1);
+    for (size_t i = 0; i < headers.size(); ++i) {
+        std::string col(headers[i]);
+        while (!col.empty() && isspace(static_cast<unsigned char>(col.back()))) {
+            col.pop_back();
         }
 
-        std::stringstream ss(line);
-        std::string token;
-        std::vector<std::string> tokens;
-
-        while (std::getline(ss, token, ',')) {
-            tokens.push_back(token);
+        if (col == "Donor") columnOrdinals[i] = timepointOrdinal(Timepoint::Donor);
+        else if (col == "PreFMT") columnOrdinals[i] = timepointOrdinal(Timepoint::PreFMT);
+        else if (col.rfind("PostFMT_", 0) == 0) {
+            std::string day_str = col.substr(8);
+            try {
+                Timepoint tp = static_cast<Timepoint>(std::stoi(day_str));
+                if (isKnownTimepoint(tp) && tp != Timepoint::Donor && tp != Timepoint::PreFMT) {
+                    columnOrdinals[i] = timepointOrdinal(tp);
+                } else {
+                    std::cerr << "Warning: Unknown timepoint in header column: " << col << std::endl;
+                }
+            } catch (const std::invalid_argument& e) {
+                std::cerr << "Warning: Could not parse day from header column: " << col << std::endl;
+            }
         }
+    }
+    return columnOrdinals;
+}
 
-        if (isHeader) {
-            headers = tokens;
-            for (const std::string& col_const : headers) {
-                std::string col = col_const;
-                 while (!col.empty() && isspace(col.back())) {
-                    col.pop_back();
-                }
+// Parses the leading integer of a field such as "12" or "12.0" (the patient column).
+// Fails for IDs outside [0, kMaxPatientID], which a PatientSet cannot hold densely.
+static bool parsePatientID(std::string_view field, int& patientID) {
+    while (!field.empty() && isspace(static_cast<unsigned char>(field.front()))) field.remove_prefix(1);
+    if (!field.empty() && field.front() == '+') field.remove_prefix(1);
+    auto [ptr, ec] = std::from_chars(field.data(), field.data() + field.size(), patientID);
+    return ec == std::errc() && ptr != field.data() && patientID >= 0 && patientID <= kMaxPatientID;
+}
 
-                if (col == "Donor") columnToTimepoint[col] = Timepoint::Donor;
-                else if (col == "PreFMT") columnToTimepoint[col] = Timepoint::PreFMT;
-                else if (col.rfind("PostFMT_", 0) == 0) {
-                    std::string day_str = col.substr(8);
-                    try {
-                        columnToTimepoint[col] = static_cast<Timepoint>(std::stoi(day_str));
-                    } catch (const std::invalid_argument& e) {
-                        std::cerr << "Warning: Could not parse day from header column: " << col << std::endl;
-                    }
-                }
+// ARG / MGE labels that are not in the entity catalog, with the number of rows naming them.
+struct UnknownLabels {
+    size_t rows = 0;
+    std::map<std::string, int, std::less<>> args;
+    std::map<std::string, int, std::less<>> mges;
+
+    static void count(std::map<std::string, int, std::less<>>& labels, std::string_view label, int rows = 1) {
+        auto it = labels.find(label);
+        if (it == labels.end()) it = labels.emplace(std::string(label), 0).first;
+        it->second += rows;
+    }
+
+    void merge(const UnknownLabels& other) {
+        rows += other.rows;
+        for (const auto& [label, n] : other.args) count(args, label, n);
+        for (const auto& [label, n] : other.mges) count(mges, label, n);
+    }
+};
+
+// Warns about the rows parseData dropped because the catalog does not know their labels.
+static void reportUnknownLabels(const std::filesystem::path& filename, const UnknownLabels& unknown) {
+    if (unknown.rows == 0) return;
+    constexpr size_t kListed = 20;
+    std::cerr << "Warning: Skipped " << unknown.rows << " rows of " << filename
+              << " with ARG / MGE labels not in the entity catalog:" << std::endl;
+    auto list = [](const char* kind, const std::map<std::string, int, std::less<>>& labels) {
+        size_t listed = 0;
+        for (const auto& [label, rows] : labels) {
+            if (listed++ == kListed) {
+                std::cerr << "  ... and " << labels.size() - kListed << " more " << kind << " labels" << std::endl;
+                break;
             }
-            isHeader = false;
-            continue;
+            std::cerr << "  " << kind << " \"" << label << "\" (" << rows << (rows == 1 ? " row)" : " rows)") << std::endl;
         }
+    };
+    list("ARG", unknown.args);
+    list("MGE", unknown.mges);
+}
 
-        if (tokens.size() < 4) continue;
+// Adds the nodes and colocalization edges of one data row. Only cells holding "1" or
+// "2" are acted on; every other cell is skipped after a one-character check. With
+// excludeMetals only ARGs of resistance class drugs (the catalog code of "Drugs") are kept.
+static void parseRow(std::string_view line, const std::vector<int>& columnOrdinals, Graph& graph,
+                     std::map<int, std::string>& patientToDiseaseMap, bool includeSNPConfirmationARGs, bool excludeMetals,
+                     CatalogCode drugs, UnknownLabels& unknown, PatientNodes* patientNodes) {
+    // Patient, Disease_type, ARG label, MGE label
+    std::string_view lead[4];
+    size_t pos = 0;
+    for (int f = 0; f < 4; ++f) {
+        if (pos >= line.size()) return; // fewer than four fields
+        size_t comma = line.find(',', pos);
+        if (comma == std::string_view::npos) comma = line.size();
+        lead[f] = line.substr(pos, comma - pos);
+        pos = comma + 1;
+    }
 
-        int patientID = std::stoi(tokens[0]);
-        std::string diseaseType = tokens[1];
-        patientToDiseaseMap[patientID] = diseaseType; 
+    int patientID;
+    if (!parsePatientID(lead[0], patientID)) {
+        std::cerr << "Warning: Skipping row with invalid patient ID: " << lead[0] << std::endl;
+        return;
+    }
+    patientToDiseaseMap[patientID] = std::string(lead[1]);
 
-        std::string argLabel = tokens[2];
-        std::string mgeLabel = tokens[3];
+    const EntityCatalog& catalog = entityCatalog();
+    int argID = catalog.findARG(lead[2]);
+    int mgeID = catalog.findMGE(lead[3]);
 
-        int argID = getARGId(argLabel);
-        int mgeID = getMGEId(mgeLabel);
+    if (argID == -1 || mgeID == -1) {
+        ++unknown.rows;
+        if (argID == -1) UnknownLabels::count(unknown.args, lead[2]);
+        if (mgeID == -1) UnknownLabels::count(unknown.mges, lead[3]);
+        return;
+    }
 
-        if (argID == -1 || mgeID == -1) continue;
+    bool requiresSNPConfirmation = catalog.requiresSNPConfirmation(argID);
+    if (includeSNPConfirmationARGs && requiresSNPConfirmation) return;
 
-        for (size_t i = 4; i < tokens.size(); ++i) {
-            std::string colName = headers[i];
-            if (columnToTimepoint.count(colName) && (tokens[i] == "1" || tokens[i] == "2")) {
-                Timepoint tp = columnToTimepoint.at(colName);
-                
-                bool requiresSNPConfirmation = argIDSNPConfirmation.count(argID) ? argIDSNPConfirmation.at(argID) : false;
-                if (includeSNPConfirmationARGs && requiresSNPConfirmation) continue;
-                
-                std::string argResistance = argResistanceMap.count(argID) ? argResistanceMap.at(argID) : "Unknown";
-                if (excludeMetals && argResistance != "Drugs") continue;
+    if (excludeMetals && (drugs == kNoCatalogCode || catalog.argResistance(argID) != drugs)) return;
 
-                Node argNode = {argID, true, tp, requiresSNPConfirmation};
-                Node mgeNode = {mgeID, false, tp, false};
+    for (size_t column = 4; pos < line.size() && column < columnOrdinals.size(); ++column) {
+        size_t comma = line.find(',', pos);
+        if (comma == std::string_view::npos) comma = line.size();
+        bool present = comma - pos == 1 && (line[pos] == '1' || line[pos] == '2');
+        pos = comma + 1;
+        if (!present || columnOrdinals[column] < 0) continue;
 
-                graph.nodes.insert(argNode);
-                graph.nodes.insert(mgeNode);
+        Timepoint tp = timepointAt(columnOrdinals[column]);
+        Node argNode = {argID, true, tp, requiresSNPConfirmation};
+        Node mgeNode = {mgeID, false, tp, false};
 
-                addEdge(graph, argNode, mgeNode, true, patientID);
-            }
+        graph.nodes.insert(argNode);
+        graph.nodes.insert(mgeNode);
+
+        addEdge(graph, argNode, mgeNode, true, patientID);
+        if (patientNodes && patientID >= 0) {
+            patientNodes->push_back({patientID, argNode});
+            patientNodes->push_back({patientID, mgeNode});
         }
     }
 }
 
+// Splits text into at most `parts` consecutive ranges that each end on a line boundary.
+static std::vector<std::string_view> splitAtLines(std::string_view text, unsigned parts) {
+    std::vector<std::string_view> chunks;
+    size_t begin = 0;
+    for (unsigned i = 1; i <= parts && begin < text.size(); ++i) {
+        size_t end = i == parts ? text.size() : std::max(begin, text.size() / parts * i);
+        end = end < text.size() ? text.find('\n', end) : text.size();
+        end = end == std::string_view::npos ? text.size() : end + 1;
+        chunks.push_back(text.substr(begin, end - begin));
+        begin = end;
+    }
+    return chunks;
+}
 
+// Folds other into graph: nodes are unioned and patients of shared edges are OR-ed.
+// Nodes and edge keys are set-ordered, so the result does not
+// depend on which graph saw an edge first.
+void mergeGraph(Graph& graph, const Graph& other) {
+    graph.nodes.insert(other.nodes.begin(), other.nodes.end());
+    for (const Edge& edge : other.edges) {
+        auto [it, inserted] = graph.edges.insert(edge);
+        if (!inserted) it->individuals |= edge.individuals;
+    }
+}
 
-/**
- * This function adds patient-specific temporal edges between nodes.
- * It creates directed edges ONLY between chronologically adjacent timepoints for the same gene within the same patient.
- * @param graph The graph to which temporal edges will be added.
- */
-void addTemporalEdges(Graph& graph) {
+// This function reads a CSV file containing patient data and constructs a graph.
+// It extracts ARG and MGE labels, maps them to IDs, and creates nodes and edges. Rows whose
+// labels are not in the entity catalog are dropped and summarized in one warning.
+// The file is read into memory in one go and tokenized in place; the header is mapped
+// to timepoints once, so data rows never look columns up by name.
+// With numThreads > 1 the data rows are split into line-aligned chunks that are parsed
+// into thread-local graphs and merged in file order, giving the same graph and
+// patient-disease map as the serial path.
+void parseData(const std::filesystem::path& filename, Graph& graph, std::map<int, std::string>& patientToDiseaseMap, bool includeSNPConfirmationARGs, bool excludeMetals, unsigned numThreads,
+               PatientNodes* patientNodes) {
+    std::string buffer;
+    if (!readFileToBuffer(filename, buffer)) {
+        std::cerr << "Warning: Could not open data file: " << filename << std::endl;
+        return;
+    }
+
+    std::string_view text(buffer);
+    size_t headerEnd = text.find('\n');
+    std::string_view header = text.substr(0, headerEnd);
+    if (!header.empty() && header.back() == '\r') header.remove_suffix(1);
+    std::string_view body = headerEnd == std::string_view::npos ? std::string_view() : text.substr(headerEnd + 1);
+
+    std::vector<std::string_view> headers;
+    splitFields(header, headers);
+    std::vector<int> columnOrdinals = mapHeaderColumns(headers);
+    const CatalogCode drugs = excludeMetals ? entityCatalog().findResistance("Drugs") : kNoCatalogCode;
+
+    auto parseChunk = [&](std::string_view chunk, Graph& target, std::map<int, std::string>& diseases, UnknownLabels& unknown,
+                          PatientNodes* nodes) {
+        forEachLine(chunk, [&](std::string_view line) {
+            parseRow(line, columnOrdinals, target, diseases, includeSNPConfirmationARGs, excludeMetals, drugs, unknown, nodes);
+        });
+    };
+
+    UnknownLabels unknown;
+    std::vector<std::string_view> chunks = splitAtLines(body, std::max(1u, numThreads));
+    if (chunks.size() <= 1) {
+        parseChunk(body, graph, patientToDiseaseMap, unknown, patientNodes);
+        reportUnknownLabels(filename, unknown);
+        return;
+    }
+
+    std::vector<Graph> partialGraphs(chunks.size());
+    std::vector<std::map<int, std::string>> partialDiseases(chunks.size());
+    std::vector<UnknownLabels> partialUnknown(chunks.size());
+    std::vector<PatientNodes> partialNodes(chunks.size());
+    std::vector<std::thread> workers;
+    workers.reserve(chunks.size() - 1);
+    for (size_t i = 1; i < chunks.size(); ++i) {
+        workers.emplace_back(parseChunk, chunks[i], std::ref(partialGraphs[i]), std::ref(partialDiseases[i]), std::ref(partialUnknown[i]),
+                             patientNodes ? &partialNodes[i] : nullptr);
+    }
+    parseChunk(chunks[0], graph, patientToDiseaseMap, unknown, patientNodes);
+    for (std::thread& worker : workers) worker.join();
+
+    // Later rows win for a patient's disease label, as in the serial path.
+    for (size_t i = 1; i < chunks.size(); ++i) {
+        mergeGraph(graph, partialGraphs[i]);
+        for (auto& [patientID, disease] : partialDiseases[i]) {
+            patientToDiseaseMap[patientID] = std::move(disease);
+        }
+        unknown.merge(partialUnknown[i]);
+        if (patientNodes) patientNodes->insert(patientNodes->end(), partialNodes[i].begin(), partialNodes[i].end());
+    }
+    reportUnknownLabels(filename, unknown);
+}
+
+
+
+// Calls step(source, target) for every pair of chronologically adjacent nodes of the same
+// gene within a patient, for every patient in `patients` (all patients when null).
+template <typename Fn>
+static void forEachTemporalStep(const Graph& graph, const PatientSet* patients, Fn&& step) {
     std::map<int, std::set<Node>> nodesByPatient;
     for (const auto& edge : graph.edges) {
         if (!edge.isColo) continue;
+        if (patients && !edge.individuals.intersects(*patients)) continue;
         for (int patientID : edge.individuals) {
+            if (patients && !patients->contains(patientID)) continue;
             nodesByPatient[patientID].insert(edge.source);
             nodesByPatient[patientID].insert(edge.target);
         }
@@ -157,10 +293,116 @@ void addTemporalEdges(Graph& graph) {
             auto nodes = nodeGroup;
             std::sort(nodes.begin(), nodes.end());
             for (size_t i = 0; i < nodes.size() - 1; ++i) {
-                const Node& sourceNode = nodes[i];
-                const Node& targetNode = nodes[i + 1];
-                addEdge(graph, sourceNode, targetNode, false, -1);
+                step(nodes[i], nodes[i + 1]);
             }
         }
     }
-}
\ No newline at end of file
+}
+
+// Distinct temporal steps, sorted by (source, target).
+using Steps = std::vector<std::pair<Node, Node>>;
+
+// Chains of one partition: rows are sorted by (patient, node), so each patient's nodes of
+// one gene are consecutive and in chronological order.
+static void collectTemporalSteps(PatientNodes& rows, Steps& steps) {
+    std::sort(rows.begin(), rows.end(), [](const PatientNode& a, const PatientNode& b) {
+        return a.patientID != b.patientID ? a.patientID < b.patientID : a.node < b.node;
+    });
+    rows.erase(std::unique(rows.begin(), rows.end(), [](const PatientNode& a, const PatientNode& b) {
+        return a.patientID == b.patientID && a.node == b.node;
+    }), rows.end());
+
+    for (size_t i = 1; i < rows.size(); ++i) {
+        const PatientNode& prev = rows[i - 1];
+        const PatientNode& curr = rows[i];
+        if (prev.patientID == curr.patientID && prev.node.id == curr.node.id && prev.node.isARG == curr.node.isARG) {
+            steps.push_back({prev.node, curr.node});
+        }
+    }
+    std::sort(steps.begin(), steps.end());
+    steps.erase(std::unique(steps.begin(), steps.end()), steps.end());
+}
+
+void addTemporalEdges(Graph& graph, PatientNodes patientNodes, unsigned numThreads) {
+    const size_t partitions = std::max(1u, numThreads);
+    std::vector<PatientNodes> byPartition(partitions);
+    if (partitions == 1) {
+        byPartition[0] = std::move(patientNodes);
+    } else {
+        for (const PatientNode& row : patientNodes) byPartition[static_cast<size_t>(row.patientID) % partitions].push_back(row);
+        PatientNodes().swap(patientNodes);
+    }
+
+    std::vector<Steps> partialSteps(partitions);
+    std::vector<std::thread> workers;
+    workers.reserve(partitions - 1);
+    for (size_t i = 1; i < partitions; ++i) {
+        workers.emplace_back(collectTemporalSteps, std::ref(byPartition[i]), std::ref(partialSteps[i]));
+    }
+    collectTemporalSteps(byPartition[0], partialSteps[0]);
+    for (std::thread& worker : workers) worker.join();
+
+    // Reduce: union of the partitions' steps; a step several partitions take is one edge
+    Steps steps = std::move(partialSteps[0]);
+    for (size_t i = 1; i < partitions; ++i) {
+        Steps merged;
+        merged.reserve(steps.size() + partialSteps[i].size());
+        std::set_union(steps.begin(), steps.end(), partialSteps[i].begin(), partialSteps[i].end(), std::back_inserter(merged));
+        steps = std::move(merged);
+    }
+
+    for (const auto& [source, target] : steps) {
+        graph.edges.insert(Edge{source, target, false, {}, 1});
+    }
+}
+
+/**
+ * This function adds patient-specific temporal edges between nodes.
+ * It creates directed edges ONLY between chronologically adjacent timepoints for the same gene within the same patient.
+ * @param graph The graph to which temporal edges will be added.
+ */
+void addTemporalEdges(Graph& graph) {
+    PatientNodes patientNodes;
+    for (const auto& edge : graph.edges) {
+        if (!edge.isColo) continue;
+        for (int patientID : edge.individuals) {
+            patientNodes.push_back({patientID, edge.source});
+            patientNodes.push_back({patientID, edge.target});
+        }
+    }
+    addTemporalEdges(graph, std::move(patientNodes));
+}
+
+// Adds the temporal chains of the given patients only.
+void addTemporalEdges(Graph& graph, const PatientSet& patients) {
+    forEachTemporalStep(graph, &patients, [&graph](const Node& source, const Node& target) {
+        addEdge(graph, source, target, false, -1);
+    });
+}
+
+// Takes the temporal chains of the given patients back out: a step is erased unless a
+// patient outside the set also takes it. Such a patient has colocalizations at the step's
+// source, so only the patients of those edges are walked again.
+void removeTemporalEdges(Graph& graph, const PatientSet& patients) {
+    std::set<std::pair<Node, Node>> steps;
+    std::set<Node> sources;
+    forEachTemporalStep(graph, &patients, [&](const Node& source, const Node& target) {
+        steps.insert({source, target});
+        sources.insert(source);
+    });
+    if (steps.empty()) return;
+
+    PatientSet others;
+    for (const auto& edge : graph.edges) {
+        if (!edge.isColo || (!sources.count(edge.source) && !sources.count(edge.target))) continue;
+        for (int patientID : edge.individuals) {
+            if (!patients.contains(patientID)) others.insert(patientID);
+        }
+    }
+    forEachTemporalStep(graph, &others, [&steps](const Node& source, const Node& target) {
+        steps.erase({source, target});
+    });
+    for (const auto& [source, target] : steps) {
+        graph.edges.erase(Edge{source, target, false, {}, 0});
+    }
+}
@@ -4,8 +4,10 @@
 /* Traverse the graph based on earliest colocalizations */
 #include "../include/traversal.h"
 #include "../include/graph.h"
+#include "../include/csr_graph.h"
 #include "../include/Timepoint.h"
 #include "../include/id_maps.h"
+#include "../include/thread_pool.h"
 #include <map>
 #include <tuple>
 #include <set>
@@ -13,6 +15,7 @@
 #include <unordered_set>
 #include <vector>
 #include <algorithm>
+#include <atomic>
 #include <queue>
 
 // This function traverses the graph and collects colocalization timepoints for each ARG and MGE pair.
@@ -38,11 +41,28 @@ void traverseAdjacency(const Graph& graph, const std::unordered_map<Node, std::u
 }
 
 
+// CSR variant of traverseAdjacency: ARG nodes only have MGE colocalization neighbors.
+void traverseAdjacency(const CSRGraph& csr, std::map<std::pair<int, int>, std::multiset<Timepoint>>& colocalizationTimeline) {
+    for (uint32_t n = 0; n < csr.nodeCount(); ++n) {
+        const Node& node = csr.nodes[n];
+        if (!node.isARG) continue;
+
+        for (uint32_t k = csr.coloOffsets[n]; k < csr.coloOffsets[n + 1]; ++k) {
+            const Node& neighbor = csr.nodes[csr.coloNeighbors[k]];
+            if (neighbor.isARG) continue;
+            colocalizationTimeline[{node.id, neighbor.id}].insert(node.timepoint);
+        }
+    }
+}
+
+
 // The function builds a timeline of colocalizations for each individual, ARG, and MGE pair, allowing for further analysis of colocalization patterns over time.
 // This allows for efficient tracking of colocalization events for each individual across different ARG and MGE pairs.
+// Rows are collected per edge and individual, then merged into the table with one sort.
 void traverseGraph(const Graph& graph, 
-    std::map<std::tuple<int, int, int>, std::set<Timepoint>>& colocalizationByIndividual) {
+    IndividualTimelines& colocalizationByIndividual) {
     // std::unordered_map<Node, std::unordered_set<Node>> adjacency;
+    std::vector<IndividualTimelines::value_type> rows;
     for (const auto& edge : graph.edges) {
         if (!edge.isColo) continue;
         int arg_id = edge.source.isARG ? edge.source.id : edge.target.id;
@@ -50,10 +70,10 @@ void traverseGraph(const Graph& graph,
         Timepoint tp = edge.source.timepoint; // or target.timepoint
 
         for (int ind_id : edge.individuals) {
-            auto key = std::make_tuple(ind_id, arg_id, mge_id);
-            colocalizationByIndividual[key].insert(tp);
+            rows.push_back({std::make_tuple(ind_id, arg_id, mge_id), timepointBit(tp)});
         }
     }
+    colocalizationByIndividual.add(std::move(rows));
 }
 
 
@@ -61,8 +81,7 @@ void traverseGraph(const Graph& graph,
 /********************************************  Traverse by Time 1 (not considering patients) ******************************************/
 // This version considers only the first occurrence of colocalization between ARG and MGE
 // It builds a timeline of colocalizations for each ARG and MGE pair, without individual
-void findFirstOccurrence(const Graph& graph, std::unordered_map<Node, std::unordered_set<Node>>& adjacency,
-                     std::map<std::pair<int, int>, Node>& firstOccurrence){
+static void collectFirstOccurrences(const Graph& graph, std::map<std::pair<int, int>, Node>& firstOccurrence) {
     for (const auto& edge : graph.edges) {
         if (!edge.isColo) continue;
 
@@ -78,6 +97,11 @@ void findFirstOccurrence(const Graph& graph, std::unordered_map<Node, std::unord
     // std::cout << "First occurrences: " << firstOccurrence.size() << "\n";
 }
 
+void findFirstOccurrence(const Graph& graph, std::unordered_map<Node, std::unordered_set<Node>>& adjacency,
+                     std::map<std::pair<int, int>, Node>& firstOccurrence){
+    collectFirstOccurrences(graph, firstOccurrence);
+}
+
 
 // This function performs a BFS-like traversal starting from the first occurrence node
 // It explores the graph in a forward-in-time manner, collecting colocalization timepoints for the ARG and MGE pair.
@@ -121,12 +145,140 @@ void traverseTempGraph(const Graph& graph, std::unordered_map<Node, std::unorder
 
 
 
+// CSR variant of bfsTemporal. The search runs level by level and expands each level in
+// node-index order, so the result is deterministic (the hash-ordered adjacency version
+// may pick a different discovering neighbor when several reach a node in one level).
+void bfsTemporal(const Node& start, const CSRGraph& csr, std::map<std::pair<int, int>, std::set<Timepoint>>& colocalizationTimeline) {
+    int startIndex = csr.indexOf(start);
+    if (startIndex < 0) return;
+
+    std::vector<char> visited(csr.nodeCount(), 0);
+    std::vector<uint32_t> frontier = {static_cast<uint32_t>(startIndex)};
+    std::vector<uint32_t> next;
+    visited[startIndex] = 1;
+
+    auto visit = [&](const Node& curr, uint32_t neighborIndex) {
+        const Node& neighbor = csr.nodes[neighborIndex];
+        if (neighbor.timepoint < curr.timepoint) return; // Enforce forward-in-time
+        if (visited[neighborIndex]) return;
+
+        visited[neighborIndex] = 1;
+        next.push_back(neighborIndex);
+
+        if (curr.isARG != neighbor.isARG) {
+            int arg = curr.isARG ? curr.id : neighbor.id;
+            int mge = curr.isARG ? neighbor.id : curr.id;
+            colocalizationTimeline[{arg, mge}].insert(neighbor.timepoint);
+        }
+    };
+
+    while (!frontier.empty()) {
+        std::sort(frontier.begin(), frontier.end());
+        for (uint32_t n : frontier) {
+            const Node& curr = csr.nodes[n];
+            for (uint32_t k = csr.coloOffsets[n]; k < csr.coloOffsets[n + 1]; ++k) visit(curr, csr.coloNeighbors[k]);
+            for (uint32_t k = csr.temporalOffsets[n]; k < csr.temporalOffsets[n + 1]; ++k) visit(curr, csr.temporalNeighbors[k]);
+        }
+        frontier.swap(next);
+        next.clear();
+    }
+}
+
+// Multi-source form of the CSR bfsTemporal. Each node keeps kSourceWords words of per-start
+// bits (seen, current frontier, next frontier) and every level expands the frontier nodes in
+// node-index order, once for all starts that reached them. A start's bit reaches a neighbor
+// from the same node, in the same order, as its own search would discover it, so the pairs
+// and timepoints recorded are exactly those of the single-source searches.
+void bfsTemporalMultiSource(const std::vector<Node>& starts, const CSRGraph& csr,
+                 std::map<std::pair<int, int>, std::set<Timepoint>>& colocalizationTimeline) {
+    constexpr size_t kSourceWords = 4;
+    constexpr size_t kSourcesPerPass = 64 * kSourceWords;
+
+    std::vector<uint32_t> startIndices;
+    startIndices.reserve(starts.size());
+    for (const Node& start : starts) {
+        int startIndex = csr.indexOf(start);
+        if (startIndex >= 0) startIndices.push_back(static_cast<uint32_t>(startIndex));
+    }
+
+    const size_t nodeCount = csr.nodeCount();
+    std::vector<uint64_t> seen(nodeCount * kSourceWords), frontier(nodeCount * kSourceWords), next(nodeCount * kSourceWords);
+    std::vector<char> queued(nodeCount, 0);   // already in nextNodes
+    std::vector<uint32_t> frontierNodes, nextNodes;
+
+    auto visit = [&](uint32_t n, uint32_t neighborIndex) {
+        const Node& curr = csr.nodes[n];
+        const Node& neighbor = csr.nodes[neighborIndex];
+        if (neighbor.timepoint < curr.timepoint) return; // Enforce forward-in-time
+
+        const uint64_t* reaching = &frontier[n * kSourceWords];
+        uint64_t* neighborSeen = &seen[neighborIndex * kSourceWords];
+        uint64_t* neighborNext = &next[neighborIndex * kSourceWords];
+        uint64_t discovered = 0;
+        for (size_t w = 0; w < kSourceWords; ++w) {
+            uint64_t fresh = reaching[w] & ~neighborSeen[w];
+            neighborSeen[w] |= fresh;
+            neighborNext[w] |= fresh;
+            discovered |= fresh;
+        }
+        if (!discovered) return;
+
+        if (!queued[neighborIndex]) {
+            queued[neighborIndex] = 1;
+            nextNodes.push_back(neighborIndex);
+        }
+        if (curr.isARG != neighbor.isARG) {
+            int arg = curr.isARG ? curr.id : neighbor.id;
+            int mge = curr.isARG ? neighbor.id : curr.id;
+            colocalizationTimeline[{arg, mge}].insert(neighbor.timepoint);
+        }
+    };
+
+    for (size_t base = 0; base < startIndices.size(); base += kSourcesPerPass) {
+        std::fill(seen.begin(), seen.end(), 0);
+        frontierNodes.clear();
+        const size_t batch = std::min(kSourcesPerPass, startIndices.size() - base);
+        for (size_t i = 0; i < batch; ++i) {
+            uint32_t s = startIndices[base + i];
+            seen[s * kSourceWords + i / 64] |= uint64_t{1} << (i % 64);
+            frontier[s * kSourceWords + i / 64] |= uint64_t{1} << (i % 64);
+            frontierNodes.push_back(s);
+        }
+        std::sort(frontierNodes.begin(), frontierNodes.end());
+        frontierNodes.erase(std::unique(frontierNodes.begin(), frontierNodes.end()), frontierNodes.end());
+
+        while (!frontierNodes.empty()) {
+            for (uint32_t n : frontierNodes) {
+                for (uint32_t k = csr.coloOffsets[n]; k < csr.coloOffsets[n + 1]; ++k) visit(n, csr.coloNeighbors[k]);
+                for (uint32_t k = csr.temporalOffsets[n]; k < csr.temporalOffsets[n + 1]; ++k) visit(n, csr.temporalNeighbors[k]);
+            }
+            for (uint32_t n : frontierNodes) std::fill_n(&frontier[n * kSourceWords], kSourceWords, 0);
+            frontier.swap(next);   // next is all zero again: only frontier nodes had bits
+
+            for (uint32_t n : nextNodes) queued[n] = 0;
+            std::sort(nextNodes.begin(), nextNodes.end());
+            frontierNodes.swap(nextNodes);
+            nextNodes.clear();
+        }
+    }
+}
+
+void traverseTempGraph(const Graph& graph, const CSRGraph& csr,
+                     std::map<std::pair<int, int>, Node>& firstOccurrence, std::map<std::pair<int, int>, std::set<Timepoint>>& colocalizationsByTime){
+    collectFirstOccurrences(graph, firstOccurrence);
+    std::vector<Node> starts;
+    starts.reserve(firstOccurrence.size());
+    for (const auto& [key, startNode] : firstOccurrence) starts.push_back(startNode);
+    bfsTemporalMultiSource(starts, csr, colocalizationsByTime);
+}
+
+
+
 /************************************************  Traverse by Time 2  **********************************************/
 // This version considers individuals and their first occurrence of colocalization
 // It builds a timeline of colocalizations for each individual, ARG, and MGE pair
-void findFirstOccurrenceByInd(
+static void collectFirstOccurrencesByInd(
     const Graph& graph,
-    std::unordered_map<Node, std::unordered_set<Node>>& adjacency,
     std::map<std::tuple<int, int, int>, Node>& firstOccurrenceByInd // This will store the first occurrence of the ARG-MGE pair for the individual (e.g{[key], srcNode(ARG)} )
 ) {
     for (const auto& edge : graph.edges) {
@@ -151,6 +303,14 @@ void findFirstOccurrenceByInd(
     std::cout << "First occurrences by individual found: " << firstOccurrenceByInd.size() << "\n";
 }
 
+void findFirstOccurrenceByInd(
+    const Graph& graph,
+    std::unordered_map<Node, std::unordered_set<Node>>& adjacency,
+    std::map<std::tuple<int, int, int>, Node>& firstOccurrenceByInd
+) {
+    collectFirstOccurrencesByInd(graph, firstOccurrenceByInd);
+}
+
 
 
 // This function performs a BFS-like traversal starting from the first occurrence node
@@ -158,9 +318,9 @@ void findFirstOccurrenceByInd(
 void temporalTimelineTraversal(
     const Node& start,
     const std::unordered_map<Node, std::unordered_set<Node>>& adjacency,
-    const std::map<std::pair<Node, Node>, std::vector<Edge>>& edgeMap,
+    const EdgeHandleMap& edgeMap,
     int ind, int arg, int mge,
-    std::map<std::tuple<int, int, int>, std::set<Timepoint>>& colocalizationTimelineByInd
+    std::vector<IndividualTimelines::value_type>& timelineRows
 ) {
     std::queue<Node> q;
     std::unordered_set<Node> visited;
@@ -168,8 +328,7 @@ void temporalTimelineTraversal(
     q.push(start);
     visited.insert(start);
 
-    auto key = std::make_tuple(ind, arg, mge);
-    colocalizationTimelineByInd[key].insert(start.timepoint);
+    TimepointMask timepoints = timepointBit(start.timepoint);
 
     while (!q.empty()) {
         Node curr = q.front();
@@ -182,14 +341,14 @@ void temporalTimelineTraversal(
             auto it = edgeMap.find({curr, neighbor});
             if (it == edgeMap.end()) continue;
 
-            for (const Edge& edge : it->second) {
-                if (!edge.isColo || !edge.individuals.count(ind)) continue;
+            for (const Edge* edge : it->second) {
+                if (!edge->isColo || !edge->individuals.count(ind)) continue;
 
                 int this_arg = curr.isARG ? curr.id : neighbor.id;
                 int this_mge = curr.isARG ? neighbor.id : curr.id;
 
                 if (this_arg == arg && this_mge == mge) {
-                    colocalizationTimelineByInd[key].insert(neighbor.timepoint);
+                    timepoints |= timepointBit(neighbor.timepoint);
                     visited.insert(neighbor);
                     q.push(neighbor);
                     break; // one valid edge is enough
@@ -197,25 +356,154 @@ void temporalTimelineTraversal(
             }
         }
     }
+    timelineRows.push_back({std::make_tuple(ind, arg, mge), timepoints});
+}
+
+void buildEdgeHandleMap(const Graph& graph, EdgeHandleMap& edgeMap) {
+    edgeMap.clear();
+    edgeMap.reserve(2 * graph.edges.size());
+    for (const auto& edge : graph.edges) {
+        edgeMap[{edge.source, edge.target}].push_back(&edge);
+        edgeMap[{edge.target, edge.source}].push_back(&edge); // undirected lookup
+    }
 }
 
 // Builds an edge map for efficient lookup of edges between nodes.
 // The adjacency map is used to represent the graph structure, allowing for efficient traversal of nodes and their neighbors based on the defined edges.
 // The function iterates over the first occurrences of each ARG-MGE pair and performs a BFS traversal starting from each first occurrence node. During the traversal, it collects colocalization timepoints for the specified individual, ARG, and MGE pair, ensuring that only valid colocalizations are recorded.
 void traverseGraphByInd(const Graph& graph, std::unordered_map<Node, std::unordered_set<Node>>& adjacency, const std::set<Edge>& edges,
-                     std::map<std::tuple<int, int, int>, Node>& firstOccurrenceByInd, std::map<std::tuple<int, int, int>, std::set<Timepoint>>& colocalizationTimelineByInd) {
+                     std::map<std::tuple<int, int, int>, Node>& firstOccurrenceByInd, IndividualTimelines& colocalizationTimelineByInd) {
     findFirstOccurrenceByInd(graph, adjacency, firstOccurrenceByInd);
-    std::map<std::pair<Node, Node>, std::vector<Edge>> edgeMap;
-    
-    for (const auto& edge : graph.edges) {
-        edgeMap[{edge.source, edge.target}].push_back(edge);
-        edgeMap[{edge.target, edge.source}].push_back(edge); // undirected lookup
-    }
+    EdgeHandleMap edgeMap;
+    buildEdgeHandleMap(graph, edgeMap);
 
+    std::vector<IndividualTimelines::value_type> timelineRows;
     for (const auto& [key, startNode] : firstOccurrenceByInd) {
         auto [ind, arg, mge] = key;
-        temporalTimelineTraversal(startNode, adjacency, edgeMap, ind, arg, mge, colocalizationTimelineByInd);
+        temporalTimelineTraversal(startNode, adjacency, edgeMap, ind, arg, mge, timelineRows);
+    }
+    colocalizationTimelineByInd.add(std::move(timelineRows));
+}
+
+
+
+
+void TraversalScratch::begin(size_t nodeCount) {
+    if (visitedBy.size() != nodeCount) {
+        visitedBy.assign(nodeCount, 0);
+        traversal = 0;
+    }
+    if (++traversal == 0) {   // wrapped: old marks would alias the new number
+        std::fill(visitedBy.begin(), visitedBy.end(), 0);
+        traversal = 1;
+    }
+    queue.clear();
+}
+
+// CSR variant of temporalTimelineTraversal. Only colocalization edges can satisfy the
+// (ind, arg, mge) check, so only colocalization neighbors are expanded; the patient test
+// is a bit lookup on the edge instead of an edge-map search.
+void temporalTimelineTraversal(
+    const Node& start,
+    const CSRGraph& csr,
+    int ind, int arg, int mge,
+    std::vector<IndividualTimelines::value_type>& timelineRows
+) {
+    TraversalScratch scratch;
+    temporalTimelineTraversal(start, csr, ind, arg, mge, timelineRows, scratch);
+}
+
+void temporalTimelineTraversal(
+    const Node& start,
+    const CSRGraph& csr,
+    int ind, int arg, int mge,
+    std::vector<IndividualTimelines::value_type>& timelineRows,
+    TraversalScratch& scratch
+) {
+    TimepointMask timepoints = timepointBit(start.timepoint);
+
+    int startIndex = csr.indexOf(start);
+    if (startIndex < 0) {
+        timelineRows.push_back({std::make_tuple(ind, arg, mge), timepoints});
+        return;
+    }
+
+    // FIFO over scratch.queue: nodes are appended and read from head, never popped
+    scratch.begin(csr.nodeCount());
+    scratch.queue.push_back(startIndex);
+    scratch.markVisited(startIndex);
+
+    for (size_t head = 0; head < scratch.queue.size(); ++head) {
+        uint32_t n = scratch.queue[head];
+        const Node& curr = csr.nodes[n];
+
+        for (uint32_t k = csr.coloOffsets[n]; k < csr.coloOffsets[n + 1]; ++k) {
+            uint32_t neighborIndex = csr.coloNeighbors[k];
+            const Node& neighbor = csr.nodes[neighborIndex];
+            if (neighbor.timepoint < curr.timepoint) continue;
+            if (scratch.visited(neighborIndex)) continue;
+            if (!csr.edgeHasPatient(csr.coloEdgeIds[k], ind)) continue;
+
+            int this_arg = curr.isARG ? curr.id : neighbor.id;
+            int this_mge = curr.isARG ? neighbor.id : curr.id;
+            if (this_arg != arg || this_mge != mge) continue;
+
+            timepoints |= timepointBit(neighbor.timepoint);
+            scratch.markVisited(neighborIndex);
+            scratch.queue.push_back(neighborIndex);
+        }
     }
+    timelineRows.push_back({std::make_tuple(ind, arg, mge), timepoints});
+}
+
+void traverseGraphByInd(const Graph& graph, const CSRGraph& csr,
+                     std::map<std::tuple<int, int, int>, Node>& firstOccurrenceByInd, IndividualTimelines& colocalizationTimelineByInd,
+                     unsigned numThreads) {
+    collectFirstOccurrencesByInd(graph, firstOccurrenceByInd);
+    traverseFirstOccurrencesByInd(csr, firstOccurrenceByInd, colocalizationTimelineByInd, numThreads);
+}
+
+void traverseFirstOccurrencesByInd(const CSRGraph& csr, const std::map<std::tuple<int, int, int>, Node>& firstOccurrenceByInd,
+                     IndividualTimelines& colocalizationTimelineByInd, unsigned numThreads) {
+    using Start = std::pair<const std::tuple<int, int, int>, Node>;
+    std::vector<const Start*> starts;
+    starts.reserve(firstOccurrenceByInd.size());
+    for (const Start& start : firstOccurrenceByInd) starts.push_back(&start);
+
+    // Small blocks keep the workers busy to the end: BFS cost varies a lot between starts
+    constexpr size_t kBlockStarts = 256;
+    const size_t blockCount = (starts.size() + kBlockStarts - 1) / kBlockStarts;
+    std::vector<std::vector<IndividualTimelines::value_type>> blockRows(blockCount);
+    std::atomic<size_t> nextBlock{0};
+
+    auto worker = [&] {
+        TraversalScratch scratch;
+        for (size_t block = nextBlock++; block < blockCount; block = nextBlock++) {
+            const size_t begin = block * kBlockStarts;
+            const size_t end = std::min(starts.size(), begin + kBlockStarts);
+            blockRows[block].reserve(end - begin);
+            for (size_t i = begin; i < end; ++i) {
+                auto [ind, arg, mge] = starts[i]->first;
+                temporalTimelineTraversal(starts[i]->second, csr, ind, arg, mge, blockRows[block], scratch);
+            }
+        }
+    };
+
+    const size_t workers = std::min<size_t>(std::max(1u, numThreads), blockCount);
+    if (workers <= 1) {
+        worker();
+    } else {
+        ThreadPool pool(static_cast<unsigned>(workers - 1));
+        std::vector<std::future<void>> tasks;
+        for (size_t i = 1; i < workers; ++i) tasks.push_back(pool.submit(worker));
+        worker();
+        waitAll(tasks);
+    }
+
+    std::vector<IndividualTimelines::value_type> timelineRows;
+    timelineRows.reserve(starts.size());
+    for (const auto& rows : blockRows) timelineRows.insert(timelineRows.end(), rows.begin(), rows.end());
+    colocalizationTimelineByInd.add(std::move(timelineRows));
 }
 
 
@@ -231,10 +519,8 @@ std::vector<std::pair<int, int>> getTopKEntities(const Graph& graph, bool isARG,
         const Node& node = isARG ? edge.source : edge.target;
  
         if (node.isARG == isARG && node.timepoint != Timepoint::Donor) {
-            for (size_t i = 0; i < edge.individuals.size(); ++i) {
-                // Count occurrences of ARG or MGE by individual
-                countMap[node.id]++;
-            }
+            // Count occurrences of ARG or MGE by individual
+            countMap[node.id] += static_cast<int>(edge.individuals.size());
         }
     }
 
@@ -261,9 +547,10 @@ void getTimelineForARG(const Graph& graph, const std::string& argName) {
     for (const Edge& edge: graph.edges){
         if (!edge.isColo) continue;
 
-        if (edge.source.id == argID || edge.target.id == argID) {
-            int mgeID = edge.source.id == argID ? edge.target.id : edge.source.id;
-            for (size_t i = 0; i < edge.individuals.size(); ++i) {
+        bool sourceIsARG = edge.source.isARG && edge.source.id == argID;
+        if (sourceIsARG || (edge.target.isARG && edge.target.id == argID)) {
+            int mgeID = sourceIsARG ? edge.target.id : edge.source.id;
+            if (!edge.individuals.empty()) {
                 timeline[mgeID].insert(edge.source.timepoint);
             }
             
@@ -294,9 +581,10 @@ void getTimelineForMGE(const Graph& graph, const std::string& mgeName) {
     }
     for (const Edge& edge: graph.edges){
         if (!edge.isColo) continue;
-        if (edge.source.id == mgeID || edge.target.id == mgeID) {
-            int argID = edge.source.id == mgeID ? edge.target.id : edge.source.id;
-            for (size_t i = 0; i < edge.individuals.size(); ++i) {
+        bool sourceIsMGE = !edge.source.isARG && edge.source.id == mgeID;
+        if (sourceIsMGE || (!edge.target.isARG && edge.target.id == mgeID)) {
+            int argID = sourceIsMGE ? edge.target.id : edge.source.id;
+            if (!edge.individuals.empty()) {
                 // Insert the timepoint for the ARG-MGE colocalization
                 timeline[argID].insert(edge.source.timepoint);
             }
@@ -337,3 +625,62 @@ std::map<Timepoint, int> computeNodeDegreeOverTime(const Graph& graph, bool isAR
 
     return degreeOverTime;
 }
+
+
+// Prints one entity's partners and their timepoints; returns the number of timepoints listed.
+static int printPartnerTimelines(const EntityTimeline* timeline, const char* partnerLabel, std::string (*partnerName)(int)) {
+    int count = 0;
+    if (!timeline) return count;
+    for (const EntityPartnerTimeline& partner : timeline->partners) {
+        std::cout << "  " << partnerLabel << " ID: " << partnerName(partner.partnerID) << ", Timepoints: ";
+        forEachTimepoint(partner.timepoints, [&count](Timepoint tp) {
+            count++;
+            std::cout << tp << " ";
+        });
+        std::cout << "\n";
+    }
+    return count;
+}
+
+void getTimelineForARG(const EntityTimelineIndex& index, const std::string& argName) {
+    int argID = getARGId(argName);
+    if (argID == -1) {
+        std::cerr << "ARG with name '" << argName << "' not found.\n";
+        return;
+    }
+    const EntityTimeline* timeline = index.find(true, argID);
+    std::cout << "Timeline for ARG ID " << argID << ":\n";
+    int count = printPartnerTimelines(timeline, "MGE", getMGEName);
+    std::cout << "Total MGEs colocalized with ARG " << argName << ": " << (timeline ? timeline->partners.size() : 0) << "\n";
+    std::cout << "Total number of Timepoints for ARG " << argName << ": " << count << "\n";
+}
+
+void getTimelineForMGE(const EntityTimelineIndex& index, const std::string& mgeName) {
+    int mgeID = getMGEId(mgeName);
+    if (mgeID == -1) {
+        std::cerr << "MGE with name '" << mgeName << "' not found.\n";
+        return;
+    }
+    const EntityTimeline* timeline = index.find(false, mgeID);
+    std::cout << "Timeline for MGE " << mgeName << ":\n";
+    int count = printPartnerTimelines(timeline, "ARG", getARGName);
+    std::cout << "Total ARGs colocalized with MGE " << mgeName << ": " << (timeline ? timeline->partners.size() : 0) << "\n";
+    std::cout << "Total number of Timepoints for MGE " << mgeName << ": " << count << "\n";
+}
+
+std::map<Timepoint, int> computeNodeDegreeOverTime(const EntityTimelineIndex& index, bool isARG, const std::string& name) {
+    std::map<Timepoint, int> degreeOverTime;
+
+    int nodeID = isARG ? getARGId(name) : getMGEId(name);
+    if (nodeID == -1) {
+        std::cerr << "Node with name '" << name << "' not found.\n";
+        return degreeOverTime;
+    }
+
+    const EntityTimeline* timeline = index.find(isARG, nodeID);
+    if (!timeline) return degreeOverTime;
+    for (int ordinal = 0; ordinal < kTimepointCount; ++ordinal) {
+        if (timeline->degree[ordinal]) degreeOverTime.emplace(timepointAt(ordinal), timeline->degree[ordinal]);
+    }
+    return degreeOverTime;
+}
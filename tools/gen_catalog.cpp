@@ -0,0 +1,205 @@
+// Released under the GNU GPLv3; see LICENSE for details.
+// Developed by Boucher Lab and Slizovskiy Lab.
+
+// gen_catalog <catalog dir> <output.cpp>
+// gen_catalog --check-legacy <id_maps.cpp> <catalog dir>
+//
+// Build step that turns the catalog tables (args.tsv, mges.tsv) into a translation unit
+// defining builtinEntityCatalog() over constexpr arrays, so the catalog costs no startup
+// work. With --check-legacy it instead diffs the tables against the static unordered_map
+// initializers of a former id_maps.cpp, entry by entry.
+
+#include <fstream>
+#include <iostream>
+#include <map>
+#include <sstream>
+#include <string>
+#include <vector>
+#include "../include/catalog_tables.h"
+
+static void writeLiteral(std::ostream& out, std::string_view text) {
+    static const char octal[] = "01234567";
+    out << '"';
+    for (char c : text) {
+        unsigned char u = static_cast<unsigned char>(c);
+        if (c == '"' || c == '\\') {
+            out << '\\' << c;
+        } else if (u < 0x20 || u == 0x7F) {
+            out << '\\' << octal[(u >> 6) & 7] << octal[(u >> 3) & 7] << octal[u & 7];
+        } else {
+            out << c;
+        }
+    }
+    out << '"';
+}
+
+static void writeValue(std::ostream& out, int value) { out << value; }
+static void writeValue(std::ostream& out, unsigned value) { out << value; }
+static void writeValue(std::ostream& out, std::string_view value) { writeLiteral(out, value); }
+static void writeValue(std::ostream& out, const CatalogNameEntry& entry) {
+    out << '{';
+    writeLiteral(out, entry.name);
+    out << ", " << entry.id << '}';
+}
+
+// Writes "constexpr type name[] = {...};" (nothing for an empty column) and returns the
+// initializer of the matching CatalogColumn.
+template <typename T, typename Out = T>
+static std::string writeArray(std::ostream& out, const char* type, const char* name, const std::vector<T>& values, size_t perLine) {
+    if (values.empty()) return "{nullptr, 0}";
+    out << "constexpr " << type << ' ' << name << "[] = {";
+    for (size_t i = 0; i < values.size(); ++i) {
+        out << (i % perLine == 0 ? "\n    " : " ");
+        writeValue(out, static_cast<Out>(values[i]));
+        out << ',';
+    }
+    out << "\n};\n\n";
+    return "{" + std::string(name) + ", " + std::to_string(values.size()) + "}";
+}
+
+// Map name -> id -> value (booleans as "0" / "1")
+using LegacyMaps = std::map<std::string, std::map<int, std::string>>;
+
+// Reads the "const std::unordered_map<int, ...> name = {" initializers of a former id_maps.cpp:
+// one {id, "value"} or {id, true|false} entry per line; commented-out lines are skipped and,
+// like the initializer list, the first entry of a repeated id wins.
+static bool readLegacyMaps(const std::filesystem::path& file, LegacyMaps& maps) {
+    std::ifstream in(file);
+    if (!in) {
+        std::cerr << "gen_catalog: cannot open " << file.string() << "\n";
+        return false;
+    }
+    std::map<int, std::string>* current = nullptr;
+    std::string line;
+    while (std::getline(in, line)) {
+        size_t first = line.find_first_not_of(" \t");
+        if (first == std::string::npos || line.compare(first, 2, "//") == 0) continue;
+        if (line.compare(0, 24, "const std::unordered_map") == 0) {
+            size_t end = line.find(" = {");
+            size_t begin = line.rfind(' ', end - 1) + 1;
+            current = &maps[line.substr(begin, end - begin)];
+            continue;
+        }
+        if (!current) continue;
+        if (line.compare(first, 2, "};") == 0) {
+            current = nullptr;
+            continue;
+        }
+        size_t comma = line.find(',', first);
+        if (line[first] != '{' || comma == std::string::npos) continue;
+        int id = std::stoi(line.substr(first + 1, comma - first - 1));
+        size_t open = line.find('"', comma);
+        std::string value;
+        if (open != std::string::npos) {
+            value = line.substr(open + 1, line.find('"', open + 1) - open - 1);
+        } else {
+            value = line.find("true", comma) != std::string::npos ? "1" : "0";
+        }
+        current->emplace(id, value);
+    }
+    return true;
+}
+
+// The same maps rebuilt from the tables: an empty field is an id missing from that map.
+static void tablesAsLegacyMaps(const CatalogTables& tables, LegacyMaps& maps) {
+    auto put = [&maps](const char* name, int id, const std::string& value) {
+        if (!value.empty()) maps[name].emplace(id, value);
+    };
+    for (const CatalogArgRow& row : tables.args) {
+        put("argIdMap", row.id, row.name);
+        put("argGroupMap", row.id, row.group);
+        put("argResistanceMap", row.id, row.resistance);
+        put("argIDSNPConfirmation", row.id, row.requiresSNPConfirmation ? "1" : "0");
+    }
+    for (const CatalogMGERow& row : tables.mges) {
+        put("mgeIdMap", row.id, row.name);
+        put("mgeNameMap", row.id, row.label);
+        put("mgeGroupMap", row.id, row.group);
+    }
+}
+
+static int checkLegacy(const std::filesystem::path& legacyFile, const std::filesystem::path& dir) {
+    LegacyMaps legacy, generated;
+    CatalogTables tables;
+    if (!readLegacyMaps(legacyFile, legacy) || !readCatalogTables(dir / "args.tsv", dir / "mges.tsv", tables)) return 1;
+    tablesAsLegacyMaps(tables, generated);
+
+    size_t differences = 0;
+    auto report = [&differences](const std::string& map, int id, const char* what, const std::string& value) {
+        if (++differences <= 20) std::cerr << "  " << map << "[" << id << "] " << what << " \"" << value << "\"\n";
+    };
+    for (const auto& [name, entries] : legacy) generated[name];
+    for (const auto& [name, entries] : generated) {
+        const std::map<int, std::string>& old = legacy[name];
+        for (const auto& [id, value] : entries) {
+            auto it = old.find(id);
+            if (it == old.end()) report(name, id, "only in the tables:", value);
+            else if (it->second != value) report(name, id, "differs, tables:", value);
+        }
+        for (const auto& [id, value] : old) {
+            if (!entries.count(id)) report(name, id, "only in the legacy maps:", value);
+        }
+    }
+    if (differences > 0) {
+        std::cerr << "gen_catalog: " << differences << " differences between " << legacyFile.string() << " and " << dir.string() << "\n";
+        return 1;
+    }
+    std::cout << "gen_catalog: " << legacy.size() << " legacy maps match " << dir.string() << "\n";
+    return 0;
+}
+
+int main(int argc, char* argv[]) {
+    if (argc == 4 && std::string(argv[1]) == "--check-legacy") return checkLegacy(argv[2], argv[3]);
+    if (argc != 3) {
+        std::cerr << "Usage: gen_catalog <catalog dir> <output.cpp>\n"
+                  << "       gen_catalog --check-legacy <id_maps.cpp> <catalog dir>\n";
+        return 2;
+    }
+
+    CatalogTables tables;
+    const std::filesystem::path dir = argv[1];
+    if (!readCatalogTables(dir / "args.tsv", dir / "mges.tsv", tables)) return 1;
+    CatalogData data;
+    buildCatalogData(std::move(tables), data);
+
+    std::ostringstream out;
+    out << "// Generated by gen_catalog from args.tsv and mges.tsv; do not edit.\n\n"
+        << "#include \"entity_catalog.h\"\n\n"
+        << "namespace {\n\n";
+
+    std::vector<std::string> columns = {
+        writeArray<int>(out, "int", "kArgIds", data.argIds, 16),
+        writeArray<std::string_view>(out, "std::string_view", "kArgNames", data.argNames, 1),
+        writeArray<CatalogCode, unsigned>(out, "CatalogCode", "kArgGroups", data.argGroups, 16),
+        writeArray<CatalogCode, unsigned>(out, "CatalogCode", "kArgResistances", data.argResistances, 16),
+        writeArray<uint8_t, unsigned>(out, "uint8_t", "kArgRequiresSNP", data.argRequiresSNP, 16),
+        writeArray<std::string_view>(out, "std::string_view", "kArgGroupNames", data.argGroupNames, 1),
+        writeArray<std::string_view>(out, "std::string_view", "kResistanceNames", data.resistanceNames, 1),
+        writeArray<int>(out, "int", "kMGEIds", data.mgeIds, 16),
+        writeArray<std::string_view>(out, "std::string_view", "kMGENames", data.mgeNames, 1),
+        writeArray<std::string_view>(out, "std::string_view", "kMGELabels", data.mgeLabels, 1),
+        writeArray<CatalogCode, unsigned>(out, "CatalogCode", "kMGEGroups", data.mgeGroups, 16),
+        writeArray<std::string_view>(out, "std::string_view", "kMGEGroupNames", data.mgeGroupNames, 1),
+        writeArray<int32_t, int>(out, "int32_t", "kArgIndexById", data.argIndexById, 16),
+        writeArray<int32_t, int>(out, "int32_t", "kMGEIndexById", data.mgeIndexById, 16),
+        writeArray<CatalogNameEntry>(out, "CatalogNameEntry", "kArgsByName", data.argsByName, 1),
+        writeArray<CatalogNameEntry>(out, "CatalogNameEntry", "kMGEsByName", data.mgesByName, 1),
+        writeArray<CatalogNameEntry>(out, "CatalogNameEntry", "kMGEsByLabel", data.mgesByLabel, 1),
+    };
+
+    out << "constexpr EntityCatalog kCatalog = {";
+    for (const std::string& column : columns) out << "\n    " << column << ',';
+    out << "\n};\n\n"
+        << "} // namespace\n\n"
+        << "const EntityCatalog& builtinEntityCatalog() {\n"
+        << "    return kCatalog;\n"
+        << "}\n";
+
+    std::ofstream file(argv[2], std::ios::binary);
+    if (!(file << out.str())) {
+        std::cerr << "gen_catalog: cannot write " << argv[2] << "\n";
+        return 1;
+    }
+    std::cout << "gen_catalog: " << data.argIds.size() << " ARGs, " << data.mgeIds.size() << " MGEs -> " << argv[2] << "\n";
+    return 0;
+}